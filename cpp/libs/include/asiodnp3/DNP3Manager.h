@@ -27,10 +27,14 @@
 
 #include <opendnp3/gen/ChannelState.h>
 #include <opendnp3/link/ChannelRetry.h>
+#include <opendnp3/link/LinkLayerConstants.h>
 
 #include <asiodnp3/IChannel.h>
+#include <asiodnp3/MultiServerSettings.h>
 
 #include <asiopal/SerialTypes.h>
+#include <asiopal/SocketOptions.h>
+#include <asiopal/ThreadPoolMode.h>
 
 #ifdef OPENDNP3_USE_TLS
 #include <asiopal/tls/TLSConfig.h>
@@ -52,6 +56,9 @@ class DNP3Manager
 
 public:
 
+	/// Default size of a channel's receive buffer, exactly one maximum sized link frame
+	static const uint32_t DEFAULT_RX_BUFFER_SIZE = opendnp3::LPDU_MAX_FRAME_SIZE;
+
 	/**
 	*	Construct a manager
 	*
@@ -59,12 +66,18 @@ public:
 	*	@param crypto Optional cryptography interface for secure authentication
 	*	@param onThreadStart Action to run when a thread pool thread starts
 	*	@param onThreadExit Action to run just before a thread pool thread exits
+	*	@param mode SHARED runs all threads on one io_service, SHARDED gives each thread its own and pins every channel to one thread
+	*	@param selection How channels are assigned to threads in SHARDED mode
+	*	@param asyncLogging If true, log messages are formatted and delivered to subscribers from a background thread (asiopal::AsyncLogHandler)
 	*/
 	DNP3Manager(
 	    uint32_t concurrencyHint,
 	    openpal::ICryptoProvider* crypto = nullptr,
 		std::function<void()> onThreadStart = []() {},
-		std::function<void()> onThreadExit = []() {}
+		std::function<void()> onThreadExit = []() {},
+		asiopal::ThreadPoolMode mode = asiopal::ThreadPoolMode::SHARED,
+		asiopal::ShardSelection selection = asiopal::ShardSelection::ROUND_ROBIN,
+		bool asyncLogging = false
 	);
 
 	~DNP3Manager();
@@ -91,6 +104,8 @@ public:
 	* @param local adapter address on which to attempt the connection (use 0.0.0.0 for all adapters)
 	* @param port Port of remote outstation is listening on
 	* @param strategy Reconnection delay strategy, default to exponential backoff
+	* @param rxBufferSize Size of the channel's receive buffer. Larger sizes allow a single read to carry many link frames.
+	* @param options Socket options applied to the socket each time it connects
 	* @return A channel interface
 	*/
 	IChannel* AddTCPClient(
@@ -99,7 +114,9 @@ public:
 		const opendnp3::ChannelRetry& retry,
 	    const std::string& host,
 	    const std::string& local,
-	    uint16_t port);
+	    uint16_t port,
+	    uint32_t rxBufferSize = DEFAULT_RX_BUFFER_SIZE,
+	    const asiopal::SocketOptions& options = asiopal::SocketOptions());
 
 	/**
 	* Add a tcp server channel
@@ -110,6 +127,8 @@ public:
 	* @param endpoint Network adapter to listen on, i.e. 127.0.0.1 or 0.0.0.0
 	* @param port Port to listen on
 	* @param strategy Reconnection delay strategy, default to exponential
+	* @param rxBufferSize Size of the channel's receive buffer. Larger sizes allow a single read to carry many link frames.
+	* @param options Socket options applied to each accepted socket
 	* @return A channel interface
 	*/
 	IChannel* AddTCPServer(
@@ -117,7 +136,107 @@ public:
 		uint32_t levels,
 		const opendnp3::ChannelRetry& retry,
 		const std::string& endpoint,
-		uint16_t port);
+		uint16_t port,
+		uint32_t rxBufferSize = DEFAULT_RX_BUFFER_SIZE,
+		const asiopal::SocketOptions& options = asiopal::SocketOptions());
+
+	/**
+	* Add a tcp server channel that accepts any number of connections on one port
+	*
+	* Sessions added to the channel are matched to connections by the link addresses of the frames the peers send.
+	* A session comes online when a frame arrives on its route, and goes offline when its connection closes.
+	* A connection whose first frame doesn't match an enabled session is closed, and so is one that isn't bound
+	* to a session within settings.bindTimeout or that arrives while settings.maxUnbound others are unbound.
+	*
+	* @param id Alias that will be used for logging purposes with this channel
+	* @param levels Bitfield that describes the logging level for this channel and associated sessions
+	* @param retry Retry parameters for when the port cannot be opened
+	* @param endpoint Network adapter to listen on, i.e. 127.0.0.1 or 0.0.0.0
+	* @param port Port to listen on
+	* @param rxBufferSize Size of the receive buffer of each connection
+	* @param options Socket options applied to each accepted socket
+	* @param settings Limits on connections that aren't bound to a session yet
+	* @return A channel interface
+	*/
+	IChannel* AddTCPMultiServer(
+		char const* id,
+		uint32_t levels,
+		const opendnp3::ChannelRetry& retry,
+		const std::string& endpoint,
+		uint16_t port,
+		uint32_t rxBufferSize = DEFAULT_RX_BUFFER_SIZE,
+		const asiopal::SocketOptions& options = asiopal::SocketOptions(),
+		const MultiServerSettings& settings = MultiServerSettings());
+
+	/**
+	* Add a udp client channel that exchanges datagrams with one remote endpoint
+	*
+	* Each write is sent as one datagram. Set LinkConfig::MaxUnconfirmedFramesPerWrite on the stacks of the channel
+	* so that all of the frames of a fragment are written together and a multi-frame APDU travels in one datagram.
+	*
+	* @param id Alias that will be used for logging purposes with this channel
+	* @param levels Bitfield that describes the logging level for this channel and associated sessions
+	* @param retry Retry parameters for failed channels
+	* @param host IP address or name of the remote device
+	* @param local adapter address from which to send (use 0.0.0.0 for all adapters)
+	* @param port UDP port of the remote device
+	* @param rxBufferSize Size of the channel's receive buffer
+	* @return A channel interface
+	*/
+	IChannel* AddUDPClient(
+		char const* id,
+		uint32_t levels,
+		const opendnp3::ChannelRetry& retry,
+		const std::string& host,
+		const std::string& local,
+		uint16_t port,
+		uint32_t rxBufferSize = DEFAULT_RX_BUFFER_SIZE);
+
+	/**
+	* Add a udp server channel that answers one peer at a time, whichever sent the last datagram
+	*
+	* @param id Alias that will be used for logging purposes with this channel
+	* @param levels Bitfield that describes the logging level for this channel and associated sessions
+	* @param retry Retry parameters for failed channels
+	* @param endpoint Network adapter to listen on, i.e. 127.0.0.1 or 0.0.0.0
+	* @param port Port to listen on
+	* @param rxBufferSize Size of the channel's receive buffer
+	* @return A channel interface
+	*/
+	IChannel* AddUDPServer(
+		char const* id,
+		uint32_t levels,
+		const opendnp3::ChannelRetry& retry,
+		const std::string& endpoint,
+		uint16_t port,
+		uint32_t rxBufferSize = DEFAULT_RX_BUFFER_SIZE);
+
+	/**
+	* Add a udp server channel that serves any number of peers from one socket
+	*
+	* Peers are bound to sessions the same way as connections are by AddTCPMultiServer: a session comes online
+	* when a datagram arrives on its route, so the remote device has to send first. A peer whose first frame
+	* doesn't match an enabled session is dropped, and a session that is heard from a new endpoint moves there.
+	* Peers that aren't bound within settings.bindTimeout, or that arrive while settings.maxUnbound others are unbound, are dropped too.
+	* Bound peers are dropped when they go quiet for settings.peerIdleTimeout, if set.
+	*
+	* @param id Alias that will be used for logging purposes with this channel
+	* @param levels Bitfield that describes the logging level for this channel and associated sessions
+	* @param retry Retry parameters for when the port cannot be opened
+	* @param endpoint Network adapter to listen on, i.e. 127.0.0.1 or 0.0.0.0
+	* @param port Port to listen on
+	* @param rxBufferSize Size of the receive buffer of each peer
+	* @param settings Limits on peers that aren't bound to a session yet
+	* @return A channel interface
+	*/
+	IChannel* AddUDPMultiServer(
+		char const* id,
+		uint32_t levels,
+		const opendnp3::ChannelRetry& retry,
+		const std::string& endpoint,
+		uint16_t port,
+		uint32_t rxBufferSize = DEFAULT_RX_BUFFER_SIZE,
+		const MultiServerSettings& settings = MultiServerSettings());
 
 	/**
 	* Add a serial channel
@@ -126,13 +245,15 @@ public:
 	* @param levels Bitfield that describes the logging level for this channel and associated sessions
 	* @param retry Retry parameters for failed channels
 	* @param settings settings object that fully parameterizes the serial port	
+	* @param rxBufferSize Size of the channel's receive buffer. Larger sizes allow a single read to carry many link frames.
 	* @return A channel interface
 	*/
 	IChannel* AddSerial(
 	    char const* id,
 	    uint32_t levels,
 		const opendnp3::ChannelRetry& retry,
-	    asiopal::SerialSettings settings);
+	    asiopal::SerialSettings settings,
+	    uint32_t rxBufferSize = DEFAULT_RX_BUFFER_SIZE);
 
 #ifdef OPENDNP3_USE_TLS
 
@@ -145,7 +266,9 @@ public:
 	* @param host IP address of remote outstation (i.e. 127.0.0.1 or www.google.com)
 	* @param local adapter address on which to attempt the connection (use 0.0.0.0 for all adapters)
 	* @param port Port of remote outstation is listening on
-	* @param config TLS configuration information	
+	* @param config TLS configuration information. Channels added with identical configurations share one TLS context and its sessions.
+	* @param rxBufferSize Size of the channel's receive buffer. Larger sizes allow a single read to carry many link frames.
+	* @param options Socket options applied to the socket each time it connects, before the TLS handshake
 	* @return A channel interface
 	*/
 	IChannel* AddTLSClient(
@@ -155,7 +278,9 @@ public:
 		const std::string& host,
 		const std::string& local,
 		uint16_t port,
-		const asiopal::TLSConfig& config);
+		const asiopal::TLSConfig& config,
+		uint32_t rxBufferSize = DEFAULT_RX_BUFFER_SIZE,
+		const asiopal::SocketOptions& options = asiopal::SocketOptions());
 
 	/**
 	* Add a TLS server channel
@@ -165,7 +290,9 @@ public:
 	* @param retry Retry parameters for failed channels
 	* @param endpoint Network adapter to listen on, i.e. 127.0.0.1 or 0.0.0.0
 	* @param port Port to listen on
-	* @param config TLS configuration information	
+	* @param config TLS configuration information. Channels added with identical configurations share one TLS context and its sessions.
+	* @param rxBufferSize Size of the channel's receive buffer. Larger sizes allow a single read to carry many link frames.
+	* @param options Socket options applied to each accepted socket, before the TLS handshake
 	* @return A channel interface
 	*/
 	IChannel* AddTLSServer(
@@ -174,7 +301,9 @@ public:
 		const opendnp3::ChannelRetry& retry,
 		const std::string& endpoint,
 		uint16_t port,
-		const asiopal::TLSConfig& config);
+		const asiopal::TLSConfig& config,
+		uint32_t rxBufferSize = DEFAULT_RX_BUFFER_SIZE,
+		const asiopal::SocketOptions& options = asiopal::SocketOptions());
 
 #endif
 
@@ -23,6 +23,7 @@
 
 #include <opendnp3/gen/ChannelState.h>
 #include <opendnp3/link/LinkChannelStatistics.h>
+#include <opendnp3/master/MultidropStatistics.h>
 
 #include <opendnp3/master/MasterStackConfig.h>
 #include <opendnp3/master/ISOEHandler.h>
@@ -38,8 +39,11 @@
 
 #include "IMaster.h"
 #include "IOutstation.h"
+#include "MasterSpec.h"
+#include "ServerStatistics.h"
 #include "DestructorHook.h"
 #include <memory>
+#include <vector>
 
 #ifdef OPENDNP3_USE_SECAUTH
 
@@ -79,6 +83,32 @@ public:
 	*/
 	virtual opendnp3::LinkChannelStatistics GetChannelStatistics() = 0;
 
+	/**
+	* Read the channel statistics without blocking. The callback runs on the channel's executor.
+	*/
+	virtual void GetChannelStatisticsAsync(const std::function<void (const opendnp3::LinkChannelStatistics&)>& callback) = 0;
+
+	/**
+	* Synchronously read the utilization and poll cycle statistics of the masters sharing this channel
+	*/
+	virtual opendnp3::MultidropStatistics GetMultidropStatistics() = 0;
+
+	/**
+	* Read the multi-drop statistics without blocking. The callback runs on the channel's executor.
+	*/
+	virtual void GetMultidropStatisticsAsync(const std::function<void (const opendnp3::MultidropStatistics&)>& callback) = 0;
+
+	/**
+	* Synchronously read the connection churn and per-connection counters of a channel created with
+	* DNP3Manager::AddTCPMultiServer. Other channels return empty statistics.
+	*/
+	virtual ServerStatistics GetServerStatistics() = 0;
+
+	/**
+	* Read the server statistics without blocking. The callback runs on the channel's executor.
+	*/
+	virtual void GetServerStatisticsAsync(const std::function<void (const ServerStatistics&)>& callback) = 0;
+
 	/**
 	* synchronously shutdown the channel
 	*/
@@ -94,6 +124,16 @@ public:
 	*/
 	virtual void SetLogFilters(const openpal::LogFilters& filters) = 0;
 
+	/**
+	*  Read the logger settings without blocking. The callback runs on the channel's executor.
+	*/
+	virtual void GetLogFiltersAsync(const std::function<void (const openpal::LogFilters&)>& callback) const = 0;
+
+	/**
+	*  Adjust the logger settings without blocking
+	*/
+	virtual void SetLogFiltersAsync(const openpal::LogFilters& filters) = 0;
+
 	/**
 	* Add a master to the channel
 	*
@@ -109,6 +149,24 @@ public:
 	                                opendnp3::IMasterApplication& application,
 	                                const opendnp3::MasterStackConfig& config) = 0;
 
+	/**
+	* Add a master to the channel without blocking
+	*
+	* @param callback receives the master, or nullptr if it couldn't be added, on the channel's executor
+	*/
+	virtual void AddMasterAsync(	char const* id,
+	                                opendnp3::ISOEHandler& SOEHandler,
+	                                opendnp3::IMasterApplication& application,
+	                                const opendnp3::MasterStackConfig& config,
+	                                const std::function<void (IMaster*)>& callback) = 0;
+
+	/**
+	* Add many masters to the channel with a single round trip to the channel's executor
+	*
+	* @return the masters in the same order as the specs, with nullptr for any that couldn't be added
+	*/
+	virtual std::vector<IMaster*> AddMasters(const std::vector<MasterSpec>& masters) = 0;
+
 	/**
 	* Add an outstation to the channel
 	*
@@ -123,6 +181,17 @@ public:
 	                                    opendnp3::IOutstationApplication& application,
 	                                    const opendnp3::OutstationStackConfig& config) = 0;
 
+	/**
+	* Add an outstation to the channel without blocking
+	*
+	* @param callback receives the outstation, or nullptr if it couldn't be added, on the channel's executor
+	*/
+	virtual void AddOutstationAsync(	char const* id,
+	                                    opendnp3::ICommandHandler& commandHandler,
+	                                    opendnp3::IOutstationApplication& application,
+	                                    const opendnp3::OutstationStackConfig& config,
+	                                    const std::function<void (IOutstation*)>& callback) = 0;
+
 #ifdef OPENDNP3_USE_SECAUTH
 
 	/**
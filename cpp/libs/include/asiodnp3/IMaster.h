@@ -42,6 +42,8 @@
 namespace asiodnp3
 {
 
+typedef std::function<void (const opendnp3::MasterScan&)> ScanCallbackT;
+
 /**
 * Interface that represents a running master session.
 */
@@ -56,6 +58,16 @@ public:
 	*/
 	virtual opendnp3::StackStatistics GetStackStatistics() = 0;
 
+	/**
+	* Read the stack statistics counters without blocking. The callback runs on the master's executor.
+	*/
+	virtual void GetStackStatisticsAsync(const StackStatisticsCallbackT& callback) = 0;
+
+	/**
+	* Read latency histograms and counters for this session. Doesn't block on the session's executor.
+	*/
+	virtual opendnp3::StackMetrics GetStackMetrics() = 0;
+
 	/**
 	* Add a recurring user-defined scan from a vector of headers
 	* @ return A proxy class used to manipulate the scan
@@ -82,7 +94,20 @@ public:
 	virtual opendnp3::MasterScan AddRangeScan(opendnp3::GroupVariationID gvId, uint16_t start, uint16_t stop, openpal::TimeDuration period, const opendnp3::TaskConfig& config = opendnp3::TaskConfig::Default()) = 0;
 
 	/**
-	* Initiate a single user defined scan via a vector of headers
+	* Non-blocking versions of the methods above. The callback receives the scan on the master's executor.
+	*/
+	virtual void AddScanAsync(openpal::TimeDuration period, const std::vector<opendnp3::Header>& headers, const ScanCallbackT& callback, const opendnp3::TaskConfig& config = opendnp3::TaskConfig::Default()) = 0;
+
+	virtual void AddAllObjectsScanAsync(opendnp3::GroupVariationID gvId, openpal::TimeDuration period, const ScanCallbackT& callback, const opendnp3::TaskConfig& config = opendnp3::TaskConfig::Default()) = 0;
+
+	virtual void AddClassScanAsync(const opendnp3::ClassField& field, openpal::TimeDuration period, const ScanCallbackT& callback, const opendnp3::TaskConfig& config = opendnp3::TaskConfig::Default()) = 0;
+
+	virtual void AddRangeScanAsync(opendnp3::GroupVariationID gvId, uint16_t start, uint16_t stop, openpal::TimeDuration period, const ScanCallbackT& callback, const opendnp3::TaskConfig& config = opendnp3::TaskConfig::Default()) = 0;
+
+	/**
+	* Initiate a single user defined scan via a vector of headers.
+	*
+	* This and the other adhoc methods below are posted to the master's executor and don't block.
 	*/
 	virtual void Scan(const std::vector<opendnp3::Header>& headers, const opendnp3::TaskConfig& config = opendnp3::TaskConfig::Default()) = 0;
 
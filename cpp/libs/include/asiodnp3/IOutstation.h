@@ -25,10 +25,13 @@
 
 #include <opendnp3/outstation/IDatabase.h>
 #include <opendnp3/outstation/DatabaseConfigView.h>
+#include <opendnp3/outstation/UpdateQueueStatistics.h>
 
 namespace asiodnp3
 {
 
+class ChangeSet;
+
 /**
 * Interface representing a running outstation.
 * To get a data observer interface to load measurements on the outstation:-
@@ -55,12 +58,28 @@ public:
 	*/
 	virtual opendnp3::StackStatistics GetStackStatistics() = 0;
 
+	/**
+	* Read the stack statistics counters without blocking. The callback runs on the outstation's executor.
+	*/
+	virtual void GetStackStatisticsAsync(const StackStatisticsCallbackT& callback) = 0;
+
+	/**
+	* Read latency histograms and counters for this session. Doesn't block on the session's executor.
+	*/
+	virtual opendnp3::StackMetrics GetStackMetrics() = 0;
+
 	/**
 	* Get a view of the raw buffers in the database. This can be used to configure each point before execution.
 	* @return View of static values and metadata.
 	*/
 	virtual opendnp3::DatabaseConfigView GetConfigView() = 0;
 
+	/**
+	* Read the counters of the queue that MeasUpdate passes updates through. Doesn't block on the outstation.
+	* @return update queue statistics counters
+	*/
+	virtual opendnp3::UpdateQueueStatistics GetUpdateQueueStatistics() = 0;
+
 protected:
 
 	//// --- These methods are protected and are only intened to be used by the MeasUpdate friend class ----
@@ -80,6 +99,16 @@ protected:
 	*/
 	virtual void CheckForUpdates() = 0;
 
+	/*
+	* return an empty change set to record updates into, thread-safe
+	*/
+	virtual ChangeSet* AcquireChanges() = 0;
+
+	/*
+	* apply a change set returned by AcquireChanges, thread-safe
+	*/
+	virtual void Apply(ChangeSet* changes) = 0;
+
 };
 
 }
@@ -26,6 +26,7 @@
 #include <openpal/executor/IExecutor.h>
 
 #include <opendnp3/StackStatistics.h>
+#include <opendnp3/StackMetrics.h>
 #include <opendnp3/link/ILinkListener.h>
 
 #include <vector>
@@ -35,6 +36,8 @@
 namespace asiodnp3
 {
 
+typedef std::function<void (const opendnp3::StackStatistics&)> StackStatisticsCallbackT;
+
 /**
 * Base class for masters or outstations
 */
@@ -54,6 +57,16 @@ public:
 	*/
 	virtual bool Disable() = 0;
 
+	/**
+	* Enable communications without blocking. The callback runs on the stack's executor with the result.
+	*/
+	virtual void EnableAsync(const std::function<void (bool)>& callback) = 0;
+
+	/**
+	* Disable communications without blocking. The callback runs on the stack's executor with the result.
+	*/
+	virtual void DisableAsync(const std::function<void (bool)>& callback) = 0;
+
 	/**
 	* Synchronously shutdown the endpoint. No more calls are allowed after this call.
 	*/
@@ -0,0 +1,56 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_MASTERSPEC_H
+#define ASIODNP3_MASTERSPEC_H
+
+#include <opendnp3/master/MasterStackConfig.h>
+#include <opendnp3/master/ISOEHandler.h>
+#include <opendnp3/master/IMasterApplication.h>
+
+#include <string>
+
+namespace asiodnp3
+{
+
+/**
+* Everything needed to create a master session, used to add many masters to a channel at once
+*/
+struct MasterSpec
+{
+	MasterSpec(	char const* id_,
+	            opendnp3::ISOEHandler& SOEHandler,
+	            opendnp3::IMasterApplication& application,
+	            const opendnp3::MasterStackConfig& config_) :
+		id(id_),
+		pSOEHandler(&SOEHandler),
+		pApplication(&application),
+		config(config_)
+	{}
+
+	std::string id;
+	opendnp3::ISOEHandler* pSOEHandler;
+	opendnp3::IMasterApplication* pApplication;
+	opendnp3::MasterStackConfig config;
+};
+
+}
+
+#endif
@@ -0,0 +1,65 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_MULTISERVERSETTINGS_H
+#define ASIODNP3_MULTISERVERSETTINGS_H
+
+#include <openpal/executor/TimeDuration.h>
+
+#include <cstdint>
+
+namespace asiodnp3
+{
+
+/**
+* Limits on the peers of a channel created with DNP3Manager::AddTCPMultiServer or AddUDPMultiServer
+*
+* A peer is unbound until a frame on the route of an enabled session arrives. Unbound peers cost a socket or
+* a receive queue without serving a session, so they are closed after a timeout and only so many may exist at once.
+*/
+struct MultiServerSettings
+{
+	MultiServerSettings() :
+		bindTimeout(openpal::TimeDuration::Seconds(30)),
+		maxUnbound(64),
+		peerIdleTimeout(openpal::TimeDuration::Max()),
+		rebindIdleTimeout(openpal::TimeDuration::Seconds(60))
+	{}
+
+	/// How long a peer may stay unbound before it is closed. TimeDuration::Max() for no limit
+	openpal::TimeDuration bindTimeout;
+
+	/// Maximum number of unbound peers. A peer accepted while this many are open is closed immediately
+	uint32_t maxUnbound;
+
+	/// UDP only. A peer that sends nothing for this long is closed, and its session stays offline until the device
+	/// sends again. A quiet device can't be polled in the meantime, so this is off by default (TimeDuration::Max())
+	openpal::TimeDuration peerIdleTimeout;
+
+	/// A frame for a session that is bound to another peer only moves the session to the new peer if the old one has
+	/// closed or has received nothing for this long, i.e. the device reconnected before its old connection was found
+	/// to be dead. Otherwise the frame is dropped, so a peer can't take over a live session by spoofing its addresses.
+	/// TimeDuration::Max() never moves a session while its peer is open
+	openpal::TimeDuration rebindIdleTimeout;
+};
+
+}
+
+#endif
@@ -0,0 +1,123 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_SERVERSTATISTICS_H
+#define ASIODNP3_SERVERSTATISTICS_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace asiodnp3
+{
+
+/**
+* Counters for one connection accepted by a channel created with DNP3Manager::AddTCPMultiServer
+*/
+struct ConnectionStatistics
+{
+	ConnectionStatistics() :
+		id(0),
+		numSessions(0),
+		uptimeMs(0),
+		numBytesRx(0),
+		numBytesTx(0),
+		numLinkFrameRx(0),
+		numLinkFrameTx(0)
+	{}
+
+	/// Sequence number assigned to the connection when it was accepted, starting at 1
+	uint32_t id;
+
+	/// Address and port of the peer
+	std::string remoteAddress;
+
+	/// Number of sessions currently bound to the connection
+	uint32_t numSessions;
+
+	/// Milliseconds since the connection was accepted
+	uint64_t uptimeMs;
+
+	/// Number of bytes received on the connection
+	uint64_t numBytesRx;
+
+	/// Number of bytes written to the connection
+	uint64_t numBytesTx;
+
+	/// Number of valid link frames received on the connection
+	uint32_t numLinkFrameRx;
+
+	/// Number of link frames written to the connection
+	uint32_t numLinkFrameTx;
+};
+
+/**
+* Connection churn of a channel that accepts many connections on one port, and the counters of each open connection
+*/
+struct ServerStatistics
+{
+	ServerStatistics() :
+		numAccept(0),
+		numClose(0),
+		numRejected(0),
+		numRebind(0),
+		numRebindRefused(0),
+		numBindTimeout(0),
+		numUnboundLimit(0),
+		numListenFail(0)
+	{}
+
+	/// Number of connections that are currently open
+	uint32_t NumActive() const
+	{
+		return static_cast<uint32_t>(connections.size());
+	}
+
+	/// Number of connections accepted
+	uint32_t numAccept;
+
+	/// Number of connections that have closed, including rejected ones
+	uint32_t numClose;
+
+	/// Number of connections closed because their first frame didn't match an enabled session
+	uint32_t numRejected;
+
+	/// Number of times a session moved to a new connection while still bound to an old one, i.e. the peer reconnected
+	uint32_t numRebind;
+
+	/// Number of frames dropped because they were for a session bound to another peer that is still active, see MultiServerSettings::rebindIdleTimeout
+	uint32_t numRebindRefused;
+
+	/// Number of connections closed because they weren't bound to a session within MultiServerSettings::bindTimeout
+	uint32_t numBindTimeout;
+
+	/// Number of connections closed as soon as they were accepted because MultiServerSettings::maxUnbound others were unbound
+	uint32_t numUnboundLimit;
+
+	/// Number of times the listening socket could not be opened
+	uint32_t numListenFail;
+
+	/// The open connections in the order they were accepted
+	std::vector<ConnectionStatistics> connections;
+};
+
+}
+
+#endif
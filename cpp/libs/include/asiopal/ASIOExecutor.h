@@ -25,19 +25,72 @@
 
 #include "Synchronized.h"
 #include "SteadyClock.h"
+#include "TimerWheel.h"
+#include "AtomicHistogram.h"
 
 #include <asio.hpp>
+#include <atomic>
 #include <queue>
-#include <set>
 
 namespace asiopal
 {
 
 class TimerASIO;
+class ShardService;
 
 /**
 * An ASIO-based implementation of openpal::IExecutor
+*
+* Work is serialized with a strand unless the io_service is a shard (see ShardService),
+* in which case the single thread running the io_service already serializes it.
+*
+* Timers live in a TimerWheel with millisecond ticks. A single asio timer wakes the
+* executor when the wheel next has work to do.
 */
+class ASIOExecutor;
+
+template <class Function>
+void InvokeOnExecutor(ASIOExecutor& executor, Function& function);
+
+/**
+* A completion handler that asio runs via the executor, i.e. an equivalent of strand::wrap
+* that skips the strand when the executor doesn't need one.
+*/
+template <class Handler>
+class WrappedHandler
+{
+public:
+
+	WrappedHandler(ASIOExecutor& executor_, const Handler& handler_) :
+		pExecutor(&executor_),
+		handler(handler_)
+	{}
+
+	template <class... Args>
+	void operator()(const Args& ... args)
+	{
+		handler(args...);
+	}
+
+	template <class Function>
+	friend void asio_handler_invoke(Function& function, WrappedHandler* pContext)
+	{
+		InvokeOnExecutor(*pContext->pExecutor, function);
+	}
+
+	template <class Function>
+	friend void asio_handler_invoke(const Function& function, WrappedHandler* pContext)
+	{
+		Function copy(function);
+		InvokeOnExecutor(*pContext->pExecutor, copy);
+	}
+
+private:
+
+	ASIOExecutor* pExecutor;
+	Handler handler;
+};
+
 class ASIOExecutor : public openpal::IExecutor
 {
 
@@ -60,37 +113,134 @@ public:
 
 	void BlockFor(const std::function<void()>& action);
 
-	// access to the underlying strand is provided for wrapping callbacks
-	asio::strand strand;
+	/// Run an action on the executor and pass its result to a callback, also on the executor. Doesn't block the caller.
+	template <class T, class Callback>
+	void ReturnAsyncFor(const std::function<T()>& action, const Callback& callback);
+
+	/// Post a handler to run on the executor
+	template <class Handler>
+	void Enqueue(const Handler& handler);
+
+	/// Wrap a completion handler for an asio operation so that it runs on the executor
+	template <class Handler>
+	WrappedHandler<Handler> Wrap(const Handler& handler);
+
+	/// @return true if the calling thread is currently running the executor's work
+	bool RunningInThisThread();
+
+	/// Start recording how long actions given to Post() wait before they run. Safe to call from any thread.
+	void RecordPostDelay()
+	{
+		recordPostDelay.store(true, std::memory_order_relaxed);
+	}
+
+	/// Time that actions given to Post() waited before they ran, if recording was enabled. Safe to call from any thread.
+	openpal::LatencyHistogram GetPostDelay() const
+	{
+		return postDelay.Snapshot();
+	}
+
+	asio::io_service& GetIOService()
+	{
+		return service;
+	}
+
+	/// Run a function on the executor. Used by WrappedHandler to route asio completions.
+	template <class Function>
+	void Invoke(Function& function);
 
 private:
 
+	asio::io_service& service;
+	ShardService* pShard;
+	asio::strand strand;
+
 	void InitiateShutdown(Synchronized<bool>& handler);
 
 	void CheckForShutdown();
 
 	Synchronized<bool>* pShutdownSignal;
 
+	friend class TimerASIO;
+
 	TimerASIO* GetTimer();
 
 	openpal::ITimer* Start(const asiopal_steady_clock::time_point& tp, const openpal::Action0& runnable);
 
-	void StartTimer(TimerASIO*, const openpal::Action0& runnable);
+	void CancelTimer(TimerASIO*);
+
+	/// Arm the wheel's asio timer to fire at a tick
+	void Arm(TimerWheel::Tick tick);
+
+	/// Fire everything the wheel has expired
+	void RunExpired();
+
+	static TimerWheel::Tick GetTick();
 
 	typedef std::deque<TimerASIO*> TimerQueue;
-	typedef std::set<TimerASIO*> TimerMap;
 
 	TimerQueue allTimers;
 	TimerQueue idleTimers;
-	TimerMap activeTimers;
 
-	void OnTimerCallback(const std::error_code&, TimerASIO*, const openpal::Action0& runnable);
+	TimerWheel wheel;
+	asio::basic_waitable_timer<asiopal_steady_clock> wheelTimer;
+	bool armed;
+	TimerWheel::Tick armedTick;
+	uint32_t numWaits;
+
+	void OnWheelTimer(const std::error_code&);
+
+	std::atomic<bool> recordPostDelay;
+	AtomicHistogram postDelay;
 };
 
+template <class Handler>
+void ASIOExecutor::Enqueue(const Handler& handler)
+{
+	if (pShard)
+	{
+		service.post(handler);
+	}
+	else
+	{
+		strand.post(handler);
+	}
+}
+
+template <class Handler>
+WrappedHandler<Handler> ASIOExecutor::Wrap(const Handler& handler)
+{
+	return WrappedHandler<Handler>(*this, handler);
+}
+
+template <class Function>
+void ASIOExecutor::Invoke(Function& function)
+{
+	if (pShard)
+	{
+		function();
+	}
+	else
+	{
+		// the function may forward its invocation hook back to a WrappedHandler, so hide it in a lambda
+		auto copy = function;
+		strand.dispatch([copy]() mutable
+		{
+			copy();
+		});
+	}
+}
+
+template <class Function>
+void InvokeOnExecutor(ASIOExecutor& executor, Function& function)
+{
+	executor.Invoke(function);
+}
+
 template <class T>
 T ASIOExecutor::ReturnBlockFor(const std::function<T()>& action)
 {
-	if (strand.running_in_this_thread())
+	if (this->RunningInThisThread())
 	{
 		return action();
 	}
@@ -103,11 +253,21 @@ T ASIOExecutor::ReturnBlockFor(const std::function<T()>& action)
 			T tmp = action();
 			pointer->SetValue(tmp);
 		};
-		strand.post(lambda);
+		this->Enqueue(lambda);
 		return sync.WaitForValue();
 	}
 }
 
+template <class T, class Callback>
+void ASIOExecutor::ReturnAsyncFor(const std::function<T()>& action, const Callback& callback)
+{
+	auto lambda = [action, callback]()
+	{
+		callback(action());
+	};
+	this->Enqueue(lambda);
+}
+
 }
 
 #endif
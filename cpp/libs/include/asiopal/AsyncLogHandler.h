@@ -0,0 +1,188 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIOPAL_ASYNCLOGHANDLER_H
+#define ASIOPAL_ASYNCLOGHANDLER_H
+
+#include <openpal/logging/ILogHandler.h>
+#include <openpal/util/Uncopyable.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace asiopal
+{
+
+/**
+* Fans out log messages to subscribers from a background thread.
+*
+* Each producing thread copies unformatted records into its own bounded ring, so logging
+* doesn't format, allocate, or take a lock on the calling thread. The background thread
+* formats the records and calls the subscribers. Records that don't fit are dropped and counted.
+* A ring is released when its thread exits and is reused by the next thread that logs.
+*/
+class AsyncLogHandler : public openpal::ILogHandler, private openpal::Uncopyable
+{
+public:
+
+	/// Default number of records buffered per producing thread
+	static const uint32_t DEFAULT_RING_SIZE = 1024;
+
+	/// Maximum number of live threads with their own ring, other threads share a locked ring
+	static const uint32_t MAX_PRODUCERS = 64;
+
+	AsyncLogHandler(uint32_t ringSize = DEFAULT_RING_SIZE);
+
+	~AsyncLogHandler();
+
+	/**
+	* Binds a listener to ALL log messages
+	*/
+	void Subscribe(openpal::ILogHandler* pHandler);
+
+	/// Block until every record logged before the call has been delivered to the subscribers
+	void Flush();
+
+	/// @return the number of records dropped because a ring was full
+	uint64_t GetNumDropped() const
+	{
+		return numDropped;
+	}
+
+	/// @return the number of records delivered to the subscribers
+	uint64_t GetNumDelivered() const
+	{
+		return numDelivered;
+	}
+
+	/// @return the number of per-thread rings allocated, at most MAX_PRODUCERS
+	uint32_t GetNumRings() const
+	{
+		return numRings;
+	}
+
+	virtual void Log(const openpal::LogEntry& entry) override final;
+
+	virtual void LogDeferred(char const* alias, const openpal::LogRecord& record) override final;
+
+private:
+
+	struct Entry
+	{
+		uint64_t timestamp;
+		// the slots are reused, so once grown the alias is copied in full without allocating
+		std::string alias;
+		openpal::LogRecord record;
+	};
+
+	// single producer, single consumer ring
+	class Ring
+	{
+	public:
+
+		Ring(uint32_t size);
+
+		bool Push(uint64_t timestamp, char const* alias, const openpal::LogRecord& record);
+
+		const Entry* Front() const;
+
+		void Pop();
+
+		/// @return a position that Reached() compares against
+		uint32_t Mark() const;
+
+		/// @return true if every record pushed before the mark was popped
+		bool Reached(uint32_t mark) const;
+
+		/// @return true if the calling thread is now the ring's only producer
+		bool Claim();
+
+		/// Called by the producer when its thread exits, records already pushed are still delivered
+		void Release();
+
+	private:
+
+		std::atomic<bool> claimed;
+
+		std::vector<Entry> entries;
+		const uint32_t mask;
+		std::atomic<uint32_t> head;
+		std::atomic<uint32_t> tail;
+	};
+
+	// releases the rings of a thread when it exits
+	struct ThreadRings;
+
+	Ring* GetRing();
+
+	std::shared_ptr<Ring> ClaimRing();
+
+	bool IsFlushed(const std::vector<std::pair<Ring*, uint32_t>>& marks) const;
+
+	void Push(char const* alias, const openpal::LogRecord& record);
+
+	void Run();
+
+	bool DeliverAll();
+
+	void NotifyFlushed();
+
+	// while records keep arriving, flushing threads are notified after this many deliveries
+	static const uint32_t FLUSH_NOTIFY_INTERVAL = 256;
+
+	// distinguishes handlers in the per-thread bindings, even if one is allocated at the address of another
+	const uint64_t id;
+	const uint32_t ringSize;
+
+	// rings are only ever added, producers claim a released ring before adding another
+	std::shared_ptr<Ring> rings[MAX_PRODUCERS];
+	std::atomic<uint32_t> numRings;
+	std::mutex ringMutex;
+
+	// used by threads that don't have a ring of their own
+	std::unique_ptr<Ring> sharedRing;
+	std::mutex sharedMutex;
+
+	std::atomic<uint64_t> numDropped;
+	std::atomic<uint64_t> numDelivered;
+
+	std::mutex subscriberMutex;
+	std::vector<openpal::ILogHandler*> subscribers;
+
+	std::mutex waitMutex;
+	std::condition_variable condition;
+	std::atomic<bool> sleeping;
+	std::atomic<bool> shutdown;
+
+	// signaled by the background thread after it delivers records
+	std::mutex flushMutex;
+	std::condition_variable flushed;
+
+	std::thread thread;
+};
+
+}
+
+#endif
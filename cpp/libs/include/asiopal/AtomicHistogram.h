@@ -0,0 +1,57 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIOPAL_ATOMICHISTOGRAM_H
+#define ASIOPAL_ATOMICHISTOGRAM_H
+
+#include <openpal/util/LatencyHistogram.h>
+#include <openpal/util/Uncopyable.h>
+
+#include <atomic>
+
+namespace asiopal
+{
+
+/**
+* A latency histogram that one thread records into while any thread takes snapshots
+*
+* Counters use relaxed atomics, so a snapshot taken during a Record() may be off by that one value.
+*/
+class AtomicHistogram : private openpal::Uncopyable
+{
+public:
+
+	AtomicHistogram();
+
+	void Record(uint64_t microseconds);
+
+	openpal::LatencyHistogram Snapshot() const;
+
+private:
+
+	std::atomic<uint32_t> counts[openpal::LatencyHistogram::NUM_BUCKETS];
+	std::atomic<uint64_t> count;
+	std::atomic<uint64_t> totalMicroseconds;
+	std::atomic<uint64_t> maxMicroseconds;
+};
+
+}
+
+#endif
@@ -25,16 +25,22 @@
 
 #include <asio.hpp>
 
+#include <atomic>
 #include <functional>
+#include <memory>
 #include <thread>
 
 #include <asiopal/SteadyClock.h>
+#include <asiopal/ThreadPoolMode.h>
 
 namespace asiopal
 {
 
 /**
 *	A thread pool that calls asio::io_service::run
+*
+*	In SHARED mode all threads run one io_service. In SHARDED mode each thread runs
+*	its own io_service and callers pin their work to a shard via Acquire().
 */
 class IOServiceThreadPool
 {
@@ -45,13 +51,35 @@ public:
 	    uint32_t levels,
 	    uint32_t aConcurrency,
 	std::function<void()> onThreadStart = []() {},
-	std::function<void()> onThreadExit = []() {}
+	std::function<void()> onThreadExit = []() {},
+	ThreadPoolMode mode = ThreadPoolMode::SHARED,
+	ShardSelection selection = ShardSelection::ROUND_ROBIN
 	);
 
 	~IOServiceThreadPool();
 
+	/// @return the shared io_service, or the first shard in SHARDED mode
 	asio::io_service& GetIOService();
 
+	/// Select an io_service for a new channel and count it against the shard's load
+	asio::io_service& Acquire();
+
+	/// Release an io_service previously returned from Acquire()
+	void Release(asio::io_service& service);
+
+	ThreadPoolMode GetMode() const
+	{
+		return mode;
+	}
+
+	uint32_t NumShards() const
+	{
+		return static_cast<uint32_t>(shards.size());
+	}
+
+	/// @return the number of channels currently pinned to a shard
+	uint32_t GetLoad(uint32_t shard) const;
+
 	void Shutdown();
 
 private:
@@ -64,10 +92,26 @@ private:
 
 	bool isShutdown;
 
-	void Run();
+	ThreadPoolMode mode;
+	ShardSelection selection;
+
+	class Shard
+	{
+	public:
+
+		Shard();
+
+		asio::io_service ioservice;
+		asio::basic_waitable_timer< asiopal::asiopal_steady_clock > infiniteTimer;
+		std::atomic<uint32_t> load;
+	};
+
+	void Run(Shard* pShard);
+
+	Shard* SelectShard();
 
-	asio::io_service ioservice;
-	asio::basic_waitable_timer< asiopal::asiopal_steady_clock > infiniteTimer;
+	std::vector<std::unique_ptr<Shard>> shards;
+	std::atomic<uint32_t> nextShard;
 	std::vector<std::thread*> threads;
 };
 
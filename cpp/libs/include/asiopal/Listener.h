@@ -0,0 +1,66 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIOPAL_LISTENER_H
+#define ASIOPAL_LISTENER_H
+
+#include "ASIOExecutor.h"
+#include "PhysicalLayerPeer.h"
+
+#include <functional>
+#include <system_error>
+
+namespace asiopal
+{
+
+/**
+* Base class for objects that serve any number of remote peers on one local endpoint
+*
+* Each new peer is handed to the owner as a PhysicalLayerPeer that runs on the listener's executor.
+*/
+class Listener
+{
+public:
+
+	/// Receives either a new physical layer that it takes ownership of, or an error and nullptr
+	typedef std::function<void (const std::error_code&, PhysicalLayerPeer*)> AcceptCallback;
+
+	Listener(asio::io_service& service) : executor(service)
+	{}
+
+	virtual ~Listener() {}
+
+	/// Open the local endpoint
+	virtual std::error_code Listen() = 0;
+
+	/// Accept the next peer. Only one accept may be outstanding. The callback runs on the executor.
+	virtual void BeginAccept(const AcceptCallback& callback) = 0;
+
+	/// Stop listening. An outstanding accept completes with asio::error::operation_aborted.
+	virtual void Close() = 0;
+
+	virtual bool IsListening() const = 0;
+
+	ASIOExecutor executor;
+};
+
+}
+
+#endif
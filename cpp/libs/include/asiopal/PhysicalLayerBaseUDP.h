@@ -0,0 +1,84 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIOPAL_PHYSICAL_LAYER_BASE_UDP_H
+#define ASIOPAL_PHYSICAL_LAYER_BASE_UDP_H
+
+#include "PhysicalLayerASIO.h"
+
+#include <asio.hpp>
+#include <asio/ip/udp.hpp>
+
+#include <vector>
+
+namespace asiopal
+{
+
+/**
+* Common socket object and read/write implementations for the UDP client and server
+*
+* Every write is sent as one datagram if it fits in MAX_DATAGRAM_SIZE. Datagrams are received whole into
+* an internal buffer and handed to reads in as many pieces as the read buffers require.
+*/
+class PhysicalLayerBaseUDP : public PhysicalLayerASIO
+{
+public:
+
+	/// The largest payload of a UDP datagram over IPv4
+	static const uint32_t MAX_DATAGRAM_SIZE = 65507;
+
+	PhysicalLayerBaseUDP(openpal::LogRoot& root, asio::io_service& service);
+
+	virtual ~PhysicalLayerBaseUDP() {}
+
+	/* Implement the shared client/server actions */
+	void DoClose() override;
+	void DoOpeningClose() override;
+	void DoRead(openpal::WSlice&) override;
+	void DoWrite(const openpal::RSlice&) override;
+	void DoOpenFailure() override;
+
+protected:
+
+	/// Called with the sender of each datagram that is received
+	virtual void OnDatagramFrom(const asio::ip::udp::endpoint& sender) {}
+
+	void CloseSocket();
+
+	asio::ip::udp::socket socket;
+	asio::ip::udp::endpoint remoteEndpoint;
+	bool hasRemoteEndpoint;
+
+private:
+
+	void BeginReceive(uint8_t* pBuffer, uint32_t size);
+	void SendNext(const openpal::RSlice& remaining, uint32_t numWritten);
+	void OnNoRemoteEndpoint(const openpal::RSlice& buffer);
+
+	uint32_t ReadPending(uint8_t* pBuffer, uint32_t size);
+
+	asio::ip::udp::endpoint sender;
+	std::vector<uint8_t> datagram;
+	openpal::RSlice pending;
+};
+
+}
+
+#endif
@@ -24,6 +24,7 @@
 #include "PhysicalLayerBaseTCP.h"
 
 #include "asiopal/LoggingConnectionCondition.h"
+#include "asiopal/SocketOptions.h"
 
 #include <openpal/logging/LogMacros.h>
 #include <openpal/logging/LogLevels.h>
@@ -44,6 +45,7 @@ public:
 	    const std::string& host,
 	    const std::string& localAddress,
 	    uint16_t port,
+	    const SocketOptions& options = SocketOptions(),
 	std::function<void (asio::ip::tcp::socket&)> configure = [](asio::ip::tcp::socket&) {});
 
 	/// Implement the remaining actions
@@ -61,6 +63,7 @@ private:
 	asio::ip::tcp::endpoint remoteEndpoint;
 	asio::ip::tcp::endpoint localEndpoint;
 	asio::ip::tcp::resolver resolver;
+	const SocketOptions options;
 	std::function<void (asio::ip::tcp::socket&)> configure;
 };
 
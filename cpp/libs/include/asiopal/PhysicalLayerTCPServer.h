@@ -22,6 +22,7 @@
 #define ASIOPAL_PHYSICAL_LAYER_TCP_SERVER_H
 
 #include "PhysicalLayerBaseTCP.h"
+#include "SocketOptions.h"
 
 #include <asio.hpp>
 #include <asio/ip/tcp.hpp>
@@ -40,6 +41,7 @@ public:
 	    asio::io_service& service,
 	    const std::string& endpoint,
 	    uint16_t port,
+		const SocketOptions& options = SocketOptions(),
 		std::function<void (asio::ip::tcp::socket&)> configure = [](asio::ip::tcp::socket&) {}
 	);
 
@@ -57,6 +59,7 @@ private:
 	asio::ip::tcp::endpoint localEndpoint;
 	asio::ip::tcp::endpoint remoteEndpoint;
 	asio::ip::tcp::acceptor acceptor;
+	const SocketOptions options;
 	std::function<void (asio::ip::tcp::socket&)> configure;
 };
 }
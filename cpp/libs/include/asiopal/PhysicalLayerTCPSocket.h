@@ -0,0 +1,71 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIOPAL_PHYSICAL_LAYER_TCP_SOCKET_H
+#define ASIOPAL_PHYSICAL_LAYER_TCP_SOCKET_H
+
+#include "PhysicalLayerPeer.h"
+#include "ASIOExecutor.h"
+
+#include <asio.hpp>
+#include <asio/ip/tcp.hpp>
+
+#include <string>
+
+namespace asiopal
+{
+
+/**
+* A physical layer for a socket that is already connected, i.e. one accepted by a TCPListener.
+*
+* Opening completes immediately and a closed layer cannot be reopened. The layer runs on an executor
+* that it shares with its owner instead of having one of its own.
+*/
+class PhysicalLayerTCPSocket final : public PhysicalLayerPeer
+{
+public:
+
+	PhysicalLayerTCPSocket(openpal::LogRoot& root, ASIOExecutor& executor, asio::ip::tcp::socket socket);
+
+	virtual const std::string& GetRemoteAddress() const override
+	{
+		return remoteAddress;
+	}
+
+	void DoOpen() override;
+	void DoClose() override;
+	void DoOpeningClose() override;
+	void DoRead(openpal::WSlice&) override;
+	void DoWrite(const openpal::RSlice&) override;
+
+private:
+
+	void ShutdownSocket();
+	void CloseSocket();
+
+	ASIOExecutor* pASIOExecutor;
+	asio::ip::tcp::socket socket;
+	std::string remoteAddress;
+	bool hasOpened;
+};
+
+}
+
+#endif
@@ -0,0 +1,104 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIOPAL_PHYSICAL_LAYER_UDP_PEER_H
+#define ASIOPAL_PHYSICAL_LAYER_UDP_PEER_H
+
+#include "PhysicalLayerPeer.h"
+
+#include <openpal/executor/TimerRef.h>
+#include <openpal/executor/MonotonicTimestamp.h>
+
+#include <asio.hpp>
+#include <asio/ip/udp.hpp>
+
+#include <string>
+#include <vector>
+
+namespace asiopal
+{
+
+class UDPListener;
+
+/**
+* One remote endpoint served by a UDPListener
+*
+* Datagrams from the endpoint are queued until they are read. Writes are sent from the listener's
+* socket, each as one datagram if it fits. Opening completes immediately and a closed peer cannot be reopened.
+* If the listener has a peer idle timeout, the peer closes itself when it hears nothing for that long.
+*/
+class PhysicalLayerUDPPeer final : public PhysicalLayerPeer
+{
+public:
+
+	/// Datagrams that arrive while this many bytes are waiting to be read are dropped
+	static const uint32_t MAX_QUEUED_BYTES = 1 << 16;
+
+	PhysicalLayerUDPPeer(openpal::LogRoot& root, UDPListener& listener, const asio::ip::udp::endpoint& remote);
+
+	~PhysicalLayerUDPPeer();
+
+	virtual const std::string& GetRemoteAddress() const override
+	{
+		return remoteAddress;
+	}
+
+	/// Called by the listener with each datagram from the remote endpoint
+	void OnDatagram(const uint8_t* pData, uint32_t size);
+
+	void DoOpen() override;
+	void DoClose() override;
+	void DoOpeningClose() override;
+	void DoRead(openpal::WSlice&) override;
+	void DoWrite(const openpal::RSlice&) override;
+
+private:
+
+	uint32_t NumQueued() const
+	{
+		return static_cast<uint32_t>(rxQueue.size()) - rxOffset;
+	}
+
+	void Deliver();
+	void SendNext(const openpal::RSlice& remaining, uint32_t numWritten);
+	void Unregister();
+
+	void StartIdleTimer(const openpal::TimeDuration& timeout);
+	void OnIdleTimeout();
+
+	UDPListener* pListener;
+	asio::ip::udp::endpoint remoteEndpoint;
+	std::string remoteAddress;
+	bool isRegistered;
+	bool hasOpened;
+
+	// bytes before the offset have been delivered, the queue is compacted once they are most of it
+	std::vector<uint8_t> rxQueue;
+	uint32_t rxOffset;
+	uint8_t* pReadBuffer;
+	uint32_t readSize;
+
+	openpal::TimerRef idleTimer;
+	openpal::MonotonicTimestamp lastReceive;
+};
+
+}
+
+#endif
@@ -0,0 +1,59 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIOPAL_PHYSICAL_LAYER_UDP_SERVER_H
+#define ASIOPAL_PHYSICAL_LAYER_UDP_SERVER_H
+
+#include "PhysicalLayerBaseUDP.h"
+
+#include <string>
+
+namespace asiopal
+{
+
+/**
+* A UDP socket bound to a local endpoint that exchanges datagrams with one peer at a time
+*
+* Writes go to the sender of the most recently received datagram. Writes made before the first
+* datagram arrives are dropped. Use a UDPListener to serve many peers from one socket.
+*/
+class PhysicalLayerUDPServer final : public PhysicalLayerBaseUDP
+{
+public:
+
+	PhysicalLayerUDPServer(
+	    openpal::LogRoot& root,
+	    asio::io_service& service,
+	    const std::string& endpoint,
+	    uint16_t port);
+
+	void DoOpen() override;
+
+private:
+
+	virtual void OnDatagramFrom(const asio::ip::udp::endpoint& sender) override;
+
+	std::string localEndpointString;
+	asio::ip::udp::endpoint localEndpoint;
+};
+
+}
+
+#endif
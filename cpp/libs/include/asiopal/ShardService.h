@@ -0,0 +1,65 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIOPAL_SHARDSERVICE_H
+#define ASIOPAL_SHARDSERVICE_H
+
+#include <asio.hpp>
+
+#include <atomic>
+#include <thread>
+
+namespace asiopal
+{
+
+/**
+* An asio service that marks an io_service as a shard, i.e. it is run by exactly
+* one thread. Executors created on a shard post directly to the io_service instead
+* of going through a strand.
+*/
+class ShardService : public asio::io_service::service
+{
+public:
+
+	static asio::io_service::id id;
+
+	explicit ShardService(asio::io_service& service);
+
+	/// Mark the service as a shard. Must be called before any executors are created on it.
+	static void Install(asio::io_service& service);
+
+	/// @return the shard service or nullptr if the io_service isn't a shard
+	static ShardService* Find(asio::io_service& service);
+
+	/// Called by the shard's thread before it runs the io_service
+	void SetOwner(std::thread::id owner);
+
+	bool RunningInThisThread() const;
+
+private:
+
+	virtual void shutdown_service() {}
+
+	std::atomic<std::thread::id> owner;
+};
+
+}
+
+#endif
@@ -22,10 +22,14 @@
 #ifndef ASIOPAL_SOCKET_HELPERS_H
 #define ASIOPAL_SOCKET_HELPERS_H
 
+#include "asiopal/SocketOptions.h"
+
 #include <openpal/util/Uncopyable.h>
+#include <openpal/logging/Logger.h>
 
 #include <system_error>
 #include <asio.hpp>
+#include <asio/ip/tcp.hpp>
 
 namespace asiopal
 {
@@ -51,6 +55,11 @@ namespace asiopal
 				}
 			}
 		}
+
+		/**
+		* Apply socket options to a connected or accepted socket. Options that fail are logged and skipped.
+		*/
+		static void ApplySocketOptions(const SocketOptions& options, asio::ip::tcp::socket::lowest_layer_type& socket, openpal::Logger& logger);
 	};
 
 }
@@ -0,0 +1,81 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIOPAL_SOCKET_OPTIONS_H
+#define ASIOPAL_SOCKET_OPTIONS_H
+
+#include <openpal/executor/TimeDuration.h>
+
+#include <cstdint>
+
+namespace asiopal
+{
+
+/**
+* Options applied to a TCP socket when it connects or is accepted
+*
+* The defaults leave every option at the operating system's setting. Options that the platform doesn't
+* support, or that the operating system rejects, are logged as warnings and don't fail the connection.
+*/
+struct SocketOptions
+{
+	SocketOptions() :
+		noDelay(false),
+		sendBufferSize(0),
+		receiveBufferSize(0),
+		keepAlive(false),
+		keepAliveIdle(openpal::TimeDuration::Zero()),
+		keepAliveInterval(openpal::TimeDuration::Zero()),
+		keepAliveCount(0),
+		userTimeout(openpal::TimeDuration::Zero()),
+		busyPollMicroseconds(0)
+	{}
+
+	/// Set TCP_NODELAY so that small writes such as link and application confirms aren't held back by Nagle's algorithm
+	bool noDelay;
+
+	/// SO_SNDBUF in bytes, 0 for the operating system default
+	int32_t sendBufferSize;
+
+	/// SO_RCVBUF in bytes, 0 for the operating system default
+	int32_t receiveBufferSize;
+
+	/// Enable SO_KEEPALIVE probes on an idle connection
+	bool keepAlive;
+
+	/// Idle time before the first keepalive probe (TCP_KEEPIDLE), whole seconds. Zero for the operating system default
+	openpal::TimeDuration keepAliveIdle;
+
+	/// Time between keepalive probes (TCP_KEEPINTVL), whole seconds. Zero for the operating system default
+	openpal::TimeDuration keepAliveInterval;
+
+	/// Number of unanswered probes before the connection is dropped (TCP_KEEPCNT), 0 for the operating system default
+	uint32_t keepAliveCount;
+
+	/// How long transmitted data may go unacknowledged before the connection is dropped (TCP_USER_TIMEOUT, Linux only). Zero for the operating system default
+	openpal::TimeDuration userTimeout;
+
+	/// Time to busy poll the device queue when receiving (SO_BUSY_POLL, Linux only), 0 to leave it off. Raising it above net.core.busy_read requires CAP_NET_ADMIN
+	uint32_t busyPollMicroseconds;
+};
+
+}
+
+#endif
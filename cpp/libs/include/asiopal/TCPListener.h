@@ -0,0 +1,83 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIOPAL_TCP_LISTENER_H
+#define ASIOPAL_TCP_LISTENER_H
+
+#include "Listener.h"
+#include "PhysicalLayerTCPSocket.h"
+#include "SocketOptions.h"
+
+#include <openpal/logging/LogRoot.h>
+
+#include <asio.hpp>
+#include <asio/ip/tcp.hpp>
+
+#include <functional>
+#include <string>
+
+namespace asiopal
+{
+
+/**
+* Listens on a TCP endpoint and hands each accepted socket to its owner as a PhysicalLayerTCPSocket
+*
+* Unlike PhysicalLayerTCPServer, which serves one peer at a time, any number of the accepted sockets
+* may be open at once.
+*/
+class TCPListener final : public Listener
+{
+public:
+
+	TCPListener(
+	    openpal::LogRoot& root,
+	    asio::io_service& service,
+	    const std::string& endpoint,
+	    uint16_t port,
+	    const SocketOptions& options = SocketOptions(),
+	    std::function<void (asio::ip::tcp::socket&)> configure = [](asio::ip::tcp::socket&) {});
+
+	virtual std::error_code Listen() override;
+
+	virtual void BeginAccept(const AcceptCallback& callback) override;
+
+	virtual void Close() override;
+
+	virtual bool IsListening() const override
+	{
+		return acceptor.is_open();
+	}
+
+private:
+
+	openpal::LogRoot* pRoot;
+	openpal::Logger logger;
+
+	std::string localEndpointString;
+	asio::ip::tcp::endpoint localEndpoint;
+	asio::ip::tcp::acceptor acceptor;
+	asio::ip::tcp::socket socket;
+	const SocketOptions options;
+	std::function<void (asio::ip::tcp::socket&)> configure;
+};
+
+}
+
+#endif
@@ -0,0 +1,47 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIOPAL_THREADPOOLMODE_H
+#define ASIOPAL_THREADPOOLMODE_H
+
+namespace asiopal
+{
+
+/// Enumeration for how the thread pool maps threads to io_services
+enum class ThreadPoolMode
+{
+    /// All threads run one shared io_service. Each channel serializes its work with a strand.
+    SHARED,
+    /// Each thread runs its own io_service. Channels are pinned to one thread and need no strand.
+    SHARDED
+};
+
+/// Enumeration for how channels are assigned to shards in SHARDED mode
+enum class ShardSelection
+{
+    /// Assign shards in turn
+    ROUND_ROBIN,
+    /// Assign the shard with the fewest channels
+    LEAST_LOADED
+};
+
+}
+
+#endif
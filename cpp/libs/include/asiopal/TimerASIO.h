@@ -21,37 +21,29 @@
 #ifndef ASIOPAL_TIMERASIO_H
 #define ASIOPAL_TIMERASIO_H
 
-#include <asio.hpp>
-
-#include <chrono>
-
 #include <openpal/executor/IExecutor.h>
 
-#include <asiopal/SteadyClock.h>
+#include <asiopal/TimerWheel.h>
 
 namespace asiopal
 {
 
+class ASIOExecutor;
+
 /**
- * This is a wrapper for ASIO timers that are used to post events
- * on a queue. Events can be posted for immediate consumption or
- * some time in the future. Events can be consumbed by the posting
- * thread or another thread.
+ * A timer started on an ASIOExecutor.
  *
- * @section Class Goals
- *
- * Decouple APL code form ASIO so ASIO could be replace if need be.
- *
- * There is a problem with ASIO. When cancel is called, an event is
- * posted. We wanted a cancel that does not generate any events.
+ * Timers don't own an asio timer. They are nodes in the executor's TimerWheel,
+ * which is driven by a single asio timer, so starting and canceling them is O(1)
+ * and canceling doesn't generate any events.
  *
  */
-class TimerASIO : public openpal::ITimer
+class TimerASIO : public openpal::ITimer, private TimerWheelNode
 {
 	friend class ASIOExecutor;
 
 public:
-	TimerASIO(asio::strand& strand);
+	TimerASIO(ASIOExecutor& executor);
 
 	// Implement ITimer
 	void Cancel();
@@ -63,9 +55,11 @@ public:
 
 private:
 
+	ASIOExecutor* pExecutor;
+
 	bool canceled;
 
-	asio::basic_waitable_timer< asiopal::asiopal_steady_clock > timer;
+	openpal::Action0 runnable;
 };
 
 }
@@ -0,0 +1,163 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIOPAL_TIMERWHEEL_H
+#define ASIOPAL_TIMERWHEEL_H
+
+#include <cstdint>
+
+namespace asiopal
+{
+
+class TimerWheel;
+
+/**
+* An intrusive entry in a TimerWheel. A node is linked into at most one slot at a time.
+*/
+class TimerWheelNode
+{
+	friend class TimerWheel;
+
+public:
+
+	TimerWheelNode();
+
+	/// @return true if the node is currently linked into a wheel slot or the expired list
+	bool IsLinked() const
+	{
+		return slot != UNLINKED;
+	}
+
+	/// @return the expiration tick passed to TimerWheel::Schedule
+	uint64_t GetExpiration() const
+	{
+		return expiration;
+	}
+
+private:
+
+	static const uint16_t UNLINKED = 0xFFFF;
+
+	uint64_t expiration;
+	uint16_t slot;
+	TimerWheelNode* pPrev;
+	TimerWheelNode* pNext;
+};
+
+/**
+* A hierarchical timing wheel with 1 tick resolution (one tick per millisecond in ASIOExecutor).
+*
+* The first level has 256 slots of one tick each and four more levels have 64 slots each,
+* covering 2^32 ticks. Timers further out are parked on the last level and re-filed when it cascades.
+* Scheduling and canceling are O(1). Advancing moves due timers, in expiration order, onto an
+* expired list that the owner drains with PopExpired().
+*/
+class TimerWheel
+{
+public:
+
+	typedef uint64_t Tick;
+
+	explicit TimerWheel(Tick now);
+
+	/**
+	* Add a node to the wheel
+	*
+	* @param now the current tick, used to fast-forward the wheel if it's empty
+	* @return the tick by which Advance must be called for the node to expire on time
+	*/
+	Tick Schedule(TimerWheelNode& node, Tick expiration, Tick now);
+
+	/// Unlink a scheduled or expired node
+	void Cancel(TimerWheelNode& node);
+
+	/// Move every node that expires at or before 'now' onto the expired list
+	void Advance(Tick now);
+
+	/// @return the oldest expired node or nullptr if there are none
+	TimerWheelNode* PopExpired();
+
+	/**
+	* @param tick set to the next tick at which Advance has work to do
+	* @return false if no nodes are scheduled
+	*/
+	bool NextWake(Tick& tick) const;
+
+	/// @return true if no nodes are scheduled or expired
+	bool IsEmpty() const
+	{
+		return (numScheduled == 0) && (expired.pHead == nullptr);
+	}
+
+private:
+
+	struct List
+	{
+		List() : pHead(nullptr), pTail(nullptr) {}
+
+		TimerWheelNode* pHead;
+		TimerWheelNode* pTail;
+	};
+
+	static const uint32_t NUM_LEVELS = 5;
+	static const uint32_t LEVEL0_BITS = 8;
+	static const uint32_t LEVEL_BITS = 6;
+	static const uint32_t LEVEL0_SIZE = 1 << LEVEL0_BITS;
+	static const uint32_t LEVEL_SIZE = 1 << LEVEL_BITS;
+	static const uint32_t NUM_SLOTS = LEVEL0_SIZE + (NUM_LEVELS - 1) * LEVEL_SIZE;
+	static const uint16_t EXPIRED = NUM_SLOTS;
+
+	static uint32_t Shift(uint32_t level)
+	{
+		return LEVEL0_BITS + (level - 1) * LEVEL_BITS;
+	}
+
+	/// @return the tick at which slot 'index' of 'level' is next cascaded
+	Tick CascadeTick(uint32_t level, uint32_t index) const;
+
+	/// File a node into the slot for its expiration and return the tick at which it's next visited
+	Tick Place(TimerWheelNode& node);
+
+	void Cascade(uint32_t level, uint32_t index);
+
+	void Link(TimerWheelNode& node, uint16_t slot);
+	void Unlink(TimerWheelNode& node);
+
+	List& GetList(uint16_t slot)
+	{
+		return (slot == EXPIRED) ? expired : slots[slot];
+	}
+
+	static uint32_t LevelOf(uint16_t slot)
+	{
+		return (slot < LEVEL0_SIZE) ? 0 : 1 + (slot - LEVEL0_SIZE) / LEVEL_SIZE;
+	}
+
+	Tick current;
+	uint32_t numScheduled;
+	uint32_t levelCount[NUM_LEVELS];
+
+	List slots[NUM_SLOTS];
+	List expired;
+};
+
+}
+
+#endif
@@ -0,0 +1,102 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIOPAL_UDP_LISTENER_H
+#define ASIOPAL_UDP_LISTENER_H
+
+#include "Listener.h"
+
+#include <openpal/logging/LogRoot.h>
+#include <openpal/executor/TimeDuration.h>
+
+#include <asio.hpp>
+#include <asio/ip/udp.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace asiopal
+{
+
+class PhysicalLayerUDPPeer;
+
+/**
+* Serves any number of peers from one UDP socket
+*
+* The first datagram from an unknown remote endpoint is accepted as a new peer, and later datagrams
+* from that endpoint are queued on it. When a peer is closed, its endpoint becomes unknown again.
+* A peer that receives nothing for the idle timeout closes itself.
+*/
+class UDPListener final : public Listener
+{
+	friend class PhysicalLayerUDPPeer;
+
+public:
+
+	UDPListener(
+	    openpal::LogRoot& root,
+	    asio::io_service& service,
+	    const std::string& endpoint,
+	    uint16_t port,
+	    const openpal::TimeDuration& peerIdleTimeout = openpal::TimeDuration::Max());
+
+	~UDPListener();
+
+	virtual std::error_code Listen() override;
+
+	virtual void BeginAccept(const AcceptCallback& callback) override;
+
+	virtual void Close() override;
+
+	virtual bool IsListening() const override
+	{
+		return socket.is_open();
+	}
+
+private:
+
+	void BeginReceive();
+	void OnReceive(const std::error_code& ec, size_t numRead);
+
+	// called by peers
+	void Remove(const asio::ip::udp::endpoint& remote);
+
+	openpal::LogRoot* pRoot;
+	openpal::Logger logger;
+	const openpal::TimeDuration peerIdleTimeout;
+
+	std::string localEndpointString;
+	asio::ip::udp::endpoint localEndpoint;
+	asio::ip::udp::socket socket;
+
+	asio::ip::udp::endpoint sender;
+	std::vector<uint8_t> datagram;
+	bool isReceiving;
+
+	AcceptCallback acceptCallback;
+	bool isAccepting;
+
+	std::map<asio::ip::udp::endpoint, PhysicalLayerUDPPeer*> peers;
+};
+
+}
+
+#endif
@@ -24,12 +24,14 @@
 
 #include <asiopal/PhysicalLayerASIO.h>
 
-#include "asiopal/tls/TLSConfig.h"
+#include "asiopal/tls/TLSContext.h"
 
 #include <asio.hpp>
 #include <asio/ip/tcp.hpp>
 #include <asio/ssl.hpp>
 
+#include <memory>
+
 namespace asiopal
 {
 
@@ -43,8 +45,7 @@ public:
 	PhysicalLayerTLSBase(
 		openpal::LogRoot& root,
 		asio::io_service& service,
-		const TLSConfig& config,
-		asio::ssl::context_base::method method		
+		std::shared_ptr<TLSContext> context
 	);
 
 	virtual ~PhysicalLayerTLSBase() {}
@@ -59,8 +60,17 @@ public:
 protected:
 
 	bool LogPeerCertificateInfo(bool preverified, asio::ssl::verify_context& ctx);
-	
-	asio::ssl::context ctx;
+
+	/// Replace the stream with a fresh one before each connection so that no SSL state carries over
+	void ResetStream();
+
+	/// Count the handshake as full or resumed and complete the open
+	void OnHandshakeResult(const std::error_code& ec);
+
+	asio::io_service& service;
+
+	/// Possibly shared with other channels, see TLSContextCache
+	std::shared_ptr<TLSContext> context;
 	
 	std::unique_ptr<asio::ssl::stream<asio::ip::tcp::socket>> stream;	
 
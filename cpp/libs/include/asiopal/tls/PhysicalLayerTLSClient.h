@@ -24,12 +24,15 @@
 #include "asiopal/tls/PhysicalLayerTLSBase.h"
 
 #include "asiopal/tls/TLSConfig.h"
+#include "asiopal/SocketOptions.h"
 
 #include "asiopal/LoggingConnectionCondition.h"
 
 #include <openpal/logging/LogMacros.h>
 #include <openpal/logging/LogLevels.h>
 
+#include <functional>
+
 namespace asiopal
 {
 
@@ -46,7 +49,20 @@ public:
 	    const std::string& host,
 	    const std::string& localAddress,
 	    uint16_t port,
-		const TLSConfig& config
+		const TLSConfig& config,
+		const SocketOptions& options = SocketOptions(),
+		std::function<void (asio::ip::tcp::socket::lowest_layer_type&)> configure = [](asio::ip::tcp::socket::lowest_layer_type&) {}
+	);
+
+	PhysicalLayerTLSClient(
+	    openpal::LogRoot& root,
+	    asio::io_service& service,
+	    const std::string& host,
+	    const std::string& localAddress,
+	    uint16_t port,
+		std::shared_ptr<TLSContext> context,
+		const SocketOptions& options = SocketOptions(),
+		std::function<void (asio::ip::tcp::socket::lowest_layer_type&)> configure = [](asio::ip::tcp::socket::lowest_layer_type&) {}
 	);
 
 	// ---- Implement the remaining actions ----
@@ -59,6 +75,10 @@ private:
 
 	void HandleResolveResult(const std::error_code& ec, asio::ip::tcp::resolver::iterator endpoint_iterator);
 	void HandleConnectResult(const std::error_code& ec);	
+	void HandleHandshakeResult(const std::error_code& ec);
+
+	// the last session issued by the server, offered when reconnecting
+	TLSClientSession session;
 
 	asiopal::LoggingConnectionCondition condition;
 	const std::string host;
@@ -66,7 +86,8 @@ private:
 	asio::ip::tcp::endpoint remoteEndpoint;
 	asio::ip::tcp::endpoint localEndpoint;
 	asio::ip::tcp::resolver resolver;
-	std::function<void (asio::ip::tcp::socket&)> configure;
+	const SocketOptions options;
+	std::function<void (asio::ip::tcp::socket::lowest_layer_type&)> configure;
 };
 
 }
@@ -24,6 +24,9 @@
 #include "asiopal/tls/PhysicalLayerTLSBase.h"
 
 #include "asiopal/tls/TLSConfig.h"
+#include "asiopal/SocketOptions.h"
+
+#include <functional>
 
 namespace asiopal
 {
@@ -39,7 +42,19 @@ public:
 	    asio::io_service& service,
 	    const std::string& endpoint,
 	    uint16_t port,
-		const TLSConfig& config
+		const TLSConfig& config,
+		const SocketOptions& options = SocketOptions(),
+		std::function<void (asio::ip::tcp::socket::lowest_layer_type&)> configure = [](asio::ip::tcp::socket::lowest_layer_type&) {}
+	);
+
+	PhysicalLayerTLSServer(
+	    openpal::LogRoot& root,
+	    asio::io_service& service,
+	    const std::string& endpoint,
+	    uint16_t port,
+		std::shared_ptr<TLSContext> context,
+		const SocketOptions& options = SocketOptions(),
+		std::function<void (asio::ip::tcp::socket::lowest_layer_type&)> configure = [](asio::ip::tcp::socket::lowest_layer_type&) {}
 	);
 
 	// --- Implement the remainging actions ---
@@ -59,7 +74,9 @@ private:
 	std::string localEndpointString;
 	asio::ip::tcp::endpoint localEndpoint;
 	asio::ip::tcp::endpoint remoteEndpoint;
-	asio::ip::tcp::acceptor acceptor;	
+	asio::ip::tcp::acceptor acceptor;
+	const SocketOptions options;
+	std::function<void (asio::ip::tcp::socket::lowest_layer_type&)> configure;
 };
 }
 
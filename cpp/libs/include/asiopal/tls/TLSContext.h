@@ -0,0 +1,106 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIOPAL_TLS_CONTEXT_H
+#define ASIOPAL_TLS_CONTEXT_H
+
+#include "asiopal/tls/TLSConfig.h"
+
+#include <openpal/util/Uncopyable.h>
+
+#include <asio/ssl.hpp>
+
+namespace asiopal
+{
+
+/// Which side of the handshake a TLS context is used for
+enum class TLSRole
+{
+	CLIENT,
+	SERVER
+};
+
+/**
+* An ssl context configured from a TLSConfig that can be shared by any number of channels.
+*
+* Server contexts keep a session cache and issue session tickets. Client contexts hand
+* new sessions to the TLSClientSession attached to the connection so that the next
+* connection can resume them.
+*/
+class TLSContext : private openpal::Uncopyable
+{
+public:
+
+	/// Throws asio::system_error if the certificate or key files cannot be loaded
+	TLSContext(const TLSConfig& config, TLSRole role);
+
+	asio::ssl::context& Get()
+	{
+		return ctx;
+	}
+
+	TLSRole GetRole() const
+	{
+		return role;
+	}
+
+private:
+
+	static int OnNewSession(SSL* ssl, SSL_SESSION* session);
+
+	const TLSRole role;
+	asio::ssl::context ctx;
+};
+
+/**
+* Holds the most recent session issued to a client so that it can be offered on the next connection
+*/
+class TLSClientSession : private openpal::Uncopyable
+{
+	friend class TLSContext;
+
+public:
+
+	TLSClientSession();
+	~TLSClientSession();
+
+	/// Offer the held session on a new connection and receive the sessions it is issued
+	void Attach(SSL* ssl);
+
+	/// Release the held session, e.g. after a failed handshake
+	void Clear();
+
+	bool HasSession() const
+	{
+		return session != nullptr;
+	}
+
+private:
+
+	static int GetIndex();
+
+	void Store(SSL_SESSION* session);
+
+	SSL_SESSION* session;
+};
+
+}
+
+#endif
@@ -0,0 +1,63 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIOPAL_TLS_CONTEXT_CACHE_H
+#define ASIOPAL_TLS_CONTEXT_CACHE_H
+
+#include "asiopal/tls/TLSContext.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace asiopal
+{
+
+/**
+* Shares TLS contexts between channels with identical configurations.
+*
+* Entries are held weakly, so a context lives as long as a channel that uses it. Channels
+* sharing a server context share its session cache and ticket keys, so a client can resume
+* a session with any of them. Configurations are keyed by file path, so a context created
+* before a certificate file is replaced keeps the old certificate until its last channel is gone.
+*/
+class TLSContextCache : private openpal::Uncopyable
+{
+public:
+
+	/// Retrieve the context for a configuration, creating it if no channel currently holds one.
+	/// Throws asio::system_error if the certificate or key files cannot be loaded.
+	std::shared_ptr<TLSContext> Get(const TLSConfig& config, TLSRole role);
+
+	/// The number of contexts currently held by at least one channel
+	uint32_t NumContexts();
+
+private:
+
+	static std::string GetKey(const TLSConfig& config, TLSRole role);
+
+	std::mutex mutex;
+	std::map<std::string, std::weak_ptr<TLSContext>> contexts;
+};
+
+}
+
+#endif
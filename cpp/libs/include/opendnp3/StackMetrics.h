@@ -0,0 +1,67 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_STACKMETRICS_H
+#define OPENDNP3_STACKMETRICS_H
+
+#include <openpal/util/LatencyHistogram.h>
+
+#include "opendnp3/gen/MasterTaskType.h"
+
+namespace opendnp3
+{
+
+/**
+* Snapshot of the latency histograms and counters of a master or outstation session
+*
+* Unlike StackStatistics, these are read without going through the channel's executor.
+*/
+struct StackMetrics
+{
+	static const uint32_t NUM_TASK_TYPES = static_cast<uint32_t>(MasterTaskType::SET_SESSION_KEYS) + 1;
+
+	StackMetrics() : eventBufferHighWater(0), numLinkRetransmit(0)
+	{}
+
+	const openpal::LatencyHistogram& GetTaskRoundTrip(MasterTaskType type) const
+	{
+		return taskRoundTrip[static_cast<uint32_t>(type)];
+	}
+
+	/// Master only: time from transmitting a task's request to receiving the first fragment of the response, by task type
+	openpal::LatencyHistogram taskRoundTrip[NUM_TASK_TYPES];
+
+	/// Outstation only: time spent processing READ requests and formatting the first response fragment
+	openpal::LatencyHistogram readHandling;
+
+	/// Time that work posted to the channel's executor waited before it ran, shared by all sessions on the channel.
+	/// Only recorded when enabled with StackMetricsConfig::recordStrandQueueDelay
+	openpal::LatencyHistogram strandQueueDelay;
+
+	/// Outstation only: largest number of events held in the event buffer
+	uint32_t eventBufferHighWater;
+
+	/// Number of link frames retransmitted because a link layer confirm or reset was not answered in time
+	uint32_t numLinkRetransmit;
+};
+
+}
+
+#endif
@@ -0,0 +1,43 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_STACKMETRICSCONFIG_H
+#define OPENDNP3_STACKMETRICSCONFIG_H
+
+namespace opendnp3
+{
+
+/**
+* Selects the optional measurements reported in StackMetrics
+*/
+struct StackMetricsConfig
+{
+	StackMetricsConfig() : recordStrandQueueDelay(false)
+	{}
+
+	/// Measure how long work posted to the channel's executor waits before it runs (StackMetrics::strandQueueDelay).
+	/// This reads the clock twice per posted action. The executor is shared, so once any session on a channel
+	/// enables it, the delay is recorded for the whole channel.
+	bool recordStrandQueueDelay;
+};
+
+}
+
+#endif
@@ -0,0 +1,128 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_COLUMNSINK_H
+#define OPENDNP3_COLUMNSINK_H
+
+#include "opendnp3/app/Indexed.h"
+
+#include <cstdint>
+
+namespace opendnp3
+{
+
+// well-formed only for types that have a value, quality and time like the measurement types
+template <class Value, class Quality, class Time>
+struct ColumnsEnabled
+{
+	typedef void Type;
+};
+
+/**
+* Destination for decoding the elements of a collection directly into caller-provided
+* columns, see MeasurementColumns. Only indexed measurement types have columns, so
+* this default loads nothing.
+*/
+template <class T, class Enable = void>
+class ColumnSink
+{
+public:
+
+	bool IsFull() const
+	{
+		return true;
+	}
+
+	void Write(const T& item) {}
+
+	uint32_t Count() const
+	{
+		return 0;
+	}
+};
+
+/**
+* Writes each indexed measurement as a row of the index, value, flags and time
+* columns. Any column may be null.
+*/
+template <class T>
+class ColumnSink<Indexed<T>, typename ColumnsEnabled<typename T::ValueType, decltype(T::quality), decltype(T::time)>::Type>
+{
+public:
+
+	typedef typename T::ValueType ValueType;
+
+	ColumnSink(uint16_t* indices_, ValueType* values_, uint8_t* flags_, uint64_t* times_, uint32_t capacity_) :
+		indices(indices_),
+		values(values_),
+		flags(flags_),
+		times(times_),
+		capacity(capacity_),
+		num(0)
+	{}
+
+	bool IsFull() const
+	{
+		return num == capacity;
+	}
+
+	void Write(const Indexed<T>& item)
+	{
+		if (indices)
+		{
+			indices[num] = item.index;
+		}
+
+		if (values)
+		{
+			values[num] = item.value.value;
+		}
+
+		if (flags)
+		{
+			flags[num] = item.value.quality;
+		}
+
+		if (times)
+		{
+			times[num] = item.value.time;
+		}
+
+		++num;
+	}
+
+	uint32_t Count() const
+	{
+		return num;
+	}
+
+private:
+
+	uint16_t* const indices;
+	ValueType* const values;
+	uint8_t* const flags;
+	uint64_t* const times;
+	const uint32_t capacity;
+	uint32_t num;
+};
+
+}
+
+#endif
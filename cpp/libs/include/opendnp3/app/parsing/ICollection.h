@@ -21,6 +21,10 @@
 #ifndef OPENDNP3_ICOLLECTION_H
 #define OPENDNP3_ICOLLECTION_H
 
+#include "opendnp3/app/parsing/ColumnSink.h"
+
+#include <cstdint>
+
 namespace opendnp3
 {
 
@@ -36,6 +40,18 @@ public:
 	virtual void OnValue(const T& value) = 0;
 };
 
+/**
+* Abstract way of visiting elements of a collection a contiguous block at a time
+*
+*/
+template <class T>
+class IBlockVisitor
+{
+public:
+
+	virtual void OnValues(const T* values, uint32_t count) = 0;
+};
+
 /**
 * A visitor implemented as an abstract functor
 *
@@ -77,6 +93,38 @@ public:
 	*/
 	virtual void Foreach(IVisitor<T>& visitor) const = 0;
 
+	/**
+	* Visit all the elements of a collection in contiguous blocks, i.e. one
+	* virtual call per block instead of one per element.
+	*
+	* The default implementation delivers blocks of one element. Collections
+	* decoded from a buffer override this to decode many elements per block.
+	*/
+	virtual void ForeachBlock(IBlockVisitor<T>& visitor) const
+	{
+		auto deliver = [&visitor](const T & item)
+		{
+			visitor.OnValues(&item, 1);
+		};
+		this->ForeachItem(deliver);
+	}
+
+	/**
+	* Decode the elements of the collection into the sink until it is full.
+	*
+	* The default implementation writes each block delivered by ForeachBlock.
+	* Collections decoded from a buffer override this to decode each element
+	* straight into the sink.
+	*
+	* @return the number of elements written to the sink
+	*/
+	virtual uint32_t LoadColumns(ColumnSink<T>& sink) const
+	{
+		BlockWriter writer(sink);
+		this->ForeachBlock(writer);
+		return sink.Count();
+	}
+
 	/**
 		visit all of the elements of a collection
 	*/
@@ -106,6 +154,28 @@ public:
 			return false;
 		}
 	}
+
+private:
+
+	class BlockWriter : public IBlockVisitor<T>
+	{
+	public:
+
+		BlockWriter(ColumnSink<T>& sink_) : sink(sink_)
+		{}
+
+		virtual void OnValues(const T* values, uint32_t count) override final
+		{
+			for (uint32_t i = 0; i < count && !sink.IsFull(); ++i)
+			{
+				sink.Write(values[i]);
+			}
+		}
+
+	private:
+
+		ColumnSink<T>& sink;
+	};
 };
 
 }
@@ -46,7 +46,8 @@ struct LinkConfig
 		LocalAddr(localAddr),
 		RemoteAddr(remoteAddr),
 		Timeout(timeout),
-		KeepAliveTimeout(keepAliveTimeout)
+		KeepAliveTimeout(keepAliveTimeout),
+		MaxUnconfirmedFramesPerWrite(1)
 	{}
 
 	LinkConfig(
@@ -59,7 +60,8 @@ struct LinkConfig
 		LocalAddr(isMaster ? 1 : 1024),
 		RemoteAddr(isMaster ? 1024 : 1),
 		Timeout(openpal::TimeDuration::Seconds(1)),
-		KeepAliveTimeout(openpal::TimeDuration::Minutes(1))
+		KeepAliveTimeout(openpal::TimeDuration::Minutes(1)),
+		MaxUnconfirmedFramesPerWrite(1)
 	{}
 
 	/// The master/outstation bit set on all messages
@@ -83,6 +85,10 @@ struct LinkConfig
 	/// the interval for keep-alive messages (link status requests)
 	openpal::TimeDuration KeepAliveTimeout;
 
+	/// The maximum number of unconfirmed user data frames that are formatted into a single buffer
+	/// and handed to the physical layer as one write. The default of 1 writes each frame separately.
+	uint16_t MaxUnconfirmedFramesPerWrite;
+
 private:
 
 	LinkConfig() {}
@@ -39,6 +39,7 @@ public:
 
 	MasterScan();
 
+	/// The demand callback is posted to the executor to demand the task
 	MasterScan(openpal::IExecutor& executor, IMasterTask* pTask, const std::function<void()>& demandCallback);
 
 	/// Request that the scan be performed as soon as possible
@@ -23,6 +23,7 @@
 
 #include "opendnp3/master/MasterParams.h"
 #include "opendnp3/link/LinkConfig.h"
+#include "opendnp3/StackMetricsConfig.h"
 
 namespace opendnp3
 {
@@ -40,6 +41,9 @@ struct MasterStackConfig
 
 	/// Link layer config
 	LinkConfig link;
+
+	/// Optional metrics
+	StackMetricsConfig metrics;
 };
 
 }
@@ -0,0 +1,73 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_MEASUREMENTCOLUMNS_H
+#define OPENDNP3_MEASUREMENTCOLUMNS_H
+
+#include "opendnp3/app/Indexed.h"
+#include "opendnp3/app/parsing/ICollection.h"
+
+namespace opendnp3
+{
+
+/**
+* Caller-provided contiguous arrays (columns) into which the measurements of a
+* single object header can be loaded from within ISOEHandler::Process.
+*
+* The values are decoded directly from the APDU into the columns, so loading
+* costs one virtual call per header rather than one per value. Any column may
+* be null if the application isn't interested in it.
+*/
+template <class T>
+class MeasurementColumns
+{
+public:
+
+	typedef typename T::ValueType ValueType;
+
+	MeasurementColumns(uint16_t* indices_, ValueType* values_, uint8_t* flags_, uint64_t* times_, uint32_t capacity_) :
+		indices(indices_),
+		values(values_),
+		flags(flags_),
+		times(times_),
+		capacity(capacity_)
+	{}
+
+	/**
+	* Load the collection into the columns, starting at position zero
+	*
+	* @return the number of rows written, never more than the capacity
+	*/
+	uint32_t Load(const ICollection<Indexed<T>>& collection)
+	{
+		ColumnSink<Indexed<T>> sink(indices, values, flags, times, capacity);
+		return collection.LoadColumns(sink);
+	}
+
+	uint16_t* const indices;
+	ValueType* const values;
+	uint8_t* const flags;
+	uint64_t* const times;
+	const uint32_t capacity;
+};
+
+}
+
+#endif
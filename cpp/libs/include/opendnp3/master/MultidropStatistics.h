@@ -0,0 +1,89 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_MULTIDROPSTATISTICS_H
+#define OPENDNP3_MULTIDROPSTATISTICS_H
+
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/**
+* Counters kept by the channel-level scheduler that decides which master session on a multi-drop channel
+* may have a request outstanding
+*/
+struct MultidropStatistics
+{
+	MultidropStatistics() :
+		numGrants(0),
+		numContendedGrants(0),
+		onlineTimeMs(0),
+		busyTimeMs(0),
+		waitTimeMs(0),
+		numPollCycles(0),
+		totalPollCycleMs(0),
+		lastPollCycleMs(0),
+		maxPollCycleMs(0)
+	{}
+
+	/// Fraction of the online time that a session was running a task, in the range [0, 1]
+	double Utilization() const
+	{
+		return (onlineTimeMs == 0) ? 0.0 : static_cast<double>(busyTimeMs) / static_cast<double>(onlineTimeMs);
+	}
+
+	/// Average time between consecutive grants to the same session, or 0 if none have been measured
+	double AveragePollCycleMs() const
+	{
+		return (numPollCycles == 0) ? 0.0 : static_cast<double>(totalPollCycleMs) / static_cast<double>(numPollCycles);
+	}
+
+	/// Number of times a session was given the channel to run a task
+	uint32_t numGrants;
+
+	/// Number of grants to a session that had to wait for another session to finish
+	uint32_t numContendedGrants;
+
+	/// Milliseconds that at least one session on the channel was online
+	uint64_t onlineTimeMs;
+
+	/// Milliseconds that a session held the channel to run a task
+	uint64_t busyTimeMs;
+
+	/// Milliseconds that sessions spent waiting for the channel, summed across sessions
+	uint64_t waitTimeMs;
+
+	/// Number of measured intervals between consecutive grants to the same session
+	uint32_t numPollCycles;
+
+	/// Sum of the measured intervals in milliseconds
+	uint64_t totalPollCycleMs;
+
+	/// Most recently measured interval in milliseconds
+	uint64_t lastPollCycleMs;
+
+	/// Largest measured interval in milliseconds
+	uint64_t maxPollCycleMs;
+};
+
+}
+
+#endif
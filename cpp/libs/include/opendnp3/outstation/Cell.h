@@ -25,22 +25,11 @@
 namespace opendnp3
 {
 
-/**
-* Type used to record whether a value is requested in a response
-*/
-template <class ValueType>
-struct SelectedValue
-{
-	SelectedValue() : selected(false), value(), variation(ValueType::DefaultStaticVariation)
-	{}
-
-	bool selected;
-	ValueType value;
-	typename ValueType::StaticVariation variation;
-};
-
 /**
 * Holds particular measurement type in the database.
+*
+* The selection state used when reading static data is kept in separate arrays (see StaticBuffers)
+* so that selecting and serializing large databases doesn't stream through the event metadata.
 */
 template <class ValueType>
 struct Cell
@@ -58,8 +47,6 @@ struct Cell
 	uint16_t vIndex; // virtual index for discontiguous data, as opposed to the raw array index
 	typename ValueType::StaticVariation variation;
 	typename ValueType::MetadataType metadata;
-
-	SelectedValue<ValueType> selection;
 };
 
 
@@ -24,7 +24,9 @@
 #include "opendnp3/outstation/OutstationConfig.h"
 #include "opendnp3/outstation/EventBufferConfig.h"
 #include "opendnp3/outstation/DatabaseTemplate.h"
+#include "opendnp3/outstation/UpdateQueueConfig.h"
 #include "opendnp3/link/LinkConfig.h"
+#include "opendnp3/StackMetricsConfig.h"
 
 namespace opendnp3
 {
@@ -55,6 +57,12 @@ struct OutstationStackConfig
 	/// Link layer config
 	LinkConfig link;
 
+	/// Queue used to pass measurement updates to the outstation
+	UpdateQueueConfig updateQueue;
+
+	/// Optional metrics
+	StackMetricsConfig metrics;
+
 };
 
 }
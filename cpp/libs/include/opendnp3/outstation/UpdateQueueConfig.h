@@ -0,0 +1,55 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_UPDATEQUEUECONFIG_H
+#define OPENDNP3_UPDATEQUEUECONFIG_H
+
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/// What happens to a measurement update when the outstation's update queue is full
+enum class UpdateOverflowPolicy : uint8_t
+{
+	/// The update is applied on the outstation's executor after everything queued before it, nothing is lost
+	Fallback,
+	/// The update is discarded and counted
+	Drop
+};
+
+/// Configuration of the bounded queue that MeasUpdate uses to pass updates to an outstation
+struct UpdateQueueConfig
+{
+	UpdateQueueConfig(uint32_t capacity_ = 1024, UpdateOverflowPolicy overflowPolicy_ = UpdateOverflowPolicy::Fallback) :
+		capacity(capacity_),
+		overflowPolicy(overflowPolicy_)
+	{}
+
+	/// Maximum number of queued updates, rounded up to a power of 2. 0 disables the queue.
+	uint32_t capacity;
+
+	/// What to do with an update when the queue is full
+	UpdateOverflowPolicy overflowPolicy;
+};
+
+}
+
+#endif
@@ -0,0 +1,59 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_UPDATEQUEUESTATISTICS_H
+#define OPENDNP3_UPDATEQUEUESTATISTICS_H
+
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/**
+* Counters for the queue that measurement updates pass through on their way to an outstation
+*/
+struct UpdateQueueStatistics
+{
+	UpdateQueueStatistics() :
+		numQueued(0),
+		numApplied(0),
+		numOverflows(0),
+		numDropped(0),
+		numDrains(0)
+	{}
+
+	/// Number of updates placed in the queue
+	uint64_t numQueued;
+
+	/// Number of queued updates applied to the database
+	uint64_t numApplied;
+
+	/// Number of updates that found the queue full
+	uint64_t numOverflows;
+
+	/// Number of updates discarded because of the Drop overflow policy
+	uint64_t numDropped;
+
+	/// Number of batches drained from the queue
+	uint64_t numDrains;
+};
+}
+
+#endif
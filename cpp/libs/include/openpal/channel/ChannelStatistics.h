@@ -48,7 +48,7 @@ namespace openpal
 {
 struct ChannelStatistics
 {
-	ChannelStatistics() : numOpen(0), numOpenFail(0), numClose(0), numBytesRx(0), numBytesTx(0)
+	ChannelStatistics() : numOpen(0), numOpenFail(0), numClose(0), numBytesRx(0), numBytesTx(0), numFullHandshake(0), numResumedHandshake(0)
 	{}
 
 	/// The number of times the channel has successfully opened
@@ -65,6 +65,12 @@ struct ChannelStatistics
 
 	/// The number of bytes transmitted
 	uint32_t numBytesTx;
+
+	/// The number of TLS handshakes that negotiated a new session (TLS channels only)
+	uint32_t numFullHandshake;
+
+	/// The number of TLS handshakes that resumed a previous session (TLS channels only)
+	uint32_t numResumedHandshake;
 };
 }
 
@@ -24,8 +24,11 @@
 #include <openpal/container/RSlice.h>
 #include <openpal/container/WSlice.h>
 
+#include "IKeyedHMAC.h"
+
 #include <initializer_list>
 #include <system_error>
+#include <memory>
 
 namespace openpal
 {
@@ -48,7 +51,8 @@ public:
 	    std::error_code& ec
 	) = 0;
 
-
+	// Bind a key to the algorithm for repeated calculations. Returns nullptr and sets 'ec' on failure.
+	virtual std::unique_ptr<IKeyedHMAC> CreateKeyed(const RSlice& key, std::error_code& ec) = 0;
 };
 }
 
@@ -0,0 +1,55 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENPAL_IKEYEDHMAC_H
+#define OPENPAL_IKEYEDHMAC_H
+
+#include <openpal/container/RSlice.h>
+#include <openpal/container/WSlice.h>
+
+#include <initializer_list>
+#include <system_error>
+
+namespace openpal
+{
+/**
+* An HMAC algorithm bound to a single key. The key schedule is computed once
+* when the instance is created instead of on every calculation.
+*
+* Unlike IHMACAlgo, instances are not thread-safe.
+*/
+class IKeyedHMAC
+{
+public:
+	virtual ~IKeyedHMAC() {}
+
+	// Describes the required output size
+	virtual uint16_t OutputSize() const = 0;
+
+	// Calculate the HMAC value using the bound key, writing the result into 'dest'
+	virtual openpal::RSlice Calculate(
+	    std::initializer_list<RSlice> data,
+	    WSlice& dest,
+	    std::error_code& ec
+	) = 0;
+};
+}
+
+#endif
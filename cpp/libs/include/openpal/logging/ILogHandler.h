@@ -22,6 +22,7 @@
 #define OPENPAL_ILOGHANDLER_H
 
 #include "LogEntry.h"
+#include "LogRecord.h"
 
 namespace openpal
 {
@@ -40,6 +41,20 @@ public:
 	* @param entry the log message to handle
 	*/
 	virtual void Log( const LogEntry& entry ) = 0;
+
+	/**
+	* Callback method for log messages whose formatting was deferred. The default implementation
+	* formats the record on the calling thread and forwards it to Log(LogEntry).
+	*
+	* @param alias the alias of the logger that recorded the message, only valid for the duration of the call
+	* @param record the unformatted log message
+	*/
+	virtual void LogDeferred(char const* alias, const LogRecord& record)
+	{
+		char message[MAX_LOG_ENTRY_SIZE];
+		record.Format(message, MAX_LOG_ENTRY_SIZE);
+		this->Log(LogEntry(alias, record.GetFilters(), record.GetLocation(), message, record.GetErrorCode()));
+	}
 };
 
 }
@@ -38,7 +38,7 @@ public:
 
 	LogEntry();
 
-	LogEntry(char const* alias, const LogFilters& filters, char const* location, char const* message, int errorCode);
+	LogEntry(char const* alias, const LogFilters& filters, char const* location, char const* message, int errorCode, uint64_t timestamp = 0);
 
 	/// @return The alias of the logger that recorded the message
 	char const*	GetAlias() const
@@ -70,6 +70,12 @@ public:
 		return errorCode;
 	}
 
+	/// @return milliseconds since the epoch when the message was recorded, or 0 if the handler didn't record it
+	uint64_t GetTimestamp() const
+	{
+		return timestamp;
+	}
+
 private:
 
 	char const*		alias;
@@ -77,6 +83,7 @@ private:
 	char const*		location;
 	char const*		message;
 	int				errorCode;
+	uint64_t		timestamp;
 };
 
 }
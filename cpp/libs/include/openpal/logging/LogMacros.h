@@ -26,6 +26,7 @@
 #ifndef OPENPAL_STRIP_LOGGING
 
 #include "StringFormatting.h"
+#include "LogRecord.h"
 
 #include <cstdio>
 
@@ -45,18 +46,21 @@
 		pLogger->Log(filters, LOCATION, message, code); \
 	}
 
+// formatting is deferred to the log handler, the dead SAFE_STRING_FORMAT keeps compile-time format checking
 #define FORMAT_LOG_BLOCK_WITH_CODE(logger, filters, code, format, ...) \
 if(logger.IsEnabled(filters)){ \
-	char message[openpal::MAX_LOG_ENTRY_SIZE]; \
-	SAFE_STRING_FORMAT(message, openpal::MAX_LOG_ENTRY_SIZE, format, ##__VA_ARGS__); \
-	logger.Log(filters, LOCATION, message, code); \
+	if(false) { SAFE_STRING_FORMAT(nullptr, 0, format, ##__VA_ARGS__); } \
+	openpal::LogRecord openpalLogRecord(filters, LOCATION, code); \
+	openpalLogRecord.Capture(format, ##__VA_ARGS__); \
+	logger.Log(openpalLogRecord); \
 }
 
 #define FORMAT_LOGGER_BLOCK_WITH_CODE(pLogger, filters, code, format, ...) \
 if(pLogger && pLogger->IsEnabled(filters)){ \
-	char message[openpal::MAX_LOG_ENTRY_SIZE]; \
-	SAFE_STRING_FORMAT(message, openpal::MAX_LOG_ENTRY_SIZE, format, ##__VA_ARGS__); \
-	pLogger->Log(filters, LOCATION, message, code); \
+	if(false) { SAFE_STRING_FORMAT(nullptr, 0, format, ##__VA_ARGS__); } \
+	openpal::LogRecord openpalLogRecord(filters, LOCATION, code); \
+	openpalLogRecord.Capture(format, ##__VA_ARGS__); \
+	pLogger->Log(openpalLogRecord); \
 }
 
 #define FORMAT_HEX_BLOCK(logger, filters, buffer, firstSize, otherSize) \
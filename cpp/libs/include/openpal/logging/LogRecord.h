@@ -0,0 +1,194 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENPAL_LOGRECORD_H
+#define OPENPAL_LOGRECORD_H
+
+#include "LogFilters.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace openpal
+{
+
+class RSlice;
+
+const uint32_t MAX_LOG_ENTRY_SIZE = 120;
+const uint32_t MAX_HEX_PER_LINE = 20;
+
+const uint32_t MAX_LOG_ARGS = 8;
+
+// strings share the budget of a formatted entry, other arguments take at most 8 bytes each
+const uint32_t MAX_LOG_ARGS_SIZE = MAX_LOG_ENTRY_SIZE + MAX_LOG_ARGS * 8;
+
+namespace logargs
+{
+
+template <class T>
+struct Codec
+{
+	static_assert(sizeof(T) <= 8, "Log arguments must be at most 8 bytes");
+
+	static void Write(uint8_t*& pos, uint32_t&, T value)
+	{
+		memcpy(pos, &value, sizeof(T));
+		pos += sizeof(T);
+	}
+
+	static T Read(const uint8_t*& pos)
+	{
+		T value;
+		memcpy(&value, pos, sizeof(T));
+		pos += sizeof(T);
+		return value;
+	}
+};
+
+// strings are copied by value since the pointer may not outlive the record
+template <>
+struct Codec<char const*>
+{
+	static void Write(uint8_t*& pos, uint32_t& budget, char const* value);
+
+	static char const* Read(const uint8_t*& pos);
+};
+
+template <>
+struct Codec<char*> : Codec<char const*>
+{};
+
+inline void WriteAll(uint8_t*&, uint32_t&)
+{}
+
+template <class T, class... Rest>
+void WriteAll(uint8_t*& pos, uint32_t& budget, T value, Rest... rest)
+{
+	Codec<T>::Write(pos, budget, value);
+	WriteAll(pos, budget, rest...);
+}
+
+template <class... Args>
+struct Formatter;
+
+template <>
+struct Formatter<>
+{
+	static void Run(char* dest, uint32_t size, char const* format, const uint8_t* pos);
+
+	template <class... Decoded>
+	static void Run(char* dest, uint32_t size, char const* format, const uint8_t*, Decoded... decoded)
+	{
+#ifdef WIN32
+		_snprintf_s(dest, size, _TRUNCATE, format, decoded...);
+#else
+		snprintf(dest, size, format, decoded...);
+#endif
+	}
+};
+
+template <class T, class... Rest>
+struct Formatter<T, Rest...>
+{
+	template <class... Decoded>
+	static void Run(char* dest, uint32_t size, char const* format, const uint8_t* pos, Decoded... decoded)
+	{
+		auto value = Codec<T>::Read(pos);
+		Formatter<Rest...>::Run(dest, size, format, pos, decoded..., value);
+	}
+};
+
+}
+
+/**
+* A log message whose formatting has been deferred. The arguments are copied by value,
+* strings by content, so the record can be formatted later on a different thread. The
+* format string and location must be literals.
+*/
+class LogRecord
+{
+
+public:
+
+	typedef void (*FormatFunc)(char* dest, uint32_t size, char const* format, const uint8_t* args);
+
+	LogRecord();
+
+	LogRecord(const LogFilters& filters, char const* location, int errorCode);
+
+	/// Capture a printf-style format string and its arguments
+	template <class... Args>
+	void Capture(char const* format, Args... args);
+
+	/// Capture a row of bytes that will be formatted as hex
+	void CaptureHex(const RSlice& bytes);
+
+	/// Format the message into a buffer, truncating if necessary
+	void Format(char* dest, uint32_t size) const;
+
+	/// Copy the record, skipping the unused part of the argument buffer
+	void CopyTo(LogRecord& dest) const;
+
+	const LogFilters& GetFilters() const
+	{
+		return filters;
+	}
+
+	char const* GetLocation() const
+	{
+		return location;
+	}
+
+	int GetErrorCode() const
+	{
+		return errorCode;
+	}
+
+private:
+
+	static void FormatHex(char* dest, uint32_t size, char const* format, const uint8_t* args);
+
+	LogFilters		filters;
+	char const*		location;
+	int				errorCode;
+	char const*		format;
+	FormatFunc		pFormat;
+	uint16_t		argsSize;
+	uint8_t			args[MAX_LOG_ARGS_SIZE];
+};
+
+template <class... Args>
+void LogRecord::Capture(char const* format_, Args... args_)
+{
+	static_assert(sizeof...(Args) <= MAX_LOG_ARGS, "Too many log arguments");
+
+	format = format_;
+	pFormat = &logargs::Formatter<Args...>::Run;
+
+	uint8_t* pos = args;
+	uint32_t budget = MAX_LOG_ENTRY_SIZE - 1;
+	logargs::WriteAll(pos, budget, args_...);
+	argsSize = static_cast<uint16_t>(pos - args);
+}
+
+}
+
+#endif
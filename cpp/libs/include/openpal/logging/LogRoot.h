@@ -22,6 +22,7 @@
 #define OPENPAL_LOGROOT_H
 
 #include "LogEntry.h"
+#include "LogRecord.h"
 #include "Logger.h"
 #include "ILogHandler.h"
 
@@ -47,6 +48,8 @@ public:
 
 	void Log(const LogFilters& filters, char const* location, char const* message, int errorCode);
 
+	void Log(const LogRecord& record);
+
 	Logger GetLogger();
 
 	bool IsEnabled(const LogFilters& rhs) const;
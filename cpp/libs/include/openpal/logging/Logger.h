@@ -23,6 +23,7 @@
 
 #include "LogEntry.h"
 #include "LogFilters.h"
+#include "LogRecord.h"
 
 #include "openpal/util/Uncopyable.h"
 
@@ -42,6 +43,8 @@ public:
 
 	void Log(const LogFilters& filters, char const* location, char const* message, int errorCode = -1);
 
+	void Log(const LogRecord& record);
+
 	bool IsEnabled(const LogFilters& filters) const;
 
 private:
@@ -22,14 +22,12 @@
 #define OPENPAL_STRINGFORMATTING_H
 
 #include "Logger.h"
+#include "LogRecord.h"
 
 namespace openpal
 {
 class RSlice;
 
-const uint32_t MAX_LOG_ENTRY_SIZE = 120;
-const uint32_t MAX_HEX_PER_LINE = 20;
-
 static_assert(MAX_HEX_PER_LINE < (MAX_LOG_ENTRY_SIZE / 3), "Each hex byte takes 3 characters");
 
 void LogHex(Logger& logger, const openpal::LogFilters& filters, const openpal::RSlice& source, uint32_t firstRowSize, uint32_t otherRowSize);
@@ -0,0 +1,74 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENPAL_LATENCYHISTOGRAM_H
+#define OPENPAL_LATENCYHISTOGRAM_H
+
+#include <cstdint>
+
+namespace openpal
+{
+
+/**
+* A snapshot of a fixed-bucket latency histogram in microseconds
+*
+* Buckets are log-linear in the style of HDR histograms: values below 4 have their own bucket
+* and every power of two above that is split into 4 linear sub-buckets, so a recorded value is
+* known to within 25%. Values of 2^32 microseconds (~71 minutes) or more go in the last bucket.
+*/
+struct LatencyHistogram
+{
+	static const uint32_t SUB_BUCKET_BITS = 2;
+	static const uint32_t NUM_SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+	static const uint32_t NUM_BUCKETS = NUM_SUB_BUCKETS + (32 - SUB_BUCKET_BITS) * NUM_SUB_BUCKETS;
+
+	LatencyHistogram();
+
+	/// @return the bucket that a value is counted in
+	static uint32_t GetBucket(uint64_t microseconds);
+
+	/// @return the smallest value counted in a bucket
+	static uint64_t GetBucketLowerBound(uint32_t bucket);
+
+	/// @return the largest value counted in a bucket
+	static uint64_t GetBucketUpperBound(uint32_t bucket);
+
+	/// @return the mean of the recorded values, or 0 if there are none
+	double MeanMicroseconds() const;
+
+	/// @return the upper bound of the bucket containing the value at a percentile in [0, 100], never more than the max
+	uint64_t PercentileMicroseconds(double percentile) const;
+
+	/// Number of values counted in each bucket
+	uint32_t counts[NUM_BUCKETS];
+
+	/// Number of recorded values
+	uint64_t count;
+
+	/// Sum of the recorded values
+	uint64_t totalMicroseconds;
+
+	/// Largest recorded value
+	uint64_t maxMicroseconds;
+};
+
+}
+
+#endif
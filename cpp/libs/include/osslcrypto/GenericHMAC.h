@@ -24,9 +24,12 @@
 
 #include <openpal/container/RSlice.h>
 #include <openpal/container/WSlice.h>
+#include <openpal/crypto/IKeyedHMAC.h>
+#include <openpal/util/Uncopyable.h>
 
 #include <initializer_list>
 #include <system_error>
+#include <memory>
 
 #include <openssl/hmac.h>
 
@@ -41,6 +44,42 @@ openpal::RSlice CalculateHMAC(
     openpal::WSlice& output,
     std::error_code& ec
 );
+
+/**
+* An HMAC context that is keyed once and then reset to the keyed state for each calculation,
+* skipping the inner/outer pad setup that CalculateHMAC performs on every call
+*/
+class KeyedHMAC final : public openpal::IKeyedHMAC, private openpal::Uncopyable
+{
+public:
+
+	KeyedHMAC(const EVP_MD* md, uint16_t outputSize);
+
+	~KeyedHMAC();
+
+	bool SetKey(const openpal::RSlice& key, std::error_code& ec);
+
+	virtual uint16_t OutputSize() const override
+	{
+		return OUTPUT_SIZE;
+	}
+
+	virtual openpal::RSlice Calculate(std::initializer_list<openpal::RSlice> data, openpal::WSlice& output, std::error_code& ec) override;
+
+private:
+
+	const EVP_MD* md;
+	const uint16_t OUTPUT_SIZE;
+	bool keyed;
+	HMAC_CTX ctx;
+};
+
+std::unique_ptr<openpal::IKeyedHMAC> CreateKeyedHMAC(
+    const EVP_MD* md,
+    uint16_t outputSize,
+    const openpal::RSlice& key,
+    std::error_code& ec
+);
 }
 
 #endif
\ No newline at end of file
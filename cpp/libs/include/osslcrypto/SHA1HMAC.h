@@ -38,6 +38,8 @@ public:
 	}
 	virtual openpal::RSlice Calculate(const openpal::RSlice& key, std::initializer_list<openpal::RSlice> data, openpal::WSlice& output, std::error_code& ec) override final;
 
+	virtual std::unique_ptr<openpal::IKeyedHMAC> CreateKeyed(const openpal::RSlice& key, std::error_code& ec) override final;
+
 private:
 
 	static const uint16_t OUTPUT_SIZE = 20;
@@ -63,6 +63,9 @@ struct OutstationAuthSettings
 	openpal::TimeDuration sessionKeyTimeout;
 	/// Thresholds for various security statistics
 	StatThresholds statThresholds;
+	/// Key an HMAC context once per session key change and reuse it to verify challenge replies.
+	/// Off by default. Whether this is faster than keying per message depends on the crypto provider.
+	bool cacheKeyedHMACs;
 
 
 };
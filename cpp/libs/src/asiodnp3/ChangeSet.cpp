@@ -22,21 +22,56 @@
 
 namespace asiodnp3
 {
+void ChangeSet::Update(const UpdateRecord& update)
+{
+	changes.push_back(Change(update));
+}
+
 void ChangeSet::Add(const UpdateFun& fun)
 {
-	updates.push_back(fun);
+	changes.push_back(Change(static_cast<uint32_t>(functions.size())));
+	functions.push_back(fun);
 }
 
 void ChangeSet::ApplyAll(opendnp3::IDatabase& db)
 {
-	for (auto & update : updates)
+	this->ApplyFrom(0, db);
+}
+
+void ChangeSet::ApplyFrom(uint32_t pos, opendnp3::IDatabase& db)
+{
+	for (auto i = pos; i < changes.size(); ++i)
 	{
-		update(db);
+		auto& change = changes[i];
+		if (change.isFunction)
+		{
+			functions[change.update.value.counter](db);
+		}
+		else
+		{
+			change.update.Apply(db);
+		}
 	}
 }
 
 bool ChangeSet::IsEmpty() const
 {
-	return updates.empty();
+	return changes.empty();
+}
+
+uint32_t ChangeSet::Size() const
+{
+	return static_cast<uint32_t>(changes.size());
+}
+
+const UpdateRecord* ChangeSet::GetUpdate(uint32_t pos) const
+{
+	return changes[pos].isFunction ? nullptr : &changes[pos].update;
+}
+
+void ChangeSet::Clear()
+{
+	changes.clear();
+	functions.clear();
 }
 }
@@ -21,7 +21,7 @@
 #ifndef ASIODNP3_CHANGESET_H
 #define ASIODNP3_CHANGESET_H
 
-#include <opendnp3/outstation/IDatabase.h>
+#include "asiodnp3/UpdateRecord.h"
 
 #include <openpal/util/Uncopyable.h>
 
@@ -31,6 +31,11 @@
 namespace asiodnp3
 {
 
+/**
+* An ordered set of changes to an outstation database. Measurement updates are stored
+* as records so that they can be passed through the update queue, and the storage is
+* kept when the set is cleared so that it can be reused.
+*/
 class ChangeSet : private openpal::Uncopyable
 {
 
@@ -38,15 +43,42 @@ public:
 
 	typedef std::function<void(opendnp3::IDatabase&)> UpdateFun;
 
+	void Update(const UpdateRecord& update);
+
 	void Add(const UpdateFun& fun);
 
 	void ApplyAll(opendnp3::IDatabase&);
 
+	/// apply the changes starting at position pos
+	void ApplyFrom(uint32_t pos, opendnp3::IDatabase& db);
+
 	bool IsEmpty() const;
 
+	uint32_t Size() const;
+
+	/// @return the update at position pos, or nullptr if the change there is a function
+	const UpdateRecord* GetUpdate(uint32_t pos) const;
+
+	void Clear();
+
 private:
 
-	std::vector<UpdateFun> updates;
+	struct Change
+	{
+		Change(const UpdateRecord& update_) : isFunction(false), update(update_)
+		{}
+
+		Change(uint32_t function) : isFunction(true)
+		{
+			update.value.counter = function;
+		}
+
+		bool isFunction;
+		UpdateRecord update;	// value.counter is the position in functions if isFunction
+	};
+
+	std::vector<Change> changes;
+	std::vector<UpdateFun> functions;
 };
 
 }
@@ -23,6 +23,8 @@
 #include "DNP3Channel.h"
 
 #include <asiopal/PhysicalLayerBase.h>
+#include <asiopal/IOServiceThreadPool.h>
+#include <asiopal/Listener.h>
 
 using namespace openpal;
 using namespace asiopal;
@@ -31,6 +33,11 @@ using namespace opendnp3;
 namespace asiodnp3
 {
 
+ChannelSet::ChannelSet(asiopal::IOServiceThreadPool& pool) : pPool(&pool)
+{
+
+}
+
 ChannelSet::~ChannelSet()
 {
 	this->Shutdown();
@@ -52,12 +59,31 @@ IChannel* ChannelSet::CreateChannel(
     asiopal::ASIOExecutor& executor,
 	const ChannelRetry& retry,
     PhysicalLayerBase* apPhys,
-    openpal::ICryptoProvider* pCrypto)
+    openpal::ICryptoProvider* pCrypto,
+    uint32_t rxBufferSize)
+{
+	return this->Register(new DNP3Channel(pLogRoot, executor, retry, apPhys, pCrypto, rxBufferSize), executor);
+}
+
+IChannel* ChannelSet::CreateChannel(
+    openpal::LogRoot* pLogRoot,
+    const ChannelRetry& retry,
+    asiopal::Listener* pListener,
+    openpal::ICryptoProvider* pCrypto,
+    uint32_t rxBufferSize,
+    const MultiServerSettings& settings)
+{
+	return this->Register(new DNP3Channel(pLogRoot, retry, pListener, pCrypto, rxBufferSize, settings), pListener->executor);
+}
+
+IChannel* ChannelSet::Register(DNP3Channel* pChannel, asiopal::ASIOExecutor& executor)
 {
-	auto pChannel = new DNP3Channel(pLogRoot, executor, retry, apPhys, pCrypto);
-	auto onShutdown = [this, pChannel]()
+	// the channel was pinned to this io_service by the manager
+	auto pService = &executor.GetIOService();
+	auto onShutdown = [this, pChannel, pService]()
 	{
 		this->OnShutdown(pChannel);
+		this->pPool->Release(*pService);
 	};
 	pChannel->SetShutdownHandler(Action0::Bind(onShutdown));
 	channels.insert(pChannel);
@@ -31,6 +31,8 @@
 
 #include <opendnp3/link/ChannelRetry.h>
 
+#include <asiodnp3/MultiServerSettings.h>
+
 namespace openpal
 {
 class ICryptoProvider;
@@ -40,6 +42,8 @@ namespace asiopal
 {
 class PhysicalLayerBase;
 class ASIOExecutor;
+class IOServiceThreadPool;
+class Listener;
 }
 
 namespace asiodnp3
@@ -53,21 +57,35 @@ class ChannelSet
 
 public:
 
+	ChannelSet(asiopal::IOServiceThreadPool& pool);
+
 	~ChannelSet();
 
 	IChannel* CreateChannel(	openpal::LogRoot* pRoot,
 	                            asiopal::ASIOExecutor& executor,
 	                            const opendnp3::ChannelRetry& retry,
 	                            asiopal::PhysicalLayerBase* pPhys,
-	                            openpal::ICryptoProvider* pCrypto);
+	                            openpal::ICryptoProvider* pCrypto,
+	                            uint32_t rxBufferSize);
+
+	IChannel* CreateChannel(	openpal::LogRoot* pRoot,
+	                            const opendnp3::ChannelRetry& retry,
+	                            asiopal::Listener* pListener,
+	                            openpal::ICryptoProvider* pCrypto,
+	                            uint32_t rxBufferSize,
+	                            const MultiServerSettings& settings);
 
 	/// Synchronously shutdown all channels. Block until complete.
 	void Shutdown();
 
 private:
 
+	asiopal::IOServiceThreadPool* pPool;
+
 	std::set<DNP3Channel*> channels;
 
+	IChannel* Register(DNP3Channel* pChannel, asiopal::ASIOExecutor& executor);
+
 	void OnShutdown(DNP3Channel* pChannel);
 };
 
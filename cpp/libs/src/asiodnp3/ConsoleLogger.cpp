@@ -48,8 +48,12 @@ void ConsoleLogger::SetPrintLocation(bool printLocation_)
 
 void ConsoleLogger::Log(const openpal::LogEntry& entry)
 {
-	auto time = std::chrono::high_resolution_clock::now();
-	auto num = duration_cast<milliseconds>(time.time_since_epoch()).count();
+	auto num = entry.GetTimestamp();
+	if (num == 0)
+	{
+		auto time = std::chrono::high_resolution_clock::now();
+		num = duration_cast<milliseconds>(time.time_since_epoch()).count();
+	}
 
 	ostringstream oss;
 
@@ -46,7 +46,8 @@ DNP3Channel::DNP3Channel(
     asiopal::ASIOExecutor& executor,
     const ChannelRetry& retry,
     openpal::IPhysicalLayer* pPhys_,
-    openpal::ICryptoProvider* pCrypto_) :
+    openpal::ICryptoProvider* pCrypto_,
+    uint32_t rxBufferSize) :
 
 	pPhys(pPhys_),
 	pCrypto(pCrypto_),
@@ -55,16 +56,43 @@ DNP3Channel::DNP3Channel(
 	logger(pLogRoot->GetLogger()),
 	pShutdownHandler(nullptr),
 	channelState(ChannelState::CLOSED),
-	router(*pLogRoot, executor, pPhys.get(), retry, this, &statistics),
-	stacks(router, executor)
+	pMultiRouter(nullptr),
+	pRouter(new LinkLayerRouter(*pLogRoot, executor, pPhys.get(), retry, this, &statistics, rxBufferSize)),
+	stacks(*pRouter, executor)
 {
 	pPhys->SetChannelStatistics(&statistics);
+	this->SetRouterShutdownHandler();
+}
+
+DNP3Channel::DNP3Channel(
+    LogRoot* pLogRoot_,
+    const ChannelRetry& retry,
+    asiopal::Listener* pListener_,
+    openpal::ICryptoProvider* pCrypto_,
+    uint32_t rxBufferSize,
+    const MultiServerSettings& settings) :
+
+	pListener(pListener_),
+	pCrypto(pCrypto_),
+	pLogRoot(pLogRoot_),
+	pExecutor(&pListener->executor),
+	logger(pLogRoot->GetLogger()),
+	pShutdownHandler(nullptr),
+	channelState(ChannelState::CLOSED),
+	pMultiRouter(new MultiConnectionRouter(*pLogRoot, *pListener, retry, this, &statistics, rxBufferSize, settings)),
+	pRouter(pMultiRouter),
+	stacks(*pRouter, *pExecutor)
+{
+	this->SetRouterShutdownHandler();
+}
 
+void DNP3Channel::SetRouterShutdownHandler()
+{
 	auto onShutdown = [this]()
 	{
 		this->CheckForFinalShutdown();
 	};
-	router.SetShutdownHandler(Action0::Bind(onShutdown));
+	pRouter->SetShutdownHandler(Action0::Bind(onShutdown));
 }
 
 void DNP3Channel::OnStateChange(ChannelState state)
@@ -84,7 +112,7 @@ void DNP3Channel::AddStateListener(const std::function<void(opendnp3::ChannelSta
 		this->callbacks.push_back(listener);
 		listener(channelState);
 	};
-	pExecutor->strand.post(lambda);
+	pExecutor->Enqueue(lambda);
 }
 
 // comes from the outside, so we need to synchronize
@@ -98,7 +126,7 @@ void DNP3Channel::Shutdown()
 	{
 		this->InitiateShutdown(blocking);
 	};
-	pExecutor->strand.post(initiate);
+	pExecutor->Enqueue(initiate);
 	blocking.WaitForValue();
 
 	// With the router shutdown, wait for any remaining timers
@@ -116,16 +144,66 @@ LinkChannelStatistics DNP3Channel::GetChannelStatistics()
 	return pExecutor->ReturnBlockFor<LinkChannelStatistics>(get);
 }
 
+void DNP3Channel::GetChannelStatisticsAsync(const std::function<void (const LinkChannelStatistics&)>& callback)
+{
+	auto get = [this]()
+	{
+		return statistics;
+	};
+	pExecutor->ReturnAsyncFor<LinkChannelStatistics>(get, callback);
+}
+
+MultidropStatistics DNP3Channel::GetMultidropStatistics()
+{
+	auto get = [this]()
+	{
+		return taskLock.GetStatistics(pExecutor->GetTime());
+	};
+	return pExecutor->ReturnBlockFor<MultidropStatistics>(get);
+}
+
+void DNP3Channel::GetMultidropStatisticsAsync(const std::function<void (const MultidropStatistics&)>& callback)
+{
+	auto get = [this]()
+	{
+		return taskLock.GetStatistics(pExecutor->GetTime());
+	};
+	pExecutor->ReturnAsyncFor<MultidropStatistics>(get, callback);
+}
+
+ServerStatistics DNP3Channel::GetServerStatistics()
+{
+	auto get = [this]()
+	{
+		return this->ReadServerStatistics();
+	};
+	return pExecutor->ReturnBlockFor<ServerStatistics>(get);
+}
+
+void DNP3Channel::GetServerStatisticsAsync(const std::function<void (const ServerStatistics&)>& callback)
+{
+	auto get = [this]()
+	{
+		return this->ReadServerStatistics();
+	};
+	pExecutor->ReturnAsyncFor<ServerStatistics>(get, callback);
+}
+
+ServerStatistics DNP3Channel::ReadServerStatistics()
+{
+	return pMultiRouter ? pMultiRouter->GetServerStatistics() : ServerStatistics();
+}
+
 void DNP3Channel::InitiateShutdown(asiopal::Synchronized<bool>& handler)
 {
 	this->pShutdownHandler = &handler;
-	router.Shutdown();
+	pRouter->Shutdown();
 	this->CheckForFinalShutdown();
 }
 
 void DNP3Channel::CheckForFinalShutdown()
 {
-	if (pShutdownHandler && (router.GetState() == ChannelState::SHUTDOWN))
+	if (pShutdownHandler && (pRouter->GetState() == ChannelState::SHUTDOWN))
 	{
 		pShutdownHandler->SetValue(true);
 	}
@@ -149,36 +227,106 @@ void DNP3Channel::SetLogFilters(const openpal::LogFilters& filters)
 	pExecutor->BlockFor(set);
 }
 
-IMaster* DNP3Channel::AddMaster(char const* id, ISOEHandler& SOEHandler, IMasterApplication& application, const MasterStackConfig& config)
+void DNP3Channel::GetLogFiltersAsync(const std::function<void (const LogFilters&)>& callback) const
 {
-	auto add = [&]() -> IMaster*
+	auto get = [this]()
 	{
-		auto factory = [&]()
-		{
-			return new MasterStack(id, *pLogRoot, *pExecutor, SOEHandler, application, config, stacks, taskLock);
-		};
+		return pLogRoot->GetFilters();
+	};
+	pExecutor->ReturnAsyncFor<LogFilters>(get, callback);
+}
 
-		return this->AddStack<MasterStack>(config.link, factory);
+void DNP3Channel::SetLogFiltersAsync(const openpal::LogFilters& filters)
+{
+	auto set = [this, filters]()
+	{
+		this->pLogRoot->SetFilters(filters);
+	};
+	pExecutor->Enqueue(set);
+}
+
+IMaster* DNP3Channel::AddMaster(char const* id, ISOEHandler& SOEHandler, IMasterApplication& application, const MasterStackConfig& config)
+{
+	auto add = [&]()
+	{
+		return this->CreateMaster(id, SOEHandler, application, config);
 	};
 
 	return pExecutor->ReturnBlockFor<IMaster*>(add);
 }
 
-IOutstation* DNP3Channel::AddOutstation(char const* id, ICommandHandler& commandHandler, IOutstationApplication& application, const OutstationStackConfig& config)
+void DNP3Channel::AddMasterAsync(char const* id, ISOEHandler& SOEHandler, IMasterApplication& application, const MasterStackConfig& config, const std::function<void (IMaster*)>& callback)
 {
-	auto add = [this, id, &commandHandler, &application, config]() -> IOutstation*
+	std::string alias(id);
+	auto pSOEHandler = &SOEHandler;
+	auto pApplication = &application;
+	auto add = [this, alias, pSOEHandler, pApplication, config]()
 	{
-		auto factory = [&]()
+		return this->CreateMaster(alias.c_str(), *pSOEHandler, *pApplication, config);
+	};
+
+	pExecutor->ReturnAsyncFor<IMaster*>(add, callback);
+}
+
+std::vector<IMaster*> DNP3Channel::AddMasters(const std::vector<MasterSpec>& masters)
+{
+	auto add = [&]()
+	{
+		std::vector<IMaster*> added;
+		added.reserve(masters.size());
+		for (auto& spec : masters)
 		{
-			return new OutstationStack(id, *pLogRoot, *pExecutor, commandHandler, application, config, stacks);
-		};
+			added.push_back(this->CreateMaster(spec.id.c_str(), *spec.pSOEHandler, *spec.pApplication, spec.config));
+		}
+		return added;
+	};
+
+	return pExecutor->ReturnBlockFor<std::vector<IMaster*>>(add);
+}
 
-		return this->AddStack<OutstationStack>(config.link, factory);
+IOutstation* DNP3Channel::AddOutstation(char const* id, ICommandHandler& commandHandler, IOutstationApplication& application, const OutstationStackConfig& config)
+{
+	auto add = [&]()
+	{
+		return this->CreateOutstation(id, commandHandler, application, config);
 	};
 
 	return pExecutor->ReturnBlockFor<IOutstation*>(add);
 }
 
+void DNP3Channel::AddOutstationAsync(char const* id, ICommandHandler& commandHandler, IOutstationApplication& application, const OutstationStackConfig& config, const std::function<void (IOutstation*)>& callback)
+{
+	std::string alias(id);
+	auto pCommandHandler = &commandHandler;
+	auto pApplication = &application;
+	auto add = [this, alias, pCommandHandler, pApplication, config]()
+	{
+		return this->CreateOutstation(alias.c_str(), *pCommandHandler, *pApplication, config);
+	};
+
+	pExecutor->ReturnAsyncFor<IOutstation*>(add, callback);
+}
+
+IMaster* DNP3Channel::CreateMaster(char const* id, ISOEHandler& SOEHandler, IMasterApplication& application, const MasterStackConfig& config)
+{
+	auto factory = [&]()
+	{
+		return new MasterStack(id, *pLogRoot, *pExecutor, SOEHandler, application, config, stacks, taskLock);
+	};
+
+	return this->AddStack<MasterStack>(config.link, factory);
+}
+
+IOutstation* DNP3Channel::CreateOutstation(char const* id, ICommandHandler& commandHandler, IOutstationApplication& application, const OutstationStackConfig& config)
+{
+	auto factory = [&]()
+	{
+		return new OutstationStack(id, *pLogRoot, *pExecutor, commandHandler, application, config, stacks);
+	};
+
+	return this->AddStack<OutstationStack>(config.link, factory);
+}
+
 void DNP3Channel::SetShutdownHandler(const openpal::Action0& action)
 {
 	shutdownHandler = action;
@@ -188,7 +336,7 @@ template <class T>
 T* DNP3Channel::AddStack(const opendnp3::LinkConfig& link, const std::function<T* ()>& factory)
 {
 	Route route(link.RemoteAddr, link.LocalAddr);
-	if (router.IsRouteInUse(route))
+	if (pRouter->IsRouteInUse(route))
 	{
 		FORMAT_LOG_BLOCK(logger, flags::ERR, "Route already in use: %i -> %i", route.source, route.destination);
 		return nullptr;
@@ -197,8 +345,8 @@ T* DNP3Channel::AddStack(const opendnp3::LinkConfig& link, const std::function<T
 	{
 		auto pStack = factory();
 		stacks.Add(pStack);
-		pStack->SetLinkRouter(router);
-		router.AddContext(&pStack->GetLinkContext(), route);
+		pStack->SetLinkRouter(*pRouter);
+		pRouter->AddContext(&pStack->GetLinkContext(), route);
 		return pStack;
 	}
 }
@@ -35,6 +35,7 @@
 #include "asiodnp3/IChannel.h"
 #include "asiodnp3/StackLifecycle.h"
 #include "asiodnp3/LinkLayerRouter.h"
+#include "asiodnp3/MultiConnectionRouter.h"
 
 #include <memory>
 
@@ -66,19 +67,44 @@ public:
 	    asiopal::ASIOExecutor& executor,
 		const opendnp3::ChannelRetry& retry,
 	    openpal::IPhysicalLayer* pPhys,
-	    openpal::ICryptoProvider* pCrypto
+	    openpal::ICryptoProvider* pCrypto,
+	    uint32_t rxBufferSize
+	);
+
+	/// A channel that accepts any number of connections from the listener and binds each one to a session by route
+	DNP3Channel(
+	    openpal::LogRoot* pLogRoot_,
+	    const opendnp3::ChannelRetry& retry,
+	    asiopal::Listener* pListener,
+	    openpal::ICryptoProvider* pCrypto,
+	    uint32_t rxBufferSize,
+	    const MultiServerSettings& settings
 	);
 
 	// ----------------------- Implement IChannel -----------------------
 
 	virtual opendnp3::LinkChannelStatistics GetChannelStatistics() override final;
 
+	virtual void GetChannelStatisticsAsync(const std::function<void (const opendnp3::LinkChannelStatistics&)>& callback) override final;
+
+	virtual opendnp3::MultidropStatistics GetMultidropStatistics() override final;
+
+	virtual void GetMultidropStatisticsAsync(const std::function<void (const opendnp3::MultidropStatistics&)>& callback) override final;
+
+	virtual ServerStatistics GetServerStatistics() override final;
+
+	virtual void GetServerStatisticsAsync(const std::function<void (const ServerStatistics&)>& callback) override final;
+
 	void Shutdown() override final;
 
 	virtual openpal::LogFilters GetLogFilters() const override final;
 
 	virtual void SetLogFilters(const openpal::LogFilters& filters) override final;
 
+	virtual void GetLogFiltersAsync(const std::function<void (const openpal::LogFilters&)>& callback) const override final;
+
+	virtual void SetLogFiltersAsync(const openpal::LogFilters& filters) override final;
+
 	virtual void AddStateListener(const std::function<void(opendnp3::ChannelState)>& listener) override final;
 
 	virtual IMaster* AddMaster(	char const* id,
@@ -86,13 +112,25 @@ public:
 	                            opendnp3::IMasterApplication& application,
 	                            const opendnp3::MasterStackConfig& config) override final;
 
+	virtual void AddMasterAsync(	char const* id,
+	                                opendnp3::ISOEHandler& SOEHandler,
+	                                opendnp3::IMasterApplication& application,
+	                                const opendnp3::MasterStackConfig& config,
+	                                const std::function<void (IMaster*)>& callback) override final;
 
+	virtual std::vector<IMaster*> AddMasters(const std::vector<MasterSpec>& masters) override final;
 
 	virtual IOutstation* AddOutstation(char const* id,
 	                                   opendnp3::ICommandHandler& commandHandler,
 	                                   opendnp3::IOutstationApplication& application,
 	                                   const opendnp3::OutstationStackConfig& config) override final;
 
+	virtual void AddOutstationAsync(	char const* id,
+	                                    opendnp3::ICommandHandler& commandHandler,
+	                                    opendnp3::IOutstationApplication& application,
+	                                    const opendnp3::OutstationStackConfig& config,
+	                                    const std::function<void (IOutstation*)>& callback) override final;
+
 #ifdef OPENDNP3_USE_SECAUTH
 
 	virtual IMasterSA* AddMasterSA(	char const* id,
@@ -118,17 +156,26 @@ private:
 	template <class T>
 	T* AddStack(const opendnp3::LinkConfig& link, const std::function<T* ()>& factory);
 
+	// ----- must be called on the executor ------
+	IMaster* CreateMaster(char const* id, opendnp3::ISOEHandler& SOEHandler, opendnp3::IMasterApplication& application, const opendnp3::MasterStackConfig& config);
+	IOutstation* CreateOutstation(char const* id, opendnp3::ICommandHandler& commandHandler, opendnp3::IOutstationApplication& application, const opendnp3::OutstationStackConfig& config);
+
 	void InitiateShutdown(asiopal::Synchronized<bool>& handler);
 
 	virtual void OnStateChange(opendnp3::ChannelState state) override final;
 
 	void CheckForFinalShutdown();
 
+	void SetRouterShutdownHandler();
+
+	ServerStatistics ReadServerStatistics();
+
 	opendnp3::MultidropTaskLock taskLock;
 
 	openpal::Action0 shutdownHandler;
 	opendnp3::LinkChannelStatistics statistics;
 	std::unique_ptr<openpal::IPhysicalLayer> pPhys;
+	std::unique_ptr<asiopal::Listener> pListener;
 	openpal::ICryptoProvider* pCrypto;
 	std::unique_ptr<openpal::LogRoot> pLogRoot;
 	asiopal::ASIOExecutor* pExecutor;
@@ -139,7 +186,9 @@ private:
 	opendnp3::ChannelState channelState;
 	std::vector<std::function<void(opendnp3::ChannelState)>> callbacks;
 
-	LinkLayerRouter router;
+	// only set on channels that accept many connections, owned by pRouter
+	MultiConnectionRouter* pMultiRouter;
+	std::unique_ptr<IChannelRouter> pRouter;
 	StackLifecycle stacks;
 
 };
@@ -26,6 +26,10 @@
 #include <asiopal/PhysicalLayerSerial.h>
 #include <asiopal/PhysicalLayerTCPClient.h>
 #include <asiopal/PhysicalLayerTCPServer.h>
+#include <asiopal/TCPListener.h>
+#include <asiopal/PhysicalLayerUDPClient.h>
+#include <asiopal/PhysicalLayerUDPServer.h>
+#include <asiopal/UDPListener.h>
 
 #ifdef OPENDNP3_USE_TLS
 #include <asiopal/tls/PhysicalLayerTLSClient.h>
@@ -44,8 +48,11 @@ DNP3Manager::DNP3Manager(
     uint32_t concurrencyHint,
     openpal::ICryptoProvider* crypto,
     std::function<void()> onThreadStart,
-    std::function<void()> onThreadExit) :
-		impl(new ManagerImpl(crypto, concurrencyHint, onThreadStart, onThreadExit))
+    std::function<void()> onThreadExit,
+    asiopal::ThreadPoolMode mode,
+    asiopal::ShardSelection selection,
+    bool asyncLogging) :
+		impl(new ManagerImpl(crypto, concurrencyHint, onThreadStart, onThreadExit, mode, selection, asyncLogging))
 {
 
 }
@@ -64,6 +71,10 @@ void DNP3Manager::AddLogSubscriber(openpal::ILogHandler* handler)
 void DNP3Manager::Shutdown()
 {
 	impl->channels.Shutdown();
+	if (impl->async)
+	{
+		impl->async->Flush();
+	}
 }
 
 IChannel* DNP3Manager::AddTCPClient(
@@ -72,11 +83,13 @@ IChannel* DNP3Manager::AddTCPClient(
 	const opendnp3::ChannelRetry& retry,
     const std::string& host,
     const std::string& local,
-    uint16_t port)
+    uint16_t port,
+    uint32_t rxBufferSize,
+    const asiopal::SocketOptions& options)
 {
-	auto pRoot = new LogRoot(&impl->fanout, id, levels);
-	auto pPhys = new asiopal::PhysicalLayerTCPClient(*pRoot, impl->threadpool.GetIOService(), host, local, port);
-	return impl->channels.CreateChannel(pRoot, pPhys->executor, retry, pPhys, impl->crypto);
+	auto pRoot = new LogRoot(impl->handler, id, levels);
+	auto pPhys = new asiopal::PhysicalLayerTCPClient(*pRoot, impl->threadpool.Acquire(), host, local, port, options);
+	return impl->channels.CreateChannel(pRoot, pPhys->executor, retry, pPhys, impl->crypto, rxBufferSize);
 }
 
 IChannel* DNP3Manager::AddTCPServer(
@@ -84,22 +97,81 @@ IChannel* DNP3Manager::AddTCPServer(
     uint32_t levels,
 	const opendnp3::ChannelRetry& retry,
     const std::string& endpoint,
-    uint16_t port)
+    uint16_t port,
+    uint32_t rxBufferSize,
+    const asiopal::SocketOptions& options)
 {
-	auto pRoot = new LogRoot(&impl->fanout, id, levels);
-	auto pPhys = new asiopal::PhysicalLayerTCPServer(*pRoot, impl->threadpool.GetIOService(), endpoint, port);
-	return impl->channels.CreateChannel(pRoot, pPhys->executor, retry, pPhys, impl->crypto);
+	auto pRoot = new LogRoot(impl->handler, id, levels);
+	auto pPhys = new asiopal::PhysicalLayerTCPServer(*pRoot, impl->threadpool.Acquire(), endpoint, port, options);
+	return impl->channels.CreateChannel(pRoot, pPhys->executor, retry, pPhys, impl->crypto, rxBufferSize);
+}
+
+IChannel* DNP3Manager::AddTCPMultiServer(
+    char const* id,
+    uint32_t levels,
+	const opendnp3::ChannelRetry& retry,
+    const std::string& endpoint,
+    uint16_t port,
+    uint32_t rxBufferSize,
+    const asiopal::SocketOptions& options,
+    const MultiServerSettings& settings)
+{
+	auto pRoot = new LogRoot(impl->handler, id, levels);
+	auto pListener = new asiopal::TCPListener(*pRoot, impl->threadpool.Acquire(), endpoint, port, options);
+	return impl->channels.CreateChannel(pRoot, retry, pListener, impl->crypto, rxBufferSize, settings);
+}
+
+IChannel* DNP3Manager::AddUDPClient(
+    char const* id,
+    uint32_t levels,
+	const opendnp3::ChannelRetry& retry,
+    const std::string& host,
+    const std::string& local,
+    uint16_t port,
+    uint32_t rxBufferSize)
+{
+	auto pRoot = new LogRoot(impl->handler, id, levels);
+	auto pPhys = new asiopal::PhysicalLayerUDPClient(*pRoot, impl->threadpool.Acquire(), host, local, port);
+	return impl->channels.CreateChannel(pRoot, pPhys->executor, retry, pPhys, impl->crypto, rxBufferSize);
+}
+
+IChannel* DNP3Manager::AddUDPServer(
+    char const* id,
+    uint32_t levels,
+	const opendnp3::ChannelRetry& retry,
+    const std::string& endpoint,
+    uint16_t port,
+    uint32_t rxBufferSize)
+{
+	auto pRoot = new LogRoot(impl->handler, id, levels);
+	auto pPhys = new asiopal::PhysicalLayerUDPServer(*pRoot, impl->threadpool.Acquire(), endpoint, port);
+	return impl->channels.CreateChannel(pRoot, pPhys->executor, retry, pPhys, impl->crypto, rxBufferSize);
+}
+
+IChannel* DNP3Manager::AddUDPMultiServer(
+    char const* id,
+    uint32_t levels,
+	const opendnp3::ChannelRetry& retry,
+    const std::string& endpoint,
+    uint16_t port,
+    uint32_t rxBufferSize,
+    const MultiServerSettings& settings)
+{
+	auto pRoot = new LogRoot(impl->handler, id, levels);
+	auto pListener = new asiopal::UDPListener(*pRoot, impl->threadpool.Acquire(), endpoint, port, settings.peerIdleTimeout);
+	return impl->channels.CreateChannel(pRoot, retry, pListener, impl->crypto, rxBufferSize, settings);
 }
 
 IChannel* DNP3Manager::AddSerial(
 	char const* id,
 	uint32_t levels,
 	const opendnp3::ChannelRetry& retry,
-	asiopal::SerialSettings settings)
+	asiopal::SerialSettings settings,
+	uint32_t rxBufferSize)
 {
-	auto pRoot = new LogRoot(&impl->fanout, id, levels);
-	auto pPhys = new asiopal::PhysicalLayerSerial(*pRoot, impl->threadpool.GetIOService(), settings);
-	return impl->channels.CreateChannel(pRoot, pPhys->executor, retry, pPhys, impl->crypto);
+	auto pRoot = new LogRoot(impl->handler, id, levels);
+	auto pPhys = new asiopal::PhysicalLayerSerial(*pRoot, impl->threadpool.Acquire(), settings);
+	return impl->channels.CreateChannel(pRoot, pPhys->executor, retry, pPhys, impl->crypto, rxBufferSize);
 }
 
 #ifdef OPENDNP3_USE_TLS
@@ -111,11 +183,14 @@ IChannel* DNP3Manager::AddTLSClient(
 	const std::string& host,
 	const std::string& local,
 	uint16_t port,
-	const asiopal::TLSConfig& config)
+	const asiopal::TLSConfig& config,
+	uint32_t rxBufferSize,
+	const asiopal::SocketOptions& options)
 {
-	auto pRoot = new LogRoot(&impl->fanout, id, levels);
-	auto pPhys = new asiopal::PhysicalLayerTLSClient(*pRoot, impl->threadpool.GetIOService(), host, local, port, config);
-	return impl->channels.CreateChannel(pRoot, pPhys->executor, retry, pPhys, impl->crypto);
+	auto context = impl->tlsContexts.Get(config, asiopal::TLSRole::CLIENT);
+	auto pRoot = new LogRoot(impl->handler, id, levels);
+	auto pPhys = new asiopal::PhysicalLayerTLSClient(*pRoot, impl->threadpool.Acquire(), host, local, port, context, options);
+	return impl->channels.CreateChannel(pRoot, pPhys->executor, retry, pPhys, impl->crypto, rxBufferSize);
 }
 
 IChannel* DNP3Manager::AddTLSServer(
@@ -124,11 +199,14 @@ IChannel* DNP3Manager::AddTLSServer(
 	const opendnp3::ChannelRetry& retry,
 	const std::string& endpoint,
 	uint16_t port,
-	const asiopal::TLSConfig& config)
+	const asiopal::TLSConfig& config,
+	uint32_t rxBufferSize,
+	const asiopal::SocketOptions& options)
 {
-	auto pRoot = new LogRoot(&impl->fanout, id, levels);
-	auto pPhys = new asiopal::PhysicalLayerTLSServer(*pRoot, impl->threadpool.GetIOService(), endpoint, port, config);
-	return impl->channels.CreateChannel(pRoot, pPhys->executor, retry, pPhys, impl->crypto);
+	auto context = impl->tlsContexts.Get(config, asiopal::TLSRole::SERVER);
+	auto pRoot = new LogRoot(impl->handler, id, levels);
+	auto pPhys = new asiopal::PhysicalLayerTLSServer(*pRoot, impl->threadpool.Acquire(), endpoint, port, context, options);
+	return impl->channels.CreateChannel(pRoot, pPhys->executor, retry, pPhys, impl->crypto, rxBufferSize);
 }
 
 #endif
@@ -0,0 +1,69 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_ICHANNELROUTER_H
+#define ASIODNP3_ICHANNELROUTER_H
+
+#include <openpal/executor/Action0.h>
+
+#include <opendnp3/Route.h>
+#include <opendnp3/gen/ChannelState.h>
+#include <opendnp3/link/ILinkRouter.h>
+#include <opendnp3/link/ILinkSession.h>
+
+namespace asiodnp3
+{
+
+/**
+* The part of a channel that moves frames between its physical layer(s) and the link sessions bound to it
+*/
+class IChannelRouter : public opendnp3::ILinkRouter
+{
+public:
+
+	virtual ~IChannelRouter() {}
+
+	// called when the router shuts down
+	virtual void SetShutdownHandler(const openpal::Action0& action) = 0;
+
+	// Query to see if a route is in use
+	virtual bool IsRouteInUse(const opendnp3::Route& route) = 0;
+
+	// Ties the lower part of the link layer to the upper part
+	virtual bool AddContext(opendnp3::ILinkSession* pContext, const opendnp3::Route& route) = 0;
+
+	// Begin sending frames to the context
+	virtual bool Enable(opendnp3::ILinkSession* pContext) = 0;
+
+	// Stop sending frames to the context without removing it
+	virtual bool Disable(opendnp3::ILinkSession* pContext) = 0;
+
+	// Remove the context entirely, must be called from the executor
+	virtual bool Remove(opendnp3::ILinkSession* pContext) = 0;
+
+	// Permanently shutdown the router, the shutdown handler runs when it completes
+	virtual void Shutdown() = 0;
+
+	virtual opendnp3::ChannelState GetState() = 0;
+};
+
+}
+
+#endif
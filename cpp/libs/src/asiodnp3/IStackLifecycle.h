@@ -53,6 +53,16 @@ public:
 	*/
 	virtual bool DisableRoute(opendnp3::ILinkSession*) = 0;
 
+	/**
+	*	Invoked from user code. Start the session without blocking, the callback runs on the executor
+	*/
+	virtual void EnableRouteAsync(opendnp3::ILinkSession*, const std::function<void (bool)>& callback) = 0;
+
+	/**
+	*	Invoked from user code. Stop the session without blocking, the callback runs on the executor
+	*/
+	virtual void DisableRouteAsync(opendnp3::ILinkSession*, const std::function<void (bool)>& callback) = 0;
+
 	/**
 	*	Invoked from user code. Synchronously stop the session and then
 	*	asynchronously delete the stack.
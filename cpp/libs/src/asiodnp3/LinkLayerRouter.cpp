@@ -29,8 +29,6 @@
 #include <opendnp3/link/ILinkSession.h>
 #include <opendnp3/link/LinkFrame.h>
 
-#include <algorithm>
-
 using namespace std;
 using namespace openpal;
 using namespace opendnp3;
@@ -42,13 +40,15 @@ LinkLayerRouter::LinkLayerRouter(	openpal::LogRoot& root,
                                     openpal::IExecutor& executor,
                                     IPhysicalLayer* pPhys,
 									const ChannelRetry& retry,
-                                    IChannelStateListener* pStateHandler_,                                   
-                                    LinkChannelStatistics* pStatistics_) :
+                                    IChannelStateListener* pStateHandler_,
+                                    LinkChannelStatistics* pStatistics_,
+                                    uint32_t rxBufferSize) :
 
 	PhysicalLayerMonitor(root, executor, pPhys, retry),
 	pStateHandler(pStateHandler_),
+	numEnabled(0),
 	pStatistics(pStatistics_),
-	parser(logger, pStatistics_),
+	parser(logger, pStatistics_, rxBufferSize),
 	isTransmitting(false)
 {}
 
@@ -59,13 +59,21 @@ void LinkLayerRouter::SetShutdownHandler(const Action0& action)
 
 bool LinkLayerRouter::IsRouteInUse(const Route& route)
 {
-	auto matches = [route](const Record & record)
-	{
-		return record.route.Equals(route);
-	};
+	return routeIndex.find(GetRouteKey(route)) != routeIndex.end();
+}
 
-	auto iter = std::find_if(records.begin(), records.end(), matches);
-	return iter != records.end();
+bool LinkLayerRouter::FindRecord(ILinkSession* pContext, RecordIterator& iter)
+{
+	auto result = sessionIndex.find(pContext);
+	if (result == sessionIndex.end())
+	{
+		return false;
+	}
+	else
+	{
+		iter = result->second;
+		return true;
+	}
 }
 
 bool LinkLayerRouter::AddContext(ILinkSession* pContext, const Route& route)
@@ -78,17 +86,12 @@ bool LinkLayerRouter::AddContext(ILinkSession* pContext, const Route& route)
 	}
 	else
 	{
-		auto matches = [pContext](const Record & record)
-		{
-			return record.pContext == pContext;
-		};
-
-		auto iter = std::find_if(records.begin(), records.end(), matches);
-
-		if (iter == records.end())
+		if (sessionIndex.find(pContext) == sessionIndex.end())
 		{
-			// record is always disabled by default			
-			records.push_back(Record(pContext, route));
+			// record is always disabled by default
+			auto iter = records.insert(records.end(), Record(pContext, route));
+			routeIndex[GetRouteKey(route)] = iter;
+			sessionIndex[pContext] = iter;
 			return true;
 		}
 		else
@@ -101,13 +104,9 @@ bool LinkLayerRouter::AddContext(ILinkSession* pContext, const Route& route)
 
 bool LinkLayerRouter::Enable(ILinkSession* pContext)
 {
-	auto matches = [pContext](const Record & rec)
-	{
-		return rec.pContext == pContext;
-	};
-	auto iter = std::find_if(records.begin(), records.end(), matches);
+	RecordIterator iter;
 
-	if(iter != records.end())
+	if(FindRecord(pContext, iter))
 	{
 		if(iter->enabled)
 		{
@@ -117,6 +116,7 @@ bool LinkLayerRouter::Enable(ILinkSession* pContext)
 		else
 		{
 			iter->enabled = true;
+			++numEnabled;
 
 			if (this->IsOnline())
 			{
@@ -137,18 +137,14 @@ bool LinkLayerRouter::Enable(ILinkSession* pContext)
 
 bool LinkLayerRouter::Disable(ILinkSession* pContext)
 {
-	auto matches = [pContext](const Record & rec)
-	{
-		return rec.pContext == pContext;
-	};
+	RecordIterator iter;
 
-	auto iter = std::find_if(records.begin(), records.end(), matches);
-
-	if (iter != records.end())
+	if (FindRecord(pContext, iter))
 	{
 		if (iter->enabled)
 		{
 			iter->enabled = false;
+			--numEnabled;
 
 			if (this->IsOnline())
 			{
@@ -170,19 +166,22 @@ bool LinkLayerRouter::Disable(ILinkSession* pContext)
 
 bool LinkLayerRouter::Remove(ILinkSession* pContext)
 {
-	auto matches = [pContext](const Record & rec)
-	{
-		return rec.pContext == pContext;
-	};
-	auto iter = std::find_if(records.begin(), records.end(), matches);
+	RecordIterator iter;
 
-	if(iter != records.end())
+	if(FindRecord(pContext, iter))
 	{
-		if (this->GetState() == ChannelState::OPEN && iter->enabled)
+		if (iter->enabled)
 		{
-			iter->pContext->OnLowerLayerDown();
+			--numEnabled;
+
+			if (this->GetState() == ChannelState::OPEN)
+			{
+				iter->pContext->OnLowerLayerDown();
+			}
 		}
 
+		routeIndex.erase(GetRouteKey(iter->route));
+		sessionIndex.erase(pContext);
 		records.erase(iter);
 
 		// if no contexts are enabled, suspend the router
@@ -201,18 +200,14 @@ bool LinkLayerRouter::Remove(ILinkSession* pContext)
 
 ILinkSession* LinkLayerRouter::GetEnabledContext(const Route& route)
 {
-	auto matches = [route](const Record & rec)
-	{
-		return rec.enabled && rec.route.Equals(route);
-	};
-	auto iter = std::find_if(records.begin(), records.end(), matches);
-	if (iter == records.end())
+	auto result = routeIndex.find(GetRouteKey(route));
+	if (result == routeIndex.end() || !result->second->enabled)
 	{
 		return nullptr;
 	}
 	else
 	{
-		return iter->pContext;
+		return result->second->pContext;
 	}
 }
 
@@ -290,12 +285,7 @@ void LinkLayerRouter::OnShutdown()
 
 bool LinkLayerRouter::HasEnabledContext()
 {
-	auto matches = [](const Record & rec)
-	{
-		return rec.enabled;
-	};
-	auto iter = std::find_if(records.begin(), records.end(), matches);
-	return iter != records.end();
+	return numEnabled > 0;
 }
 
 void LinkLayerRouter::OnSendResult(bool result)
@@ -314,8 +304,12 @@ void LinkLayerRouter::CheckForSend()
 {
 	if (!transmitQueue.empty() && !isTransmitting && pPhys->CanWrite())
 	{
-		if (pStatistics) ++pStatistics->numLinkFrameTx;
 		auto tx = transmitQueue.front();
+		if (pStatistics)
+		{
+			// a single write may carry several back-to-back frames
+			pStatistics->numLinkFrameTx += LinkFrame::CountFrames(tx.buffer);
+		}
 		isTransmitting = true;
 		pPhys->BeginWrite(tx.buffer);
 	}
@@ -22,16 +22,17 @@
 #define ASIODNP3_LINKLAYERROUTER_H
 
 #include "asiodnp3/PhysicalLayerMonitor.h"
+#include "asiodnp3/IChannelRouter.h"
 
 #include <opendnp3/Route.h>
 #include <opendnp3/link/LinkLayerParser.h>
 #include <opendnp3/link/IFrameSink.h>
-#include <opendnp3/link/ILinkRouter.h>
 #include <opendnp3/link/ChannelRetry.h>
 #include <opendnp3/link/IChannelStateListener.h>
 
-#include <vector>
+#include <list>
 #include <deque>
+#include <unordered_map>
 
 namespace openpal
 {
@@ -52,7 +53,7 @@ namespace asiodnp3
 // Implements the parsing and de-multiplexing portion of
 // of DNP 3 Data Link Layer. PhysicalLayerMonitor inherits
 // from IHandler, which inherits from IUpperLayer
-class LinkLayerRouter : public asiodnp3::PhysicalLayerMonitor, public opendnp3::ILinkRouter, private opendnp3::IFrameSink
+class LinkLayerRouter : public asiodnp3::PhysicalLayerMonitor, public IChannelRouter, private opendnp3::IFrameSink
 {
 public:
 
@@ -60,33 +61,44 @@ public:
 	                openpal::IExecutor& executor,
 	                openpal::IPhysicalLayer*,
 					const opendnp3::ChannelRetry& retry,
-	                opendnp3::IChannelStateListener* pStateHandler = nullptr,	                
-	                opendnp3::LinkChannelStatistics* pStatistics = nullptr);
+	                opendnp3::IChannelStateListener* pStateHandler = nullptr,
+	                opendnp3::LinkChannelStatistics* pStatistics = nullptr,
+	                uint32_t rxBufferSize = opendnp3::LPDU_MAX_FRAME_SIZE);
 
 	// called when the router shuts down
-	void SetShutdownHandler(const openpal::Action0& action);
+	virtual void SetShutdownHandler(const openpal::Action0& action) override final;
 
 	// Query to see if a route is in use
-	bool IsRouteInUse(const opendnp3::Route& route);
+	virtual bool IsRouteInUse(const opendnp3::Route& route) override final;
 
 	// Ties the lower part of the link layer to the upper part
-	bool AddContext(opendnp3::ILinkSession* pContext, const opendnp3::Route& route);
+	virtual bool AddContext(opendnp3::ILinkSession* pContext, const opendnp3::Route& route) override final;
 
 	/**
 	*  Tells the router to begin sending messages to the context
 	*/
-	bool Enable(opendnp3::ILinkSession* pContext);
+	virtual bool Enable(opendnp3::ILinkSession* pContext) override final;
 
 	/**
 	*  Tells the router to stop sending messages to the context associated with this route
 	*  Does not remove the context entirely
 	*/
-	bool Disable(opendnp3::ILinkSession* pContext);
+	virtual bool Disable(opendnp3::ILinkSession* pContext) override final;
 
 	/**
 	* This is safe to do at runtime, so long as the request happens from the executor
 	*/
-	bool Remove(opendnp3::ILinkSession* pContext);
+	virtual bool Remove(opendnp3::ILinkSession* pContext) override final;
+
+	virtual void Shutdown() override final
+	{
+		PhysicalLayerMonitor::Shutdown();
+	}
+
+	virtual opendnp3::ChannelState GetState() override final
+	{
+		return PhysicalLayerMonitor::GetState();
+	}
 
 	// ------------ IFrameSink -----------------
 	virtual bool OnFrame(const opendnp3::LinkHeaderFields& header, const openpal::RSlice& userdata) override final;
@@ -140,6 +152,16 @@ private:
 		opendnp3::ILinkSession* pContext;
 	};
 
+	typedef std::list<Record>::iterator RecordIterator;
+
+	// packs the source and destination of a route into a single hash key
+	static uint32_t GetRouteKey(const opendnp3::Route& route)
+	{
+		return (static_cast<uint32_t>(route.source) << 16) | route.destination;
+	}
+
+	bool FindRecord(opendnp3::ILinkSession* pContext, RecordIterator& iter);
+
 	opendnp3::ILinkSession* GetDestination(uint16_t aDest, uint16_t aSrc);
 	opendnp3::ILinkSession* GetEnabledContext(const opendnp3::Route&);
 
@@ -148,7 +170,12 @@ private:
 	opendnp3::IChannelStateListener* pStateHandler;
 	openpal::Action0 shutdownHandler;
 
-	std::vector<Record> records;
+	// records are kept in the order they were added, the maps index them by route and by session
+	std::list<Record> records;
+	std::unordered_map<uint32_t, RecordIterator> routeIndex;
+	std::unordered_map<opendnp3::ILinkSession*, RecordIterator> sessionIndex;
+	uint32_t numEnabled;
+
 	std::deque<Transmission>  transmitQueue;
 
 	// Handles the parsing of incoming frames
@@ -27,11 +27,18 @@
 #include <openpal/crypto/ICryptoProvider.h>
 #include <openpal/util/Uncopyable.h>
 
+#include <asiopal/AsyncLogHandler.h>
 #include <asiopal/LogFanoutHandler.h>
 #include <asiopal/IOServiceThreadPool.h>
 
+#ifdef OPENDNP3_USE_TLS
+#include <asiopal/tls/TLSContextCache.h>
+#endif
+
 #include <opendnp3/LogLevels.h>
 
+#include <memory>
+
 #include "asiodnp3/ChannelSet.h"
 
 namespace asiodnp3
@@ -46,18 +53,45 @@ public:
 			openpal::ICryptoProvider* crypto_,
 			uint32_t concurrencyHint,			
 			std::function<void()> onThreadStart,
-			std::function<void()> onThreadExit
+			std::function<void()> onThreadExit,
+			asiopal::ThreadPoolMode mode,
+			asiopal::ShardSelection selection,
+			bool asyncLogging
 		) :
 		crypto(crypto_),
 		fanout(),
-		threadpool(&fanout, opendnp3::flags::INFO, concurrencyHint, onThreadStart, onThreadExit),
-		channels()
+		async(asyncLogging ? new asiopal::AsyncLogHandler() : nullptr),
+		handler(GetLogHandler()),
+		threadpool(handler, opendnp3::flags::INFO, concurrencyHint, onThreadStart, onThreadExit, mode, selection),
+		channels(threadpool)
 	{}
 
 	openpal::ICryptoProvider* crypto;
 	asiopal::LogFanoutHandler fanout;
+	// optional, formats and delivers log messages to the fanout from a background thread
+	std::unique_ptr<asiopal::AsyncLogHandler> async;
+	// what channels log to, the async handler if enabled, otherwise the fanout
+	openpal::ILogHandler* const handler;
 	asiopal::IOServiceThreadPool threadpool;
 	ChannelSet channels;
+
+#ifdef OPENDNP3_USE_TLS
+	// declared after the channels so that it outlives any context they hold
+	asiopal::TLSContextCache tlsContexts;
+#endif
+
+private:
+
+	openpal::ILogHandler* GetLogHandler()
+	{
+		if (async)
+		{
+			async->Subscribe(&fanout);
+			return async.get();
+		}
+
+		return &fanout;
+	}
 };
 
 }
@@ -31,6 +31,7 @@
 #include "asiodnp3/IStackLifecycle.h"
 #include "asiodnp3/IMaster.h"
 #include "asiodnp3/ILinkBind.h"
+#include "asiodnp3/StackMetricsRecorder.h"
 
 #include "Conversions.h"
 
@@ -58,7 +59,10 @@ public:
 		pASIOExecutor(&executor),
 		pContext(nullptr)
 	{
-
+		if (config.metrics.recordStrandQueueDelay)
+		{
+			executor.RecordPostDelay();
+		}
 	}
 
 	virtual ~MasterStackBase() {}
@@ -73,6 +77,16 @@ public:
 		return pLifecycle->DisableRoute(&stack.link);
 	}
 
+	virtual void EnableAsync(const std::function<void (bool)>& callback) override final
+	{
+		pLifecycle->EnableRouteAsync(&stack.link, callback);
+	}
+
+	virtual void DisableAsync(const std::function<void (bool)>& callback) override final
+	{
+		pLifecycle->DisableRouteAsync(&stack.link, callback);
+	}
+
 	virtual void Shutdown() override final
 	{
 		return pLifecycle->Shutdown(&stack.link, this);
@@ -87,6 +101,22 @@ public:
 		return pLifecycle->GetExecutor().ReturnBlockFor<opendnp3::StackStatistics>(get);
 	}
 
+	virtual void GetStackStatisticsAsync(const StackStatisticsCallbackT& callback) override final
+	{
+		auto get = [this]()
+		{
+			return this->statistics;
+		};
+		pLifecycle->GetExecutor().ReturnAsyncFor<opendnp3::StackStatistics>(get, callback);
+	}
+
+	virtual opendnp3::StackMetrics GetStackMetrics() override final
+	{
+		auto snapshot = metrics.Get();
+		snapshot.strandQueueDelay = pLifecycle->GetExecutor().GetPostDelay();
+		return snapshot;
+	}
+
 	// ------- Periodic scan API ---------
 
 	virtual opendnp3::MasterScan AddScan(openpal::TimeDuration period, const std::vector<opendnp3::Header>& headers, const opendnp3::TaskConfig& config) override final
@@ -126,6 +156,43 @@ public:
 		return pLifecycle->GetExecutor().ReturnBlockFor<opendnp3::MasterScan>(add);
 	}
 
+	virtual void AddScanAsync(openpal::TimeDuration period, const std::vector<opendnp3::Header>& headers, const ScanCallbackT& callback, const opendnp3::TaskConfig& config) override final
+	{
+		auto builder = ConvertToLambda(headers);
+		auto add = [this, builder, period, config]()
+		{
+			return this->pContext->AddScan(period, builder, config);
+		};
+		pLifecycle->GetExecutor().ReturnAsyncFor<opendnp3::MasterScan>(add, callback);
+	}
+
+	virtual void AddAllObjectsScanAsync(opendnp3::GroupVariationID gvId, openpal::TimeDuration period, const ScanCallbackT& callback, const opendnp3::TaskConfig& config) override final
+	{
+		auto add = [this, gvId, period, config]()
+		{
+			return this->pContext->AddAllObjectsScan(gvId, period, config);
+		};
+		pLifecycle->GetExecutor().ReturnAsyncFor<opendnp3::MasterScan>(add, callback);
+	}
+
+	virtual void AddClassScanAsync(const opendnp3::ClassField& field, openpal::TimeDuration period, const ScanCallbackT& callback, const opendnp3::TaskConfig& config) override final
+	{
+		auto add = [this, field, period, config]()
+		{
+			return this->pContext->AddClassScan(field, period, config);
+		};
+		pLifecycle->GetExecutor().ReturnAsyncFor<opendnp3::MasterScan>(add, callback);
+	}
+
+	virtual void AddRangeScanAsync(opendnp3::GroupVariationID gvId, uint16_t start, uint16_t stop, openpal::TimeDuration period, const ScanCallbackT& callback, const opendnp3::TaskConfig& config) override final
+	{
+		auto add = [this, gvId, start, stop, period, config]()
+		{
+			return this->pContext->AddRangeScan(gvId, start, stop, period, config);
+		};
+		pLifecycle->GetExecutor().ReturnAsyncFor<opendnp3::MasterScan>(add, callback);
+	}
+
 	// ------- Adhoc scan API ---------
 
 	virtual void Scan(const std::vector<opendnp3::Header>& headers, const opendnp3::TaskConfig& config) override final
@@ -133,9 +200,9 @@ public:
 		auto builder = ConvertToLambda(headers);
 		auto add = [this, builder, config]()
 		{
-			return this->pContext->Scan(builder, config);
+			this->pContext->Scan(builder, config);
 		};
-		return pLifecycle->GetExecutor().BlockFor(add);
+		pLifecycle->GetExecutor().Enqueue(add);
 	}
 
 	virtual void ScanAllObjects(opendnp3::GroupVariationID gvId, const opendnp3::TaskConfig& config) override final
@@ -144,7 +211,7 @@ public:
 		{
 			this->pContext->ScanAllObjects(gvId, config);
 		};
-		return pLifecycle->GetExecutor().BlockFor(add);
+		pLifecycle->GetExecutor().Enqueue(add);
 	}
 
 	virtual void ScanClasses(const opendnp3::ClassField& field, const opendnp3::TaskConfig& config) override final
@@ -153,7 +220,7 @@ public:
 		{
 			this->pContext->ScanClasses(field, config);
 		};
-		return pLifecycle->GetExecutor().BlockFor(add);
+		pLifecycle->GetExecutor().Enqueue(add);
 	}
 
 	virtual void ScanRange(opendnp3::GroupVariationID gvId, uint16_t start, uint16_t stop, const opendnp3::TaskConfig& config) override final
@@ -162,7 +229,7 @@ public:
 		{
 			this->pContext->ScanRange(gvId, start, stop, config);
 		};
-		return pLifecycle->GetExecutor().BlockFor(add);
+		pLifecycle->GetExecutor().Enqueue(add);
 	}
 
 	// ------- Other adhoc methods -------
@@ -173,7 +240,7 @@ public:
 		{
 			this->pContext->Write(value, index, config);
 		};
-		return pLifecycle->GetExecutor().BlockFor(add);
+		pLifecycle->GetExecutor().Enqueue(add);
 	}
 
 	virtual void Restart(opendnp3::RestartType op, const opendnp3::RestartOperationCallbackT& callback, opendnp3::TaskConfig config) override final
@@ -182,7 +249,7 @@ public:
 		{
 			this->pContext->Restart(op, callback, config);
 		};
-		return pLifecycle->GetExecutor().BlockFor(add);
+		pLifecycle->GetExecutor().Enqueue(add);
 	}
 
 	virtual void PerformFunction(const std::string& name, opendnp3::FunctionCode fc, const std::vector<opendnp3::Header>& headers, const opendnp3::TaskConfig& config) override final
@@ -192,7 +259,7 @@ public:
 		{
 			this->pContext->PerformFunction(name, fc, builder, config);
 		};
-		return pLifecycle->GetExecutor().BlockFor(add);
+		pLifecycle->GetExecutor().Enqueue(add);
 	}
 
 	// ------- implement ILinkBind ---------
@@ -221,7 +288,7 @@ public:
 			this->pContext->SelectAndOperate(std::move(*set), callback, config);
 		};
 			
-		this->pASIOExecutor->strand.post(action);		
+		this->pASIOExecutor->Enqueue(action);		
 	}
 
 	virtual void DirectOperate(opendnp3::CommandSet&& commands, const opendnp3::CommandCallbackT& callback, const opendnp3::TaskConfig& config) override final
@@ -234,7 +301,7 @@ public:
 			this->pContext->DirectOperate(std::move(*set), callback, config);
 		};
 
-		this->pASIOExecutor->strand.post(action);
+		this->pASIOExecutor->Enqueue(action);
 	}
 	
 protected:	
@@ -244,10 +311,13 @@ protected:
 		assert(pContext == nullptr);
 		this->pContext = &context;
 		this->stack.transport.SetAppLayer(&context);
+		this->stack.link.SetMetricsListener(&metrics);
+		context.SetMetricsListener(&metrics);
 	}
 
 	openpal::LogRoot root;
 	opendnp3::StackStatistics statistics;
+	StackMetricsRecorder metrics;
 	IStackLifecycle* pLifecycle;
 	opendnp3::TransportStack stack;
 	asiopal::ASIOExecutor* pASIOExecutor;
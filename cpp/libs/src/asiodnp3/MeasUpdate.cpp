@@ -35,11 +35,7 @@ namespace asiodnp3
 template <class T>
 void MeasUpdate::UpdateAny(const T& meas, uint16_t index, opendnp3::EventMode mode)
 {
-	auto update = [ = ](opendnp3::IDatabase & db)
-	{
-		db.Update(meas, index, mode);
-	};
-	pChanges->Add(update);
+	pChanges->Update(UpdateRecord(meas, index, mode));
 }
 
 template <class T>
@@ -54,32 +50,15 @@ void MeasUpdate::ModifyAny(const openpal::Function1<const T&, T>& modify, uint16
   
 MeasUpdate::MeasUpdate(IOutstation* pOutstation_) :
 	pOutstation(pOutstation_),
-	pChanges(new ChangeSet())
+	pChanges(pOutstation_->AcquireChanges())
 {
 
 }
 
 MeasUpdate::~MeasUpdate()
 {
-	if (pChanges->IsEmpty())
-	{
-		// The user didn't add anything, just delete it here
-		delete pChanges;
-	}
-	else
-	{
-		auto pChangeSet = pChanges;
-		auto pOut = pOutstation;
-
-		auto update = [pChangeSet, pOut]()
-		{
-			pChangeSet->ApplyAll(pOut->GetDatabase());
-			delete pChangeSet;
-			pOut->CheckForUpdates();
-		};
-
-		pOutstation->GetExecutor().PostLambda(update);
-	}
+	// the outstation applies the changes and then recycles the change set
+	pOutstation->Apply(pChanges);
 }
 
 void MeasUpdate::Update(const Binary& meas, uint16_t index, EventMode mode)
@@ -119,11 +98,7 @@ void MeasUpdate::Update(const AnalogOutputStatus& meas, uint16_t index, EventMod
 
 void MeasUpdate::Update(const TimeAndInterval& meas, uint16_t index)
 {
-	auto update = [ = ](IDatabase & db)
-	{
-		db.Update(meas, index);
-	};
-	pChanges->Add(update);
+	pChanges->Update(UpdateRecord(meas, index, EventMode::Detect));
 }
 
 void MeasUpdate::Modify(const openpal::Function1<const Binary&, Binary>& modify, uint16_t index, EventMode mode)
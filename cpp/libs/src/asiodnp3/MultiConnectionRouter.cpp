@@ -0,0 +1,659 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "MultiConnectionRouter.h"
+
+#include <assert.h>
+
+#include <openpal/logging/LogMacros.h>
+
+#include <opendnp3/LogLevels.h>
+#include <opendnp3/ErrorCodes.h>
+#include <opendnp3/link/LinkFrame.h>
+
+#include <algorithm>
+
+using namespace openpal;
+using namespace opendnp3;
+
+namespace asiodnp3
+{
+
+MultiConnectionRouter::MultiConnectionRouter(
+    openpal::LogRoot& root,
+    asiopal::Listener& listener,
+    const ChannelRetry& retry_,
+    IChannelStateListener* pStateHandler_,
+    LinkChannelStatistics* pStatistics_,
+    uint32_t rxBufferSize_,
+    const MultiServerSettings& settings_) :
+
+	pRoot(&root),
+	logger(root.GetLogger()),
+	pListener(&listener),
+	pExecutor(&listener.executor),
+	retry(retry_),
+	currentRetry(retry_.minOpenRetry),
+	listenTimer(listener.executor),
+	pStateHandler(pStateHandler_),
+	pStatistics(pStatistics_),
+	rxBufferSize(rxBufferSize_),
+	settings(settings_),
+	state(ChannelState::CLOSED),
+	isShutdown(false),
+	isAccepting(false),
+	numPendingDelete(0),
+	numUnbound(0)
+{
+
+}
+
+MultiConnectionRouter::~MultiConnectionRouter()
+{
+	assert(connections.empty());
+}
+
+void MultiConnectionRouter::SetShutdownHandler(const Action0& action)
+{
+	this->shutdownHandler = action;
+}
+
+bool MultiConnectionRouter::IsRouteInUse(const Route& route)
+{
+	return routeIndex.find(GetRouteKey(route)) != routeIndex.end();
+}
+
+bool MultiConnectionRouter::FindRecord(ILinkSession* pContext, RecordIterator& iter)
+{
+	auto result = sessionIndex.find(pContext);
+	if (result == sessionIndex.end())
+	{
+		return false;
+	}
+	else
+	{
+		iter = result->second;
+		return true;
+	}
+}
+
+bool MultiConnectionRouter::AddContext(ILinkSession* pContext, const Route& route)
+{
+	assert(pContext != nullptr);
+
+	if (IsRouteInUse(route))
+	{
+		return false;
+	}
+
+	if (sessionIndex.find(pContext) != sessionIndex.end())
+	{
+		SIMPLE_LOG_BLOCK(logger, flags::ERR, "Context cannot be bound 2x");
+		return false;
+	}
+
+	// record is always disabled by default
+	auto iter = records.insert(records.end(), Record(pContext, route));
+	routeIndex[GetRouteKey(route)] = iter;
+	sessionIndex[pContext] = iter;
+	return true;
+}
+
+bool MultiConnectionRouter::Enable(ILinkSession* pContext)
+{
+	RecordIterator iter;
+
+	if (!FindRecord(pContext, iter))
+	{
+		return false;
+	}
+
+	iter->enabled = true;
+
+	if (state == ChannelState::CLOSED && !isShutdown)
+	{
+		this->StartListening();
+	}
+
+	return true;
+}
+
+bool MultiConnectionRouter::Disable(ILinkSession* pContext)
+{
+	RecordIterator iter;
+
+	if (!FindRecord(pContext, iter))
+	{
+		return false;
+	}
+
+	iter->enabled = false;
+
+	if (iter->pConnection)
+	{
+		this->Unbind(*iter);
+	}
+
+	return true;
+}
+
+bool MultiConnectionRouter::Remove(ILinkSession* pContext)
+{
+	RecordIterator iter;
+
+	if (!FindRecord(pContext, iter))
+	{
+		return false;
+	}
+
+	if (iter->pConnection)
+	{
+		this->Unbind(*iter);
+	}
+
+	routeIndex.erase(GetRouteKey(iter->route));
+	sessionIndex.erase(pContext);
+	records.erase(iter);
+	return true;
+}
+
+void MultiConnectionRouter::Shutdown()
+{
+	if (isShutdown)
+	{
+		return;
+	}
+
+	isShutdown = true;
+	listenTimer.Cancel();
+
+	if (pListener->IsListening())
+	{
+		pListener->Close();
+	}
+
+	// closing a connection can remove it from the map
+	std::vector<Connection*> open;
+	for (auto& pair : connections)
+	{
+		open.push_back(pair.second.get());
+	}
+
+	for (auto pConnection : open)
+	{
+		pConnection->Close();
+	}
+
+	this->CheckForShutdown();
+}
+
+void MultiConnectionRouter::BeginTransmit(const openpal::RSlice& buffer, ILinkSession* pContext)
+{
+	RecordIterator iter;
+
+	if (FindRecord(pContext, iter) && iter->pConnection)
+	{
+		iter->pConnection->Transmit(buffer, pContext);
+	}
+	else
+	{
+		SIMPLE_LOG_BLOCK(logger, flags::ERR, "Router received transmit request for a session without a connection");
+	}
+}
+
+ServerStatistics MultiConnectionRouter::GetServerStatistics()
+{
+	auto stats = counters;
+	auto now = pExecutor->GetTime();
+
+	stats.connections.reserve(connections.size());
+	for (auto& pair : connections)
+	{
+		stats.connections.push_back(pair.second->GetStatistics(now));
+	}
+
+	return stats;
+}
+
+void MultiConnectionRouter::StartListening()
+{
+	auto ec = pListener->Listen();
+	if (ec)
+	{
+		FORMAT_LOG_BLOCK(logger, flags::WARN, "Unable to listen: %s", ec.message().c_str());
+
+		++counters.numListenFail;
+		if (pStatistics)
+		{
+			++pStatistics->numOpenFail;
+		}
+
+		this->StartListenTimer();
+	}
+	else
+	{
+		currentRetry = retry.minOpenRetry;
+		this->ChangeState(ChannelState::OPEN);
+		this->BeginAccept();
+	}
+}
+
+void MultiConnectionRouter::StartListenTimer()
+{
+	this->ChangeState(ChannelState::WAITING);
+
+	auto expired = [this]()
+	{
+		this->OnListenTimerExpiration();
+	};
+	listenTimer.Start(currentRetry, expired);
+	currentRetry = retry.strategy.GetNextDelay(currentRetry, retry.maxOpenRetry);
+}
+
+void MultiConnectionRouter::OnListenTimerExpiration()
+{
+	if (!isShutdown)
+	{
+		this->StartListening();
+	}
+}
+
+void MultiConnectionRouter::BeginAccept()
+{
+	auto callback = [this](const std::error_code & ec, asiopal::PhysicalLayerPeer * pPhys)
+	{
+		this->OnAccept(ec, pPhys);
+	};
+
+	isAccepting = true;
+	pListener->BeginAccept(callback);
+}
+
+void MultiConnectionRouter::OnAccept(const std::error_code& ec, asiopal::PhysicalLayerPeer* pPhys)
+{
+	isAccepting = false;
+
+	if (isShutdown)
+	{
+		// an accept can complete successfully after the acceptor was closed
+		delete pPhys;
+		this->CheckForShutdown();
+		return;
+	}
+
+	if (ec)
+	{
+		// i.e. the process ran out of file descriptors, listen again after a delay
+		FORMAT_LOG_BLOCK(logger, flags::WARN, "Error accepting connection: %s", ec.message().c_str());
+		pListener->Close();
+		this->StartListenTimer();
+		return;
+	}
+
+	++counters.numAccept;
+	auto id = counters.numAccept;
+
+	if (numUnbound >= settings.maxUnbound)
+	{
+		FORMAT_LOG_BLOCK(logger, flags::WARN, "Closing connection %u from %s, %u connections are already waiting to be bound", id, pPhys->GetRemoteAddress().c_str(), settings.maxUnbound);
+		++counters.numUnboundLimit;
+		++counters.numClose;
+		delete pPhys;
+		this->BeginAccept();
+		return;
+	}
+
+	FORMAT_LOG_BLOCK(logger, flags::INFO, "Accepted connection %u from %s", id, pPhys->GetRemoteAddress().c_str());
+
+	pPhys->SetChannelStatistics(pStatistics);
+
+	auto pConnection = new Connection(*this, id, pPhys, pExecutor->GetTime());
+	connections[id] = std::unique_ptr<Connection>(pConnection);
+	++numUnbound;
+	pConnection->Open();
+
+	this->BeginAccept();
+}
+
+bool MultiConnectionRouter::OnFrame(Connection& connection, const LinkHeaderFields& header, const openpal::RSlice& userdata)
+{
+	Route route(header.src, header.dest);
+
+	auto result = routeIndex.find(GetRouteKey(route));
+	if (result == routeIndex.end() || !result->second->enabled)
+	{
+		FORMAT_LOG_BLOCK_WITH_CODE(logger, flags::WARN, DLERR_UNKNOWN_ROUTE, "Frame w/ unknown route, source: %i, dest %i", route.source, route.destination);
+
+		if (connection.sessions.empty())
+		{
+			FORMAT_LOG_BLOCK(logger, flags::INFO, "Closing connection %u, its first frame matches no session", connection.id);
+			++counters.numRejected;
+			connection.Close();
+		}
+
+		return false;
+	}
+
+	auto& record = *result->second;
+	if (record.pConnection != &connection)
+	{
+		if (record.pConnection && !this->CanRebind(record))
+		{
+			FORMAT_LOG_BLOCK(logger, flags::WARN, "Dropping frame for route %i -> %i from connection %u, the route is bound to active connection %u", route.source, route.destination, connection.id, record.pConnection->id);
+			++counters.numRebindRefused;
+			return false;
+		}
+
+		this->Bind(record, connection);
+	}
+
+	return record.pContext->OnFrame(header, userdata);
+}
+
+bool MultiConnectionRouter::CanRebind(const Record& record)
+{
+	return record.pConnection->IsInactive(pExecutor->GetTime(), settings.rebindIdleTimeout);
+}
+
+void MultiConnectionRouter::Bind(Record& record, Connection& connection)
+{
+	if (record.pConnection)
+	{
+		// the peer reconnected before its old connection was found to be dead
+		FORMAT_LOG_BLOCK(logger, flags::INFO, "Route %i -> %i moved from connection %u to %u", record.route.source, record.route.destination, record.pConnection->id, connection.id);
+		++counters.numRebind;
+		this->Unbind(record);
+	}
+
+	if (connection.sessions.empty())
+	{
+		connection.StopBindTimer();
+		--numUnbound;
+	}
+
+	record.pConnection = &connection;
+	connection.sessions.push_back(record.pContext);
+	record.pContext->OnLowerLayerUp();
+}
+
+void MultiConnectionRouter::Unbind(Record& record)
+{
+	auto pConnection = record.pConnection;
+	record.pConnection = nullptr;
+
+	pConnection->Unbind(record.pContext);
+	record.pContext->OnLowerLayerDown();
+
+	if (pConnection->sessions.empty())
+	{
+		++numUnbound;
+		pConnection->Close();
+	}
+}
+
+void MultiConnectionRouter::OnConnectionClosed(Connection& connection)
+{
+	FORMAT_LOG_BLOCK(logger, flags::INFO, "Connection %u closed", connection.id);
+
+	++counters.numClose;
+
+	if (connection.sessions.empty())
+	{
+		--numUnbound;
+	}
+
+	auto sessions = connection.sessions;
+	connection.sessions.clear();
+
+	for (auto pContext : sessions)
+	{
+		RecordIterator iter;
+		if (FindRecord(pContext, iter))
+		{
+			iter->pConnection = nullptr;
+			pContext->OnLowerLayerDown();
+		}
+	}
+
+	// the connection is still on the call stack, so delete it from the executor
+	auto pConnection = connections[connection.id].release();
+	connections.erase(connection.id);
+	++numPendingDelete;
+
+	auto destroy = [this, pConnection]()
+	{
+		delete pConnection;
+		--numPendingDelete;
+		this->CheckForShutdown();
+	};
+	pExecutor->PostLambda(destroy);
+}
+
+void MultiConnectionRouter::OnBindTimeout(Connection& connection)
+{
+	FORMAT_LOG_BLOCK(logger, flags::INFO, "Closing connection %u, it wasn't bound to a session in time", connection.id);
+	++counters.numBindTimeout;
+	connection.Close();
+}
+
+void MultiConnectionRouter::ChangeState(ChannelState state_)
+{
+	if (state != state_)
+	{
+		state = state_;
+		if (pStateHandler)
+		{
+			pStateHandler->OnStateChange(state);
+		}
+	}
+}
+
+void MultiConnectionRouter::CheckForShutdown()
+{
+	if (isShutdown && state != ChannelState::SHUTDOWN && !isAccepting && connections.empty() && numPendingDelete == 0)
+	{
+		this->ChangeState(ChannelState::SHUTDOWN);
+		shutdownHandler.Apply();
+	}
+}
+
+// ------------ Connection -----------------
+
+MultiConnectionRouter::Connection::Connection(MultiConnectionRouter& router, uint32_t id_, asiopal::PhysicalLayerPeer* pPhys_, const MonotonicTimestamp& acceptTime_) :
+	id(id_),
+	pRouter(&router),
+	pPhys(pPhys_),
+	parser(router.logger, router.pStatistics, router.rxBufferSize),
+	bindTimer(*router.pExecutor),
+	isTransmitting(false),
+	isClosing(false),
+	isClosed(false),
+	acceptTime(acceptTime_),
+	lastRxTime(acceptTime_),
+	numBytesRx(0),
+	numBytesTx(0),
+	numLinkFrameRx(0),
+	numLinkFrameTx(0)
+{
+	pPhys->SetHandler(this);
+}
+
+void MultiConnectionRouter::Connection::Open()
+{
+	if (!(pRouter->settings.bindTimeout == TimeDuration::Max()))
+	{
+		auto expired = [this]()
+		{
+			pRouter->OnBindTimeout(*this);
+		};
+		bindTimer.Start(pRouter->settings.bindTimeout, expired);
+	}
+
+	pPhys->BeginOpen();
+}
+
+void MultiConnectionRouter::Connection::Close()
+{
+	isClosing = true;
+
+	if (pPhys->CanClose())
+	{
+		pPhys->BeginClose();
+	}
+}
+
+void MultiConnectionRouter::Connection::StopBindTimer()
+{
+	bindTimer.Cancel();
+}
+
+void MultiConnectionRouter::Connection::Transmit(const openpal::RSlice& buffer, ILinkSession* pContext)
+{
+	transmitQueue.push_back(Transmission(buffer, pContext));
+	this->CheckForSend();
+}
+
+void MultiConnectionRouter::Connection::Unbind(ILinkSession* pContext)
+{
+	sessions.erase(std::remove(sessions.begin(), sessions.end(), pContext), sessions.end());
+
+	// a write that is in flight stays at the front of the queue, but its result is no longer reported
+	auto begin = isTransmitting ? transmitQueue.begin() + 1 : transmitQueue.begin();
+	transmitQueue.erase(
+	    std::remove_if(begin, transmitQueue.end(), [pContext](const Transmission & tx)
+	{
+		return tx.pContext == pContext;
+	}),
+	transmitQueue.end());
+
+	if (isTransmitting && transmitQueue.front().pContext == pContext)
+	{
+		transmitQueue.front().pContext = nullptr;
+	}
+}
+
+ConnectionStatistics MultiConnectionRouter::Connection::GetStatistics(const MonotonicTimestamp& now) const
+{
+	ConnectionStatistics stats;
+	stats.id = id;
+	stats.remoteAddress = pPhys->GetRemoteAddress();
+	stats.numSessions = static_cast<uint32_t>(sessions.size());
+	stats.uptimeMs = (now.milliseconds > acceptTime.milliseconds) ? (now.milliseconds - acceptTime.milliseconds) : 0;
+	stats.numBytesRx = numBytesRx;
+	stats.numBytesTx = numBytesTx;
+	stats.numLinkFrameRx = numLinkFrameRx;
+	stats.numLinkFrameTx = numLinkFrameTx;
+	return stats;
+}
+
+bool MultiConnectionRouter::Connection::IsInactive(const MonotonicTimestamp& now, const TimeDuration& timeout) const
+{
+	if (isClosing || isClosed)
+	{
+		return true;
+	}
+
+	if (timeout == TimeDuration::Max())
+	{
+		return false;
+	}
+
+	return (now.milliseconds - lastRxTime.milliseconds) >= timeout.GetMilliseconds();
+}
+
+void MultiConnectionRouter::Connection::OnLowerLayerUp()
+{
+	auto buff = parser.WriteBuff();
+	pPhys->BeginRead(buff);
+}
+
+void MultiConnectionRouter::Connection::OnLowerLayerDown()
+{
+	bindTimer.Cancel();
+	isClosed = true;
+	isTransmitting = false;
+	transmitQueue.clear();
+	pRouter->OnConnectionClosed(*this);
+}
+
+void MultiConnectionRouter::Connection::OnOpenFailure()
+{
+	// only happens if the connection is closed before it finishes opening
+	this->OnLowerLayerDown();
+}
+
+void MultiConnectionRouter::Connection::OnReceive(const openpal::RSlice& input)
+{
+	numBytesRx += input.Size();
+	lastRxTime = pRouter->pExecutor->GetTime();
+
+	// let the parser process the bytes before another read could write over the buffer
+	parser.OnRead(input.Size(), this);
+	if (pPhys->CanRead())   // the frames may have closed the connection
+	{
+		auto buff = parser.WriteBuff();
+		pPhys->BeginRead(buff);
+	}
+}
+
+bool MultiConnectionRouter::Connection::OnFrame(const LinkHeaderFields& header, const openpal::RSlice& userdata)
+{
+	if (isClosed)
+	{
+		return false;
+	}
+
+	++numLinkFrameRx;
+	return pRouter->OnFrame(*this, header, userdata);
+}
+
+void MultiConnectionRouter::Connection::OnSendResult(bool success)
+{
+	assert(!transmitQueue.empty());
+	assert(isTransmitting);
+	isTransmitting = false;
+
+	auto tx = transmitQueue.front();
+	transmitQueue.pop_front();
+	if (tx.pContext)
+	{
+		tx.pContext->OnTransmitResult(success);
+	}
+	this->CheckForSend();
+}
+
+void MultiConnectionRouter::Connection::CheckForSend()
+{
+	if (!transmitQueue.empty() && !isTransmitting && pPhys->CanWrite())
+	{
+		auto& tx = transmitQueue.front();
+		auto numFrames = LinkFrame::CountFrames(tx.buffer);
+		numLinkFrameTx += numFrames;
+		numBytesTx += tx.buffer.Size();
+		if (pRouter->pStatistics)
+		{
+			pRouter->pStatistics->numLinkFrameTx += numFrames;
+		}
+		isTransmitting = true;
+		pPhys->BeginWrite(tx.buffer);
+	}
+}
+
+}
@@ -0,0 +1,251 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_MULTICONNECTIONROUTER_H
+#define ASIODNP3_MULTICONNECTIONROUTER_H
+
+#include "asiodnp3/IChannelRouter.h"
+#include "asiodnp3/ServerStatistics.h"
+#include "asiodnp3/MultiServerSettings.h"
+
+#include <openpal/channel/IPhysicalLayerCallbacks.h>
+#include <openpal/executor/MonotonicTimestamp.h>
+#include <openpal/executor/TimerRef.h>
+
+#include <opendnp3/link/LinkLayerParser.h>
+#include <opendnp3/link/IFrameSink.h>
+#include <opendnp3/link/ChannelRetry.h>
+#include <opendnp3/link/IChannelStateListener.h>
+
+#include <asiopal/Listener.h>
+
+#include <list>
+#include <deque>
+#include <map>
+#include <memory>
+#include <unordered_map>
+
+namespace asiodnp3
+{
+
+/**
+* Routes frames for a channel that serves any number of connections, or datagram peers, on one local endpoint.
+*
+* Sessions are registered and enabled up front. A connection is bound to the enabled session whose route
+* matches the addresses of a frame it receives, so the first frame from a peer brings its session online.
+* A connection whose first frame matches no enabled session is closed. Unbinding the last session of a
+* connection closes it, and closing a connection takes its sessions offline until the peer reconnects.
+* Connections that stay unbound past MultiServerSettings::bindTimeout are closed, and so are connections
+* accepted while MultiServerSettings::maxUnbound others are unbound. A session bound to one connection only
+* moves to another if the first is closing or has been idle for MultiServerSettings::rebindIdleTimeout.
+*/
+class MultiConnectionRouter final : public IChannelRouter
+{
+public:
+
+	MultiConnectionRouter(	openpal::LogRoot& root,
+	                        asiopal::Listener& listener,
+	                        const opendnp3::ChannelRetry& retry,
+	                        opendnp3::IChannelStateListener* pStateHandler,
+	                        opendnp3::LinkChannelStatistics* pStatistics,
+	                        uint32_t rxBufferSize,
+	                        const MultiServerSettings& settings);
+
+	~MultiConnectionRouter();
+
+	// ------------ IChannelRouter -----------------
+
+	virtual void SetShutdownHandler(const openpal::Action0& action) override final;
+
+	virtual bool IsRouteInUse(const opendnp3::Route& route) override final;
+
+	virtual bool AddContext(opendnp3::ILinkSession* pContext, const opendnp3::Route& route) override final;
+
+	// Starts listening when the first context is enabled. The context comes online when a peer sends a frame on its route.
+	virtual bool Enable(opendnp3::ILinkSession* pContext) override final;
+
+	virtual bool Disable(opendnp3::ILinkSession* pContext) override final;
+
+	virtual bool Remove(opendnp3::ILinkSession* pContext) override final;
+
+	virtual void Shutdown() override final;
+
+	virtual opendnp3::ChannelState GetState() override final
+	{
+		return state;
+	}
+
+	// ------------ ILinkRouter -----------------
+
+	virtual void BeginTransmit(const openpal::RSlice& buffer, opendnp3::ILinkSession* pContext) override final;
+
+	/// Must be called from the executor
+	ServerStatistics GetServerStatistics();
+
+private:
+
+	class Connection;
+
+	struct Record
+	{
+		Record(opendnp3::ILinkSession* context, const opendnp3::Route& route_) :
+			pContext(context),
+			route(route_),
+			enabled(false),
+			pConnection(nullptr)
+		{}
+
+		opendnp3::ILinkSession* pContext;
+		opendnp3::Route route;
+		bool enabled;
+		Connection* pConnection;
+	};
+
+	struct Transmission
+	{
+		Transmission(const openpal::RSlice& buffer_, opendnp3::ILinkSession* pContext_) :
+			buffer(buffer_),
+			pContext(pContext_)
+		{}
+
+		openpal::RSlice buffer;
+		opendnp3::ILinkSession* pContext;
+	};
+
+	// One accepted socket with its own parser and transmit queue
+	class Connection final : public openpal::IPhysicalLayerCallbacks, private opendnp3::IFrameSink
+	{
+	public:
+
+		Connection(MultiConnectionRouter& router, uint32_t id, asiopal::PhysicalLayerPeer* pPhys, const openpal::MonotonicTimestamp& acceptTime);
+
+		// Opens the physical layer and starts the bind timer
+		void Open();
+		void Close();
+
+		// Called when the first session is bound
+		void StopBindTimer();
+		void Transmit(const openpal::RSlice& buffer, opendnp3::ILinkSession* pContext);
+
+		// Stop transmitting on behalf of a context that is no longer bound
+		void Unbind(opendnp3::ILinkSession* pContext);
+
+		ConnectionStatistics GetStatistics(const openpal::MonotonicTimestamp& now) const;
+
+		// true if the connection is closing or hasn't received anything for the timeout
+		bool IsInactive(const openpal::MonotonicTimestamp& now, const openpal::TimeDuration& timeout) const;
+
+		// ------------ IPhysicalLayerCallbacks -----------------
+
+		virtual void OnLowerLayerUp() override final;
+		virtual void OnLowerLayerDown() override final;
+		virtual void OnOpenFailure() override final;
+		virtual void OnReceive(const openpal::RSlice&) override final;
+		virtual void OnSendResult(bool success) override final;
+
+		const uint32_t id;
+		std::vector<opendnp3::ILinkSession*> sessions;
+
+	private:
+
+		virtual bool OnFrame(const opendnp3::LinkHeaderFields& header, const openpal::RSlice& userdata) override final;
+
+		void CheckForSend();
+
+		MultiConnectionRouter* pRouter;
+		std::unique_ptr<asiopal::PhysicalLayerPeer> pPhys;
+		opendnp3::LinkLayerParser parser;
+		openpal::TimerRef bindTimer;
+		std::deque<Transmission> transmitQueue;
+		bool isTransmitting;
+		bool isClosing;
+		bool isClosed;
+
+		openpal::MonotonicTimestamp acceptTime;
+		openpal::MonotonicTimestamp lastRxTime;
+		uint64_t numBytesRx;
+		uint64_t numBytesTx;
+		uint32_t numLinkFrameRx;
+		uint32_t numLinkFrameTx;
+	};
+
+	typedef std::list<Record>::iterator RecordIterator;
+
+	// packs the source and destination of a route into a single hash key
+	static uint32_t GetRouteKey(const opendnp3::Route& route)
+	{
+		return (static_cast<uint32_t>(route.source) << 16) | route.destination;
+	}
+
+	bool FindRecord(opendnp3::ILinkSession* pContext, RecordIterator& iter);
+
+	void StartListening();
+	void StartListenTimer();
+	void BeginAccept();
+	void OnAccept(const std::error_code& ec, asiopal::PhysicalLayerPeer* pPhys);
+	void OnListenTimerExpiration();
+
+	// called by connections
+	bool OnFrame(Connection& connection, const opendnp3::LinkHeaderFields& header, const openpal::RSlice& userdata);
+	void OnConnectionClosed(Connection& connection);
+	void OnBindTimeout(Connection& connection);
+
+	bool CanRebind(const Record& record);
+	void Bind(Record& record, Connection& connection);
+	void Unbind(Record& record);
+
+	void ChangeState(opendnp3::ChannelState state);
+	void CheckForShutdown();
+
+	openpal::LogRoot* pRoot;
+	openpal::Logger logger;
+	asiopal::Listener* pListener;
+	asiopal::ASIOExecutor* pExecutor;
+	opendnp3::ChannelRetry retry;
+	openpal::TimeDuration currentRetry;
+	openpal::TimerRef listenTimer;
+	opendnp3::IChannelStateListener* pStateHandler;
+	opendnp3::LinkChannelStatistics* pStatistics;
+	uint32_t rxBufferSize;
+	MultiServerSettings settings;
+	openpal::Action0 shutdownHandler;
+
+	opendnp3::ChannelState state;
+	bool isShutdown;
+	bool isAccepting;
+	uint32_t numPendingDelete;
+
+	// number of open connections without a session, see MultiServerSettings::maxUnbound
+	uint32_t numUnbound;
+
+	// records are kept in the order they were added, the maps index them by route and by session
+	std::list<Record> records;
+	std::unordered_map<uint32_t, RecordIterator> routeIndex;
+	std::unordered_map<opendnp3::ILinkSession*, RecordIterator> sessionIndex;
+
+	// open connections by id
+	std::map<uint32_t, std::unique_ptr<Connection>> connections;
+
+	ServerStatistics counters;
+};
+
+}
+
+#endif
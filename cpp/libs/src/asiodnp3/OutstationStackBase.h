@@ -35,6 +35,8 @@
 #include "asiodnp3/IStackLifecycle.h"
 #include "asiodnp3/IOutstation.h"
 #include "asiodnp3/ILinkBind.h"
+#include "asiodnp3/StackMetricsRecorder.h"
+#include "asiodnp3/OutstationUpdater.h"
 
 namespace asiodnp3
 {
@@ -56,8 +58,14 @@ public:
 		root(root_, id),
 		pLifecycle(&lifecycle),
 		stack(root, executor, listener, config.outstation.params.maxRxFragSize, &statistics, config.link),
+		updater(config.updateQueue, executor),
 		pContext(nullptr)
-	{}
+	{
+		if (config.metrics.recordStrandQueueDelay)
+		{
+			lifecycle.GetExecutor().RecordPostDelay();
+		}
+	}
 
 
 	// ------- implement IOutstation -------
@@ -74,7 +82,7 @@ public:
 		{
 			this->pContext->SetRestartIIN();
 		};
-		pLifecycle->GetExecutor().strand.post(lambda);
+		pLifecycle->GetExecutor().Enqueue(lambda);
 	}
 
 	virtual bool Enable() override final
@@ -87,6 +95,16 @@ public:
 		return pLifecycle->DisableRoute(&stack.link);
 	}
 
+	virtual void EnableAsync(const std::function<void (bool)>& callback) override final
+	{
+		pLifecycle->EnableRouteAsync(&stack.link, callback);
+	}
+
+	virtual void DisableAsync(const std::function<void (bool)>& callback) override final
+	{
+		pLifecycle->DisableRouteAsync(&stack.link, callback);
+	}
+
 	virtual void Shutdown() override final
 	{
 		pLifecycle->Shutdown(&stack.link, this);
@@ -101,6 +119,27 @@ public:
 		return pLifecycle->GetExecutor().ReturnBlockFor<opendnp3::StackStatistics>(get);
 	}
 
+	virtual void GetStackStatisticsAsync(const StackStatisticsCallbackT& callback) override final
+	{
+		auto get = [this]()
+		{
+			return statistics;
+		};
+		pLifecycle->GetExecutor().ReturnAsyncFor<opendnp3::StackStatistics>(get, callback);
+	}
+
+	virtual opendnp3::StackMetrics GetStackMetrics() override final
+	{
+		auto snapshot = metrics.Get();
+		snapshot.strandQueueDelay = pLifecycle->GetExecutor().GetPostDelay();
+		return snapshot;
+	}
+
+	virtual opendnp3::UpdateQueueStatistics GetUpdateQueueStatistics() override final
+	{
+		return updater.GetStatistics();
+	}
+
 	// ------- implement ILinkBind ---------
 
 	virtual void SetLinkRouter(opendnp3::ILinkRouter& router) override final
@@ -130,21 +169,36 @@ private:
 		this->pContext->CheckForTaskStart();
 	}
 
+	virtual ChangeSet* AcquireChanges() override final
+	{
+		return updater.Acquire();
+	}
+
+	virtual void Apply(ChangeSet* changes) override final
+	{
+		updater.Apply(changes);
+	}
+
 protected:
 
 	void SetContext(opendnp3::OContext& context)
 	{
 		this->stack.transport.SetAppLayer(&context);
+		this->stack.link.SetMetricsListener(&metrics);
+		context.SetMetricsListener(&metrics);
+		this->updater.SetContext(context);
 		this->pContext = &context;
 	}
 
 	openpal::LogRoot root;
 	opendnp3::StackStatistics statistics;
+	StackMetricsRecorder metrics;
 	IStackLifecycle* pLifecycle;
 	opendnp3::TransportStack stack;
 
 private:
 
+	OutstationUpdater updater;
 	opendnp3::OContext* pContext;
 };
 
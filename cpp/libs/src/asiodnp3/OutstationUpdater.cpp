@@ -0,0 +1,158 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiodnp3/OutstationUpdater.h"
+
+using namespace openpal;
+using namespace opendnp3;
+
+namespace asiodnp3
+{
+
+OutstationUpdater::OutstationUpdater(const UpdateQueueConfig& config, IExecutor& executor) :
+	queue(config),
+	pExecutor(&executor),
+	pContext(nullptr)
+{
+
+}
+
+void OutstationUpdater::SetContext(OContext& context)
+{
+	pContext = &context;
+}
+
+ChangeSet* OutstationUpdater::Acquire()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+
+	if (pool.empty())
+	{
+		return new ChangeSet();
+	}
+
+	auto changes = pool.back().release();
+	pool.pop_back();
+	return changes;
+}
+
+void OutstationUpdater::Apply(ChangeSet* changes)
+{
+	uint32_t pos = 0;
+	bool queued = false;
+
+	if (queue.IsAvailable())
+	{
+		for (; pos < changes->Size(); ++pos)
+		{
+			auto update = changes->GetUpdate(pos);
+			if (!update)
+			{
+				break; // modifications are always applied on the executor
+			}
+
+			if (queue.TryPush(*update))
+			{
+				queued = true;
+			}
+			else if (queue.OverflowPolicy() == UpdateOverflowPolicy::Drop)
+			{
+				queue.RecordDropped();
+			}
+			else
+			{
+				break;
+			}
+		}
+	}
+
+	// the drain is posted before any fallback, so queued updates are applied first
+	if (queued && queue.MarkDrainPending())
+	{
+		auto drain = [this]()
+		{
+			this->Drain();
+		};
+
+		pExecutor->PostLambda(drain);
+	}
+
+	if (pos == changes->Size())
+	{
+		this->Release(changes);
+		return;
+	}
+
+	// producers bypass the queue until the rest of the changes are applied to preserve ordering
+	queue.BeginFallback();
+
+	auto update = [this, changes, pos]()
+	{
+		// anything queued before these changes must be applied first
+		queue.Apply(pContext->GetDatabase(), queue.Capacity());
+		changes->ApplyFrom(pos, pContext->GetDatabase());
+		this->Release(changes);
+		queue.EndFallback();
+		pContext->CheckForTaskStart();
+	};
+
+	pExecutor->PostLambda(update);
+}
+
+void OutstationUpdater::Drain()
+{
+	do
+	{
+		// apply at most one lap of the ring per handler so the executor isn't monopolized
+		if (queue.Apply(pContext->GetDatabase(), queue.Capacity()) == queue.Capacity())
+		{
+			pContext->CheckForTaskStart();
+
+			auto drain = [this]()
+			{
+				this->Drain();
+			};
+
+			pExecutor->PostLambda(drain);
+			return;
+		}
+	}
+	while (queue.ClearDrainPending());
+
+	pContext->CheckForTaskStart();
+}
+
+void OutstationUpdater::Release(ChangeSet* changes)
+{
+	changes->Clear();
+
+	std::unique_lock<std::mutex> lock(mutex);
+
+	if (pool.size() < MAX_POOLED)
+	{
+		pool.push_back(std::unique_ptr<ChangeSet>(changes));
+	}
+	else
+	{
+		delete changes;
+	}
+}
+
+}
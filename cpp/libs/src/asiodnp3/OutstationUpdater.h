@@ -0,0 +1,83 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_OUTSTATIONUPDATER_H
+#define ASIODNP3_OUTSTATIONUPDATER_H
+
+#include "asiodnp3/ChangeSet.h"
+#include "asiodnp3/UpdateQueue.h"
+
+#include <opendnp3/outstation/OutstationContext.h>
+
+#include <openpal/executor/IExecutor.h>
+
+#include <memory>
+#include <mutex>
+
+namespace asiodnp3
+{
+
+/**
+* Applies the changes that MeasUpdate records to an outstation's database.
+*
+* Leading measurement updates go through the lock-free update queue. Anything after a
+* modification or an overflow is applied on the executor once everything queued before
+* it has been applied. Change sets are recycled so that a MeasUpdate doesn't allocate one.
+*/
+class OutstationUpdater : private openpal::Uncopyable
+{
+
+public:
+
+	OutstationUpdater(const opendnp3::UpdateQueueConfig& config, openpal::IExecutor& executor);
+
+	void SetContext(opendnp3::OContext& context);
+
+	/// @return an empty change set, callable from any thread
+	ChangeSet* Acquire();
+
+	/// apply and then recycle a change set, callable from any thread
+	void Apply(ChangeSet* changes);
+
+	opendnp3::UpdateQueueStatistics GetStatistics() const
+	{
+		return queue.GetStatistics();
+	}
+
+private:
+
+	// runs on the executor
+	void Drain();
+	void Release(ChangeSet* changes);
+
+	// the most change sets kept for reuse, more than this are freed
+	static const size_t MAX_POOLED = 8;
+
+	UpdateQueue queue;
+	openpal::IExecutor* pExecutor;
+	opendnp3::OContext* pContext;
+
+	std::mutex mutex;
+	std::vector<std::unique_ptr<ChangeSet>> pool;
+};
+
+}
+
+#endif
@@ -23,7 +23,7 @@
 #include <openpal/executor/IExecutor.h>
 #include <asiopal/ASIOExecutor.h>
 
-#include "asiodnp3/LinkLayerRouter.h"
+#include "asiodnp3/IChannelRouter.h"
 
 #include <vector>
 
@@ -33,7 +33,7 @@ using namespace opendnp3;
 namespace asiodnp3
 {
 
-StackLifecycle::StackLifecycle(LinkLayerRouter& router, asiopal::ASIOExecutor& executor) :
+StackLifecycle::StackLifecycle(IChannelRouter& router, asiopal::ASIOExecutor& executor) :
 	pRouter(&router),
 	pExecutor(&executor)
 {
@@ -77,9 +77,27 @@ bool StackLifecycle::DisableRoute(ILinkSession* pContext)
 	return pExecutor->ReturnBlockFor<bool>(disable);
 }
 
+void StackLifecycle::EnableRouteAsync(ILinkSession* pContext, const std::function<void (bool)>& callback)
+{
+	auto enable = [this, pContext]()
+	{
+		return pRouter->Enable(pContext);
+	};
+	pExecutor->ReturnAsyncFor<bool>(enable, callback);
+}
+
+void StackLifecycle::DisableRouteAsync(ILinkSession* pContext, const std::function<void (bool)>& callback)
+{
+	auto disable = [this, pContext]()
+	{
+		return pRouter->Disable(pContext);
+	};
+	pExecutor->ReturnAsyncFor<bool>(disable, callback);
+}
+
 void StackLifecycle::Shutdown(ILinkSession* pContext, IStack* pStack)
 {
-	// synchronously remove the stack from the running strand
+	// synchronously remove the stack from the executor
 	auto action = [this, pContext]()
 	{
 		pRouter->Remove(pContext);
@@ -88,12 +106,12 @@ void StackLifecycle::Shutdown(ILinkSession* pContext, IStack* pStack)
 
 	stacks.erase(pStack);
 
-	// post the deletion of the stack to the strand
+	// post the deletion of the stack to the executor
 	auto deleteStack = [pStack]()
 	{
 		delete pStack;
 	};
-	pExecutor->strand.post(deleteStack);
+	pExecutor->Enqueue(deleteStack);
 }
 
 }
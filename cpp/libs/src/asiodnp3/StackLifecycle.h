@@ -33,13 +33,13 @@ class ASIOExecutor;
 namespace asiodnp3
 {
 
-class LinkLayerRouter;
+class IChannelRouter;
 
 class StackLifecycle final : public IStackLifecycle
 {
 public:
 
-	StackLifecycle(LinkLayerRouter& router, asiopal::ASIOExecutor& executor);
+	StackLifecycle(IChannelRouter& router, asiopal::ASIOExecutor& executor);
 
 	/// --- helper methods uses within the channel ----
 
@@ -58,12 +58,16 @@ public:
 
 	virtual bool DisableRoute(opendnp3::ILinkSession* pContext) override;
 
+	virtual void EnableRouteAsync(opendnp3::ILinkSession* pContext, const std::function<void (bool)>& callback) override;
+
+	virtual void DisableRouteAsync(opendnp3::ILinkSession* pContext, const std::function<void (bool)>& callback) override;
+
 	virtual void Shutdown(opendnp3::ILinkSession* pContext, IStack* pStack) override;
 
 
 private:
 
-	LinkLayerRouter* pRouter;
+	IChannelRouter* pRouter;
 	asiopal::ASIOExecutor* pExecutor;
 	std::set<IStack*> stacks;
 
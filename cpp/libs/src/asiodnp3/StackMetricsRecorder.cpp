@@ -0,0 +1,96 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "StackMetricsRecorder.h"
+
+using namespace opendnp3;
+
+namespace asiodnp3
+{
+
+StackMetricsRecorder::StackMetricsRecorder() :
+	isRequestPending(false),
+	eventBufferHighWater(0),
+	numLinkRetransmit(0)
+{}
+
+StackMetrics StackMetricsRecorder::Get() const
+{
+	StackMetrics metrics;
+	for (uint32_t i = 0; i < StackMetrics::NUM_TASK_TYPES; ++i)
+	{
+		metrics.taskRoundTrip[i] = taskRoundTrip[i].Snapshot();
+	}
+	metrics.readHandling = readHandling.Snapshot();
+	metrics.eventBufferHighWater = eventBufferHighWater.load(std::memory_order_relaxed);
+	metrics.numLinkRetransmit = numLinkRetransmit.load(std::memory_order_relaxed);
+	return metrics;
+}
+
+void StackMetricsRecorder::OnTaskRequest(MasterTaskType)
+{
+	isRequestPending = true;
+	requestTime = asiopal::asiopal_steady_clock::now();
+}
+
+void StackMetricsRecorder::OnTaskResponse(MasterTaskType type)
+{
+	if (isRequestPending)
+	{
+		isRequestPending = false;
+
+		const auto index = static_cast<uint32_t>(type);
+		if (index < StackMetrics::NUM_TASK_TYPES)
+		{
+			taskRoundTrip[index].Record(MicrosecondsSince(requestTime));
+		}
+	}
+}
+
+void StackMetricsRecorder::OnReadBegin()
+{
+	readStart = asiopal::asiopal_steady_clock::now();
+}
+
+void StackMetricsRecorder::OnReadEnd()
+{
+	readHandling.Record(MicrosecondsSince(readStart));
+}
+
+void StackMetricsRecorder::OnEventCount(uint32_t numEvents)
+{
+	if (numEvents > eventBufferHighWater.load(std::memory_order_relaxed))
+	{
+		eventBufferHighWater.store(numEvents, std::memory_order_relaxed);
+	}
+}
+
+void StackMetricsRecorder::OnLinkRetransmit()
+{
+	numLinkRetransmit.store(numLinkRetransmit.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+uint64_t StackMetricsRecorder::MicrosecondsSince(const asiopal::asiopal_steady_clock::time_point& start)
+{
+	auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(asiopal::asiopal_steady_clock::now() - start);
+	return static_cast<uint64_t>(elapsed.count());
+}
+
+}
@@ -0,0 +1,79 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_STACKMETRICSRECORDER_H
+#define ASIODNP3_STACKMETRICSRECORDER_H
+
+#include <opendnp3/IStackMetricsListener.h>
+#include <opendnp3/StackMetrics.h>
+
+#include <asiopal/AtomicHistogram.h>
+#include <asiopal/SteadyClock.h>
+
+#include <atomic>
+
+namespace asiodnp3
+{
+
+/**
+* Times the events of a session with the steady clock and keeps the results in atomics
+*
+* The listener methods are called on the session's executor, Get() may be called from any thread.
+*/
+class StackMetricsRecorder : public opendnp3::IStackMetricsListener, private openpal::Uncopyable
+{
+public:
+
+	StackMetricsRecorder();
+
+	/// @return a snapshot of everything except the strand queue delay, which belongs to the executor
+	opendnp3::StackMetrics Get() const;
+
+	virtual void OnTaskRequest(opendnp3::MasterTaskType type) override final;
+
+	virtual void OnTaskResponse(opendnp3::MasterTaskType type) override final;
+
+	virtual void OnReadBegin() override final;
+
+	virtual void OnReadEnd() override final;
+
+	virtual void OnEventCount(uint32_t numEvents) override final;
+
+	virtual void OnLinkRetransmit() override final;
+
+private:
+
+	static uint64_t MicrosecondsSince(const asiopal::asiopal_steady_clock::time_point& start);
+
+	// only touched on the executor
+	bool isRequestPending;
+	asiopal::asiopal_steady_clock::time_point requestTime;
+	asiopal::asiopal_steady_clock::time_point readStart;
+
+	asiopal::AtomicHistogram taskRoundTrip[opendnp3::StackMetrics::NUM_TASK_TYPES];
+	asiopal::AtomicHistogram readHandling;
+
+	std::atomic<uint32_t> eventBufferHighWater;
+	std::atomic<uint32_t> numLinkRetransmit;
+};
+
+}
+
+#endif
@@ -0,0 +1,224 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiodnp3/UpdateQueue.h"
+
+using namespace opendnp3;
+
+namespace asiodnp3
+{
+
+UpdateQueue::UpdateQueue(const UpdateQueueConfig& config) :
+	overflowPolicy(config.overflowPolicy),
+	records(RoundUpToPowerOf2(config.capacity)),
+	mask(records.Size() ? (records.Size() - 1) : 0),
+	enqueuePosition(0),
+	dequeuePosition(0),
+	drainPending(false),
+	numFallbacks(0),
+	numQueued(0),
+	numApplied(0),
+	numOverflows(0),
+	numDropped(0),
+	numDrains(0)
+{
+	// a slot is free for the producer at position p when its sequence equals p
+	for (uint32_t i = 0; i < records.Size(); ++i)
+	{
+		records[i].sequence.store(i, std::memory_order_relaxed);
+	}
+}
+
+bool UpdateQueue::IsAvailable() const
+{
+	return records.IsNotEmpty() && (numFallbacks.load() == 0);
+}
+
+bool UpdateQueue::TryPush(const Binary& meas, uint16_t index, EventMode mode)
+{
+	return TryPush(UpdateRecord(meas, index, mode));
+}
+
+bool UpdateQueue::TryPush(const DoubleBitBinary& meas, uint16_t index, EventMode mode)
+{
+	return TryPush(UpdateRecord(meas, index, mode));
+}
+
+bool UpdateQueue::TryPush(const Analog& meas, uint16_t index, EventMode mode)
+{
+	return TryPush(UpdateRecord(meas, index, mode));
+}
+
+bool UpdateQueue::TryPush(const Counter& meas, uint16_t index, EventMode mode)
+{
+	return TryPush(UpdateRecord(meas, index, mode));
+}
+
+bool UpdateQueue::TryPush(const FrozenCounter& meas, uint16_t index, EventMode mode)
+{
+	return TryPush(UpdateRecord(meas, index, mode));
+}
+
+bool UpdateQueue::TryPush(const BinaryOutputStatus& meas, uint16_t index, EventMode mode)
+{
+	return TryPush(UpdateRecord(meas, index, mode));
+}
+
+bool UpdateQueue::TryPush(const AnalogOutputStatus& meas, uint16_t index, EventMode mode)
+{
+	return TryPush(UpdateRecord(meas, index, mode));
+}
+
+bool UpdateQueue::TryPush(const TimeAndInterval& meas, uint16_t index, EventMode mode)
+{
+	return TryPush(UpdateRecord(meas, index, mode));
+}
+
+void UpdateQueue::RecordDropped()
+{
+	++numDropped;
+}
+
+void UpdateQueue::BeginFallback()
+{
+	++numFallbacks;
+}
+
+void UpdateQueue::EndFallback()
+{
+	--numFallbacks;
+}
+
+bool UpdateQueue::MarkDrainPending()
+{
+	return !drainPending.exchange(true);
+}
+
+bool UpdateQueue::TryPush(const UpdateRecord& update)
+{
+	auto position = enqueuePosition.load(std::memory_order_relaxed);
+
+	for (;;)
+	{
+		auto& record = records[position & mask];
+		auto sequence = record.sequence.load(std::memory_order_acquire);
+		auto diff = static_cast<int32_t>(sequence - position);
+
+		if (diff == 0)
+		{
+			// the slot is free, try to claim it
+			if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+			{
+				record.update = update;
+				// publishes the record to the consumer
+				record.sequence.store(position + 1);
+				++numQueued;
+				return true;
+			}
+		}
+		else if (diff < 0)
+		{
+			// the consumer hasn't released this slot yet, the queue is full
+			++numOverflows;
+			return false;
+		}
+		else
+		{
+			// another producer claimed the slot first
+			position = enqueuePosition.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+uint32_t UpdateQueue::Apply(IDatabase& db, uint32_t max)
+{
+	uint32_t count = 0;
+
+	while (count < max)
+	{
+		auto& record = records[dequeuePosition & mask];
+		auto sequence = record.sequence.load(std::memory_order_acquire);
+
+		if (static_cast<int32_t>(sequence - (dequeuePosition + 1)) < 0)
+		{
+			break; // empty, or the next producer hasn't finished writing
+		}
+
+		record.update.Apply(db);
+
+		// hand the slot back to the producers for the next lap around the ring
+		record.sequence.store(dequeuePosition + records.Size(), std::memory_order_release);
+		++dequeuePosition;
+		++count;
+	}
+
+	if (count > 0)
+	{
+		numApplied += count;
+		++numDrains;
+	}
+
+	return count;
+}
+
+bool UpdateQueue::ClearDrainPending()
+{
+	drainPending.store(false);
+	return !IsEmpty() && MarkDrainPending();
+}
+
+bool UpdateQueue::IsEmpty() const
+{
+	if (records.IsEmpty())
+	{
+		return true;
+	}
+
+	auto sequence = records[dequeuePosition & mask].sequence.load();
+	return static_cast<int32_t>(sequence - (dequeuePosition + 1)) < 0;
+}
+
+UpdateQueueStatistics UpdateQueue::GetStatistics() const
+{
+	UpdateQueueStatistics stats;
+	stats.numQueued = numQueued.load(std::memory_order_relaxed);
+	stats.numApplied = numApplied.load(std::memory_order_relaxed);
+	stats.numOverflows = numOverflows.load(std::memory_order_relaxed);
+	stats.numDropped = numDropped.load(std::memory_order_relaxed);
+	stats.numDrains = numDrains.load(std::memory_order_relaxed);
+	return stats;
+}
+
+uint32_t UpdateQueue::RoundUpToPowerOf2(uint32_t value)
+{
+	if (value == 0)
+	{
+		return 0;
+	}
+
+	uint32_t power = 1;
+	while (power < value && power < (1u << 31))
+	{
+		power <<= 1;
+	}
+	return power;
+}
+
+}
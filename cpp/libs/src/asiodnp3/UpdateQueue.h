@@ -0,0 +1,134 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_UPDATEQUEUE_H
+#define ASIODNP3_UPDATEQUEUE_H
+
+#include "asiodnp3/UpdateRecord.h"
+
+#include <opendnp3/outstation/UpdateQueueConfig.h>
+#include <opendnp3/outstation/UpdateQueueStatistics.h>
+
+#include <openpal/container/Array.h>
+#include <openpal/util/Uncopyable.h>
+
+#include <atomic>
+
+namespace asiodnp3
+{
+
+/**
+* Bounded multi-producer / single-consumer queue of typed measurement updates.
+*
+* Any thread may push. Only the outstation's executor applies the updates to the database.
+* Slots are preallocated, so pushing never allocates.
+*/
+class UpdateQueue : private openpal::Uncopyable
+{
+
+public:
+
+	UpdateQueue(const opendnp3::UpdateQueueConfig& config);
+
+	uint32_t Capacity() const
+	{
+		return records.Size();
+	}
+
+	opendnp3::UpdateOverflowPolicy OverflowPolicy() const
+	{
+		return overflowPolicy;
+	}
+
+	// ------ producer side, any thread ------
+
+	/// true if producers may push, i.e. the queue is enabled and no fallback updates are outstanding
+	bool IsAvailable() const;
+
+	/// @return false and counts an overflow if the queue is full
+	bool TryPush(const UpdateRecord& update);
+
+	bool TryPush(const opendnp3::Binary& meas, uint16_t index, opendnp3::EventMode mode);
+	bool TryPush(const opendnp3::DoubleBitBinary& meas, uint16_t index, opendnp3::EventMode mode);
+	bool TryPush(const opendnp3::Analog& meas, uint16_t index, opendnp3::EventMode mode);
+	bool TryPush(const opendnp3::Counter& meas, uint16_t index, opendnp3::EventMode mode);
+	bool TryPush(const opendnp3::FrozenCounter& meas, uint16_t index, opendnp3::EventMode mode);
+	bool TryPush(const opendnp3::BinaryOutputStatus& meas, uint16_t index, opendnp3::EventMode mode);
+	bool TryPush(const opendnp3::AnalogOutputStatus& meas, uint16_t index, opendnp3::EventMode mode);
+	bool TryPush(const opendnp3::TimeAndInterval& meas, uint16_t index, opendnp3::EventMode mode);
+
+	void RecordDropped();
+
+	/**
+	* Updates that bypass the queue (modifications, overflows) must be applied after everything queued before them.
+	* While any are outstanding, producers are expected to bypass the queue as well.
+	*/
+	void BeginFallback();
+	void EndFallback();
+
+	/// @return true if the caller is responsible for scheduling a drain on the executor
+	bool MarkDrainPending();
+
+	// ------ consumer side, executor only ------
+
+	/// apply up to max queued updates to the database, returning the number applied
+	uint32_t Apply(opendnp3::IDatabase& db, uint32_t max);
+
+	/// @return true if updates arrived after the last Apply and the caller must drain again
+	bool ClearDrainPending();
+
+	/// lock-free snapshot of the counters, callable from any thread
+	opendnp3::UpdateQueueStatistics GetStatistics() const;
+
+private:
+
+	struct Record
+	{
+		Record() : sequence(0)
+		{}
+
+		std::atomic<uint32_t> sequence;
+		UpdateRecord update;
+	};
+
+	bool IsEmpty() const;
+
+	static uint32_t RoundUpToPowerOf2(uint32_t value);
+
+	const opendnp3::UpdateOverflowPolicy overflowPolicy;
+	openpal::Array<Record, uint32_t> records;
+	const uint32_t mask;
+
+	std::atomic<uint32_t> enqueuePosition;
+	uint32_t dequeuePosition;	// only touched by the consumer
+
+	std::atomic<bool> drainPending;
+	std::atomic<uint32_t> numFallbacks;
+
+	std::atomic<uint64_t> numQueued;
+	std::atomic<uint64_t> numApplied;
+	std::atomic<uint64_t> numOverflows;
+	std::atomic<uint64_t> numDropped;
+	std::atomic<uint64_t> numDrains;
+};
+
+}
+
+#endif
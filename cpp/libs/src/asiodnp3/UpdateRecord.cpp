@@ -0,0 +1,114 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiodnp3/UpdateRecord.h"
+
+using namespace opendnp3;
+
+namespace asiodnp3
+{
+
+UpdateRecord::UpdateRecord() : type(Type::Binary), mode(EventMode::Detect), flags(0), index(0), time(0)
+{
+	value.analog = 0;
+}
+
+UpdateRecord::UpdateRecord(const Binary& meas, uint16_t index_, EventMode mode_) :
+	type(Type::Binary), mode(mode_), flags(meas.quality), index(index_), time(meas.time)
+{
+	value.boolean = meas.value;
+}
+
+UpdateRecord::UpdateRecord(const DoubleBitBinary& meas, uint16_t index_, EventMode mode_) :
+	type(Type::DoubleBitBinary), mode(mode_), flags(meas.quality), index(index_), time(meas.time)
+{
+	value.doubleBit = meas.value;
+}
+
+UpdateRecord::UpdateRecord(const Analog& meas, uint16_t index_, EventMode mode_) :
+	type(Type::Analog), mode(mode_), flags(meas.quality), index(index_), time(meas.time)
+{
+	value.analog = meas.value;
+}
+
+UpdateRecord::UpdateRecord(const Counter& meas, uint16_t index_, EventMode mode_) :
+	type(Type::Counter), mode(mode_), flags(meas.quality), index(index_), time(meas.time)
+{
+	value.counter = meas.value;
+}
+
+UpdateRecord::UpdateRecord(const FrozenCounter& meas, uint16_t index_, EventMode mode_) :
+	type(Type::FrozenCounter), mode(mode_), flags(meas.quality), index(index_), time(meas.time)
+{
+	value.counter = meas.value;
+}
+
+UpdateRecord::UpdateRecord(const BinaryOutputStatus& meas, uint16_t index_, EventMode mode_) :
+	type(Type::BinaryOutputStatus), mode(mode_), flags(meas.quality), index(index_), time(meas.time)
+{
+	value.boolean = meas.value;
+}
+
+UpdateRecord::UpdateRecord(const AnalogOutputStatus& meas, uint16_t index_, EventMode mode_) :
+	type(Type::AnalogOutputStatus), mode(mode_), flags(meas.quality), index(index_), time(meas.time)
+{
+	value.analog = meas.value;
+}
+
+UpdateRecord::UpdateRecord(const TimeAndInterval& meas, uint16_t index_, EventMode mode_) :
+	type(Type::TimeAndInterval), mode(mode_), flags(meas.units), index(index_), time(meas.time)
+{
+	value.counter = meas.interval;
+}
+
+void UpdateRecord::Apply(IDatabase& db) const
+{
+	const DNPTime dnpTime(time);
+
+	switch (type)
+	{
+	case(Type::Binary) :
+		db.Update(Binary(value.boolean, flags, dnpTime), index, mode);
+		break;
+	case(Type::DoubleBitBinary) :
+		db.Update(DoubleBitBinary(value.doubleBit, flags, dnpTime), index, mode);
+		break;
+	case(Type::Analog) :
+		db.Update(Analog(value.analog, flags, dnpTime), index, mode);
+		break;
+	case(Type::Counter) :
+		db.Update(Counter(value.counter, flags, dnpTime), index, mode);
+		break;
+	case(Type::FrozenCounter) :
+		db.Update(FrozenCounter(value.counter, flags, dnpTime), index, mode);
+		break;
+	case(Type::BinaryOutputStatus) :
+		db.Update(BinaryOutputStatus(value.boolean, flags, dnpTime), index, mode);
+		break;
+	case(Type::AnalogOutputStatus) :
+		db.Update(AnalogOutputStatus(value.analog, flags, dnpTime), index, mode);
+		break;
+	case(Type::TimeAndInterval) :
+		db.Update(TimeAndInterval(dnpTime, value.counter, flags), index);
+		break;
+	}
+}
+
+}
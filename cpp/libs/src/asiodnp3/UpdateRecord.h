@@ -0,0 +1,76 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef ASIODNP3_UPDATERECORD_H
+#define ASIODNP3_UPDATERECORD_H
+
+#include <opendnp3/outstation/IDatabase.h>
+
+namespace asiodnp3
+{
+
+/**
+* A typed measurement update that can be copied around without allocating
+*/
+struct UpdateRecord
+{
+	UpdateRecord();
+
+	UpdateRecord(const opendnp3::Binary& meas, uint16_t index, opendnp3::EventMode mode);
+	UpdateRecord(const opendnp3::DoubleBitBinary& meas, uint16_t index, opendnp3::EventMode mode);
+	UpdateRecord(const opendnp3::Analog& meas, uint16_t index, opendnp3::EventMode mode);
+	UpdateRecord(const opendnp3::Counter& meas, uint16_t index, opendnp3::EventMode mode);
+	UpdateRecord(const opendnp3::FrozenCounter& meas, uint16_t index, opendnp3::EventMode mode);
+	UpdateRecord(const opendnp3::BinaryOutputStatus& meas, uint16_t index, opendnp3::EventMode mode);
+	UpdateRecord(const opendnp3::AnalogOutputStatus& meas, uint16_t index, opendnp3::EventMode mode);
+	UpdateRecord(const opendnp3::TimeAndInterval& meas, uint16_t index, opendnp3::EventMode mode);
+
+	void Apply(opendnp3::IDatabase& db) const;
+
+	enum class Type : uint8_t
+	{
+		Binary,
+		DoubleBitBinary,
+		Analog,
+		Counter,
+		FrozenCounter,
+		BinaryOutputStatus,
+		AnalogOutputStatus,
+		TimeAndInterval
+	};
+
+	Type type;
+	opendnp3::EventMode mode;
+	uint8_t flags;	// quality, or units for TimeAndInterval
+	uint16_t index;
+	uint64_t time;
+
+	union
+	{
+		bool boolean;
+		opendnp3::DoubleBit doubleBit;
+		double analog;
+		uint32_t counter;	// also the TimeAndInterval interval
+	} value;
+};
+
+}
+
+#endif
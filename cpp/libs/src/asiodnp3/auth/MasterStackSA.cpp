@@ -60,7 +60,7 @@ void MasterStackSA::ChangeUserStatus(const secauth::UserStatusChange& userStatus
 	{
 		this->mcontext.ChangeUserStatus(userStatusChange, config);
 	};
-	this->pASIOExecutor->strand.post(action);
+	this->pASIOExecutor->Enqueue(action);
 }
 
 void MasterStackSA::BeginUpdateKeyChange(const std::string& username, const opendnp3::TaskConfig& config, const secauth::BeginUpdateKeyChangeCallbackT& callback)
@@ -69,7 +69,7 @@ void MasterStackSA::BeginUpdateKeyChange(const std::string& username, const open
 	{
 		this->mcontext.BeginUpdateKeyChange(username, config, callback);
 	};
-	this->pASIOExecutor->strand.post(action);
+	this->pASIOExecutor->Enqueue(action);
 }
 
 void MasterStackSA::FinishUpdateKeyChange(const secauth::FinishUpdateKeyChangeArgs& args, const opendnp3::TaskConfig& config)
@@ -78,7 +78,7 @@ void MasterStackSA::FinishUpdateKeyChange(const secauth::FinishUpdateKeyChangeAr
 	{
 		this->mcontext.FinishUpdateKeyChange(args, config);
 	};
-	this->pASIOExecutor->strand.post(action);
+	this->pASIOExecutor->Enqueue(action);
 }
 
 
@@ -22,6 +22,7 @@
 
 #include "asiopal/TimerASIO.h"
 #include "asiopal/SteadyClock.h"
+#include "asiopal/ShardService.h"
 
 #include <asio.hpp>
 #include <functional>
@@ -31,9 +32,17 @@ using namespace std;
 namespace asiopal
 {
 
-ASIOExecutor::ASIOExecutor(asio::io_service& service) :
-	strand(service),
-	pShutdownSignal(nullptr)
+ASIOExecutor::ASIOExecutor(asio::io_service& service_) :
+	service(service_),
+	pShard(ShardService::Find(service_)),
+	strand(service_),
+	pShutdownSignal(nullptr),
+	wheel(GetTick()),
+	wheelTimer(service_),
+	armed(false),
+	armedTick(0),
+	numWaits(0),
+	recordPostDelay(false)
 {
 
 }
@@ -53,13 +62,18 @@ void ASIOExecutor::WaitForShutdown()
 	{
 		this->InitiateShutdown(sync);
 	};
-	strand.post(initiate);
+	this->Enqueue(initiate);
 	sync.WaitForValue();
 }
 
+bool ASIOExecutor::RunningInThisThread()
+{
+	return pShard ? pShard->RunningInThisThread() : strand.running_in_this_thread();
+}
+
 void ASIOExecutor::BlockFor(const std::function<void()>& action)
 {
-	if (strand.running_in_this_thread())
+	if (this->RunningInThisThread())
 	{
 		action();
 	}
@@ -72,7 +86,7 @@ void ASIOExecutor::BlockFor(const std::function<void()>& action)
 			action();
 			pointer->SetValue(true);
 		};
-		strand.post(lambda);
+		this->Enqueue(lambda);
 		sync.WaitForValue();
 	}
 }
@@ -85,17 +99,22 @@ void ASIOExecutor::InitiateShutdown(Synchronized<bool>& handler)
 
 void ASIOExecutor::CheckForShutdown()
 {
-	if (pShutdownSignal)
+	if (pShutdownSignal && wheel.IsEmpty())
 	{
-		if (activeTimers.empty())
+		if (numWaits > 0)
+		{
+			// nothing left to wait for, abort the outstanding wait(s) and check again when they complete
+			wheelTimer.cancel();
+		}
+		else
 		{
-			// send the final shutdown signal via the strand to ensure all post events are flushed
+			// send the final shutdown signal via the executor to ensure all post events are flushed
 			auto finalpost = [this]()
 			{
 				this->pShutdownSignal->SetValue(true);
 			};
 
-			strand.post(finalpost);
+			this->Enqueue(finalpost);
 		}
 	}
 }
@@ -105,6 +124,11 @@ openpal::MonotonicTimestamp ASIOExecutor::GetTime()
 	return std::chrono::duration_cast<std::chrono::milliseconds>(asiopal_steady_clock::now().time_since_epoch()).count();
 }
 
+TimerWheel::Tick ASIOExecutor::GetTick()
+{
+	return std::chrono::duration_cast<std::chrono::milliseconds>(asiopal_steady_clock::now().time_since_epoch()).count();
+}
+
 openpal::ITimer* ASIOExecutor::Start(const openpal::TimeDuration& delay, const openpal::Action0& runnable)
 {
 	auto expiration = asiopal_steady_clock::now() + std::chrono::milliseconds(delay.GetMilliseconds());
@@ -119,19 +143,44 @@ openpal::ITimer* ASIOExecutor::Start(const openpal::MonotonicTimestamp& time, co
 
 openpal::ITimer* ASIOExecutor::Start(const asiopal_steady_clock::time_point& tp, const openpal::Action0& runnable)
 {
+	// round up to the next tick so that timers never fire early
+	auto sinceEpoch = tp.time_since_epoch();
+	auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(sinceEpoch);
+	if (ms < sinceEpoch)
+	{
+		++ms;
+	}
+
 	TimerASIO* pTimer = GetTimer();
-	pTimer->timer.expires_at(tp);
-	this->StartTimer(pTimer, runnable);
+	pTimer->runnable = runnable;
+	auto wake = wheel.Schedule(*pTimer, ms.count(), GetTick());
+	if (!armed || wake < armedTick)
+	{
+		this->Arm(wake);
+	}
 	return pTimer;
 }
 
 void ASIOExecutor::Post(const openpal::Action0& runnable)
 {
-	auto captured = [runnable]()
+	if (!recordPostDelay.load(std::memory_order_relaxed))
+	{
+		auto captured = [runnable]()
+		{
+			runnable.Apply();
+		};
+		this->Enqueue(captured);
+		return;
+	}
+
+	auto posted = asiopal_steady_clock::now();
+	auto captured = [this, runnable, posted]()
 	{
+		auto delay = std::chrono::duration_cast<std::chrono::microseconds>(asiopal_steady_clock::now() - posted);
+		this->postDelay.Record(static_cast<uint64_t>(delay.count()));
 		runnable.Apply();
 	};
-	strand.post(captured);
+	this->Enqueue(captured);
 }
 
 TimerASIO* ASIOExecutor::GetTimer()
@@ -139,7 +188,7 @@ TimerASIO* ASIOExecutor::GetTimer()
 	TimerASIO* pTimer;
 	if(idleTimers.size() == 0)
 	{
-		pTimer = new TimerASIO(strand);
+		pTimer = new TimerASIO(*this);
 		allTimers.push_back(pTimer);
 	}
 	else
@@ -148,30 +197,65 @@ TimerASIO* ASIOExecutor::GetTimer()
 		idleTimers.pop_front();
 	}
 
-	activeTimers.insert(pTimer);
 	pTimer->canceled = false;
 	return pTimer;
 }
 
-void ASIOExecutor::StartTimer(TimerASIO* pTimer, const openpal::Action0& runnable)
+void ASIOExecutor::CancelTimer(TimerASIO* pTimer)
 {
-	auto callback = [runnable, this, pTimer](const std::error_code & ec)
+	wheel.Cancel(*pTimer);
+	idleTimers.push_back(pTimer);
+	this->CheckForShutdown();
+}
+
+void ASIOExecutor::Arm(TimerWheel::Tick tick)
+{
+	// re-arming aborts any outstanding wait, but its handler still runs and is counted
+	wheelTimer.expires_at(asiopal_steady_clock::time_point(std::chrono::milliseconds(tick)));
+	auto callback = [this](const std::error_code & ec)
 	{
-		this->OnTimerCallback(ec, pTimer, runnable);
+		this->OnWheelTimer(ec);
 	};
-	pTimer->timer.async_wait(strand.wrap(callback));
+	wheelTimer.async_wait(this->Wrap(callback));
+	++numWaits;
+	armed = true;
+	armedTick = tick;
 }
 
-void ASIOExecutor::OnTimerCallback(const std::error_code& ec, TimerASIO* pTimer, const openpal::Action0& runnable)
+void ASIOExecutor::OnWheelTimer(const std::error_code& ec)
 {
-	activeTimers.erase(pTimer);
-	idleTimers.push_back(pTimer);
-	if (!(ec || pTimer->canceled))
+	--numWaits;
+	if (numWaits == 0)
 	{
-		runnable.Apply();
+		armed = false;
 	}
+
+	if (!ec)
+	{
+		wheel.Advance(GetTick());
+		this->RunExpired();
+	}
+
+	TimerWheel::Tick next;
+	if (wheel.NextWake(next) && (!armed || next < armedTick))
+	{
+		this->Arm(next);
+	}
+
 	this->CheckForShutdown();
 }
 
+void ASIOExecutor::RunExpired()
+{
+	TimerWheelNode* pNode;
+	while ((pNode = wheel.PopExpired()))
+	{
+		auto pTimer = static_cast<TimerASIO*>(pNode);
+		auto runnable = pTimer->runnable;
+		idleTimers.push_back(pTimer);
+		runnable.Apply();
+	}
+}
+
 } //end namespace
 
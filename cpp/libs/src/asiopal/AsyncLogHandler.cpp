@@ -0,0 +1,371 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiopal/AsyncLogHandler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+using namespace std;
+using namespace openpal;
+
+namespace asiopal
+{
+
+struct AsyncLogHandler::ThreadRings
+{
+	~ThreadRings()
+	{
+		for (auto& binding : bindings)
+		{
+			binding.second->Release();
+		}
+	}
+
+	// handler id and the ring this thread claimed from it
+	std::vector<std::pair<uint64_t, std::shared_ptr<Ring>>> bindings;
+};
+
+static std::atomic<uint64_t> nextHandlerId(0);
+
+AsyncLogHandler::Ring::Ring(uint32_t size) :
+	claimed(false),
+	entries(size),
+	mask(size - 1),
+	head(0),
+	tail(0)
+{
+
+}
+
+bool AsyncLogHandler::Ring::Push(uint64_t timestamp, char const* alias, const LogRecord& record)
+{
+	auto position = tail.load(std::memory_order_relaxed);
+	if ((position - head.load(std::memory_order_acquire)) > mask)
+	{
+		return false;
+	}
+
+	auto& entry = entries[position & mask];
+	entry.timestamp = timestamp;
+	entry.alias.assign(alias);
+	record.CopyTo(entry.record);
+
+	tail.store(position + 1, std::memory_order_release);
+	return true;
+}
+
+const AsyncLogHandler::Entry* AsyncLogHandler::Ring::Front() const
+{
+	auto position = head.load(std::memory_order_relaxed);
+	return (position == tail.load(std::memory_order_acquire)) ? nullptr : &entries[position & mask];
+}
+
+void AsyncLogHandler::Ring::Pop()
+{
+	head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+uint32_t AsyncLogHandler::Ring::Mark() const
+{
+	return tail.load(std::memory_order_acquire);
+}
+
+bool AsyncLogHandler::Ring::Reached(uint32_t mark) const
+{
+	return static_cast<int32_t>(head.load(std::memory_order_acquire) - mark) >= 0;
+}
+
+bool AsyncLogHandler::Ring::Claim()
+{
+	// acquiring the claim makes the previous producer's writes to the tail visible
+	bool expected = false;
+	return claimed.compare_exchange_strong(expected, true, std::memory_order_acq_rel);
+}
+
+void AsyncLogHandler::Ring::Release()
+{
+	claimed.store(false, std::memory_order_release);
+}
+
+static uint32_t RoundUpToPowerOfTwo(uint32_t value)
+{
+	uint32_t size = 1;
+	while (size < value)
+	{
+		size <<= 1;
+	}
+	return size;
+}
+
+AsyncLogHandler::AsyncLogHandler(uint32_t ringSize_) :
+	id(++nextHandlerId),
+	ringSize(RoundUpToPowerOfTwo(ringSize_)),
+	numRings(0),
+	sharedRing(new Ring(RoundUpToPowerOfTwo(ringSize_))),
+	numDropped(0),
+	numDelivered(0),
+	sleeping(false),
+	shutdown(false),
+	thread(&AsyncLogHandler::Run, this)
+{
+
+}
+
+AsyncLogHandler::~AsyncLogHandler()
+{
+	shutdown = true;
+	condition.notify_one();
+	thread.join();
+}
+
+void AsyncLogHandler::Subscribe(ILogHandler* pHandler)
+{
+	std::unique_lock<std::mutex> lock(subscriberMutex);
+	subscribers.push_back(pHandler);
+}
+
+void AsyncLogHandler::Log(const LogEntry& entry)
+{
+	// the message may live on the caller's stack, so it's copied like any other string argument
+	LogRecord record(entry.GetFilters(), entry.GetLocation(), entry.GetErrorCode());
+	record.Capture("%s", entry.GetMessage());
+	this->Push(entry.GetAlias(), record);
+}
+
+void AsyncLogHandler::LogDeferred(char const* alias, const LogRecord& record)
+{
+	this->Push(alias, record);
+}
+
+void AsyncLogHandler::Push(char const* alias, const LogRecord& record)
+{
+	auto timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+	auto pRing = this->GetRing();
+
+	bool pushed = false;
+	if (pRing)
+	{
+		pushed = pRing->Push(timestamp, alias, record);
+	}
+	else
+	{
+		std::unique_lock<std::mutex> lock(sharedMutex);
+		pushed = sharedRing->Push(timestamp, alias, record);
+	}
+
+	if (!pushed)
+	{
+		++numDropped;
+	}
+	else if (sleeping.exchange(false))
+	{
+		// only the first record after the consumer went to sleep pays for the notification
+		condition.notify_one();
+	}
+}
+
+AsyncLogHandler::Ring* AsyncLogHandler::GetRing()
+{
+	static thread_local ThreadRings local;
+
+	for (auto& binding : local.bindings)
+	{
+		if (binding.first == id)
+		{
+			return binding.second.get();
+		}
+	}
+
+	// forget the rings of handlers that were destroyed
+	local.bindings.erase(std::remove_if(local.bindings.begin(), local.bindings.end(), [](const std::pair<uint64_t, std::shared_ptr<Ring>>& binding)
+	{
+		return binding.second.use_count() == 1;
+	}), local.bindings.end());
+
+	auto ring = this->ClaimRing();
+	if (!ring)
+	{
+		return nullptr;
+	}
+
+	local.bindings.push_back(std::make_pair(id, ring));
+	return ring.get();
+}
+
+std::shared_ptr<AsyncLogHandler::Ring> AsyncLogHandler::ClaimRing()
+{
+	// reuse a ring released by a thread that exited once its records have been delivered
+	auto count = numRings.load(std::memory_order_acquire);
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		if (rings[i]->Claim())
+		{
+			if (rings[i]->Reached(rings[i]->Mark()))
+			{
+				return rings[i];
+			}
+			rings[i]->Release();
+		}
+	}
+
+	std::unique_lock<std::mutex> lock(ringMutex);
+	count = numRings.load(std::memory_order_relaxed);
+	if (count == MAX_PRODUCERS)
+	{
+		return nullptr;
+	}
+	std::shared_ptr<Ring> ring(new Ring(ringSize));
+	ring->Claim();
+	rings[count] = ring;
+	numRings.store(count + 1, std::memory_order_release);
+	return ring;
+}
+
+void AsyncLogHandler::Flush()
+{
+	std::vector<std::pair<Ring*, uint32_t>> marks;
+
+	auto count = numRings.load(std::memory_order_acquire);
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		marks.push_back(std::make_pair(rings[i].get(), rings[i]->Mark()));
+	}
+	{
+		std::unique_lock<std::mutex> lock(sharedMutex);
+		marks.push_back(std::make_pair(sharedRing.get(), sharedRing->Mark()));
+	}
+
+	// the background thread may be asleep without having been notified of the last records
+	condition.notify_one();
+
+	std::unique_lock<std::mutex> lock(flushMutex);
+	flushed.wait(lock, [&]()
+	{
+		return this->IsFlushed(marks);
+	});
+}
+
+bool AsyncLogHandler::IsFlushed(const std::vector<std::pair<Ring*, uint32_t>>& marks) const
+{
+	for (auto& mark : marks)
+	{
+		if (!mark.first->Reached(mark.second))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void AsyncLogHandler::Run()
+{
+	while (!shutdown)
+	{
+		if (!this->DeliverAll())
+		{
+			sleeping = true;
+			// re-check after announcing that we're going to sleep so that a concurrent push either
+			// gets delivered here or notifies us. A lost notification only delays delivery by the timeout.
+			if (!this->DeliverAll() && !shutdown)
+			{
+				std::unique_lock<std::mutex> lock(waitMutex);
+				condition.wait_for(lock, std::chrono::milliseconds(10));
+			}
+			sleeping = false;
+		}
+	}
+
+	this->DeliverAll();
+}
+
+bool AsyncLogHandler::DeliverAll()
+{
+	bool delivered = false;
+	uint32_t numSinceNotify = 0;
+	char message[MAX_LOG_ENTRY_SIZE];
+
+	while (true)
+	{
+		// deliver the oldest record across all rings so that messages stay roughly in time order
+		Ring* pOldest = nullptr;
+		const Entry* pEntry = nullptr;
+
+		auto consider = [&](Ring * pRing)
+		{
+			auto pFront = pRing->Front();
+			if (pFront && (!pEntry || pFront->timestamp < pEntry->timestamp))
+			{
+				pOldest = pRing;
+				pEntry = pFront;
+			}
+		};
+
+		auto count = numRings.load(std::memory_order_acquire);
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			consider(rings[i].get());
+		}
+		consider(sharedRing.get());
+
+		if (!pEntry)
+		{
+			if (delivered)
+			{
+				this->NotifyFlushed();
+			}
+			return delivered;
+		}
+
+		pEntry->record.Format(message, MAX_LOG_ENTRY_SIZE);
+		LogEntry entry(pEntry->alias.c_str(), pEntry->record.GetFilters(), pEntry->record.GetLocation(), message, pEntry->record.GetErrorCode(), pEntry->timestamp);
+
+		{
+			std::unique_lock<std::mutex> lock(subscriberMutex);
+			for (auto pSubscriber : subscribers)
+			{
+				pSubscriber->Log(entry);
+			}
+		}
+
+		pOldest->Pop();
+		++numDelivered;
+		delivered = true;
+
+		// don't keep a flushing thread waiting until a busy producer goes quiet
+		if ((++numSinceNotify % FLUSH_NOTIFY_INTERVAL) == 0)
+		{
+			this->NotifyFlushed();
+		}
+	}
+}
+
+void AsyncLogHandler::NotifyFlushed()
+{
+	// taking the mutex orders the pops before the notification so that a flushing thread can't miss it
+	{
+		std::unique_lock<std::mutex> lock(flushMutex);
+	}
+	flushed.notify_all();
+}
+
+}
@@ -0,0 +1,62 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiopal/AtomicHistogram.h"
+
+using namespace openpal;
+
+namespace asiopal
+{
+
+AtomicHistogram::AtomicHistogram() : count(0), totalMicroseconds(0), maxMicroseconds(0)
+{
+	for (auto& c : counts)
+	{
+		c.store(0, std::memory_order_relaxed);
+	}
+}
+
+void AtomicHistogram::Record(uint64_t microseconds)
+{
+	// single writer, so plain load/store pairs are enough and avoid locked instructions
+	auto& bucket = counts[LatencyHistogram::GetBucket(microseconds)];
+	bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	totalMicroseconds.store(totalMicroseconds.load(std::memory_order_relaxed) + microseconds, std::memory_order_relaxed);
+	if (microseconds > maxMicroseconds.load(std::memory_order_relaxed))
+	{
+		maxMicroseconds.store(microseconds, std::memory_order_relaxed);
+	}
+}
+
+LatencyHistogram AtomicHistogram::Snapshot() const
+{
+	LatencyHistogram snapshot;
+	for (uint32_t i = 0; i < LatencyHistogram::NUM_BUCKETS; ++i)
+	{
+		snapshot.counts[i] = counts[i].load(std::memory_order_relaxed);
+	}
+	snapshot.count = count.load(std::memory_order_relaxed);
+	snapshot.totalMicroseconds = totalMicroseconds.load(std::memory_order_relaxed);
+	snapshot.maxMicroseconds = maxMicroseconds.load(std::memory_order_relaxed);
+	return snapshot;
+}
+
+}
@@ -27,6 +27,7 @@
 #include <sstream>
 
 #include <asiopal/SteadyClock.h>
+#include <asiopal/ShardService.h>
 
 using namespace std;
 using namespace std::chrono;
@@ -40,28 +41,52 @@ IOServiceThreadPool::IOServiceThreadPool(
     uint32_t levels,
     uint32_t aConcurrency,
     std::function<void()> onThreadStart_,
-    std::function<void()> onThreadExit_) :
+    std::function<void()> onThreadExit_,
+    ThreadPoolMode mode_,
+    ShardSelection selection_) :
 	root(pHandler, "pool", levels),
 	logger(root.GetLogger()),
 	onThreadStart(onThreadStart_),
 	onThreadExit(onThreadExit_),
 	isShutdown(false),
-	ioservice(),
-	infiniteTimer(ioservice)
+	mode(mode_),
+	selection(selection_),
+	nextShard(0)
 {
 	if(aConcurrency == 0)
 	{
 		aConcurrency = 1;
 		SIMPLE_LOG_BLOCK(logger, logflags::WARN, "Concurrency was set to 0, defaulting to 1 thread");
 	}
-	infiniteTimer.expires_at(asiopal::asiopal_steady_clock::time_point::max());
-	infiniteTimer.async_wait([](const std::error_code&) {});
+
+	const uint32_t numShards = (mode == ThreadPoolMode::SHARDED) ? aConcurrency : 1;
+	for (uint32_t i = 0; i < numShards; ++i)
+	{
+		std::unique_ptr<Shard> shard(new Shard());
+		if (mode == ThreadPoolMode::SHARDED)
+		{
+			ShardService::Install(shard->ioservice);
+		}
+		shard->infiniteTimer.expires_at(asiopal::asiopal_steady_clock::time_point::max());
+		shard->infiniteTimer.async_wait([](const std::error_code&) {});
+		shards.push_back(std::move(shard));
+	}
+
 	for(uint32_t i = 0; i < aConcurrency; ++i)
 	{
-		threads.push_back(new thread(bind(&IOServiceThreadPool::Run, this)));
+		auto pShard = shards[i % numShards].get();
+		threads.push_back(new thread(bind(&IOServiceThreadPool::Run, this, pShard)));
 	}
 }
 
+IOServiceThreadPool::Shard::Shard() :
+	ioservice(),
+	infiniteTimer(ioservice),
+	load(0)
+{
+
+}
+
 IOServiceThreadPool::~IOServiceThreadPool()
 {
 	this->Shutdown();
@@ -76,7 +101,10 @@ void IOServiceThreadPool::Shutdown()
 	if(!isShutdown)
 	{
 		isShutdown = true;
-		infiniteTimer.cancel();
+		for (auto& shard : shards)
+		{
+			shard->infiniteTimer.cancel();
+		}
 		for (auto pThread : threads)
 		{
 			pThread->join();
@@ -86,13 +114,63 @@ void IOServiceThreadPool::Shutdown()
 
 asio::io_service& IOServiceThreadPool::GetIOService()
 {
-	return ioservice;
+	return shards.front()->ioservice;
+}
+
+asio::io_service& IOServiceThreadPool::Acquire()
+{
+	auto pShard = this->SelectShard();
+	++pShard->load;
+	return pShard->ioservice;
+}
+
+void IOServiceThreadPool::Release(asio::io_service& service)
+{
+	for (auto& shard : shards)
+	{
+		if (&shard->ioservice == &service)
+		{
+			--shard->load;
+			return;
+		}
+	}
+}
+
+uint32_t IOServiceThreadPool::GetLoad(uint32_t shard) const
+{
+	return (shard < shards.size()) ? shards[shard]->load.load() : 0;
 }
 
-void IOServiceThreadPool::Run()
+IOServiceThreadPool::Shard* IOServiceThreadPool::SelectShard()
 {
+	if (selection == ShardSelection::LEAST_LOADED)
+	{
+		// concurrent callers may pick the same shard, this only has to be approximately balanced
+		auto pMin = shards.front().get();
+		for (auto& shard : shards)
+		{
+			if (shard->load < pMin->load)
+			{
+				pMin = shard.get();
+			}
+		}
+		return pMin;
+	}
+	else
+	{
+		return shards[nextShard++ % shards.size()].get();
+	}
+}
+
+void IOServiceThreadPool::Run(Shard* pShard)
+{
+	auto pService = ShardService::Find(pShard->ioservice);
+	if (pService)
+	{
+		pService->SetOwner(std::this_thread::get_id());
+	}
 	onThreadStart();
-	ioservice.run();
+	pShard->ioservice.run();
 	onThreadExit();
 }
 
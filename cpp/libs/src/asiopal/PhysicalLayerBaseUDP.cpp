@@ -0,0 +1,173 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiopal/PhysicalLayerBaseUDP.h"
+
+#include <openpal/logging/LogMacros.h>
+#include <openpal/logging/LogLevels.h>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace asio;
+using namespace openpal;
+
+namespace asiopal
+{
+
+PhysicalLayerBaseUDP::PhysicalLayerBaseUDP(openpal::LogRoot& root, asio::io_service& service) :
+	PhysicalLayerASIO(root, service),
+	socket(service),
+	hasRemoteEndpoint(false),
+	datagram(MAX_DATAGRAM_SIZE)
+{
+
+}
+
+void PhysicalLayerBaseUDP::DoClose()
+{
+	this->CloseSocket();
+}
+
+void PhysicalLayerBaseUDP::DoOpeningClose()
+{
+	this->CloseSocket();
+}
+
+void PhysicalLayerBaseUDP::DoOpenFailure()
+{
+	SIMPLE_LOG_BLOCK(logger, logflags::DBG, "Failed socket open, closing socket");
+	this->CloseSocket();
+}
+
+void PhysicalLayerBaseUDP::DoRead(WSlice& buff)
+{
+	uint8_t* pBuff = buff;
+	const uint32_t size = buff.Size();
+
+	if (pending.IsEmpty())
+	{
+		this->BeginReceive(pBuff, size);
+	}
+	else
+	{
+		// the rest of the last datagram didn't fit in the previous read
+		auto callback = [this, pBuff, size]()
+		{
+			auto num = this->ReadPending(pBuff, size);
+			this->OnReadCallback(std::error_code(), pBuff, num);
+		};
+		pExecutor->PostLambda(callback);
+	}
+}
+
+void PhysicalLayerBaseUDP::BeginReceive(uint8_t* pBuff, uint32_t size)
+{
+	auto callback = [this, pBuff, size](const std::error_code & ec, size_t numRead)
+	{
+		if (ec == asio::error::connection_refused)
+		{
+			// an ICMP port unreachable for an earlier datagram, the peer may not be up yet
+			SIMPLE_LOG_BLOCK(logger, logflags::DBG, "Remote port unreachable");
+			this->BeginReceive(pBuff, size);
+		}
+		else if (ec)
+		{
+			this->OnReadCallback(ec, pBuff, 0);
+		}
+		else
+		{
+			this->OnDatagramFrom(sender);
+			pending = RSlice(datagram.data(), static_cast<uint32_t>(numRead));
+			auto num = this->ReadPending(pBuff, size);
+			this->OnReadCallback(ec, pBuff, num);
+		}
+	};
+
+	socket.async_receive_from(buffer(datagram.data(), datagram.size()), sender, executor.Wrap(callback));
+}
+
+uint32_t PhysicalLayerBaseUDP::ReadPending(uint8_t* pBuff, uint32_t size)
+{
+	auto num = std::min(size, pending.Size());
+	memcpy(pBuff, pending, num);
+	pending.Advance(num);
+	return num;
+}
+
+void PhysicalLayerBaseUDP::DoWrite(const RSlice& buff)
+{
+	if (hasRemoteEndpoint)
+	{
+		this->SendNext(buff, 0);
+	}
+	else
+	{
+		this->OnNoRemoteEndpoint(buff);
+	}
+}
+
+void PhysicalLayerBaseUDP::SendNext(const RSlice& remaining, uint32_t numWritten)
+{
+	auto chunk = remaining.Take(MAX_DATAGRAM_SIZE);
+	auto rest = remaining.Skip(chunk.Size());
+
+	auto callback = [this, rest, numWritten](const std::error_code & ec, size_t numSent)
+	{
+		const uint32_t total = numWritten + static_cast<uint32_t>(numSent);
+
+		if (ec || rest.IsEmpty())
+		{
+			this->OnWriteCallback(ec, total);
+		}
+		else
+		{
+			this->SendNext(rest, total);
+		}
+	};
+
+	socket.async_send_to(buffer(chunk, chunk.Size()), remoteEndpoint, executor.Wrap(callback));
+}
+
+void PhysicalLayerBaseUDP::OnNoRemoteEndpoint(const RSlice& buff)
+{
+	SIMPLE_LOG_BLOCK(logger, logflags::WARN, "No datagram has been received yet, dropping write");
+
+	const uint32_t size = buff.Size();
+	auto callback = [this, size]()
+	{
+		this->OnWriteCallback(std::error_code(), size);
+	};
+	pExecutor->PostLambda(callback);
+}
+
+void PhysicalLayerBaseUDP::CloseSocket()
+{
+	pending = RSlice();
+
+	std::error_code ec;
+	socket.close(ec);
+	if (ec)
+	{
+		FORMAT_LOG_BLOCK(logger, logflags::WARN, "Error while closing socket: %s", ec.message().c_str());
+	}
+}
+
+}
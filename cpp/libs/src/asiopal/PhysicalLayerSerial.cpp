@@ -106,7 +106,7 @@ void PhysicalLayerSerial::DoRead(openpal::WSlice& buff)
 		this->OnReadCallback(error, pBuffer, static_cast<uint32_t>(numRead));
 	};
 
-	port.async_read_some(buffer(pBuffer, buff.Size()), executor.strand.wrap(callback));
+	port.async_read_some(buffer(pBuffer, buff.Size()), executor.Wrap(callback));
 }
 
 void PhysicalLayerSerial::DoWrite(const RSlice& buff)
@@ -116,7 +116,7 @@ void PhysicalLayerSerial::DoWrite(const RSlice& buff)
 		this->OnWriteCallback(error, static_cast<uint32_t>(size));
 	};
 
-	async_write(port, buffer(buff, buff.Size()), executor.strand.wrap(callback));
+	async_write(port, buffer(buff, buff.Size()), executor.Wrap(callback));
 }
 
 }
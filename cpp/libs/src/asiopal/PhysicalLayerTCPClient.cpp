@@ -43,6 +43,7 @@ PhysicalLayerTCPClient::PhysicalLayerTCPClient(
     const std::string& host_,
     const std::string& localAddress_,
     uint16_t port,
+    const SocketOptions& options_,
     std::function<void (asio::ip::tcp::socket&)> aConfigure) :
 
 	PhysicalLayerBaseTCP(root, service),
@@ -52,6 +53,7 @@ PhysicalLayerTCPClient::PhysicalLayerTCPClient(
 	remoteEndpoint(ip::tcp::v4(), port),
 	localEndpoint(),
 	resolver(service),
+	options(options_),
 	configure(aConfigure)
 {
 
@@ -69,7 +71,7 @@ void PhysicalLayerTCPClient::DoOpen()
 		{
 			this->OnOpenCallback(ec);
 		};
-		executor.strand.post(callback);
+		executor.Enqueue(callback);
 	}
 	else
 	{
@@ -81,7 +83,7 @@ void PhysicalLayerTCPClient::DoOpen()
 				this->HandleResolve(code, endpoints);
 			};
 			ip::tcp::resolver::query query(host, "20000");
-			resolver.async_resolve(query, executor.strand.wrap(callback));
+			resolver.async_resolve(query, executor.Wrap(callback));
 		}
 		else
 		{
@@ -90,7 +92,7 @@ void PhysicalLayerTCPClient::DoOpen()
 			{
 				this->OnOpenCallback(code);
 			};
-			socket.async_connect(remoteEndpoint, executor.strand.wrap(callback));
+			socket.async_connect(remoteEndpoint, executor.Wrap(callback));
 		}
 	}
 }
@@ -109,7 +111,7 @@ void PhysicalLayerTCPClient::HandleResolve(const std::error_code& code, asio::ip
 			this->OnOpenCallback(code);
 		};
 
-		asio::async_connect(socket, endpoints, condition, executor.strand.wrap(callback));
+		asio::async_connect(socket, endpoints, condition, executor.Wrap(callback));
 	}
 }
 
@@ -121,6 +123,7 @@ void PhysicalLayerTCPClient::DoOpeningClose()
 void PhysicalLayerTCPClient::DoOpenSuccess()
 {
 	SIMPLE_LOG_BLOCK(logger, logflags::INFO, "Connected to host");
+	SocketHelpers::ApplySocketOptions(options, socket, logger);
 	configure(socket);
 }
 
@@ -20,6 +20,8 @@
  */
 #include "asiopal/PhysicalLayerTCPServer.h"
 
+#include "asiopal/SocketHelpers.h"
+
 #include <asio.hpp>
 
 #include <functional>
@@ -41,12 +43,14 @@ PhysicalLayerTCPServer::PhysicalLayerTCPServer(
     asio::io_service& service,
     const std::string& endpoint,
     uint16_t port,
+    const SocketOptions& options_,
     std::function<void (asio::ip::tcp::socket&)> configure_) :
 
 	PhysicalLayerBaseTCP(root, service),
 	localEndpointString(endpoint),
 	localEndpoint(ip::tcp::v4(), port),
 	acceptor(service),
+	options(options_),
 	configure(configure_)
 {
 
@@ -108,7 +112,7 @@ void PhysicalLayerTCPServer::DoOpen()
 						{
 							this->OnOpenCallback(code);
 						};
-						acceptor.async_accept(socket, remoteEndpoint, executor.strand.wrap(callback));
+						acceptor.async_accept(socket, remoteEndpoint, executor.Wrap(callback));
 					}
 				}
 			}
@@ -120,7 +124,7 @@ void PhysicalLayerTCPServer::DoOpen()
 		{
 			this->OnOpenCallback(code);
 		};
-		acceptor.async_accept(socket, remoteEndpoint, executor.strand.wrap(callback));
+		acceptor.async_accept(socket, remoteEndpoint, executor.Wrap(callback));
 	}
 }
 
@@ -147,6 +151,7 @@ void PhysicalLayerTCPServer::DoOpeningClose()
 void PhysicalLayerTCPServer::DoOpenSuccess()
 {
 	FORMAT_LOG_BLOCK(logger, logflags::INFO, "Accepted connection from: %s", remoteEndpoint.address().to_string().c_str());
+	SocketHelpers::ApplySocketOptions(options, socket, logger);
 	configure(socket);
 }
 
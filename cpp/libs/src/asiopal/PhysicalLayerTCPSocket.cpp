@@ -0,0 +1,119 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiopal/PhysicalLayerTCPSocket.h"
+
+#include <openpal/logging/LogMacros.h>
+#include <openpal/logging/LogLevels.h>
+
+#include <sstream>
+
+using namespace asio;
+using namespace openpal;
+
+namespace asiopal
+{
+
+PhysicalLayerTCPSocket::PhysicalLayerTCPSocket(openpal::LogRoot& root, ASIOExecutor& executor, asio::ip::tcp::socket socket_) :
+	PhysicalLayerPeer(root),
+	pASIOExecutor(&executor),
+	socket(std::move(socket_)),
+	hasOpened(false)
+{
+	this->SetExecutor(executor);
+
+	std::error_code ec;
+	auto remote = socket.remote_endpoint(ec);
+	if (!ec)
+	{
+		std::ostringstream oss;
+		oss << remote.address().to_string() << ":" << remote.port();
+		remoteAddress = oss.str();
+	}
+}
+
+void PhysicalLayerTCPSocket::DoOpen()
+{
+	// the socket was connected before it was handed to us, but it can only be used once
+	std::error_code ec = hasOpened ? asio::error::not_connected : std::error_code();
+	hasOpened = true;
+
+	auto callback = [this, ec]()
+	{
+		this->OnOpenCallback(ec);
+	};
+	pExecutor->PostLambda(callback);
+}
+
+void PhysicalLayerTCPSocket::DoClose()
+{
+	this->ShutdownSocket();
+	this->CloseSocket();
+}
+
+void PhysicalLayerTCPSocket::DoOpeningClose()
+{
+	// nothing is outstanding on the socket, the posted open callback completes the close
+	this->CloseSocket();
+}
+
+void PhysicalLayerTCPSocket::DoRead(WSlice& buff)
+{
+	uint8_t* pBuff = buff;
+
+	auto callback = [this, pBuff](const std::error_code & code, size_t  numRead)
+	{
+		this->OnReadCallback(code, pBuff, static_cast<uint32_t>(numRead));
+	};
+
+	socket.async_read_some(buffer(pBuff, buff.Size()), pASIOExecutor->Wrap(callback));
+}
+
+void PhysicalLayerTCPSocket::DoWrite(const RSlice& buff)
+{
+	auto callback = [this](const std::error_code & code, size_t  numWritten)
+	{
+		this->OnWriteCallback(code, static_cast<uint32_t>(numWritten));
+	};
+
+	async_write(socket, buffer(buff, buff.Size()), pASIOExecutor->Wrap(callback));
+}
+
+void PhysicalLayerTCPSocket::ShutdownSocket()
+{
+	std::error_code ec;
+	socket.shutdown(ip::tcp::socket::shutdown_both, ec);
+	if (ec)
+	{
+		FORMAT_LOG_BLOCK(logger, logflags::DBG, "Error while shutting down socket: %s", ec.message().c_str());
+	}
+}
+
+void PhysicalLayerTCPSocket::CloseSocket()
+{
+	std::error_code ec;
+	socket.close(ec);
+	if (ec)
+	{
+		FORMAT_LOG_BLOCK(logger, logflags::WARN, "Error while closing socket: %s", ec.message().c_str());
+	}
+}
+
+}
@@ -0,0 +1,124 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiopal/PhysicalLayerUDPClient.h"
+
+#include <openpal/logging/LogMacros.h>
+#include <openpal/logging/LogLevels.h>
+
+#include <string>
+
+using namespace asio;
+using namespace openpal;
+
+namespace asiopal
+{
+
+PhysicalLayerUDPClient::PhysicalLayerUDPClient(
+    openpal::LogRoot& root,
+    asio::io_service& service,
+    const std::string& host_,
+    const std::string& localAddress_,
+    uint16_t port_) :
+
+	PhysicalLayerBaseUDP(root, service),
+	host(host_),
+	localAddress(localAddress_),
+	port(port_),
+	resolver(service)
+{
+
+}
+
+void PhysicalLayerUDPClient::DoOpen()
+{
+	std::error_code ec;
+
+	auto local = asio::ip::address::from_string(localAddress.empty() ? "0.0.0.0" : localAddress, ec);
+	if (!ec)
+	{
+		socket.open(ip::udp::v4(), ec);
+	}
+	if (!ec)
+	{
+		socket.bind(ip::udp::endpoint(local, 0), ec);
+	}
+
+	if (ec)
+	{
+		auto callback = [this, ec]()
+		{
+			this->OnOpenCallback(ec);
+		};
+		executor.Enqueue(callback);
+		return;
+	}
+
+	auto address = asio::ip::address::from_string(host, ec);
+	if (ec)
+	{
+		auto callback = [this](const std::error_code & code, ip::udp::resolver::iterator endpoints)
+		{
+			if (code)
+			{
+				this->OnOpenCallback(code);
+			}
+			else
+			{
+				this->Connect(*endpoints);
+			}
+		};
+		ip::udp::resolver::query query(ip::udp::v4(), host, std::to_string(port));
+		resolver.async_resolve(query, executor.Wrap(callback));
+	}
+	else
+	{
+		auto remote = ip::udp::endpoint(address, port);
+		auto callback = [this, remote]()
+		{
+			this->Connect(remote);
+		};
+		executor.Enqueue(callback);
+	}
+}
+
+void PhysicalLayerUDPClient::Connect(const asio::ip::udp::endpoint& remote)
+{
+	// connecting a datagram socket only sets the default destination and filters what is received
+	std::error_code ec;
+	if (this->IsClosing())
+	{
+		ec = asio::error::operation_aborted;
+	}
+	else
+	{
+		socket.connect(remote, ec);
+	}
+
+	if (!ec)
+	{
+		remoteEndpoint = remote;
+		hasRemoteEndpoint = true;
+	}
+
+	this->OnOpenCallback(ec);
+}
+
+}
@@ -0,0 +1,226 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiopal/PhysicalLayerUDPPeer.h"
+
+#include "asiopal/UDPListener.h"
+#include "asiopal/PhysicalLayerBaseUDP.h"
+
+#include <openpal/logging/LogMacros.h>
+#include <openpal/logging/LogLevels.h>
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+
+using namespace asio;
+using namespace openpal;
+
+namespace asiopal
+{
+
+PhysicalLayerUDPPeer::PhysicalLayerUDPPeer(openpal::LogRoot& root, UDPListener& listener, const asio::ip::udp::endpoint& remote) :
+	PhysicalLayerPeer(root),
+	pListener(&listener),
+	remoteEndpoint(remote),
+	isRegistered(true),
+	hasOpened(false),
+	rxOffset(0),
+	pReadBuffer(nullptr),
+	readSize(0),
+	idleTimer(listener.executor),
+	lastReceive(listener.executor.GetTime())
+{
+	this->SetExecutor(listener.executor);
+
+	std::ostringstream oss;
+	oss << remote.address().to_string() << ":" << remote.port();
+	remoteAddress = oss.str();
+
+	if (!(listener.peerIdleTimeout == TimeDuration::Max()))
+	{
+		this->StartIdleTimer(listener.peerIdleTimeout);
+	}
+}
+
+PhysicalLayerUDPPeer::~PhysicalLayerUDPPeer()
+{
+	this->Unregister();
+}
+
+void PhysicalLayerUDPPeer::OnDatagram(const uint8_t* pData, uint32_t size)
+{
+	if (idleTimer.IsActive())
+	{
+		// the timer is only moved when it expires
+		lastReceive = pExecutor->GetTime();
+	}
+
+	if ((NumQueued() + size) > MAX_QUEUED_BYTES)
+	{
+		FORMAT_LOG_BLOCK(logger, logflags::WARN, "Receive queue for %s is full, dropping datagram", remoteAddress.c_str());
+		return;
+	}
+
+	rxQueue.insert(rxQueue.end(), pData, pData + size);
+
+	if (pReadBuffer)
+	{
+		this->Deliver();
+	}
+}
+
+void PhysicalLayerUDPPeer::Deliver()
+{
+	auto pBuff = pReadBuffer;
+	auto num = std::min(readSize, NumQueued());
+
+	memcpy(pBuff, rxQueue.data() + rxOffset, num);
+	rxOffset += num;
+
+	// usually the read drains the queue and this is a clear. Otherwise each byte is moved at most once more on average
+	if (rxOffset > (rxQueue.size() / 2))
+	{
+		rxQueue.erase(rxQueue.begin(), rxQueue.begin() + rxOffset);
+		rxOffset = 0;
+	}
+
+	pReadBuffer = nullptr;
+
+	this->OnReadCallback(std::error_code(), pBuff, num);
+}
+
+void PhysicalLayerUDPPeer::DoOpen()
+{
+	std::error_code ec = hasOpened ? asio::error::not_connected : std::error_code();
+	hasOpened = true;
+
+	auto callback = [this, ec]()
+	{
+		this->OnOpenCallback(ec);
+	};
+	pExecutor->PostLambda(callback);
+}
+
+void PhysicalLayerUDPPeer::DoClose()
+{
+	idleTimer.Cancel();
+	this->Unregister();
+
+	if (pReadBuffer)
+	{
+		auto pBuff = pReadBuffer;
+		pReadBuffer = nullptr;
+		auto callback = [this, pBuff]()
+		{
+			this->OnReadCallback(asio::error::operation_aborted, pBuff, 0);
+		};
+		pExecutor->PostLambda(callback);
+	}
+}
+
+void PhysicalLayerUDPPeer::DoOpeningClose()
+{
+	// the posted open callback completes the close
+	idleTimer.Cancel();
+	this->Unregister();
+}
+
+void PhysicalLayerUDPPeer::DoRead(WSlice& buff)
+{
+	pReadBuffer = buff;
+	readSize = buff.Size();
+
+	if (NumQueued() > 0)
+	{
+		auto callback = [this]()
+		{
+			// a datagram may have completed the read in the meantime
+			if (pReadBuffer)
+			{
+				this->Deliver();
+			}
+		};
+		pExecutor->PostLambda(callback);
+	}
+}
+
+void PhysicalLayerUDPPeer::DoWrite(const RSlice& buff)
+{
+	this->SendNext(buff, 0);
+}
+
+void PhysicalLayerUDPPeer::SendNext(const RSlice& remaining, uint32_t numWritten)
+{
+	auto chunk = remaining.Take(PhysicalLayerBaseUDP::MAX_DATAGRAM_SIZE);
+	auto rest = remaining.Skip(chunk.Size());
+
+	auto callback = [this, rest, numWritten](const std::error_code & ec, size_t numSent)
+	{
+		const uint32_t total = numWritten + static_cast<uint32_t>(numSent);
+
+		if (ec || rest.IsEmpty())
+		{
+			this->OnWriteCallback(ec, total);
+		}
+		else
+		{
+			this->SendNext(rest, total);
+		}
+	};
+
+	pListener->socket.async_send_to(buffer(chunk, chunk.Size()), remoteEndpoint, pListener->executor.Wrap(callback));
+}
+
+void PhysicalLayerUDPPeer::StartIdleTimer(const TimeDuration& timeout)
+{
+	auto expired = [this]()
+	{
+		this->OnIdleTimeout();
+	};
+	idleTimer.Start(timeout, expired);
+}
+
+void PhysicalLayerUDPPeer::OnIdleTimeout()
+{
+	const auto timeout = pListener->peerIdleTimeout.GetMilliseconds();
+	const auto idle = pExecutor->GetTime().milliseconds - lastReceive.milliseconds;
+
+	if (idle < timeout)
+	{
+		this->StartIdleTimer(TimeDuration::Milliseconds(timeout - idle));
+	}
+	else if (this->CanClose())
+	{
+		FORMAT_LOG_BLOCK(logger, logflags::INFO, "Closing idle peer %s", remoteAddress.c_str());
+		this->BeginClose();
+	}
+}
+
+void PhysicalLayerUDPPeer::Unregister()
+{
+	if (isRegistered)
+	{
+		isRegistered = false;
+		pListener->Remove(remoteEndpoint);
+	}
+}
+
+}
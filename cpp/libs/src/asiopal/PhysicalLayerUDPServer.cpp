@@ -0,0 +1,84 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiopal/PhysicalLayerUDPServer.h"
+
+#include <openpal/logging/LogMacros.h>
+#include <openpal/logging/LogLevels.h>
+
+using namespace asio;
+using namespace openpal;
+
+namespace asiopal
+{
+
+PhysicalLayerUDPServer::PhysicalLayerUDPServer(
+    openpal::LogRoot& root,
+    asio::io_service& service,
+    const std::string& endpoint,
+    uint16_t port) :
+
+	PhysicalLayerBaseUDP(root, service),
+	localEndpointString(endpoint),
+	localEndpoint(ip::udp::v4(), port)
+{
+
+}
+
+void PhysicalLayerUDPServer::DoOpen()
+{
+	std::error_code ec;
+
+	auto address = asio::ip::address::from_string(localEndpointString, ec);
+	if (!ec)
+	{
+		localEndpoint.address(address);
+		socket.open(localEndpoint.protocol(), ec);
+	}
+	if (!ec)
+	{
+		socket.set_option(ip::udp::socket::reuse_address(true), ec);
+	}
+	if (!ec)
+	{
+		socket.bind(localEndpoint, ec);
+	}
+
+	// the peer is learned from the first datagram that arrives
+	hasRemoteEndpoint = false;
+
+	auto callback = [this, ec]()
+	{
+		this->OnOpenCallback(ec);
+	};
+	executor.Enqueue(callback);
+}
+
+void PhysicalLayerUDPServer::OnDatagramFrom(const asio::ip::udp::endpoint& sender)
+{
+	if (!hasRemoteEndpoint || sender != remoteEndpoint)
+	{
+		FORMAT_LOG_BLOCK(logger, logflags::INFO, "Peer is now %s:%u", sender.address().to_string().c_str(), sender.port());
+		remoteEndpoint = sender;
+		hasRemoteEndpoint = true;
+	}
+}
+
+}
@@ -0,0 +1,55 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiopal/ShardService.h"
+
+namespace asiopal
+{
+
+asio::io_service::id ShardService::id;
+
+ShardService::ShardService(asio::io_service& service) :
+	asio::io_service::service(service),
+	owner(std::thread::id())
+{
+
+}
+
+void ShardService::Install(asio::io_service& service)
+{
+	asio::add_service(service, new ShardService(service));
+}
+
+ShardService* ShardService::Find(asio::io_service& service)
+{
+	return asio::has_service<ShardService>(service) ? &asio::use_service<ShardService>(service) : nullptr;
+}
+
+void ShardService::SetOwner(std::thread::id owner_)
+{
+	owner = owner_;
+}
+
+bool ShardService::RunningInThisThread() const
+{
+	return owner.load() == std::this_thread::get_id();
+}
+
+}
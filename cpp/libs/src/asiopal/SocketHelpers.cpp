@@ -0,0 +1,170 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiopal/SocketHelpers.h"
+
+#include <openpal/logging/LogMacros.h>
+#include <openpal/logging/LogLevels.h>
+
+#include <algorithm>
+
+using namespace asio;
+using namespace openpal;
+
+namespace asiopal
+{
+
+namespace
+{
+	// whole seconds, rounded up so that a sub-second setting doesn't turn into the operating system default
+	int ToSeconds(const TimeDuration& duration)
+	{
+		return static_cast<int>(std::max<int64_t>(1, (duration.GetMilliseconds() + 999) / 1000));
+	}
+
+	// an integer option at any level, for the options asio doesn't define such as TCP_KEEPIDLE
+	class SettableSocketOption
+	{
+	public:
+
+		SettableSocketOption(int level_, int name_, int value_) : optionLevel(level_), optionName(name_), value(value_)
+		{}
+
+		template <class Protocol>
+		int level(const Protocol&) const
+		{
+			return optionLevel;
+		}
+
+		template <class Protocol>
+		int name(const Protocol&) const
+		{
+			return optionName;
+		}
+
+		template <class Protocol>
+		const int* data(const Protocol&) const
+		{
+			return &value;
+		}
+
+		template <class Protocol>
+		std::size_t size(const Protocol&) const
+		{
+			return sizeof(value);
+		}
+
+	private:
+
+		int optionLevel;
+		int optionName;
+		int value;
+	};
+
+	template <class Option>
+	void Apply(ip::tcp::socket::lowest_layer_type& socket, const Option& option, const char* name, Logger& logger)
+	{
+		std::error_code ec;
+		socket.set_option(option, ec);
+		if (ec)
+		{
+			FORMAT_LOG_BLOCK(logger, logflags::WARN, "Unable to set %s: %s", name, ec.message().c_str());
+		}
+	}
+
+#if (!defined(TCP_KEEPIDLE) && !defined(TCP_KEEPALIVE)) || !defined(TCP_KEEPINTVL) || !defined(TCP_KEEPCNT) || !defined(TCP_USER_TIMEOUT) || !defined(SO_BUSY_POLL)
+	void NotSupported(const char* name, Logger& logger)
+	{
+		FORMAT_LOG_BLOCK(logger, logflags::WARN, "%s is not supported on this platform", name);
+	}
+#endif
+}
+
+void SocketHelpers::ApplySocketOptions(const SocketOptions& options, ip::tcp::socket::lowest_layer_type& socket, Logger& logger)
+{
+	if (options.noDelay)
+	{
+		Apply(socket, ip::tcp::no_delay(true), "TCP_NODELAY", logger);
+	}
+
+	if (options.sendBufferSize > 0)
+	{
+		Apply(socket, socket_base::send_buffer_size(options.sendBufferSize), "SO_SNDBUF", logger);
+	}
+
+	if (options.receiveBufferSize > 0)
+	{
+		Apply(socket, socket_base::receive_buffer_size(options.receiveBufferSize), "SO_RCVBUF", logger);
+	}
+
+	if (options.keepAlive)
+	{
+		Apply(socket, socket_base::keep_alive(true), "SO_KEEPALIVE", logger);
+
+		if (options.keepAliveIdle.GetMilliseconds() > 0)
+		{
+#if defined(TCP_KEEPIDLE)
+			Apply(socket, SettableSocketOption(IPPROTO_TCP, TCP_KEEPIDLE, ToSeconds(options.keepAliveIdle)), "TCP_KEEPIDLE", logger);
+#elif defined(TCP_KEEPALIVE)
+			Apply(socket, SettableSocketOption(IPPROTO_TCP, TCP_KEEPALIVE, ToSeconds(options.keepAliveIdle)), "TCP_KEEPALIVE", logger);
+#else
+			NotSupported("TCP_KEEPIDLE", logger);
+#endif
+		}
+
+		if (options.keepAliveInterval.GetMilliseconds() > 0)
+		{
+#ifdef TCP_KEEPINTVL
+			Apply(socket, SettableSocketOption(IPPROTO_TCP, TCP_KEEPINTVL, ToSeconds(options.keepAliveInterval)), "TCP_KEEPINTVL", logger);
+#else
+			NotSupported("TCP_KEEPINTVL", logger);
+#endif
+		}
+
+		if (options.keepAliveCount > 0)
+		{
+#ifdef TCP_KEEPCNT
+			Apply(socket, SettableSocketOption(IPPROTO_TCP, TCP_KEEPCNT, static_cast<int>(options.keepAliveCount)), "TCP_KEEPCNT", logger);
+#else
+			NotSupported("TCP_KEEPCNT", logger);
+#endif
+		}
+	}
+
+	if (options.userTimeout.GetMilliseconds() > 0)
+	{
+#ifdef TCP_USER_TIMEOUT
+		Apply(socket, SettableSocketOption(IPPROTO_TCP, TCP_USER_TIMEOUT, static_cast<int>(options.userTimeout.GetMilliseconds())), "TCP_USER_TIMEOUT", logger);
+#else
+		NotSupported("TCP_USER_TIMEOUT", logger);
+#endif
+	}
+
+	if (options.busyPollMicroseconds > 0)
+	{
+#ifdef SO_BUSY_POLL
+		Apply(socket, SettableSocketOption(SOL_SOCKET, SO_BUSY_POLL, static_cast<int>(options.busyPollMicroseconds)), "SO_BUSY_POLL", logger);
+#else
+		NotSupported("SO_BUSY_POLL", logger);
+#endif
+	}
+}
+
+}
@@ -0,0 +1,119 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiopal/TCPListener.h"
+
+#include "asiopal/SocketHelpers.h"
+
+#include <openpal/logging/LogMacros.h>
+#include <openpal/logging/LogLevels.h>
+
+using namespace asio;
+using namespace openpal;
+
+namespace asiopal
+{
+
+TCPListener::TCPListener(
+    openpal::LogRoot& root,
+    asio::io_service& service,
+    const std::string& endpoint,
+    uint16_t port,
+    const SocketOptions& options_,
+    std::function<void (asio::ip::tcp::socket&)> configure_) :
+	Listener(service),
+	pRoot(&root),
+	logger(root.GetLogger()),
+	localEndpointString(endpoint),
+	localEndpoint(ip::tcp::v4(), port),
+	acceptor(service),
+	socket(service),
+	options(options_),
+	configure(configure_)
+{
+
+}
+
+std::error_code TCPListener::Listen()
+{
+	std::error_code ec;
+
+	auto address = asio::ip::address::from_string(localEndpointString, ec);
+	if (ec)
+	{
+		return ec;
+	}
+
+	localEndpoint.address(address);
+	acceptor.open(localEndpoint.protocol(), ec);
+	if (ec)
+	{
+		return ec;
+	}
+
+	acceptor.set_option(ip::tcp::acceptor::reuse_address(true), ec);
+	if (!ec)
+	{
+		acceptor.bind(localEndpoint, ec);
+	}
+	if (!ec)
+	{
+		acceptor.listen(socket_base::max_connections, ec);
+	}
+	if (ec)
+	{
+		this->Close();
+	}
+
+	return ec;
+}
+
+void TCPListener::BeginAccept(const AcceptCallback& callback)
+{
+	auto handler = [this, callback](const std::error_code & ec)
+	{
+		if (ec)
+		{
+			callback(ec, nullptr);
+		}
+		else
+		{
+			SocketHelpers::ApplySocketOptions(options, socket, logger);
+			configure(socket);
+
+			// a moved-from socket is left as if it was just constructed, so it can accept the next connection
+			callback(ec, new PhysicalLayerTCPSocket(*pRoot, executor, std::move(socket)));
+		}
+	};
+
+	acceptor.async_accept(socket, executor.Wrap(handler));
+}
+
+void TCPListener::Close()
+{
+	std::error_code ec;
+	acceptor.close(ec);
+	if (ec)
+	{
+		FORMAT_LOG_BLOCK(logger, logflags::WARN, "Error while closing tcp acceptor: %s", ec.message().c_str());
+	}
+}
+
+}
@@ -20,6 +20,8 @@
  */
 #include "asiopal/TimerASIO.h"
 
+#include "asiopal/ASIOExecutor.h"
+
 #include <assert.h>
 
 using namespace openpal;
@@ -27,9 +29,9 @@ using namespace openpal;
 namespace asiopal
 {
 
-TimerASIO::TimerASIO(asio::strand& strand) :
-	canceled(false),
-	timer(strand.get_io_service())
+TimerASIO::TimerASIO(ASIOExecutor& executor) :
+	pExecutor(&executor),
+	canceled(false)
 {
 
 }
@@ -39,14 +41,14 @@ TimerASIO::TimerASIO(asio::strand& strand) :
  */
 openpal::MonotonicTimestamp TimerASIO::ExpiresAt()
 {
-	return std::chrono::duration_cast<std::chrono::milliseconds>(timer.expires_at().time_since_epoch()).count();
+	return static_cast<int64_t>(this->GetExpiration());
 }
 
 void TimerASIO::Cancel()
 {
 	assert(!canceled);
-	timer.cancel();
 	canceled = true;
+	pExecutor->CancelTimer(this);
 }
 
 
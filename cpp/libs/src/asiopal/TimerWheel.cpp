@@ -0,0 +1,289 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiopal/TimerWheel.h"
+
+#include <assert.h>
+
+namespace asiopal
+{
+
+TimerWheelNode::TimerWheelNode() :
+	expiration(0),
+	slot(UNLINKED),
+	pPrev(nullptr),
+	pNext(nullptr)
+{
+
+}
+
+TimerWheel::TimerWheel(Tick now) :
+	current(now),
+	numScheduled(0)
+{
+	for (uint32_t i = 0; i < NUM_LEVELS; ++i)
+	{
+		levelCount[i] = 0;
+	}
+}
+
+TimerWheel::Tick TimerWheel::Schedule(TimerWheelNode& node, Tick expiration, Tick now)
+{
+	assert(!node.IsLinked());
+
+	// an empty wheel doesn't need to walk the ticks it missed
+	if (numScheduled == 0 && current < now)
+	{
+		current = now;
+	}
+
+	node.expiration = expiration;
+	return this->Place(node);
+}
+
+void TimerWheel::Cancel(TimerWheelNode& node)
+{
+	if (node.IsLinked())
+	{
+		this->Unlink(node);
+	}
+}
+
+void TimerWheel::Advance(Tick now)
+{
+	while (current <= now)
+	{
+		if (numScheduled == 0)
+		{
+			current = now + 1;
+			return;
+		}
+
+		const uint32_t index = static_cast<uint32_t>(current & (LEVEL0_SIZE - 1));
+
+		if (index == 0)
+		{
+			// each level cascades one slot down whenever the level below it wraps around
+			for (uint32_t level = 1; level < NUM_LEVELS; ++level)
+			{
+				const uint32_t cascaded = static_cast<uint32_t>((current >> Shift(level)) & (LEVEL_SIZE - 1));
+				this->Cascade(level, cascaded);
+				if (cascaded != 0)
+				{
+					break;
+				}
+			}
+		}
+		else if (levelCount[0] == 0)
+		{
+			// nothing can expire before the next cascade, so skip straight to it
+			const Tick next = (current | (LEVEL0_SIZE - 1)) + 1;
+			current = (next <= now) ? next : (now + 1);
+			continue;
+		}
+
+		List& list = slots[index];
+		while (list.pHead)
+		{
+			TimerWheelNode* pNode = list.pHead;
+			this->Unlink(*pNode);
+			this->Link(*pNode, EXPIRED);
+		}
+
+		++current;
+	}
+}
+
+TimerWheelNode* TimerWheel::PopExpired()
+{
+	TimerWheelNode* pNode = expired.pHead;
+	if (pNode)
+	{
+		this->Unlink(*pNode);
+	}
+	return pNode;
+}
+
+bool TimerWheel::NextWake(Tick& tick) const
+{
+	if (numScheduled == 0)
+	{
+		return false;
+	}
+
+	bool found = false;
+	Tick best = 0;
+
+	if (levelCount[0] > 0)
+	{
+		for (uint32_t i = 0; i < LEVEL0_SIZE; ++i)
+		{
+			if (slots[(current + i) & (LEVEL0_SIZE - 1)].pHead)
+			{
+				best = current + i;
+				found = true;
+				break;
+			}
+		}
+	}
+
+	for (uint32_t level = 1; level < NUM_LEVELS; ++level)
+	{
+		if (levelCount[level] > 0)
+		{
+			const uint32_t base = LEVEL0_SIZE + (level - 1) * LEVEL_SIZE;
+			const Tick first = (current + (Tick(1) << Shift(level)) - 1) >> Shift(level);
+			for (uint32_t i = 0; i < LEVEL_SIZE; ++i)
+			{
+				const uint32_t index = static_cast<uint32_t>((first + i) & (LEVEL_SIZE - 1));
+				if (slots[base + index].pHead)
+				{
+					const Tick cascade = CascadeTick(level, index);
+					if (!found || cascade < best)
+					{
+						best = cascade;
+						found = true;
+					}
+					break;
+				}
+			}
+		}
+	}
+
+	tick = best;
+	return found;
+}
+
+TimerWheel::Tick TimerWheel::CascadeTick(uint32_t level, uint32_t index) const
+{
+	const uint32_t shift = Shift(level);
+	// first multiple of the level's span at or after the current tick
+	const Tick first = (current + (Tick(1) << shift) - 1) >> shift;
+	const Tick cycle = first + ((index - first) & (LEVEL_SIZE - 1));
+	return cycle << shift;
+}
+
+TimerWheel::Tick TimerWheel::Place(TimerWheelNode& node)
+{
+	Tick expires = (node.expiration < current) ? current : node.expiration;
+	const Tick delta = expires - current;
+
+	if (delta < LEVEL0_SIZE)
+	{
+		this->Link(node, static_cast<uint16_t>(expires & (LEVEL0_SIZE - 1)));
+		return expires;
+	}
+
+	for (uint32_t level = 1; level < NUM_LEVELS; ++level)
+	{
+		const uint32_t shift = Shift(level);
+		const Tick span = Tick(1) << (shift + LEVEL_BITS);
+		const bool last = (level == (NUM_LEVELS - 1));
+
+		if (delta < span || last)
+		{
+			if (delta >= span)
+			{
+				// park it as far out as the wheel reaches, it's re-filed when that slot cascades
+				expires = current + span - 1;
+			}
+
+			const uint32_t index = static_cast<uint32_t>((expires >> shift) & (LEVEL_SIZE - 1));
+			this->Link(node, static_cast<uint16_t>(LEVEL0_SIZE + (level - 1) * LEVEL_SIZE + index));
+			return CascadeTick(level, index);
+		}
+	}
+
+	assert(false);
+	return expires;
+}
+
+void TimerWheel::Cascade(uint32_t level, uint32_t index)
+{
+	List& list = slots[LEVEL0_SIZE + (level - 1) * LEVEL_SIZE + index];
+	TimerWheelNode* pNode = list.pHead;
+	list.pHead = list.pTail = nullptr;
+
+	while (pNode)
+	{
+		TimerWheelNode* pNext = pNode->pNext;
+		--levelCount[level];
+		--numScheduled;
+		pNode->slot = TimerWheelNode::UNLINKED;
+		pNode->pPrev = pNode->pNext = nullptr;
+		this->Place(*pNode);
+		pNode = pNext;
+	}
+}
+
+void TimerWheel::Link(TimerWheelNode& node, uint16_t slot)
+{
+	List& list = this->GetList(slot);
+	node.slot = slot;
+	node.pPrev = list.pTail;
+	node.pNext = nullptr;
+	if (list.pTail)
+	{
+		list.pTail->pNext = &node;
+	}
+	else
+	{
+		list.pHead = &node;
+	}
+	list.pTail = &node;
+
+	if (slot != EXPIRED)
+	{
+		++numScheduled;
+		++levelCount[LevelOf(slot)];
+	}
+}
+
+void TimerWheel::Unlink(TimerWheelNode& node)
+{
+	List& list = this->GetList(node.slot);
+	if (node.pPrev)
+	{
+		node.pPrev->pNext = node.pNext;
+	}
+	else
+	{
+		list.pHead = node.pNext;
+	}
+	if (node.pNext)
+	{
+		node.pNext->pPrev = node.pPrev;
+	}
+	else
+	{
+		list.pTail = node.pPrev;
+	}
+
+	if (node.slot != EXPIRED)
+	{
+		--numScheduled;
+		--levelCount[LevelOf(node.slot)];
+	}
+
+	node.slot = TimerWheelNode::UNLINKED;
+	node.pPrev = node.pNext = nullptr;
+}
+
+}
@@ -0,0 +1,188 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "asiopal/UDPListener.h"
+
+#include "asiopal/PhysicalLayerUDPPeer.h"
+#include "asiopal/PhysicalLayerBaseUDP.h"
+
+#include <openpal/logging/LogMacros.h>
+#include <openpal/logging/LogLevels.h>
+
+#include <assert.h>
+
+using namespace asio;
+using namespace openpal;
+
+namespace asiopal
+{
+
+UDPListener::UDPListener(
+    openpal::LogRoot& root,
+    asio::io_service& service,
+    const std::string& endpoint,
+    uint16_t port,
+    const openpal::TimeDuration& peerIdleTimeout_) :
+	Listener(service),
+	pRoot(&root),
+	logger(root.GetLogger()),
+	peerIdleTimeout(peerIdleTimeout_),
+	localEndpointString(endpoint),
+	localEndpoint(ip::udp::v4(), port),
+	socket(service),
+	datagram(PhysicalLayerBaseUDP::MAX_DATAGRAM_SIZE),
+	isReceiving(false),
+	isAccepting(false)
+{
+
+}
+
+UDPListener::~UDPListener()
+{
+	assert(peers.empty());
+}
+
+std::error_code UDPListener::Listen()
+{
+	std::error_code ec;
+
+	auto address = asio::ip::address::from_string(localEndpointString, ec);
+	if (!ec)
+	{
+		localEndpoint.address(address);
+		socket.open(localEndpoint.protocol(), ec);
+	}
+	if (!ec)
+	{
+		socket.set_option(ip::udp::socket::reuse_address(true), ec);
+	}
+	if (!ec)
+	{
+		socket.bind(localEndpoint, ec);
+	}
+
+	if (ec)
+	{
+		this->Close();
+	}
+	else if (!isReceiving)
+	{
+		this->BeginReceive();
+	}
+
+	return ec;
+}
+
+void UDPListener::BeginAccept(const AcceptCallback& callback)
+{
+	assert(!isAccepting);
+	acceptCallback = callback;
+	isAccepting = true;
+}
+
+void UDPListener::Close()
+{
+	std::error_code ec;
+	socket.close(ec);
+	if (ec)
+	{
+		FORMAT_LOG_BLOCK(logger, logflags::WARN, "Error while closing udp socket: %s", ec.message().c_str());
+	}
+
+	if (!isReceiving && isAccepting)
+	{
+		// no receive is outstanding to complete the accept
+		auto callback = [this]()
+		{
+			if (isAccepting)
+			{
+				isAccepting = false;
+				acceptCallback(asio::error::operation_aborted, nullptr);
+			}
+		};
+		executor.Enqueue(callback);
+	}
+}
+
+void UDPListener::BeginReceive()
+{
+	auto callback = [this](const std::error_code & ec, size_t numRead)
+	{
+		this->OnReceive(ec, numRead);
+	};
+
+	isReceiving = true;
+	socket.async_receive_from(buffer(datagram.data(), datagram.size()), sender, executor.Wrap(callback));
+}
+
+void UDPListener::OnReceive(const std::error_code& ec, size_t numRead)
+{
+	isReceiving = false;
+
+	if (!socket.is_open())
+	{
+		// closed, the outstanding accept can't complete
+		if (isAccepting)
+		{
+			isAccepting = false;
+			acceptCallback(asio::error::operation_aborted, nullptr);
+		}
+		return;
+	}
+
+	if (ec)
+	{
+		// errors on a datagram socket concern a single datagram, i.e. an ICMP port unreachable
+		FORMAT_LOG_BLOCK(logger, logflags::DBG, "Error receiving datagram: %s", ec.message().c_str());
+	}
+	else
+	{
+		const uint32_t size = static_cast<uint32_t>(numRead);
+		auto iter = peers.find(sender);
+		if (iter != peers.end())
+		{
+			iter->second->OnDatagram(datagram.data(), size);
+		}
+		else if (isAccepting)
+		{
+			auto pPeer = new PhysicalLayerUDPPeer(*pRoot, *this, sender);
+			peers[sender] = pPeer;
+			pPeer->OnDatagram(datagram.data(), size);
+
+			// the callback may begin the next accept
+			isAccepting = false;
+			auto callback = acceptCallback;
+			callback(ec, pPeer);
+		}
+		else
+		{
+			FORMAT_LOG_BLOCK(logger, logflags::DBG, "Dropped datagram from %s:%u", sender.address().to_string().c_str(), sender.port());
+		}
+	}
+
+	this->BeginReceive();
+}
+
+void UDPListener::Remove(const asio::ip::udp::endpoint& remote)
+{
+	peers.erase(remote);
+}
+
+}
@@ -21,8 +21,6 @@
 
 #include "asiopal/tls/PhysicalLayerTLSBase.h"
 
-#include "asiopal/tls/TLSHelpers.h"
-
 #include <openpal/logging/LogMacros.h>
 #include <openpal/logging/LogLevels.h>
 
@@ -35,26 +33,52 @@ namespace asiopal
 
 	PhysicalLayerTLSBase::PhysicalLayerTLSBase(
 			openpal::LogRoot& root, 
-			asio::io_service& service,			
-			const TLSConfig& config,
-			asio::ssl::context_base::method method) :
+			asio::io_service& service_,
+			std::shared_ptr<TLSContext> context_) :
 
-		PhysicalLayerASIO(root, service),
-		ctx(method)
+		PhysicalLayerASIO(root, service_),
+		service(service_),
+		context(context_)
 	{
+		this->ResetStream();
+	}
 
-		TLSHelpers::ApplyConfig(config, ctx);
+	void PhysicalLayerTLSBase::ResetStream()
+	{
+		/// The stream inherits all the settings from the context when it is created
+		this->stream = std::unique_ptr<asio::ssl::stream<asio::ip::tcp::socket>>(new asio::ssl::stream<asio::ip::tcp::socket>(service, context->Get()));
 
-		ctx.set_verify_callback(
-			[this](bool preverified, asio::ssl::verify_context& ctx)
+		/// The context may be shared, so the verify callback that logs to this channel goes on the stream
+		stream->set_verify_callback(
+			[this](bool preverified, asio::ssl::verify_context& verifyContext)
 			{
-				return this->LogPeerCertificateInfo(preverified, ctx);
+				return this->LogPeerCertificateInfo(preverified, verifyContext);
 			}
 		);
+	}
+
+	void PhysicalLayerTLSBase::OnHandshakeResult(const std::error_code& ec)
+	{
+		if (!ec)
+		{
+			const bool resumed = SSL_session_reused(stream->native_handle()) != 0;
 
-		/// Now with all of this configured, we can create the stream class
-		/// The order is important since the socket object inerhits all the settings from the context
-		this->stream = std::unique_ptr<asio::ssl::stream<asio::ip::tcp::socket>>(new asio::ssl::stream<asio::ip::tcp::socket>(service, ctx));		
+			SIMPLE_LOG_BLOCK(logger, logflags::DBG, resumed ? "TLS session resumed" : "Full TLS handshake");
+
+			if (pChannelStatistics)
+			{
+				if (resumed)
+				{
+					++pChannelStatistics->numResumedHandshake;
+				}
+				else
+				{
+					++pChannelStatistics->numFullHandshake;
+				}
+			}
+		}
+
+		this->OnOpenCallback(ec);
 	}
 
 	bool PhysicalLayerTLSBase::LogPeerCertificateInfo(bool preverified, asio::ssl::verify_context& ctx)
@@ -89,7 +113,7 @@ namespace asiopal
 			this->OnReadCallback(ec, pBuff, static_cast<uint32_t>(numRead));
 		};
 
-		stream->async_read_some(buffer(pBuff, dest.Size()), executor.strand.wrap(callback));
+		stream->async_read_some(buffer(pBuff, dest.Size()), executor.Wrap(callback));
 	}
 	
 	void PhysicalLayerTLSBase::DoWrite(const openpal::RSlice& data)
@@ -99,7 +123,7 @@ namespace asiopal
 			this->OnWriteCallback(code, static_cast<uint32_t>(numWritten));
 		};
 		
-		async_write(*stream, buffer(data, data.Size()), executor.strand.wrap(callback));
+		async_write(*stream, buffer(data, data.Size()), executor.Wrap(callback));
 	}
 	
 	void PhysicalLayerTLSBase::DoOpenFailure()
@@ -110,7 +134,11 @@ namespace asiopal
 	}
 
 	void PhysicalLayerTLSBase::ShutdownTLSStream()
-	{		
+	{
+		// Send our close_notify without waiting for the peer's. The synchronous shutdown would otherwise block
+		// the executor until the peer answers, and a session is only kept for resumption after a clean shutdown.
+		SSL_set_shutdown(stream->native_handle(), SSL_get_shutdown(stream->native_handle()) | SSL_RECEIVED_SHUTDOWN);
+
 		std::error_code ec;
 		stream->shutdown(ec);
 		if (ec)
@@ -22,7 +22,6 @@
 #include "asiopal/tls/PhysicalLayerTLSClient.h"
 
 #include "asiopal/SocketHelpers.h"
-#include "asiopal/tls/TLSHelpers.h"
 
 using namespace asio;
 using namespace asiopal;
@@ -36,15 +35,34 @@ namespace asiopal
 		const std::string& host_,
 		const std::string& localAddress_,
 		uint16_t port,
-		const TLSConfig& config
+		const TLSConfig& config,
+		const SocketOptions& options_,
+		std::function<void (asio::ip::tcp::socket::lowest_layer_type&)> configure_
 	) :
-			PhysicalLayerTLSBase(root, service, config, ssl::context_base::sslv23_client),
+			PhysicalLayerTLSClient(root, service, host_, localAddress_, port, std::make_shared<TLSContext>(config, TLSRole::CLIENT), options_, configure_)
+	{
+
+	}
+
+	PhysicalLayerTLSClient::PhysicalLayerTLSClient(
+		openpal::LogRoot& root,
+		asio::io_service& service,
+		const std::string& host_,
+		const std::string& localAddress_,
+		uint16_t port,
+		std::shared_ptr<TLSContext> context,
+		const SocketOptions& options_,
+		std::function<void (asio::ip::tcp::socket::lowest_layer_type&)> configure_
+	) :
+			PhysicalLayerTLSBase(root, service, context),
 			condition(logger),
 			host(host_),
 			localAddress(localAddress_),
 			remoteEndpoint(ip::tcp::v4(), port),
 			localEndpoint(),
-			resolver(service)
+			resolver(service),
+			options(options_),
+			configure(configure_)
 	{	
 
 		
@@ -52,6 +70,9 @@ namespace asiopal
 	
 	void PhysicalLayerTLSClient::DoOpen()
 	{
+		this->ResetStream();
+		session.Attach(stream->native_handle());
+
 		std::error_code ec;
 		SocketHelpers::BindToLocalAddress(localAddress, localEndpoint, this->stream->lowest_layer(), ec);
 		if (ec)
@@ -60,7 +81,7 @@ namespace asiopal
 			{
 				this->OnOpenCallback(ec);
 			};
-			executor.strand.post(callback);
+			executor.Enqueue(callback);
 			return;
 		}
 		
@@ -72,7 +93,7 @@ namespace asiopal
 				this->HandleResolveResult(ec, endpoints);
 			};
 			ip::tcp::resolver::query query(host, "20000");
-			resolver.async_resolve(query, executor.strand.wrap(callback));
+			resolver.async_resolve(query, executor.Wrap(callback));
 		}
 		else
 		{
@@ -82,7 +103,7 @@ namespace asiopal
 				this->HandleConnectResult(ec);
 			};
 
-			stream->lowest_layer().async_connect(remoteEndpoint, executor.strand.wrap(callback));			
+			stream->lowest_layer().async_connect(remoteEndpoint, executor.Wrap(callback));			
 		}
 
 	}
@@ -112,7 +133,7 @@ namespace asiopal
 				this->HandleConnectResult(code);
 			};
 
-			asio::async_connect(stream->lowest_layer(), endpoints, condition, executor.strand.wrap(callback));
+			asio::async_connect(stream->lowest_layer(), endpoints, condition, executor.Wrap(callback));
 		}
 	}
 
@@ -124,13 +145,27 @@ namespace asiopal
 		}
 		else
 		{
+			SocketHelpers::ApplySocketOptions(options, stream->lowest_layer(), logger);
+			configure(stream->lowest_layer());
+
 			auto callback = [this](const std::error_code& code)
 			{
-				this->OnOpenCallback(code);
+				this->HandleHandshakeResult(code);
 			};
 
-			this->stream->async_handshake(asio::ssl::stream_base::client, executor.strand.wrap(callback));
+			this->stream->async_handshake(asio::ssl::stream_base::client, executor.Wrap(callback));
+		}
+	}
+
+	void PhysicalLayerTLSClient::HandleHandshakeResult(const std::error_code& ec)
+	{
+		if (ec)
+		{
+			// don't offer a session the server may have rejected
+			session.Clear();
 		}
+
+		this->OnHandshakeResult(ec);
 	}
 	
 }
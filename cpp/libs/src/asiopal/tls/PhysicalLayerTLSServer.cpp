@@ -21,7 +21,7 @@
 
 #include "asiopal/tls/PhysicalLayerTLSServer.h"
 
-#include "asiopal/tls/TLSHelpers.h"
+#include "asiopal/SocketHelpers.h"
 
 #include <openpal/logging/LogMacros.h>
 #include <openpal/channel/IPhysicalLayerCallbacks.h>
@@ -39,12 +39,30 @@ PhysicalLayerTLSServer::PhysicalLayerTLSServer(
     asio::io_service& service,
     const std::string& endpoint,
     uint16_t port,
-    const TLSConfig& config) :
+    const TLSConfig& config,
+    const SocketOptions& options_,
+    std::function<void (asio::ip::tcp::socket::lowest_layer_type&)> configure_) :
 
-	PhysicalLayerTLSBase(root, service, config, asio::ssl::context_base::sslv23_server),
+	PhysicalLayerTLSServer(root, service, endpoint, port, std::make_shared<TLSContext>(config, TLSRole::SERVER), options_, configure_)
+{
+
+}
+
+PhysicalLayerTLSServer::PhysicalLayerTLSServer(
+    openpal::LogRoot& root,
+    asio::io_service& service,
+    const std::string& endpoint,
+    uint16_t port,
+    std::shared_ptr<TLSContext> context,
+    const SocketOptions& options_,
+    std::function<void (asio::ip::tcp::socket::lowest_layer_type&)> configure_) :
+
+	PhysicalLayerTLSBase(root, service, context),
 	localEndpointString(endpoint),
 	localEndpoint(ip::tcp::v4(), port),
-	acceptor(service)	
+	acceptor(service),
+	options(options_),
+	configure(configure_)
 {
 	
 }
@@ -68,11 +86,13 @@ void PhysicalLayerTLSServer::DoOpen()
 	}
 	else
 	{			
+		this->ResetStream();
+
 		auto callback = [this](const std::error_code &code)
 		{
 			this->HandleAcceptResult(code);
 		};
-		acceptor.async_accept(stream->lowest_layer(), remoteEndpoint, executor.strand.wrap(callback));								
+		acceptor.async_accept(stream->lowest_layer(), remoteEndpoint, executor.Wrap(callback));								
 	}	
 }
 
@@ -83,13 +103,16 @@ void PhysicalLayerTLSServer::HandleAcceptResult(const std::error_code& ec)
 		this->OnOpenCallback(ec);
 	}
 	else
-	{		
+	{
+		SocketHelpers::ApplySocketOptions(options, stream->lowest_layer(), logger);
+		configure(stream->lowest_layer());
+
 		auto callback = [this](const std::error_code& code)
 		{
-			this->OnOpenCallback(code);
+			this->OnHandshakeResult(code);
 		};
 
-		this->stream->async_handshake(asio::ssl::stream_base::server, executor.strand.wrap(callback));
+		this->stream->async_handshake(asio::ssl::stream_base::server, executor.Wrap(callback));
 	}
 }
 
@@ -0,0 +1,108 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+
+#include "asiopal/tls/TLSContext.h"
+
+#include "asiopal/tls/TLSHelpers.h"
+
+using namespace asio;
+
+namespace asiopal
+{
+
+namespace
+{
+	const unsigned char SESSION_ID_CONTEXT[] = { 'o', 'p', 'e', 'n', 'd', 'n', 'p', '3' };
+}
+
+TLSContext::TLSContext(const TLSConfig& config, TLSRole role_) :
+	role(role_),
+	ctx((role_ == TLSRole::SERVER) ? ssl::context_base::sslv23_server : ssl::context_base::sslv23_client)
+{
+	TLSHelpers::ApplyConfig(config, ctx);
+
+	if (role == TLSRole::SERVER)
+	{
+		// sessions are only resumed within the same id context, and OpenSSL refuses to resume without one when verifying the peer
+		SSL_CTX_set_session_cache_mode(ctx.native_handle(), SSL_SESS_CACHE_SERVER);
+		SSL_CTX_set_session_id_context(ctx.native_handle(), SESSION_ID_CONTEXT, sizeof(SESSION_ID_CONTEXT));
+	}
+	else
+	{
+		// the context is shared by clients connecting to different hosts, so each connection keeps its own session
+		SSL_CTX_set_session_cache_mode(ctx.native_handle(), SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+		SSL_CTX_sess_set_new_cb(ctx.native_handle(), &TLSContext::OnNewSession);
+	}
+}
+
+int TLSContext::OnNewSession(SSL* ssl, SSL_SESSION* session)
+{
+	auto pOwner = static_cast<TLSClientSession*>(SSL_get_ex_data(ssl, TLSClientSession::GetIndex()));
+	if (!pOwner)
+	{
+		return 0;
+	}
+
+	// returning 1 keeps the reference OpenSSL passed to the callback
+	pOwner->Store(session);
+	return 1;
+}
+
+TLSClientSession::TLSClientSession() : session(nullptr)
+{}
+
+TLSClientSession::~TLSClientSession()
+{
+	this->Clear();
+}
+
+void TLSClientSession::Attach(SSL* ssl)
+{
+	SSL_set_ex_data(ssl, GetIndex(), this);
+
+	if (session)
+	{
+		SSL_set_session(ssl, session);
+	}
+}
+
+void TLSClientSession::Clear()
+{
+	if (session)
+	{
+		SSL_SESSION_free(session);
+		session = nullptr;
+	}
+}
+
+int TLSClientSession::GetIndex()
+{
+	static const int index = SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+	return index;
+}
+
+void TLSClientSession::Store(SSL_SESSION* session_)
+{
+	this->Clear();
+	session = session_;
+}
+
+}
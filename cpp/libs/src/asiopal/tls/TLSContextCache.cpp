@@ -0,0 +1,94 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+
+#include "asiopal/tls/TLSContextCache.h"
+
+namespace asiopal
+{
+
+std::shared_ptr<TLSContext> TLSContextCache::Get(const TLSConfig& config, TLSRole role)
+{
+	const auto key = GetKey(config, role);
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	auto iter = contexts.find(key);
+	if (iter != contexts.end())
+	{
+		auto context = iter->second.lock();
+		if (context)
+		{
+			return context;
+		}
+	}
+
+	// drop the entries of contexts whose channels are all gone
+	for (auto i = contexts.begin(); i != contexts.end();)
+	{
+		if (i->second.expired())
+		{
+			i = contexts.erase(i);
+		}
+		else
+		{
+			++i;
+		}
+	}
+
+	auto context = std::make_shared<TLSContext>(config, role);
+	contexts[key] = context;
+	return context;
+}
+
+uint32_t TLSContextCache::NumContexts()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	uint32_t count = 0;
+	for (auto& entry : contexts)
+	{
+		if (!entry.second.expired())
+		{
+			++count;
+		}
+	}
+	return count;
+}
+
+std::string TLSContextCache::GetKey(const TLSConfig& config, TLSRole role)
+{
+	std::string key;
+	key += (role == TLSRole::SERVER) ? 'S' : 'C';
+	key += config.allowTLSv10 ? '1' : '0';
+	key += config.allowTLSv11 ? '1' : '0';
+	key += config.allowTLSv12 ? '1' : '0';
+
+	for (auto field : { &config.peerCertFilePath, &config.localCertFilePath, &config.privateKeyFilePath, &config.cipherList })
+	{
+		// the separator can't appear in a path or a cipher list
+		key += '\0';
+		key += *field;
+	}
+
+	return key;
+}
+
+}
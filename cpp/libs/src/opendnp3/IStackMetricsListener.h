@@ -0,0 +1,60 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_ISTACKMETRICSLISTENER_H
+#define OPENDNP3_ISTACKMETRICSLISTENER_H
+
+#include "opendnp3/gen/MasterTaskType.h"
+
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/**
+* Receives the events that StackMetrics are built from. Implementations do their own timing so that
+* the stack itself doesn't need a high resolution clock.
+*/
+class IStackMetricsListener
+{
+public:
+
+	/// A master transmitted a request for a task
+	virtual void OnTaskRequest(MasterTaskType type) = 0;
+
+	/// A master received a response fragment for its outstanding request, only the first one completes a round trip
+	virtual void OnTaskResponse(MasterTaskType type) = 0;
+
+	/// An outstation began processing a READ request
+	virtual void OnReadBegin() = 0;
+
+	/// An outstation finished formatting the response to a READ request
+	virtual void OnReadEnd() = 0;
+
+	/// Number of events in an outstation's event buffer after it may have grown
+	virtual void OnEventCount(uint32_t numEvents) = 0;
+
+	/// The link layer retransmitted a frame
+	virtual void OnLinkRetransmit() = 0;
+};
+
+}
+
+#endif
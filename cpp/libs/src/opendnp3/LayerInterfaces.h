@@ -61,7 +61,8 @@ public:
 
 	virtual ~IUpperLayer() {}
 
-	// Called by the lower layer when data arrives
+	// Called by the lower layer when data arrives. The data may point into the lower layer's
+	// receive buffers, and is only valid for the duration of the call.
 	// return false if the layer is down
 	virtual bool OnReceive(const openpal::RSlice&) = 0;
 
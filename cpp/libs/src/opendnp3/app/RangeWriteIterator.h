@@ -79,6 +79,30 @@ public:
 		}
 	}
 
+	/**
+	* Write a run of values with the bulk serializer of a specific object type,
+	* checking for space once for the entire run
+	*/
+	template <class BulkSerializer>
+	bool WriteMany(const WriteType* values, uint32_t num)
+	{
+		if (isValid && BulkSerializer::WriteTargets(values, num, *pPosition))
+		{
+			count += static_cast<typename IndexType::Type>(num);
+			return true;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	// the number of values that still fit in the buffer
+	uint32_t Remaining() const
+	{
+		return isValid ? (pPosition->Size() / serializer.Size()) : 0;
+	}
+
 	bool IsValid() const
 	{
 		return isValid;
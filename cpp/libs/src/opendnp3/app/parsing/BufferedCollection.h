@@ -53,8 +53,41 @@ public:
 		}
 	}
 
+	virtual void ForeachBlock(IBlockVisitor<T>& visitor) const override final
+	{
+		openpal::RSlice copy(buffer);
+		T block[BLOCK_SIZE];
+
+		for (uint32_t pos = 0; pos < COUNT;)
+		{
+			uint32_t num = 0;
+			while (num < BLOCK_SIZE && pos < COUNT)
+			{
+				block[num] = readFunc(copy, pos);
+				++num;
+				++pos;
+			}
+			visitor.OnValues(block, num);
+		}
+	}
+
+	virtual uint32_t LoadColumns(ColumnSink<T>& sink) const override final
+	{
+		openpal::RSlice copy(buffer);
+
+		for (uint32_t pos = 0; pos < COUNT && !sink.IsFull(); ++pos)
+		{
+			sink.Write(readFunc(copy, pos));
+		}
+
+		return sink.Count();
+	}
+
 private:
 
+	// number of elements decoded onto the stack before each call to the block visitor
+	static const uint32_t BLOCK_SIZE = 32;
+
 	openpal::RSlice buffer;
 	const uint32_t COUNT;
 	ReadFunc readFunc;
@@ -51,6 +51,14 @@ public:
 		}
 	}
 
+	virtual void ForeachBlock(IBlockVisitor<T>& visitor) const override final
+	{
+		if (COUNT > 0)
+		{
+			visitor.OnValues(pArray, COUNT);
+		}
+	}
+
 private:
 
 	const T* pArray;
@@ -81,8 +89,76 @@ public:
 		input->ForeachItem(process);
 	}
 
+	virtual void ForeachBlock(IBlockVisitor<U>& visitor) const override final
+	{
+		TransformBlocks blocks(transform, visitor);
+		input->ForeachBlock(blocks);
+	}
+
+	virtual uint32_t LoadColumns(ColumnSink<U>& sink) const override final
+	{
+		TransformRows rows(transform, sink);
+		input->ForeachBlock(rows);
+		return sink.Count();
+	}
+
 private:
 
+	// transforms each element of the input straight into the sink
+	class TransformRows : public IBlockVisitor<T>
+	{
+	public:
+
+		TransformRows(const Transform& transform_, ColumnSink<U>& sink_) : transform(transform_), sink(sink_)
+		{}
+
+		virtual void OnValues(const T* values, uint32_t count) override final
+		{
+			for (uint32_t i = 0; i < count && !sink.IsFull(); ++i)
+			{
+				sink.Write(transform(values[i]));
+			}
+		}
+
+	private:
+
+		const Transform& transform;
+		ColumnSink<U>& sink;
+	};
+
+	// transforms each block of the input into a block of the output
+	class TransformBlocks : public IBlockVisitor<T>
+	{
+	public:
+
+		TransformBlocks(const Transform& transform_, IBlockVisitor<U>& output_) : transform(transform_), output(output_)
+		{}
+
+		virtual void OnValues(const T* values, uint32_t count) override final
+		{
+			U block[BLOCK_SIZE];
+
+			while (count > 0)
+			{
+				uint32_t num = (count < BLOCK_SIZE) ? count : BLOCK_SIZE;
+				for (uint32_t i = 0; i < num; ++i)
+				{
+					block[i] = transform(values[i]);
+				}
+				output.OnValues(block, num);
+				values += num;
+				count -= num;
+			}
+		}
+
+	private:
+
+		static const uint32_t BLOCK_SIZE = 32;
+
+		const Transform& transform;
+		IBlockVisitor<U>& output;
+	};
+
 	const ICollection<T>* input;
 	Transform transform;
 
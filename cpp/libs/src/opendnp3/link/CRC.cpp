@@ -25,7 +25,7 @@
 namespace opendnp3
 {
 
-uint16_t CRC::crcTable[256] =
+const uint16_t CRC::crcTable[256] =
 {
 	0x0000, 0x365E, 0x6CBC, 0x5AE2, 0xD978, 0xEF26, 0xB5C4, 0x839A,
 	0xFF89, 0xC9D7, 0x9335, 0xA56B, 0x26F1, 0x10AF, 0x4A4D, 0x7C13,
@@ -61,8 +61,321 @@ uint16_t CRC::crcTable[256] =
 	0x91AF, 0xA7F1, 0xFD13, 0xCB4D, 0x48D7, 0x7E89, 0x246B, 0x1235
 };
 
+// precomputed from crcTable so that the tables are constant initialized and usable during static initialization
+const uint16_t CRC::crcSlices[NUM_SLICES][256] =
+{
+	// followed by 0 zero bytes
+	{
+		0x0000, 0x365E, 0x6CBC, 0x5AE2, 0xD978, 0xEF26, 0xB5C4, 0x839A,
+		0xFF89, 0xC9D7, 0x9335, 0xA56B, 0x26F1, 0x10AF, 0x4A4D, 0x7C13,
+		0xB26B, 0x8435, 0xDED7, 0xE889, 0x6B13, 0x5D4D, 0x07AF, 0x31F1,
+		0x4DE2, 0x7BBC, 0x215E, 0x1700, 0x949A, 0xA2C4, 0xF826, 0xCE78,
+		0x29AF, 0x1FF1, 0x4513, 0x734D, 0xF0D7, 0xC689, 0x9C6B, 0xAA35,
+		0xD626, 0xE078, 0xBA9A, 0x8CC4, 0x0F5E, 0x3900, 0x63E2, 0x55BC,
+		0x9BC4, 0xAD9A, 0xF778, 0xC126, 0x42BC, 0x74E2, 0x2E00, 0x185E,
+		0x644D, 0x5213, 0x08F1, 0x3EAF, 0xBD35, 0x8B6B, 0xD189, 0xE7D7,
+		0x535E, 0x6500, 0x3FE2, 0x09BC, 0x8A26, 0xBC78, 0xE69A, 0xD0C4,
+		0xACD7, 0x9A89, 0xC06B, 0xF635, 0x75AF, 0x43F1, 0x1913, 0x2F4D,
+		0xE135, 0xD76B, 0x8D89, 0xBBD7, 0x384D, 0x0E13, 0x54F1, 0x62AF,
+		0x1EBC, 0x28E2, 0x7200, 0x445E, 0xC7C4, 0xF19A, 0xAB78, 0x9D26,
+		0x7AF1, 0x4CAF, 0x164D, 0x2013, 0xA389, 0x95D7, 0xCF35, 0xF96B,
+		0x8578, 0xB326, 0xE9C4, 0xDF9A, 0x5C00, 0x6A5E, 0x30BC, 0x06E2,
+		0xC89A, 0xFEC4, 0xA426, 0x9278, 0x11E2, 0x27BC, 0x7D5E, 0x4B00,
+		0x3713, 0x014D, 0x5BAF, 0x6DF1, 0xEE6B, 0xD835, 0x82D7, 0xB489,
+		0xA6BC, 0x90E2, 0xCA00, 0xFC5E, 0x7FC4, 0x499A, 0x1378, 0x2526,
+		0x5935, 0x6F6B, 0x3589, 0x03D7, 0x804D, 0xB613, 0xECF1, 0xDAAF,
+		0x14D7, 0x2289, 0x786B, 0x4E35, 0xCDAF, 0xFBF1, 0xA113, 0x974D,
+		0xEB5E, 0xDD00, 0x87E2, 0xB1BC, 0x3226, 0x0478, 0x5E9A, 0x68C4,
+		0x8F13, 0xB94D, 0xE3AF, 0xD5F1, 0x566B, 0x6035, 0x3AD7, 0x0C89,
+		0x709A, 0x46C4, 0x1C26, 0x2A78, 0xA9E2, 0x9FBC, 0xC55E, 0xF300,
+		0x3D78, 0x0B26, 0x51C4, 0x679A, 0xE400, 0xD25E, 0x88BC, 0xBEE2,
+		0xC2F1, 0xF4AF, 0xAE4D, 0x9813, 0x1B89, 0x2DD7, 0x7735, 0x416B,
+		0xF5E2, 0xC3BC, 0x995E, 0xAF00, 0x2C9A, 0x1AC4, 0x4026, 0x7678,
+		0x0A6B, 0x3C35, 0x66D7, 0x5089, 0xD313, 0xE54D, 0xBFAF, 0x89F1,
+		0x4789, 0x71D7, 0x2B35, 0x1D6B, 0x9EF1, 0xA8AF, 0xF24D, 0xC413,
+		0xB800, 0x8E5E, 0xD4BC, 0xE2E2, 0x6178, 0x5726, 0x0DC4, 0x3B9A,
+		0xDC4D, 0xEA13, 0xB0F1, 0x86AF, 0x0535, 0x336B, 0x6989, 0x5FD7,
+		0x23C4, 0x159A, 0x4F78, 0x7926, 0xFABC, 0xCCE2, 0x9600, 0xA05E,
+		0x6E26, 0x5878, 0x029A, 0x34C4, 0xB75E, 0x8100, 0xDBE2, 0xEDBC,
+		0x91AF, 0xA7F1, 0xFD13, 0xCB4D, 0x48D7, 0x7E89, 0x246B, 0x1235
+	},
+	// followed by 1 zero byte
+	{
+		0x0000, 0xAB4E, 0x1BE5, 0xB0AB, 0x37CA, 0x9C84, 0x2C2F, 0x8761,
+		0x6F94, 0xC4DA, 0x7471, 0xDF3F, 0x585E, 0xF310, 0x43BB, 0xE8F5,
+		0xDF28, 0x7466, 0xC4CD, 0x6F83, 0xE8E2, 0x43AC, 0xF307, 0x5849,
+		0xB0BC, 0x1BF2, 0xAB59, 0x0017, 0x8776, 0x2C38, 0x9C93, 0x37DD,
+		0xF329, 0x5867, 0xE8CC, 0x4382, 0xC4E3, 0x6FAD, 0xDF06, 0x7448,
+		0x9CBD, 0x37F3, 0x8758, 0x2C16, 0xAB77, 0x0039, 0xB092, 0x1BDC,
+		0x2C01, 0x874F, 0x37E4, 0x9CAA, 0x1BCB, 0xB085, 0x002E, 0xAB60,
+		0x4395, 0xE8DB, 0x5870, 0xF33E, 0x745F, 0xDF11, 0x6FBA, 0xC4F4,
+		0xAB2B, 0x0065, 0xB0CE, 0x1B80, 0x9CE1, 0x37AF, 0x8704, 0x2C4A,
+		0xC4BF, 0x6FF1, 0xDF5A, 0x7414, 0xF375, 0x583B, 0xE890, 0x43DE,
+		0x7403, 0xDF4D, 0x6FE6, 0xC4A8, 0x43C9, 0xE887, 0x582C, 0xF362,
+		0x1B97, 0xB0D9, 0x0072, 0xAB3C, 0x2C5D, 0x8713, 0x37B8, 0x9CF6,
+		0x5802, 0xF34C, 0x43E7, 0xE8A9, 0x6FC8, 0xC486, 0x742D, 0xDF63,
+		0x3796, 0x9CD8, 0x2C73, 0x873D, 0x005C, 0xAB12, 0x1BB9, 0xB0F7,
+		0x872A, 0x2C64, 0x9CCF, 0x3781, 0xB0E0, 0x1BAE, 0xAB05, 0x004B,
+		0xE8BE, 0x43F0, 0xF35B, 0x5815, 0xDF74, 0x743A, 0xC491, 0x6FDF,
+		0x1B2F, 0xB061, 0x00CA, 0xAB84, 0x2CE5, 0x87AB, 0x3700, 0x9C4E,
+		0x74BB, 0xDFF5, 0x6F5E, 0xC410, 0x4371, 0xE83F, 0x5894, 0xF3DA,
+		0xC407, 0x6F49, 0xDFE2, 0x74AC, 0xF3CD, 0x5883, 0xE828, 0x4366,
+		0xAB93, 0x00DD, 0xB076, 0x1B38, 0x9C59, 0x3717, 0x87BC, 0x2CF2,
+		0xE806, 0x4348, 0xF3E3, 0x58AD, 0xDFCC, 0x7482, 0xC429, 0x6F67,
+		0x8792, 0x2CDC, 0x9C77, 0x3739, 0xB058, 0x1B16, 0xABBD, 0x00F3,
+		0x372E, 0x9C60, 0x2CCB, 0x8785, 0x00E4, 0xABAA, 0x1B01, 0xB04F,
+		0x58BA, 0xF3F4, 0x435F, 0xE811, 0x6F70, 0xC43E, 0x7495, 0xDFDB,
+		0xB004, 0x1B4A, 0xABE1, 0x00AF, 0x87CE, 0x2C80, 0x9C2B, 0x3765,
+		0xDF90, 0x74DE, 0xC475, 0x6F3B, 0xE85A, 0x4314, 0xF3BF, 0x58F1,
+		0x6F2C, 0xC462, 0x74C9, 0xDF87, 0x58E6, 0xF3A8, 0x4303, 0xE84D,
+		0x00B8, 0xABF6, 0x1B5D, 0xB013, 0x3772, 0x9C3C, 0x2C97, 0x87D9,
+		0x432D, 0xE863, 0x58C8, 0xF386, 0x74E7, 0xDFA9, 0x6F02, 0xC44C,
+		0x2CB9, 0x87F7, 0x375C, 0x9C12, 0x1B73, 0xB03D, 0x0096, 0xABD8,
+		0x9C05, 0x374B, 0x87E0, 0x2CAE, 0xABCF, 0x0081, 0xB02A, 0x1B64,
+		0xF391, 0x58DF, 0xE874, 0x433A, 0xC45B, 0x6F15, 0xDFBE, 0x74F0
+	},
+	// followed by 2 zero bytes
+	{
+		0x0000, 0x19B8, 0x3370, 0x2AC8, 0x66E0, 0x7F58, 0x5590, 0x4C28,
+		0xCDC0, 0xD478, 0xFEB0, 0xE708, 0xAB20, 0xB298, 0x9850, 0x81E8,
+		0xD6F9, 0xCF41, 0xE589, 0xFC31, 0xB019, 0xA9A1, 0x8369, 0x9AD1,
+		0x1B39, 0x0281, 0x2849, 0x31F1, 0x7DD9, 0x6461, 0x4EA9, 0x5711,
+		0xE08B, 0xF933, 0xD3FB, 0xCA43, 0x866B, 0x9FD3, 0xB51B, 0xACA3,
+		0x2D4B, 0x34F3, 0x1E3B, 0x0783, 0x4BAB, 0x5213, 0x78DB, 0x6163,
+		0x3672, 0x2FCA, 0x0502, 0x1CBA, 0x5092, 0x492A, 0x63E2, 0x7A5A,
+		0xFBB2, 0xE20A, 0xC8C2, 0xD17A, 0x9D52, 0x84EA, 0xAE22, 0xB79A,
+		0x8C6F, 0x95D7, 0xBF1F, 0xA6A7, 0xEA8F, 0xF337, 0xD9FF, 0xC047,
+		0x41AF, 0x5817, 0x72DF, 0x6B67, 0x274F, 0x3EF7, 0x143F, 0x0D87,
+		0x5A96, 0x432E, 0x69E6, 0x705E, 0x3C76, 0x25CE, 0x0F06, 0x16BE,
+		0x9756, 0x8EEE, 0xA426, 0xBD9E, 0xF1B6, 0xE80E, 0xC2C6, 0xDB7E,
+		0x6CE4, 0x755C, 0x5F94, 0x462C, 0x0A04, 0x13BC, 0x3974, 0x20CC,
+		0xA124, 0xB89C, 0x9254, 0x8BEC, 0xC7C4, 0xDE7C, 0xF4B4, 0xED0C,
+		0xBA1D, 0xA3A5, 0x896D, 0x90D5, 0xDCFD, 0xC545, 0xEF8D, 0xF635,
+		0x77DD, 0x6E65, 0x44AD, 0x5D15, 0x113D, 0x0885, 0x224D, 0x3BF5,
+		0x55A7, 0x4C1F, 0x66D7, 0x7F6F, 0x3347, 0x2AFF, 0x0037, 0x198F,
+		0x9867, 0x81DF, 0xAB17, 0xB2AF, 0xFE87, 0xE73F, 0xCDF7, 0xD44F,
+		0x835E, 0x9AE6, 0xB02E, 0xA996, 0xE5BE, 0xFC06, 0xD6CE, 0xCF76,
+		0x4E9E, 0x5726, 0x7DEE, 0x6456, 0x287E, 0x31C6, 0x1B0E, 0x02B6,
+		0xB52C, 0xAC94, 0x865C, 0x9FE4, 0xD3CC, 0xCA74, 0xE0BC, 0xF904,
+		0x78EC, 0x6154, 0x4B9C, 0x5224, 0x1E0C, 0x07B4, 0x2D7C, 0x34C4,
+		0x63D5, 0x7A6D, 0x50A5, 0x491D, 0x0535, 0x1C8D, 0x3645, 0x2FFD,
+		0xAE15, 0xB7AD, 0x9D65, 0x84DD, 0xC8F5, 0xD14D, 0xFB85, 0xE23D,
+		0xD9C8, 0xC070, 0xEAB8, 0xF300, 0xBF28, 0xA690, 0x8C58, 0x95E0,
+		0x1408, 0x0DB0, 0x2778, 0x3EC0, 0x72E8, 0x6B50, 0x4198, 0x5820,
+		0x0F31, 0x1689, 0x3C41, 0x25F9, 0x69D1, 0x7069, 0x5AA1, 0x4319,
+		0xC2F1, 0xDB49, 0xF181, 0xE839, 0xA411, 0xBDA9, 0x9761, 0x8ED9,
+		0x3943, 0x20FB, 0x0A33, 0x138B, 0x5FA3, 0x461B, 0x6CD3, 0x756B,
+		0xF483, 0xED3B, 0xC7F3, 0xDE4B, 0x9263, 0x8BDB, 0xA113, 0xB8AB,
+		0xEFBA, 0xF602, 0xDCCA, 0xC572, 0x895A, 0x90E2, 0xBA2A, 0xA392,
+		0x227A, 0x3BC2, 0x110A, 0x08B2, 0x449A, 0x5D22, 0x77EA, 0x6E52
+	},
+	// followed by 3 zero bytes
+	{
+		0x0000, 0xC2E8, 0xC8A9, 0x0A41, 0xDC2B, 0x1EC3, 0x1482, 0xD66A,
+		0xF52F, 0x37C7, 0x3D86, 0xFF6E, 0x2904, 0xEBEC, 0xE1AD, 0x2345,
+		0xA727, 0x65CF, 0x6F8E, 0xAD66, 0x7B0C, 0xB9E4, 0xB3A5, 0x714D,
+		0x5208, 0x90E0, 0x9AA1, 0x5849, 0x8E23, 0x4CCB, 0x468A, 0x8462,
+		0x0337, 0xC1DF, 0xCB9E, 0x0976, 0xDF1C, 0x1DF4, 0x17B5, 0xD55D,
+		0xF618, 0x34F0, 0x3EB1, 0xFC59, 0x2A33, 0xE8DB, 0xE29A, 0x2072,
+		0xA410, 0x66F8, 0x6CB9, 0xAE51, 0x783B, 0xBAD3, 0xB092, 0x727A,
+		0x513F, 0x93D7, 0x9996, 0x5B7E, 0x8D14, 0x4FFC, 0x45BD, 0x8755,
+		0x066E, 0xC486, 0xCEC7, 0x0C2F, 0xDA45, 0x18AD, 0x12EC, 0xD004,
+		0xF341, 0x31A9, 0x3BE8, 0xF900, 0x2F6A, 0xED82, 0xE7C3, 0x252B,
+		0xA149, 0x63A1, 0x69E0, 0xAB08, 0x7D62, 0xBF8A, 0xB5CB, 0x7723,
+		0x5466, 0x968E, 0x9CCF, 0x5E27, 0x884D, 0x4AA5, 0x40E4, 0x820C,
+		0x0559, 0xC7B1, 0xCDF0, 0x0F18, 0xD972, 0x1B9A, 0x11DB, 0xD333,
+		0xF076, 0x329E, 0x38DF, 0xFA37, 0x2C5D, 0xEEB5, 0xE4F4, 0x261C,
+		0xA27E, 0x6096, 0x6AD7, 0xA83F, 0x7E55, 0xBCBD, 0xB6FC, 0x7414,
+		0x5751, 0x95B9, 0x9FF8, 0x5D10, 0x8B7A, 0x4992, 0x43D3, 0x813B,
+		0x0CDC, 0xCE34, 0xC475, 0x069D, 0xD0F7, 0x121F, 0x185E, 0xDAB6,
+		0xF9F3, 0x3B1B, 0x315A, 0xF3B2, 0x25D8, 0xE730, 0xED71, 0x2F99,
+		0xABFB, 0x6913, 0x6352, 0xA1BA, 0x77D0, 0xB538, 0xBF79, 0x7D91,
+		0x5ED4, 0x9C3C, 0x967D, 0x5495, 0x82FF, 0x4017, 0x4A56, 0x88BE,
+		0x0FEB, 0xCD03, 0xC742, 0x05AA, 0xD3C0, 0x1128, 0x1B69, 0xD981,
+		0xFAC4, 0x382C, 0x326D, 0xF085, 0x26EF, 0xE407, 0xEE46, 0x2CAE,
+		0xA8CC, 0x6A24, 0x6065, 0xA28D, 0x74E7, 0xB60F, 0xBC4E, 0x7EA6,
+		0x5DE3, 0x9F0B, 0x954A, 0x57A2, 0x81C8, 0x4320, 0x4961, 0x8B89,
+		0x0AB2, 0xC85A, 0xC21B, 0x00F3, 0xD699, 0x1471, 0x1E30, 0xDCD8,
+		0xFF9D, 0x3D75, 0x3734, 0xF5DC, 0x23B6, 0xE15E, 0xEB1F, 0x29F7,
+		0xAD95, 0x6F7D, 0x653C, 0xA7D4, 0x71BE, 0xB356, 0xB917, 0x7BFF,
+		0x58BA, 0x9A52, 0x9013, 0x52FB, 0x8491, 0x4679, 0x4C38, 0x8ED0,
+		0x0985, 0xCB6D, 0xC12C, 0x03C4, 0xD5AE, 0x1746, 0x1D07, 0xDFEF,
+		0xFCAA, 0x3E42, 0x3403, 0xF6EB, 0x2081, 0xE269, 0xE828, 0x2AC0,
+		0xAEA2, 0x6C4A, 0x660B, 0xA4E3, 0x7289, 0xB061, 0xBA20, 0x78C8,
+		0x5B8D, 0x9965, 0x9324, 0x51CC, 0x87A6, 0x454E, 0x4F0F, 0x8DE7
+	},
+	// followed by 4 zero bytes
+	{
+		0x0000, 0x2306, 0x460C, 0x650A, 0x8C18, 0xAF1E, 0xCA14, 0xE912,
+		0x5549, 0x764F, 0x1345, 0x3043, 0xD951, 0xFA57, 0x9F5D, 0xBC5B,
+		0xAA92, 0x8994, 0xEC9E, 0xCF98, 0x268A, 0x058C, 0x6086, 0x4380,
+		0xFFDB, 0xDCDD, 0xB9D7, 0x9AD1, 0x73C3, 0x50C5, 0x35CF, 0x16C9,
+		0x185D, 0x3B5B, 0x5E51, 0x7D57, 0x9445, 0xB743, 0xD249, 0xF14F,
+		0x4D14, 0x6E12, 0x0B18, 0x281E, 0xC10C, 0xE20A, 0x8700, 0xA406,
+		0xB2CF, 0x91C9, 0xF4C3, 0xD7C5, 0x3ED7, 0x1DD1, 0x78DB, 0x5BDD,
+		0xE786, 0xC480, 0xA18A, 0x828C, 0x6B9E, 0x4898, 0x2D92, 0x0E94,
+		0x30BA, 0x13BC, 0x76B6, 0x55B0, 0xBCA2, 0x9FA4, 0xFAAE, 0xD9A8,
+		0x65F3, 0x46F5, 0x23FF, 0x00F9, 0xE9EB, 0xCAED, 0xAFE7, 0x8CE1,
+		0x9A28, 0xB92E, 0xDC24, 0xFF22, 0x1630, 0x3536, 0x503C, 0x733A,
+		0xCF61, 0xEC67, 0x896D, 0xAA6B, 0x4379, 0x607F, 0x0575, 0x2673,
+		0x28E7, 0x0BE1, 0x6EEB, 0x4DED, 0xA4FF, 0x87F9, 0xE2F3, 0xC1F5,
+		0x7DAE, 0x5EA8, 0x3BA2, 0x18A4, 0xF1B6, 0xD2B0, 0xB7BA, 0x94BC,
+		0x8275, 0xA173, 0xC479, 0xE77F, 0x0E6D, 0x2D6B, 0x4861, 0x6B67,
+		0xD73C, 0xF43A, 0x9130, 0xB236, 0x5B24, 0x7822, 0x1D28, 0x3E2E,
+		0x6174, 0x4272, 0x2778, 0x047E, 0xED6C, 0xCE6A, 0xAB60, 0x8866,
+		0x343D, 0x173B, 0x7231, 0x5137, 0xB825, 0x9B23, 0xFE29, 0xDD2F,
+		0xCBE6, 0xE8E0, 0x8DEA, 0xAEEC, 0x47FE, 0x64F8, 0x01F2, 0x22F4,
+		0x9EAF, 0xBDA9, 0xD8A3, 0xFBA5, 0x12B7, 0x31B1, 0x54BB, 0x77BD,
+		0x7929, 0x5A2F, 0x3F25, 0x1C23, 0xF531, 0xD637, 0xB33D, 0x903B,
+		0x2C60, 0x0F66, 0x6A6C, 0x496A, 0xA078, 0x837E, 0xE674, 0xC572,
+		0xD3BB, 0xF0BD, 0x95B7, 0xB6B1, 0x5FA3, 0x7CA5, 0x19AF, 0x3AA9,
+		0x86F2, 0xA5F4, 0xC0FE, 0xE3F8, 0x0AEA, 0x29EC, 0x4CE6, 0x6FE0,
+		0x51CE, 0x72C8, 0x17C2, 0x34C4, 0xDDD6, 0xFED0, 0x9BDA, 0xB8DC,
+		0x0487, 0x2781, 0x428B, 0x618D, 0x889F, 0xAB99, 0xCE93, 0xED95,
+		0xFB5C, 0xD85A, 0xBD50, 0x9E56, 0x7744, 0x5442, 0x3148, 0x124E,
+		0xAE15, 0x8D13, 0xE819, 0xCB1F, 0x220D, 0x010B, 0x6401, 0x4707,
+		0x4993, 0x6A95, 0x0F9F, 0x2C99, 0xC58B, 0xE68D, 0x8387, 0xA081,
+		0x1CDA, 0x3FDC, 0x5AD6, 0x79D0, 0x90C2, 0xB3C4, 0xD6CE, 0xF5C8,
+		0xE301, 0xC007, 0xA50D, 0x860B, 0x6F19, 0x4C1F, 0x2915, 0x0A13,
+		0xB648, 0x954E, 0xF044, 0xD342, 0x3A50, 0x1956, 0x7C5C, 0x5F5A
+	},
+	// followed by 5 zero bytes
+	{
+		0x0000, 0xB5E7, 0x26B7, 0x9350, 0x4D6E, 0xF889, 0x6BD9, 0xDE3E,
+		0x9ADC, 0x2F3B, 0xBC6B, 0x098C, 0xD7B2, 0x6255, 0xF105, 0x44E2,
+		0x78C1, 0xCD26, 0x5E76, 0xEB91, 0x35AF, 0x8048, 0x1318, 0xA6FF,
+		0xE21D, 0x57FA, 0xC4AA, 0x714D, 0xAF73, 0x1A94, 0x89C4, 0x3C23,
+		0xF182, 0x4465, 0xD735, 0x62D2, 0xBCEC, 0x090B, 0x9A5B, 0x2FBC,
+		0x6B5E, 0xDEB9, 0x4DE9, 0xF80E, 0x2630, 0x93D7, 0x0087, 0xB560,
+		0x8943, 0x3CA4, 0xAFF4, 0x1A13, 0xC42D, 0x71CA, 0xE29A, 0x577D,
+		0x139F, 0xA678, 0x3528, 0x80CF, 0x5EF1, 0xEB16, 0x7846, 0xCDA1,
+		0xAE7D, 0x1B9A, 0x88CA, 0x3D2D, 0xE313, 0x56F4, 0xC5A4, 0x7043,
+		0x34A1, 0x8146, 0x1216, 0xA7F1, 0x79CF, 0xCC28, 0x5F78, 0xEA9F,
+		0xD6BC, 0x635B, 0xF00B, 0x45EC, 0x9BD2, 0x2E35, 0xBD65, 0x0882,
+		0x4C60, 0xF987, 0x6AD7, 0xDF30, 0x010E, 0xB4E9, 0x27B9, 0x925E,
+		0x5FFF, 0xEA18, 0x7948, 0xCCAF, 0x1291, 0xA776, 0x3426, 0x81C1,
+		0xC523, 0x70C4, 0xE394, 0x5673, 0x884D, 0x3DAA, 0xAEFA, 0x1B1D,
+		0x273E, 0x92D9, 0x0189, 0xB46E, 0x6A50, 0xDFB7, 0x4CE7, 0xF900,
+		0xBDE2, 0x0805, 0x9B55, 0x2EB2, 0xF08C, 0x456B, 0xD63B, 0x63DC,
+		0x1183, 0xA464, 0x3734, 0x82D3, 0x5CED, 0xE90A, 0x7A5A, 0xCFBD,
+		0x8B5F, 0x3EB8, 0xADE8, 0x180F, 0xC631, 0x73D6, 0xE086, 0x5561,
+		0x6942, 0xDCA5, 0x4FF5, 0xFA12, 0x242C, 0x91CB, 0x029B, 0xB77C,
+		0xF39E, 0x4679, 0xD529, 0x60CE, 0xBEF0, 0x0B17, 0x9847, 0x2DA0,
+		0xE001, 0x55E6, 0xC6B6, 0x7351, 0xAD6F, 0x1888, 0x8BD8, 0x3E3F,
+		0x7ADD, 0xCF3A, 0x5C6A, 0xE98D, 0x37B3, 0x8254, 0x1104, 0xA4E3,
+		0x98C0, 0x2D27, 0xBE77, 0x0B90, 0xD5AE, 0x6049, 0xF319, 0x46FE,
+		0x021C, 0xB7FB, 0x24AB, 0x914C, 0x4F72, 0xFA95, 0x69C5, 0xDC22,
+		0xBFFE, 0x0A19, 0x9949, 0x2CAE, 0xF290, 0x4777, 0xD427, 0x61C0,
+		0x2522, 0x90C5, 0x0395, 0xB672, 0x684C, 0xDDAB, 0x4EFB, 0xFB1C,
+		0xC73F, 0x72D8, 0xE188, 0x546F, 0x8A51, 0x3FB6, 0xACE6, 0x1901,
+		0x5DE3, 0xE804, 0x7B54, 0xCEB3, 0x108D, 0xA56A, 0x363A, 0x83DD,
+		0x4E7C, 0xFB9B, 0x68CB, 0xDD2C, 0x0312, 0xB6F5, 0x25A5, 0x9042,
+		0xD4A0, 0x6147, 0xF217, 0x47F0, 0x99CE, 0x2C29, 0xBF79, 0x0A9E,
+		0x36BD, 0x835A, 0x100A, 0xA5ED, 0x7BD3, 0xCE34, 0x5D64, 0xE883,
+		0xAC61, 0x1986, 0x8AD6, 0x3F31, 0xE10F, 0x54E8, 0xC7B8, 0x725F
+	},
+	// followed by 6 zero bytes
+	{
+		0x0000, 0x5F62, 0xBEC4, 0xE1A6, 0x30F1, 0x6F93, 0x8E35, 0xD157,
+		0x61E2, 0x3E80, 0xDF26, 0x8044, 0x5113, 0x0E71, 0xEFD7, 0xB0B5,
+		0xC3C4, 0x9CA6, 0x7D00, 0x2262, 0xF335, 0xAC57, 0x4DF1, 0x1293,
+		0xA226, 0xFD44, 0x1CE2, 0x4380, 0x92D7, 0xCDB5, 0x2C13, 0x7371,
+		0xCAF1, 0x9593, 0x7435, 0x2B57, 0xFA00, 0xA562, 0x44C4, 0x1BA6,
+		0xAB13, 0xF471, 0x15D7, 0x4AB5, 0x9BE2, 0xC480, 0x2526, 0x7A44,
+		0x0935, 0x5657, 0xB7F1, 0xE893, 0x39C4, 0x66A6, 0x8700, 0xD862,
+		0x68D7, 0x37B5, 0xD613, 0x8971, 0x5826, 0x0744, 0xE6E2, 0xB980,
+		0xD89B, 0x87F9, 0x665F, 0x393D, 0xE86A, 0xB708, 0x56AE, 0x09CC,
+		0xB979, 0xE61B, 0x07BD, 0x58DF, 0x8988, 0xD6EA, 0x374C, 0x682E,
+		0x1B5F, 0x443D, 0xA59B, 0xFAF9, 0x2BAE, 0x74CC, 0x956A, 0xCA08,
+		0x7ABD, 0x25DF, 0xC479, 0x9B1B, 0x4A4C, 0x152E, 0xF488, 0xABEA,
+		0x126A, 0x4D08, 0xACAE, 0xF3CC, 0x229B, 0x7DF9, 0x9C5F, 0xC33D,
+		0x7388, 0x2CEA, 0xCD4C, 0x922E, 0x4379, 0x1C1B, 0xFDBD, 0xA2DF,
+		0xD1AE, 0x8ECC, 0x6F6A, 0x3008, 0xE15F, 0xBE3D, 0x5F9B, 0x00F9,
+		0xB04C, 0xEF2E, 0x0E88, 0x51EA, 0x80BD, 0xDFDF, 0x3E79, 0x611B,
+		0xFC4F, 0xA32D, 0x428B, 0x1DE9, 0xCCBE, 0x93DC, 0x727A, 0x2D18,
+		0x9DAD, 0xC2CF, 0x2369, 0x7C0B, 0xAD5C, 0xF23E, 0x1398, 0x4CFA,
+		0x3F8B, 0x60E9, 0x814F, 0xDE2D, 0x0F7A, 0x5018, 0xB1BE, 0xEEDC,
+		0x5E69, 0x010B, 0xE0AD, 0xBFCF, 0x6E98, 0x31FA, 0xD05C, 0x8F3E,
+		0x36BE, 0x69DC, 0x887A, 0xD718, 0x064F, 0x592D, 0xB88B, 0xE7E9,
+		0x575C, 0x083E, 0xE998, 0xB6FA, 0x67AD, 0x38CF, 0xD969, 0x860B,
+		0xF57A, 0xAA18, 0x4BBE, 0x14DC, 0xC58B, 0x9AE9, 0x7B4F, 0x242D,
+		0x9498, 0xCBFA, 0x2A5C, 0x753E, 0xA469, 0xFB0B, 0x1AAD, 0x45CF,
+		0x24D4, 0x7BB6, 0x9A10, 0xC572, 0x1425, 0x4B47, 0xAAE1, 0xF583,
+		0x4536, 0x1A54, 0xFBF2, 0xA490, 0x75C7, 0x2AA5, 0xCB03, 0x9461,
+		0xE710, 0xB872, 0x59D4, 0x06B6, 0xD7E1, 0x8883, 0x6925, 0x3647,
+		0x86F2, 0xD990, 0x3836, 0x6754, 0xB603, 0xE961, 0x08C7, 0x57A5,
+		0xEE25, 0xB147, 0x50E1, 0x0F83, 0xDED4, 0x81B6, 0x6010, 0x3F72,
+		0x8FC7, 0xD0A5, 0x3103, 0x6E61, 0xBF36, 0xE054, 0x01F2, 0x5E90,
+		0x2DE1, 0x7283, 0x9325, 0xCC47, 0x1D10, 0x4272, 0xA3D4, 0xFCB6,
+		0x4C03, 0x1361, 0xF2C7, 0xADA5, 0x7CF2, 0x2390, 0xC236, 0x9D54
+	},
+	// followed by 7 zero bytes
+	{
+		0x0000, 0x1612, 0x2C24, 0x3A36, 0x5848, 0x4E5A, 0x746C, 0x627E,
+		0xB090, 0xA682, 0x9CB4, 0x8AA6, 0xE8D8, 0xFECA, 0xC4FC, 0xD2EE,
+		0x2C59, 0x3A4B, 0x007D, 0x166F, 0x7411, 0x6203, 0x5835, 0x4E27,
+		0x9CC9, 0x8ADB, 0xB0ED, 0xA6FF, 0xC481, 0xD293, 0xE8A5, 0xFEB7,
+		0x58B2, 0x4EA0, 0x7496, 0x6284, 0x00FA, 0x16E8, 0x2CDE, 0x3ACC,
+		0xE822, 0xFE30, 0xC406, 0xD214, 0xB06A, 0xA678, 0x9C4E, 0x8A5C,
+		0x74EB, 0x62F9, 0x58CF, 0x4EDD, 0x2CA3, 0x3AB1, 0x0087, 0x1695,
+		0xC47B, 0xD269, 0xE85F, 0xFE4D, 0x9C33, 0x8A21, 0xB017, 0xA605,
+		0xB164, 0xA776, 0x9D40, 0x8B52, 0xE92C, 0xFF3E, 0xC508, 0xD31A,
+		0x01F4, 0x17E6, 0x2DD0, 0x3BC2, 0x59BC, 0x4FAE, 0x7598, 0x638A,
+		0x9D3D, 0x8B2F, 0xB119, 0xA70B, 0xC575, 0xD367, 0xE951, 0xFF43,
+		0x2DAD, 0x3BBF, 0x0189, 0x179B, 0x75E5, 0x63F7, 0x59C1, 0x4FD3,
+		0xE9D6, 0xFFC4, 0xC5F2, 0xD3E0, 0xB19E, 0xA78C, 0x9DBA, 0x8BA8,
+		0x5946, 0x4F54, 0x7562, 0x6370, 0x010E, 0x171C, 0x2D2A, 0x3B38,
+		0xC58F, 0xD39D, 0xE9AB, 0xFFB9, 0x9DC7, 0x8BD5, 0xB1E3, 0xA7F1,
+		0x751F, 0x630D, 0x593B, 0x4F29, 0x2D57, 0x3B45, 0x0173, 0x1761,
+		0x2FB1, 0x39A3, 0x0395, 0x1587, 0x77F9, 0x61EB, 0x5BDD, 0x4DCF,
+		0x9F21, 0x8933, 0xB305, 0xA517, 0xC769, 0xD17B, 0xEB4D, 0xFD5F,
+		0x03E8, 0x15FA, 0x2FCC, 0x39DE, 0x5BA0, 0x4DB2, 0x7784, 0x6196,
+		0xB378, 0xA56A, 0x9F5C, 0x894E, 0xEB30, 0xFD22, 0xC714, 0xD106,
+		0x7703, 0x6111, 0x5B27, 0x4D35, 0x2F4B, 0x3959, 0x036F, 0x157D,
+		0xC793, 0xD181, 0xEBB7, 0xFDA5, 0x9FDB, 0x89C9, 0xB3FF, 0xA5ED,
+		0x5B5A, 0x4D48, 0x777E, 0x616C, 0x0312, 0x1500, 0x2F36, 0x3924,
+		0xEBCA, 0xFDD8, 0xC7EE, 0xD1FC, 0xB382, 0xA590, 0x9FA6, 0x89B4,
+		0x9ED5, 0x88C7, 0xB2F1, 0xA4E3, 0xC69D, 0xD08F, 0xEAB9, 0xFCAB,
+		0x2E45, 0x3857, 0x0261, 0x1473, 0x760D, 0x601F, 0x5A29, 0x4C3B,
+		0xB28C, 0xA49E, 0x9EA8, 0x88BA, 0xEAC4, 0xFCD6, 0xC6E0, 0xD0F2,
+		0x021C, 0x140E, 0x2E38, 0x382A, 0x5A54, 0x4C46, 0x7670, 0x6062,
+		0xC667, 0xD075, 0xEA43, 0xFC51, 0x9E2F, 0x883D, 0xB20B, 0xA419,
+		0x76F7, 0x60E5, 0x5AD3, 0x4CC1, 0x2EBF, 0x38AD, 0x029B, 0x1489,
+		0xEA3E, 0xFC2C, 0xC61A, 0xD008, 0xB276, 0xA464, 0x9E52, 0x8840,
+		0x5AAE, 0x4CBC, 0x768A, 0x6098, 0x02E6, 0x14F4, 0x2EC2, 0x38D0
+	}
+};
+
 uint16_t CRC::CalcCrc(const uint8_t* input, uint32_t length)
-{	
+{
+	uint16_t crc = 0;
+
+	// the 16-bit register only overlaps the first 2 bytes of each 8 byte slice
+	while (length >= NUM_SLICES)
+	{
+		crc = crcSlices[7][(crc ^ input[0]) & 0xFF] ^
+		      crcSlices[6][(crc >> 8) ^ input[1]] ^
+		      crcSlices[5][input[2]] ^
+		      crcSlices[4][input[3]] ^
+		      crcSlices[3][input[4]] ^
+		      crcSlices[2][input[5]] ^
+		      crcSlices[1][input[6]] ^
+		      crcSlices[0][input[7]];
+
+		input += NUM_SLICES;
+		length -= NUM_SLICES;
+	}
+
+	for (uint32_t i = 0; i < length; ++i)
+	{
+		crc = crcTable[(crc ^ input[i]) & 0xFF] ^ (crc >> 8);
+	}
+
+	return ~crc;
+}
+
+uint16_t CRC::CalcCrcBytewise(const uint8_t* input, uint32_t length)
+{
 	uint16_t CRC = 0;
 
 	for (uint32_t i = 0; i < length; ++i)
@@ -32,6 +32,7 @@ class CRC
 {
 public:
 
+	/// Calculates the DNP3 CRC 8 bytes at a time using slice-by-8 lookup tables
 	static uint16_t CalcCrc(const uint8_t* input, uint32_t length);
 
 	static uint16_t CalcCrc(const openpal::RSlice& view);
@@ -40,9 +41,17 @@ public:
 
 	static bool IsCorrectCRC(const uint8_t* input, uint32_t length);
 
+	/// Reference implementation that consumes a single byte per table lookup
+	static uint16_t CalcCrcBytewise(const uint8_t* input, uint32_t length);
+
 private:
 
-	static uint16_t crcTable[256]; //Precomputed CRC lookup table
+	static const uint32_t NUM_SLICES = 8;
+
+	static const uint16_t crcTable[256]; //Precomputed CRC lookup table
+
+	// crcSlices[n][i] is the CRC register after byte i is followed by n zero bytes
+	static const uint16_t crcSlices[NUM_SLICES][256];
 
 };
 
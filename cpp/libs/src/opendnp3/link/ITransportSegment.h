@@ -26,6 +26,29 @@
 namespace opendnp3
 {
 
+/**
+* A transport segment described as its header byte and a view of the payload.
+* The payload refers directly into the APDU being segmented so that the link layer
+* can write frames from the original buffer without an intermediate copy.
+*/
+struct TransportSegment
+{
+	TransportSegment() : header(0)
+	{}
+
+	TransportSegment(uint8_t header_, const openpal::RSlice& payload_) : header(header_), payload(payload_)
+	{}
+
+	/// Size of the segment including the header byte
+	uint32_t Size() const
+	{
+		return payload.Size() + 1;
+	}
+
+	uint8_t header;
+	openpal::RSlice payload;
+};
+
 class ITransportSegment
 {
 
@@ -35,8 +58,8 @@ public:
 
 	virtual bool HasValue() const = 0;
 
-	// Read the current segment with a specified max size
-	virtual openpal::RSlice GetSegment() = 0;
+	// Read the current segment, the payload remains valid until the segments are reconfigured
+	virtual TransportSegment GetSegment() = 0;
 
 	// move to the next segment, true if more segments available
 	virtual bool Advance() = 0;
@@ -34,6 +34,8 @@ namespace opendnp3
 {
 
 LinkContext::LinkContext(openpal::LogRoot& root, openpal::IExecutor& executor, IUpperLayer& upper, opendnp3::ILinkListener& linkListener, ILinkSession& session, const LinkConfig& config_) :
+	batchTxBuffer((config_.MaxUnconfirmedFramesPerWrite > 1) ? (config_.MaxUnconfirmedFramesPerWrite * LPDU_MAX_FRAME_SIZE) : 0),
+	batchConsumedFinal(false),
 	logger(root.GetLogger()),
 	config(config_),
 	pSegments(nullptr),
@@ -53,7 +55,8 @@ LinkContext::LinkContext(openpal::LogRoot& root, openpal::IExecutor& executor, I
 	pSecState(&SLLS_NotReset::Instance()),
 	pListener(&linkListener),
 	pSession(&session),
-	pUpperLayer(&upper)
+	pUpperLayer(&upper),
+	pMetrics(nullptr)
 {}
 
 bool LinkContext::OnLowerLayerUp()
@@ -158,22 +161,58 @@ bool LinkContext::OnTransmitResult(bool success)
 	return true;
 }
 
-openpal::RSlice LinkContext::FormatPrimaryBufferWithConfirmed(const openpal::RSlice& tpdu, bool FCB)
+openpal::RSlice LinkContext::FormatPrimaryBufferWithConfirmed(const TransportSegment& tpdu, bool FCB)
 {
 	auto dest = this->priTxBuffer.GetWSlice();
-	auto output = LinkFrame::FormatConfirmedUserData(dest, config.IsMaster, FCB, config.RemoteAddr, config.LocalAddr, tpdu, tpdu.Size(), &logger);
+	auto output = LinkFrame::FormatConfirmedUserData(dest, config.IsMaster, FCB, config.RemoteAddr, config.LocalAddr, tpdu, &logger);
 	FORMAT_HEX_BLOCK(logger, flags::LINK_TX_HEX, output, 10, 18);
 	return output;
 }
 
-RSlice LinkContext::FormatPrimaryBufferWithUnconfirmed(const openpal::RSlice& tpdu)
+RSlice LinkContext::FormatPrimaryBufferWithUnconfirmed(const TransportSegment& tpdu)
 {
 	auto dest = this->priTxBuffer.GetWSlice();
-	auto output = LinkFrame::FormatUnconfirmedUserData(dest, config.IsMaster, config.RemoteAddr, config.LocalAddr, tpdu, tpdu.Size(), &logger);
+	auto output = LinkFrame::FormatUnconfirmedUserData(dest, config.IsMaster, config.RemoteAddr, config.LocalAddr, tpdu, &logger);
 	FORMAT_HEX_BLOCK(logger, flags::LINK_TX_HEX, output, 10, 18);
 	return output;
 }
 
+RSlice LinkContext::FormatPrimaryBufferWithUnconfirmed(ITransportSegment& segments)
+{
+	batchConsumedFinal = false;
+
+	if (batchTxBuffer.IsEmpty())
+	{
+		return this->FormatPrimaryBufferWithUnconfirmed(segments.GetSegment());
+	}
+
+	// frame as many segments as will fit back-to-back so that they can be written at once
+	auto dest = this->batchTxBuffer.GetWSlice();
+	const auto start = dest.Size();
+
+	while (true)
+	{
+		auto tpdu = segments.GetSegment();
+		auto output = LinkFrame::FormatUnconfirmedUserData(dest, config.IsMaster, config.RemoteAddr, config.LocalAddr, tpdu, &logger);
+		FORMAT_HEX_BLOCK(logger, flags::LINK_TX_HEX, output, 10, 18);
+
+		// only advance if there's room for another frame, otherwise the next segment is sent on the transmit callback
+		if (dest.Size() < LPDU_MAX_FRAME_SIZE)
+		{
+			break;
+		}
+
+		if (!segments.Advance())
+		{
+			// the final segment is framed, the transmit callback must not advance again
+			batchConsumedFinal = true;
+			break;
+		}
+	}
+
+	return batchTxBuffer.ToRSlice().Take(start - dest.Size());
+}
+
 void LinkContext::QueueTransmit(const RSlice& buffer, bool primary)
 {
 	if (txMode == LinkTransmitMode::Idle)
@@ -236,6 +275,7 @@ bool LinkContext::Retry()
 	if (numRetryRemaining > 0)
 	{
 		--numRetryRemaining;
+		if (pMetrics) pMetrics->OnLinkRetransmit();
 		return true;
 	}
 	else
@@ -26,6 +26,7 @@
 #include <openpal/executor/TimerRef.h>
 #include <openpal/container/Settable.h>
 #include <openpal/container/StaticBuffer.h>
+#include <openpal/container/Buffer.h>
 
 #include "opendnp3/gen/LinkStatus.h"
 #include "opendnp3/link/ILinkLayer.h"
@@ -33,6 +34,7 @@
 #include "opendnp3/link/LinkLayerConstants.h"
 #include "opendnp3/link/LinkConfig.h"
 #include "opendnp3/link/ILinkListener.h"
+#include "opendnp3/IStackMetricsListener.h"
 
 namespace opendnp3
 {
@@ -84,8 +86,9 @@ public:
 	bool SetTxSegment(ITransportSegment& segments);
 
 	/// --- helpers for formatting user data messages ---
-	openpal::RSlice FormatPrimaryBufferWithUnconfirmed(const openpal::RSlice& tpdu);
-	openpal::RSlice FormatPrimaryBufferWithConfirmed(const openpal::RSlice& tpdu, bool FCB);
+	openpal::RSlice FormatPrimaryBufferWithUnconfirmed(const TransportSegment& tpdu);
+	openpal::RSlice FormatPrimaryBufferWithUnconfirmed(ITransportSegment& segments);
+	openpal::RSlice FormatPrimaryBufferWithConfirmed(const TransportSegment& tpdu, bool FCB);
 
 	/// --- Helpers for queueing frames ---
 	void QueueAck();
@@ -117,6 +120,11 @@ public:
 	openpal::StaticBuffer<LPDU_MAX_FRAME_SIZE> priTxBuffer;
 	openpal::StaticBuffer<LPDU_HEADER_SIZE> secTxBuffer;
 
+	// optional buffer for writing multiple unconfirmed frames at once, empty if disabled
+	openpal::Buffer batchTxBuffer;
+	// true if the last batch already advanced past the final segment
+	bool batchConsumedFinal;
+
 	openpal::Settable<openpal::RSlice> pendingPriTx;
 	openpal::Settable<openpal::RSlice> pendingSecTx;
 
@@ -140,6 +148,7 @@ public:
 	ILinkListener* pListener;
 	ILinkSession* pSession;
 	IUpperLayer* pUpperLayer;
+	IStackMetricsListener* pMetrics;
 };
 
 }
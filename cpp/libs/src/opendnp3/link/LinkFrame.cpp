@@ -79,6 +79,27 @@ uint32_t LinkFrame::CalcFrameSize(uint8_t dataLength)
 	return LPDU_HEADER_SIZE + CalcUserDataSize(dataLength);
 }
 
+uint32_t LinkFrame::CountFrames(const openpal::RSlice& frames)
+{
+	uint32_t count = 0;
+	RSlice remainder(frames);
+
+	while (remainder.Size() >= LPDU_HEADER_SIZE && remainder[LI_LENGTH] >= LPDU_MIN_LENGTH)
+	{
+		auto size = CalcFrameSize(remainder[LI_LENGTH] - LPDU_MIN_LENGTH);
+
+		if (size > remainder.Size())
+		{
+			break;
+		}
+
+		remainder.Advance(size);
+		++count;
+	}
+
+	return count;
+}
+
 uint32_t LinkFrame::CalcUserDataSize(uint8_t dataLength)
 {
 	if (dataLength > 0)
@@ -164,6 +185,30 @@ RSlice LinkFrame::FormatUnconfirmedUserData(WSlice& buffer, bool aIsMaster, uint
 	return ret;
 }
 
+RSlice LinkFrame::FormatConfirmedUserData(WSlice& buffer, bool aIsMaster, bool aFcb, uint16_t aDest, uint16_t aSrc, const TransportSegment& segment, openpal::Logger* pLogger)
+{
+	assert(segment.Size() <= LPDU_MAX_USER_DATA_SIZE);
+	auto dataLength = static_cast<uint8_t>(segment.Size());
+	auto userDataSize = CalcUserDataSize(dataLength);
+	auto ret = buffer.ToRSlice().Take(userDataSize + LPDU_HEADER_SIZE);
+	FormatHeader(buffer, dataLength, aIsMaster, aFcb, true, LinkFunction::PRI_CONFIRMED_USER_DATA, aDest, aSrc, pLogger);
+	WriteUserData(segment, buffer);
+	buffer.Advance(userDataSize);
+	return ret;
+}
+
+RSlice LinkFrame::FormatUnconfirmedUserData(WSlice& buffer, bool aIsMaster, uint16_t aDest, uint16_t aSrc, const TransportSegment& segment, openpal::Logger* pLogger)
+{
+	assert(segment.Size() <= LPDU_MAX_USER_DATA_SIZE);
+	auto dataLength = static_cast<uint8_t>(segment.Size());
+	auto userDataSize = CalcUserDataSize(dataLength);
+	auto ret = buffer.ToRSlice().Take(userDataSize + LPDU_HEADER_SIZE);
+	FormatHeader(buffer, dataLength, aIsMaster, false, false, LinkFunction::PRI_UNCONFIRMED_USER_DATA, aDest, aSrc, pLogger);
+	WriteUserData(segment, buffer);
+	buffer.Advance(userDataSize);
+	return ret;
+}
+
 RSlice LinkFrame::FormatHeader(WSlice& buffer, uint8_t aDataLength, bool aIsMaster, bool aFcb, bool aFcvDfc, LinkFunction aFuncCode, uint16_t aDest, uint16_t aSrc, openpal::Logger* pLogger)
 {
 	assert(buffer.Size() >= LPDU_HEADER_SIZE);
@@ -188,13 +233,27 @@ void LinkFrame::WriteUserData(const uint8_t* pSrc, uint8_t* pDest, uint8_t lengt
 	{
 		uint8_t max = LPDU_DATA_BLOCK_SIZE;
 		uint8_t num = length > max ? max : length;
+		// the crc is calculated over the source so the copied block isn't read back
+		auto crc = CRC::CalcCrc(pSrc, num);
 		memcpy(pDest, pSrc, num);
-		CRC::AddCrc(pDest, num);
+		openpal::UInt16::Write(pDest + num, crc);
 		pSrc += num;
 		pDest += (num + 2);
 		length -= num;
 	}
 }
 
+void LinkFrame::WriteUserData(const TransportSegment& segment, uint8_t* pDest)
+{
+	// the first block is the transport header followed by the start of the payload
+	uint8_t first = segment.payload.Size() < (LPDU_DATA_BLOCK_SIZE - 1) ? static_cast<uint8_t>(segment.payload.Size()) : (LPDU_DATA_BLOCK_SIZE - 1);
+	pDest[0] = segment.header;
+	memcpy(pDest + 1, segment.payload, first);
+	openpal::UInt16::Write(pDest + first + 1, CRC::CalcCrc(pDest, first + 1));
+
+	// the remaining blocks are copied directly from the APDU
+	WriteUserData(segment.payload.Skip(first), pDest + first + 3, static_cast<uint8_t>(segment.payload.Size() - first));
+}
+
 } //end namespace
 
@@ -23,6 +23,7 @@
 
 #include "opendnp3/gen/FunctionCode.h"
 #include "opendnp3/gen/LinkFunction.h"
+#include "opendnp3/link/ITransportSegment.h"
 
 #include <openpal/container/RSlice.h>
 #include <openpal/container/WSlice.h>
@@ -60,6 +61,10 @@ public:
 	static openpal::RSlice FormatConfirmedUserData(openpal::WSlice& output, bool aIsMaster, bool aFcb, uint16_t aDest, uint16_t aSrc, const uint8_t* apData, uint8_t aDataLength, openpal::Logger* pLogger);
 	static openpal::RSlice FormatUnconfirmedUserData(openpal::WSlice& output, bool aIsMaster, uint16_t aDest, uint16_t aSrc, const uint8_t* apData, uint8_t aDataLength, openpal::Logger* pLogger);
 
+	// These overloads write the transport header and payload straight from the APDU, one copy per block
+	static openpal::RSlice FormatConfirmedUserData(openpal::WSlice& output, bool aIsMaster, bool aFcb, uint16_t aDest, uint16_t aSrc, const TransportSegment& segment, openpal::Logger* pLogger);
+	static openpal::RSlice FormatUnconfirmedUserData(openpal::WSlice& output, bool aIsMaster, uint16_t aDest, uint16_t aSrc, const TransportSegment& segment, openpal::Logger* pLogger);
+
 	////////////////////////////////////////////////
 	//	Reusable static formatting functions to any buffer
 	////////////////////////////////////////////////
@@ -80,6 +85,9 @@ public:
 	// @return Total frame size based on user data length
 	static uint32_t CalcFrameSize(uint8_t dataLength);
 
+	// Counts the complete frames in a buffer of back-to-back formatted frames
+	static uint32_t CountFrames(const openpal::RSlice& frames);
+
 private:
 
 	static uint32_t CalcUserDataSize(uint8_t dataLength);
@@ -92,6 +100,12 @@ private:
 	*/
 	static void WriteUserData(const uint8_t* pSrc, uint8_t* pDest, uint8_t length);
 
+	/** Writes a transport segment as user data, the header byte leads the first block
+		@param segment Transport header and a view of the payload in the APDU
+		@param apDest Destination buffer where the data + CRC is written
+	*/
+	static void WriteUserData(const TransportSegment& segment, uint8_t* pDest);
+
 	/** Write 10 header bytes to to buffer including 0x0564, all fields, and CRC */
 	static openpal::RSlice FormatHeader(openpal::WSlice& output, uint8_t aDataLength, bool aIsMaster, bool aFcb, bool aFcvDfc, LinkFunction aCode, uint16_t aDest, uint16_t aSrc, openpal::Logger* pLogger);
 
@@ -21,7 +21,7 @@
 #ifndef OPENDNP3_LINKHEADER_H
 #define OPENDNP3_LINKHEADER_H
 
-#include "LinkLayerConstants.h"
+#include "opendnp3/link/LinkLayerConstants.h"
 
 #include "opendnp3/gen/LinkFunction.h"
 
@@ -35,6 +35,11 @@ void LinkLayer::SetRouter(ILinkRouter& router)
 	ctx.pRouter = &router;
 }
 
+void LinkLayer::SetMetricsListener(IStackMetricsListener* pMetrics)
+{
+	ctx.pMetrics = pMetrics;
+}
+
 ////////////////////////////////
 // ILowerLayer
 ////////////////////////////////
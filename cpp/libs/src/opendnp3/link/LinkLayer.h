@@ -36,6 +36,8 @@ public:
 
 	void SetRouter(ILinkRouter&);
 
+	void SetMetricsListener(IStackMetricsListener* pMetrics);
+
 	// ---- Events from below: ILinkSession / IFrameSink  ----
 
 	virtual bool OnLowerLayerUp() override;
@@ -32,12 +32,13 @@ using namespace openpal;
 namespace opendnp3
 {
 
-LinkLayerParser::LinkLayerParser(const Logger& logger_, LinkChannelStatistics* pStatistics_) :
+LinkLayerParser::LinkLayerParser(const Logger& logger_, LinkChannelStatistics* pStatistics_, uint32_t rxBufferSize_) :
 	logger(logger_),
 	pStatistics(pStatistics_),
 	state(State::FindSync),
 	frameSize(0),
-	buffer(rxBuffer, LPDU_MAX_FRAME_SIZE)
+	rxBuffer((rxBufferSize_ < LPDU_MAX_FRAME_SIZE) ? LPDU_MAX_FRAME_SIZE : rxBufferSize_),
+	buffer(rxBuffer(), rxBuffer.Size())
 {
 
 }
@@ -171,8 +172,9 @@ void LinkLayerParser::PushFrame(IFrameSink* pSink)
 void LinkLayerParser::TransferUserData()
 {
 	uint32_t len = header.GetLength() - LPDU_MIN_LENGTH;
-	LinkFrame::ReadUserData(buffer.ReadBuffer() + LPDU_HEADER_SIZE, rxBuffer, len);
-	userData = RSlice(rxBuffer, len);
+	// user data is compacted to the front of the buffer, which never overlaps unread frames
+	LinkFrame::ReadUserData(buffer.ReadBuffer() + LPDU_HEADER_SIZE, rxBuffer(), len);
+	userData = RSlice(rxBuffer(), len);
 }
 
 bool LinkLayerParser::ReadHeader()
@@ -23,6 +23,7 @@
 
 
 #include <openpal/container/WSlice.h>
+#include <openpal/container/Buffer.h>
 #include <openpal/logging/Logger.h>
 
 #include "opendnp3/ErrorCodes.h"
@@ -51,11 +52,12 @@ class LinkLayerParser
 public:
 
 	/// @param logger_ Logger that the receiver is to use.
-	/// @param pSink_ Completely parsed frames are sent to this interface
-	LinkLayerParser(const openpal::Logger& logger, LinkChannelStatistics* pStatistics_ = nullptr);
+	/// @param pStatistics_ Optional statistics that are updated as frames are parsed
+	/// @param rxBufferSize_ Size of the receive buffer. Larger buffers allow a single read to carry many frames. Never less than LPDU_MAX_FRAME_SIZE.
+	LinkLayerParser(const openpal::Logger& logger, LinkChannelStatistics* pStatistics_ = nullptr, uint32_t rxBufferSize_ = LPDU_MAX_FRAME_SIZE);
 
 	/// Called when valid data has been written to the current buffer write position
-	/// Parses the new data and calls the specified frame sink
+	/// Parses the new data and calls the specified frame sink for every complete frame
 	/// @param numBytes Number of bytes written
 	void OnRead(uint32_t numBytes, IFrameSink* pSink);
 
@@ -93,7 +95,7 @@ private:
 	openpal::RSlice userData;
 
 	// buffer where received data is written
-	uint8_t rxBuffer[LPDU_MAX_FRAME_SIZE];
+	openpal::Buffer rxBuffer;
 
 	// facade over the rxBuffer that provides ability to "shift" as data is read
 	ShiftableBuffer buffer;
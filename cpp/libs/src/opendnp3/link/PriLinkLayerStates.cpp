@@ -95,8 +95,7 @@ PLLS_Idle PLLS_Idle::instance;
 
 PriStateBase& PLLS_Idle::TrySendUnconfirmed(LinkContext& ctx, ITransportSegment& segments)
 {
-	auto first = segments.GetSegment();
-	auto output = ctx.FormatPrimaryBufferWithUnconfirmed(first);
+	auto output = ctx.FormatPrimaryBufferWithUnconfirmed(segments);
 	ctx.QueueTransmit(output, true);
 	return PLLS_SendUnconfirmedTransmitWait::Instance();
 }
@@ -134,9 +133,10 @@ PLLS_SendUnconfirmedTransmitWait PLLS_SendUnconfirmedTransmitWait::instance;
 
 PriStateBase& PLLS_SendUnconfirmedTransmitWait::OnTransmitResult(LinkContext& ctx, bool success)
 {
-	if (ctx.pSegments->Advance())
+	// a batch that framed the final segment has already advanced past it
+	if (!ctx.batchConsumedFinal && ctx.pSegments->Advance())
 	{
-		auto output = ctx.FormatPrimaryBufferWithUnconfirmed(ctx.pSegments->GetSegment());
+		auto output = ctx.FormatPrimaryBufferWithUnconfirmed(*ctx.pSegments);
 		ctx.QueueTransmit(output, true);
 		return *this;
 	}
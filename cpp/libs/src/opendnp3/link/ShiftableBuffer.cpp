@@ -70,13 +70,26 @@ bool ShiftableBuffer::Sync()
 {
 	while (this->NumBytesRead() > 1) // at least 2 bytes
 	{
-		if (this->ReadBuffer()[0] == 0x05 && this->ReadBuffer()[1] == 0x64)
+		// memchr is vectorized by the C library, the last byte is excluded b/c it can't start a complete sync
+		auto pStart = pBuffer + readPos;
+		auto pSync = static_cast<const uint8_t*>(memchr(pStart, 0x05, this->NumBytesRead() - 1));
+
+		if (pSync == nullptr)
+		{
+			// discard everything but the last byte which might be the beginning of a sync
+			this->AdvanceRead(this->NumBytesRead() - 1);
+			return false;
+		}
+
+		this->AdvanceRead(static_cast<uint32_t>(pSync - pStart));
+
+		if (pSync[1] == 0x64)
 		{
 			return true;
 		}
 		else
 		{
-			this->AdvanceRead(1); // skip the first byte
+			this->AdvanceRead(1); // skip the 0x05
 		}
 	}
 
@@ -126,6 +126,11 @@ public:
 	*/
 	virtual char const* Name() const = 0;
 
+	/**
+	* The type of the task as reported to the application
+	*/
+	virtual MasterTaskType GetTaskType() const = 0;
+
 	/**
 	* The task's priority. Lower numbers are higher priority.
 	*/
@@ -212,6 +217,8 @@ public:
 
 	/**
 	* Demand that the task run immediately by setting the expiration to 0
+	*
+	* A task that is scheduled must be demanded through MasterScheduler::Demand() so that it is re-indexed
 	*/
 	void Demand();
 
@@ -226,8 +233,6 @@ protected:
 
 	virtual bool IsEnabled() const = 0;
 
-	virtual MasterTaskType GetTaskType() const = 0;
-
 	IMasterApplication* pApplication;
 	openpal::Logger logger;
 
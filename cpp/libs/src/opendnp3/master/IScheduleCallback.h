@@ -28,7 +28,11 @@ class IScheduleCallback
 {
 public:
 
+	/// The lock was handed to this session, check for a task on a later turn of the executor
 	virtual void OnPendingTask() = 0;
+
+	/// The lock was handed to this session as another one completed its task, start the task now
+	virtual void OnLockGranted() = 0;
 };
 
 }
@@ -35,22 +35,22 @@ NullTaskLock::NullTaskLock()
 
 }
 
-bool NullTaskLock::Acquire(IScheduleCallback&)
+bool NullTaskLock::Acquire(IScheduleCallback&, const openpal::MonotonicTimestamp&, const openpal::MonotonicTimestamp&)
 {
 	return true;
 }
 
-void NullTaskLock::Release(IScheduleCallback&)
+void NullTaskLock::Release(IScheduleCallback&, const openpal::MonotonicTimestamp&)
 {
 
 }
 
-void NullTaskLock::OnLayerUp()
+void NullTaskLock::OnLayerUp(IScheduleCallback&, const openpal::MonotonicTimestamp&)
 {
 
 }
 
-void NullTaskLock::OnLayerDown()
+void NullTaskLock::OnLayerDown(IScheduleCallback&, const openpal::MonotonicTimestamp&)
 {
 
 }
@@ -22,6 +22,7 @@
 #define OPENDNP3_ITASKLOCK_H
 
 #include <openpal/util/Uncopyable.h>
+#include <openpal/executor/MonotonicTimestamp.h>
 
 #include "opendnp3/master/IScheduleCallback.h"
 
@@ -36,30 +37,32 @@ class ITaskLock
 {
 public:
 
-	/// Acquire a lock
-	virtual bool Acquire(IScheduleCallback&) = 0;
+	/// Acquire a lock to run a task that must start by the deadline, Max() if it can wait indefinitely.
+	/// If the lock is not available, the callback is notified when it has been granted: via OnLockGranted() when
+	/// another session releases the lock, or via OnPendingTask() when the holder goes offline.
+	virtual bool Acquire(IScheduleCallback&, const openpal::MonotonicTimestamp& deadline, const openpal::MonotonicTimestamp& now) = 0;
 
 	/// Release a lock
-	virtual void Release(IScheduleCallback&) = 0;
+	virtual void Release(IScheduleCallback&, const openpal::MonotonicTimestamp& now) = 0;
 
-	/// channel online
-	virtual void OnLayerUp() = 0;
+	/// session online
+	virtual void OnLayerUp(IScheduleCallback&, const openpal::MonotonicTimestamp& now) = 0;
 
-	/// channel offline
-	virtual void OnLayerDown() = 0;
+	/// session offline, releases the lock and any pending request from the session
+	virtual void OnLayerDown(IScheduleCallback&, const openpal::MonotonicTimestamp& now) = 0;
 };
 
 class NullTaskLock : public ITaskLock, private openpal::Uncopyable
 {
 public:
 
-	virtual bool Acquire(IScheduleCallback&) override final;
+	virtual bool Acquire(IScheduleCallback&, const openpal::MonotonicTimestamp&, const openpal::MonotonicTimestamp&) override final;
 
-	virtual void Release(IScheduleCallback&) override final;
+	virtual void Release(IScheduleCallback&, const openpal::MonotonicTimestamp&) override final;
 
-	virtual void OnLayerUp() override final;
+	virtual void OnLayerUp(IScheduleCallback&, const openpal::MonotonicTimestamp&) override final;
 
-	virtual void OnLayerDown() override final;
+	virtual void OnLayerDown(IScheduleCallback&, const openpal::MonotonicTimestamp&) override final;
 
 	static ITaskLock& Instance();
 
@@ -55,6 +55,7 @@ MContext::MContext(
 	pSOEHandler(&SOEHandler),
 	pTaskLock(&taskLock),
 	pApplication(&application),
+	pMetrics(nullptr),
 	isOnline(false),
 	isSending(false),
 	responseTimer(executor),
@@ -74,7 +75,7 @@ bool MContext::OnLowerLayerUp()
 	}
 
 	isOnline = true;
-	pTaskLock->OnLayerUp();
+	pTaskLock->OnLayerUp(*this, pExecutor->GetTime());
 	tasks.Initialize(scheduler);
 	this->PostCheckForTask();
 	return true;
@@ -98,7 +99,7 @@ bool MContext::OnLowerLayerDown()
 
 	tstate = TaskState::IDLE;
 
-	pTaskLock->OnLayerDown();
+	pTaskLock->OnLayerDown(*this, now);
 
 	responseTimer.Cancel();
 	taskStartTimeoutTimer.Cancel();
@@ -182,7 +183,7 @@ void MContext::CompleteActiveTask()
 			this->pActiveTask.Release();
 		}
 
-		pTaskLock->Release(*this);
+		pTaskLock->Release(*this, pExecutor->GetTime());
 		this->PostCheckForTask();
 	}
 }
@@ -225,27 +226,27 @@ void MContext::ProcessIIN(const IINField& iin)
 {
 	if (iin.IsSet(IINBit::DEVICE_RESTART))
 	{
-		this->tasks.clearRestart.Demand();
-		this->tasks.assignClass.Demand();
-		this->tasks.startupIntegrity.Demand();
-		this->tasks.enableUnsol.Demand();
+		this->scheduler.Demand(this->tasks.clearRestart);
+		this->scheduler.Demand(this->tasks.assignClass);
+		this->scheduler.Demand(this->tasks.startupIntegrity);
+		this->scheduler.Demand(this->tasks.enableUnsol);
 	}
 
 	if (iin.IsSet(IINBit::EVENT_BUFFER_OVERFLOW) && this->params.integrityOnEventOverflowIIN)
 	{
-		this->tasks.startupIntegrity.Demand();
+		this->scheduler.Demand(this->tasks.startupIntegrity);
 	}
 
 	if (iin.IsSet(IINBit::NEED_TIME))
 	{
-		this->tasks.timeSync.Demand();
+		this->scheduler.Demand(this->tasks.timeSync);
 	}
 
 	if ((iin.IsSet(IINBit::CLASS1_EVENTS) && this->params.eventScanOnEventsAvailableClassMask.HasClass1()) ||
 	        (iin.IsSet(IINBit::CLASS2_EVENTS) && this->params.eventScanOnEventsAvailableClassMask.HasClass2()) ||
 	        (iin.IsSet(IINBit::CLASS3_EVENTS) && this->params.eventScanOnEventsAvailableClassMask.HasClass3()))
 	{
-		this->tasks.eventScan.Demand();
+		this->scheduler.Demand(this->tasks.eventScan);
 	}
 
 	this->pApplication->OnReceiveIIN(iin);
@@ -327,9 +328,10 @@ MasterScan MContext::AddScan(openpal::TimeDuration period, const HeaderBuilderT&
 {
 	auto pTask = new UserPollTask(builder, true, period, params.taskRetryPeriod, *pApplication, *pSOEHandler, logger, config);
 	this->ScheduleRecurringPollTask(pTask);
-	auto callback = [this]()
+	auto callback = [this, pTask]()
 	{
-		this->PostCheckForTask();
+		this->scheduler.Demand(*pTask);
+		this->CheckForTask();
 	};
 	return MasterScan(*pExecutor, pTask, callback);
 }
@@ -427,6 +429,11 @@ void MContext::SetTaskStartTimeout(const openpal::MonotonicTimestamp& time)
 	this->taskStartTimeoutTimer.Restart(time, action);
 }
 
+void MContext::SetMetricsListener(IStackMetricsListener* pMetrics_)
+{
+	this->pMetrics = pMetrics_;
+}
+
 /// ------ private helpers ----------
 
 void MContext::ScheduleRecurringPollTask(IMasterTask* pTask)
@@ -477,7 +484,7 @@ MContext::TaskState MContext::BeginNewTask(ManagedPtr<IMasterTask>& task)
 
 MContext::TaskState MContext::ResumeActiveTask()
 {
-	if (!this->pTaskLock->Acquire(*this))
+	if (!this->pTaskLock->Acquire(*this, this->pActiveTask->StartExpirationTime(), pExecutor->GetTime()))
 	{
 		return TaskState::TASK_READY;
 	}
@@ -497,6 +504,11 @@ MContext::TaskState MContext::ResumeActiveTask()
 	this->RecordLastRequest(apdu);
 	this->Transmit(apdu);
 
+	if (pMetrics)
+	{
+		pMetrics->OnTaskRequest(pActiveTask->GetTaskType());
+	}
+
 	return TaskState::WAIT_FOR_RESPONSE;
 }
 
@@ -589,6 +601,11 @@ MContext::TaskState MContext::OnResponse_WaitForResponse(const APDUResponseHeade
 
 	this->responseTimer.Cancel();
 
+	if (pMetrics)
+	{
+		pMetrics->OnTaskResponse(pActiveTask->GetTaskType());
+	}
+
 	this->solSeq.Increment();
 
 	auto now = this->pExecutor->GetTime();
@@ -37,6 +37,7 @@
 #include "opendnp3/master/ITaskFilter.h"
 #include "opendnp3/master/MasterTasks.h"
 #include "opendnp3/master/ITaskLock.h"
+#include "opendnp3/IStackMetricsListener.h"
 #include "opendnp3/master/IMasterApplication.h"
 #include "opendnp3/master/MasterScan.h"
 #include "opendnp3/master/HeaderBuilder.h"
@@ -83,6 +84,7 @@ public:
 	ISOEHandler* pSOEHandler;
 	ITaskLock* pTaskLock;
 	IMasterApplication* pApplication;
+	IStackMetricsListener* pMetrics;
 
 
 	// ------- dynamic state ---------
@@ -130,6 +132,9 @@ public:
 
 	virtual void SetTaskStartTimeout(const openpal::MonotonicTimestamp& time) override final;
 
+	/// optional listener for request round trip times, may be null
+	void SetMetricsListener(IStackMetricsListener* pMetrics);
+
 	/// methods for initiating command sequences
 
 	void DirectOperate(CommandSet&& commands, const CommandCallbackT& callback, const TaskConfig& config);
@@ -199,6 +204,11 @@ private:
 		this->PostCheckForTask();
 	}
 
+	virtual void OnLockGranted() override
+	{
+		this->CheckForTask();
+	}
+
 	void ProcessIIN(const IINField& iin);
 
 	void OnResponseTimeout();	
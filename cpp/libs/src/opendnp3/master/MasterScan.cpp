@@ -47,12 +47,7 @@ bool MasterScan::Demand()
 {
 	if (IsDefined())
 	{
-		auto action = [this]()
-		{
-			pTask->Demand();
-		};
-		pExecutor->PostLambda(action);
-		demandCallback();
+		pExecutor->PostLambda(demandCallback);
 		return true;
 	}
 	else
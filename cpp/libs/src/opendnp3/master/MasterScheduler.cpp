@@ -32,35 +32,177 @@ namespace opendnp3
 {
 
 MasterScheduler::MasterScheduler(ITaskFilter& filter) :
-	m_filter(&filter)
+	m_filter(&filter),
+	m_sequence(0)
 {
 
 }
 
 void MasterScheduler::Schedule(openpal::ManagedPtr<IMasterTask> pTask)
 {
-	m_tasks.push_back(std::move(pTask));
+	const auto seq = m_sequence++;
+	const bool blocking = pTask->BlocksLowerPriority();
+	const auto expiration = pTask->ExpirationTime().milliseconds;
+	const auto priority = pTask->Priority();
+
+	if (!pTask->IsRecurring() && !pTask->StartExpirationTime().IsMax())
+	{
+		m_startTimeouts.push(StartTimeout(pTask->StartExpirationTime().milliseconds, seq));
+	}
+
+	m_index.insert(std::make_pair(&*pTask, seq));
+	m_tasks.insert(std::make_pair(seq, Record(std::move(pTask), blocking, priority, expiration)));
+
+	if (blocking)
+	{
+		m_blocking.push_back(seq);
+	}
+	else
+	{
+		m_waiting.insert(WaitingKey(expiration, priority, seq));
+	}
+
 	this->RecalculateTaskStartTimeout();
 }
 
-std::vector<openpal::ManagedPtr<IMasterTask>>::iterator MasterScheduler::GetNextTask(const MonotonicTimestamp& now)
+void MasterScheduler::Demand(IMasterTask& task)
 {
-	auto runningBest = m_tasks.begin();
+	task.Demand();
 
-	if (!m_tasks.empty())
+	auto range = m_index.equal_range(&task);
+	for (auto i = range.first; i != range.second; ++i)
 	{
-		auto current = m_tasks.begin();
-		++current;
+		auto& record = m_tasks.find(i->second)->second;
 
-		for (; current != m_tasks.end(); ++current)
+		// expired tasks are ordered by priority alone and stay expired
+		if (!record.blocking && !record.expired)
 		{
-			auto result = TaskComparison::SelectHigherPriority(now, **runningBest, **current, *m_filter);
-			if (result == TaskComparison::Result::Right)
-			{
-				runningBest = current;
-			}
+			m_waiting.erase(WaitingKey(record.expiration, record.priority, i->second));
+			record.expiration = task.ExpirationTime().milliseconds;
+			m_waiting.insert(WaitingKey(record.expiration, record.priority, i->second));
 		}
 	}
+}
+
+void MasterScheduler::Remove(TaskMap::iterator elem)
+{
+	const auto seq = elem->first;
+	auto& record = elem->second;
+
+	if (record.blocking)
+	{
+		m_blocking.erase(std::find(m_blocking.begin(), m_blocking.end(), seq));
+	}
+	else if (record.expired)
+	{
+		m_expired.erase(ExpiredKey(record.priority, seq));
+	}
+	else
+	{
+		m_waiting.erase(WaitingKey(record.expiration, record.priority, seq));
+	}
+
+	auto range = m_index.equal_range(record.pTask);
+	for (auto i = range.first; i != range.second; ++i)
+	{
+		if (i->second == seq)
+		{
+			m_index.erase(i);
+			break;
+		}
+	}
+
+	m_tasks.erase(elem);
+}
+
+void MasterScheduler::MoveExpired(const MonotonicTimestamp& now)
+{
+	while (!m_waiting.empty() && std::get<0>(*m_waiting.begin()) <= now.milliseconds)
+	{
+		const auto seq = std::get<2>(*m_waiting.begin());
+		m_expired.insert(ExpiredKey(std::get<1>(*m_waiting.begin()), seq));
+		m_waiting.erase(m_waiting.begin());
+		m_tasks.find(seq)->second.expired = true;
+	}
+}
+
+MasterScheduler::TaskMap::iterator MasterScheduler::GetNextUnblockedTask()
+{
+	/*
+	* Between two tasks that don't block lower priority tasks, TaskComparison prefers an enabled task, then an expired
+	* task, then among expired tasks the higher priority and among the others the earlier expiration. Ties go to the
+	* task scheduled first. The first enabled task in the expired index followed by the waiting index is the task the
+	* comparison selects.
+	*/
+
+	for (auto& key : m_expired)
+	{
+		auto elem = m_tasks.find(key.second);
+		if (m_filter->CanRun(*elem->second.task))
+		{
+			return elem;
+		}
+	}
+
+	for (auto& key : m_waiting)
+	{
+		if (std::get<0>(key) == MonotonicTimestamp::Max().milliseconds)
+		{
+			// only disabled tasks remain
+			break;
+		}
+
+		auto elem = m_tasks.find(std::get<2>(key));
+		if (m_filter->CanRun(*elem->second.task))
+		{
+			return elem;
+		}
+	}
+
+	return m_tasks.end();
+}
+
+MasterScheduler::TaskMap::iterator MasterScheduler::SelectHigherPriority(const MonotonicTimestamp& now, TaskMap::iterator best, TaskMap::iterator current)
+{
+	if (best == m_tasks.end())
+	{
+		return current;
+	}
+
+	auto result = TaskComparison::SelectHigherPriority(now, *best->second.task, *current->second.task, *m_filter);
+	return (result == TaskComparison::Result::Right) ? current : best;
+}
+
+MasterScheduler::TaskMap::iterator MasterScheduler::GetNextTask(const MonotonicTimestamp& now)
+{
+	this->MoveExpired(now);
+
+	auto unblocked = this->GetNextUnblockedTask();
+
+	if (m_blocking.empty())
+	{
+		return unblocked;
+	}
+
+	// compare the blocking tasks and the best of the others pairwise in the order they were scheduled
+	auto runningBest = m_tasks.end();
+	bool pending = (unblocked != m_tasks.end());
+
+	for (auto seq : m_blocking)
+	{
+		if (pending && unblocked->first < seq)
+		{
+			runningBest = this->SelectHigherPriority(now, runningBest, unblocked);
+			pending = false;
+		}
+
+		runningBest = this->SelectHigherPriority(now, runningBest, m_tasks.find(seq));
+	}
+
+	if (pending)
+	{
+		runningBest = this->SelectHigherPriority(now, runningBest, unblocked);
+	}
 
 	return runningBest;
 }
@@ -76,18 +218,19 @@ openpal::ManagedPtr<IMasterTask> MasterScheduler::GetNext(const MonotonicTimesta
 	}
 	else
 	{
-		const bool EXPIRED = (*elem)->ExpirationTime().milliseconds <= now.milliseconds;
-		const bool CAN_RUN = this->m_filter->CanRun(**elem);
+		auto& task = elem->second.task;
+		const bool EXPIRED = task->ExpirationTime().milliseconds <= now.milliseconds;
+		const bool CAN_RUN = this->m_filter->CanRun(*task);
 
 		if (EXPIRED && CAN_RUN)
 		{
-			ManagedPtr<IMasterTask> ret(std::move(*elem));
-			m_tasks.erase(elem);
+			ManagedPtr<IMasterTask> ret(std::move(task));
+			this->Remove(elem);
 			return ret;
 		}
 		else
 		{
-			next = CAN_RUN ? (*elem)->ExpirationTime() : MonotonicTimestamp::Max();
+			next = CAN_RUN ? task->ExpirationTime() : MonotonicTimestamp::Max();
 			return ManagedPtr<IMasterTask>();
 		}
 	}
@@ -96,45 +239,54 @@ openpal::ManagedPtr<IMasterTask> MasterScheduler::GetNext(const MonotonicTimesta
 void MasterScheduler::Shutdown(const MonotonicTimestamp& now)
 {
 	m_tasks.clear();
-}
-
-bool MasterScheduler::IsTimedOut(const MonotonicTimestamp& now, openpal::ManagedPtr<IMasterTask>& task)
-{
-	if (task->IsRecurring() || task->StartExpirationTime() > now)
-	{
-		return false;
-	}
-
-	task->OnStartTimeout(now);
-
-	return true;
+	m_blocking.clear();
+	m_waiting.clear();
+	m_expired.clear();
+	m_index.clear();
+	m_startTimeouts = decltype(m_startTimeouts)();
 }
 
 void MasterScheduler::CheckTaskStartTimeout(const openpal::MonotonicTimestamp& now)
 {
-	auto timedOut = [this, now](openpal::ManagedPtr<IMasterTask>& task)
+	while (!m_startTimeouts.empty() && m_startTimeouts.top().first <= now.milliseconds)
 	{
-		return this->IsTimedOut(now, task);
-	};
+		auto elem = m_tasks.find(m_startTimeouts.top().second);
+		m_startTimeouts.pop();
 
-	// erase-remove idion (https://en.wikipedia.org/wiki/Erase-remove_idiom)
-	m_tasks.erase(std::remove_if(m_tasks.begin(), m_tasks.end(), timedOut), m_tasks.end());
+		if (elem != m_tasks.end())
+		{
+			ManagedPtr<IMasterTask> task(std::move(elem->second.task));
+			this->Remove(elem);
+			task->OnStartTimeout(now);
+		}
+	}
 }
 
 void MasterScheduler::RecalculateTaskStartTimeout()
 {
-	auto min = MonotonicTimestamp::Max();
-
-	for(auto & task : m_tasks)
+	// rebuild the heap if entries for tasks that have already started dominate it
+	if (m_startTimeouts.size() > (2 * m_tasks.size() + 16))
 	{
-		if (!task->IsRecurring() && (task->StartExpirationTime() < min))
+		decltype(m_startTimeouts) live;
+		for (auto& elem : m_tasks)
 		{
-			min = task->StartExpirationTime();
+			auto& task = elem.second.task;
+			if (!task->IsRecurring() && !task->StartExpirationTime().IsMax())
+			{
+				live.push(StartTimeout(task->StartExpirationTime().milliseconds, elem.first));
+			}
 		}
+		m_startTimeouts = std::move(live);
 	}
 
+	while (!m_startTimeouts.empty() && (m_tasks.find(m_startTimeouts.top().second) == m_tasks.end()))
+	{
+		m_startTimeouts.pop();
+	}
+
+	auto min = m_startTimeouts.empty() ? MonotonicTimestamp::Max() : MonotonicTimestamp(m_startTimeouts.top().first);
+
 	this->m_filter->SetTaskStartTimeout(min);
 }
 
 }
-
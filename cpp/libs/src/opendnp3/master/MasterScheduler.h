@@ -32,11 +32,23 @@
 #include "opendnp3/master/ITaskFilter.h"
 
 #include <vector>
+#include <map>
+#include <set>
+#include <tuple>
+#include <queue>
+#include <unordered_map>
 #include <functional>
 
 namespace opendnp3
 {
 
+/**
+* Selects the next master task to run.
+*
+* Tasks that block lower priority tasks are the handful of startup tasks. Their enabled state depends on the
+* outstation's IIN bits, so they are compared pairwise on every selection. All other tasks are indexed by
+* expiration and by priority. Their order only changes when they are demanded, which must go through Demand().
+*/
 class MasterScheduler
 {
 
@@ -49,6 +61,11 @@ public:
 	*/
 	void Schedule(openpal::ManagedPtr<IMasterTask> pTask);
 
+	/**
+	* Demand that a task run as soon as possible, re-indexing it if it is scheduled
+	*/
+	void Demand(IMasterTask& task);
+
 	/**
 	* @return Task to start or undefined pointer if no task to start
 	* If there is no task to start, 'next' is set to the timestamp when the scheduler should be re-evaluated
@@ -65,17 +82,73 @@ public:
 	*/
 	void CheckTaskStartTimeout(const openpal::MonotonicTimestamp& now);
 
+	/**
+	* @return The number of scheduled tasks
+	*/
+	size_t Size() const
+	{
+		return m_tasks.size();
+	}
+
 private:
 
-	bool IsTimedOut(const openpal::MonotonicTimestamp& now, openpal::ManagedPtr<IMasterTask>& task);
+	struct Record
+	{
+		Record(openpal::ManagedPtr<IMasterTask> task_, bool blocking_, int priority_, int64_t expiration_) :
+			pTask(&*task_), task(std::move(task_)), blocking(blocking_), priority(priority_), expiration(expiration_), expired(false)
+		{}
 
-	void RecalculateTaskStartTimeout();
+		// remains valid for removal after the task has been moved out
+		const IMasterTask* pTask;
+		openpal::ManagedPtr<IMasterTask> task;
+		bool blocking;
+		int priority;
+		// expiration a task that does not block is indexed under
+		int64_t expiration;
+		// true if the task has been moved from the waiting to the expired index
+		bool expired;
+	};
+
+	typedef std::map<uint64_t, Record> TaskMap;
+
+	// expiration, priority, sequence
+	typedef std::tuple<int64_t, int, uint64_t> WaitingKey;
+
+	// priority, sequence
+	typedef std::pair<int, uint64_t> ExpiredKey;
+
+	// start expiration, sequence
+	typedef std::pair<int64_t, uint64_t> StartTimeout;
 
+	void Remove(TaskMap::iterator elem);
 
-	std::vector<openpal::ManagedPtr<IMasterTask>>::iterator GetNextTask(const openpal::MonotonicTimestamp& now);
+	void MoveExpired(const openpal::MonotonicTimestamp& now);
+
+	TaskMap::iterator GetNextTask(const openpal::MonotonicTimestamp& now);
+
+	TaskMap::iterator GetNextUnblockedTask();
+
+	TaskMap::iterator SelectHigherPriority(const openpal::MonotonicTimestamp& now, TaskMap::iterator best, TaskMap::iterator current);
+
+	void RecalculateTaskStartTimeout();
 
 	ITaskFilter* m_filter;
-	std::vector<openpal::ManagedPtr<IMasterTask>> m_tasks;
+	uint64_t m_sequence;
+
+	// every scheduled task in the order it was scheduled
+	TaskMap m_tasks;
+
+	// sequence numbers of the tasks that block lower priority tasks
+	std::vector<uint64_t> m_blocking;
+
+	// tasks that don't block, by expiration until they expire and then by priority
+	std::set<WaitingKey> m_waiting;
+	std::set<ExpiredKey> m_expired;
+
+	std::unordered_multimap<const IMasterTask*, uint64_t> m_index;
+
+	// min-heap of start timeouts, entries for tasks that are no longer scheduled are skipped
+	std::priority_queue<StartTimeout, std::vector<StartTimeout>, std::greater<StartTimeout>> m_startTimeouts;
 };
 
 }
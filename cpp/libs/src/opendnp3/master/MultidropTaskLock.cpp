@@ -20,91 +20,203 @@
  */
 #include "MultidropTaskLock.h"
 
+using namespace openpal;
+
 namespace opendnp3
 {
 
-MultidropTaskLock::MultidropTaskLock() : isOnline(false), pActive(nullptr)
+MultidropTaskLock::MultidropTaskLock() : nextOrder(0), lastOrder(0), pActive(nullptr)
 {
 
 }
 
-bool MultidropTaskLock::Acquire(IScheduleCallback& callback)
+bool MultidropTaskLock::Acquire(IScheduleCallback& callback, const MonotonicTimestamp& deadline, const MonotonicTimestamp& now)
 {
-	if (isOnline)
+	auto session = sessions.find(&callback);
+	if (session == sessions.end())
+	{
+		return false;
+	}
+
+	if (pActive)
 	{
-		if (pActive)
+		if (&callback == pActive)
 		{
-			if (&callback == pActive)
-			{
-				return true;
-			}
-			else
-			{
-				this->AddIfNotContained(callback);
-				return false;
-			}
+			return true;
 		}
-		else
+
+		if (!session->second.isWaiting)
 		{
-			pActive = &callback;
-			return true;
+			session->second.isWaiting = true;
+			session->second.waitStart = now;
 		}
+
+		session->second.deadline = deadline;
+		return false;
 	}
-	else
+
+	this->Grant(session, now);
+	return true;
+}
+
+void MultidropTaskLock::Release(IScheduleCallback& callback, const MonotonicTimestamp& now)
+{
+	auto next = this->ReleaseAndSelect(callback, now);
+	if (next)
 	{
-		return false;
+		// start the next request in the same call that processed the final response
+		next->OnLockGranted();
 	}
 }
 
-void MultidropTaskLock::Release(IScheduleCallback& callback)
+IScheduleCallback* MultidropTaskLock::ReleaseAndSelect(IScheduleCallback& callback, const MonotonicTimestamp& now)
 {
-	if (isOnline && pActive == &callback)
+	if (pActive != &callback)
 	{
-		pActive = nullptr;
+		return nullptr;
+	}
 
-		if (!callbackQueue.empty())
-		{
-			pActive = callbackQueue.front();
-			callbackQueue.pop_front();
-			callbackSet.erase(pActive);
-			pActive->OnPendingTask();
-		}
+	statistics.busyTimeMs += Elapsed(activeSince, now);
+	pActive = nullptr;
+
+	auto released = sessions.find(&callback);
+	if (released != sessions.end())
+	{
+		lastOrder = released->second.order;
+	}
+
+	auto next = this->SelectNext();
+	if (next == sessions.end())
+	{
+		return nullptr;
+	}
+
+	this->Grant(next, now);
+	return next->first;
+}
+
+void MultidropTaskLock::OnLayerUp(IScheduleCallback& callback, const MonotonicTimestamp& now)
+{
+	if (sessions.empty())
+	{
+		onlineSince = now;
+	}
+
+	if (sessions.find(&callback) == sessions.end())
+	{
+		sessions.insert(std::make_pair(&callback, Session(nextOrder++)));
+	}
+}
+
+void MultidropTaskLock::OnLayerDown(IScheduleCallback& callback, const MonotonicTimestamp& now)
+{
+	auto session = sessions.find(&callback);
+	if (session == sessions.end())
+	{
+		return;
+	}
+
+	// a session going offline must not strand the others that are waiting on it, but the whole
+	// channel may be closing so the next session checks for its task on a later turn
+	auto next = this->ReleaseAndSelect(callback, now);
+	if (next)
+	{
+		next->OnPendingTask();
+	}
+
+	sessions.erase(&callback);
+
+	if (sessions.empty())
+	{
+		statistics.onlineTimeMs += Elapsed(onlineSince, now);
+	}
+}
+
+MultidropStatistics MultidropTaskLock::GetStatistics(const MonotonicTimestamp& now) const
+{
+	auto stats = statistics;
+
+	if (!sessions.empty())
+	{
+		stats.onlineTimeMs += Elapsed(onlineSince, now);
 	}
+
+	if (pActive)
+	{
+		stats.busyTimeMs += Elapsed(activeSince, now);
+	}
+
+	return stats;
 }
 
-void MultidropTaskLock::OnLayerUp()
+MultidropTaskLock::SessionMap::iterator MultidropTaskLock::SelectNext()
 {
-	if (!isOnline)
+	auto best = sessions.end();
+
+	for (auto iter = sessions.begin(); iter != sessions.end(); ++iter)
 	{
-		isOnline = true;
+		if (iter->second.isWaiting && ((best == sessions.end()) || IsHigherPriority(iter->second, best->second)))
+		{
+			best = iter;
+		}
 	}
+
+	return best;
 }
 
-void MultidropTaskLock::OnLayerDown()
+bool MultidropTaskLock::IsHigherPriority(const Session& lhs, const Session& rhs) const
 {
-	if (isOnline)
+	if (lhs.deadline.milliseconds != rhs.deadline.milliseconds)
 	{
-		isOnline = false;
-		pActive = nullptr;
-		callbackSet.clear();
-		callbackQueue.clear();
+		return lhs.deadline.milliseconds < rhs.deadline.milliseconds;
 	}
+
+	// round-robin: sessions that come after the last one to run go first
+	const bool lhsWraps = lhs.order <= lastOrder;
+	const bool rhsWraps = rhs.order <= lastOrder;
+
+	if (lhsWraps != rhsWraps)
+	{
+		return rhsWraps;
+	}
+
+	return lhs.order < rhs.order;
 }
 
-bool MultidropTaskLock::AddIfNotContained(IScheduleCallback& callback)
+void MultidropTaskLock::Grant(SessionMap::iterator session, const MonotonicTimestamp& now)
 {
-	auto result = callbackSet.find(&callback);
-	if (result == callbackSet.end())
+	auto& record = session->second;
+
+	if (record.isWaiting)
 	{
-		callbackSet.insert(&callback);
-		callbackQueue.push_back(&callback);
-		return true;
+		record.isWaiting = false;
+		++statistics.numContendedGrants;
+		statistics.waitTimeMs += Elapsed(record.waitStart, now);
 	}
-	else
+
+	if (record.hasGrant)
 	{
-		return false;
+		const auto cycle = Elapsed(record.lastGrant, now);
+		++statistics.numPollCycles;
+		statistics.totalPollCycleMs += cycle;
+		statistics.lastPollCycleMs = cycle;
+		if (cycle > statistics.maxPollCycleMs)
+		{
+			statistics.maxPollCycleMs = cycle;
+		}
 	}
+
+	record.hasGrant = true;
+	record.lastGrant = now;
+
+	++statistics.numGrants;
+	pActive = session->first;
+	activeSince = now;
 }
 
+uint64_t MultidropTaskLock::Elapsed(const MonotonicTimestamp& start, const MonotonicTimestamp& end)
+{
+	return (end.milliseconds > start.milliseconds) ? static_cast<uint64_t>(end.milliseconds - start.milliseconds) : 0;
 }
 
+}
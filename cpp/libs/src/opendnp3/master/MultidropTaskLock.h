@@ -22,42 +22,78 @@
 #define OPENDNP3_MULTIDROPTASKLOCK_H
 
 #include "opendnp3/master/ITaskLock.h"
+#include "opendnp3/master/MultidropStatistics.h"
 
-#include <set>
-#include <deque>
+#include <map>
 
 namespace opendnp3
 {
 
-class MultidropTaskLock: public opendnp3::ITaskLock
+/**
+	Channel-level scheduler for masters sharing a multi-drop channel.
+
+	Sessions present their next ready task when they try to acquire the lock. When the lock is released
+	it is handed directly to a waiting session in the same call, so the next request goes out as soon as
+	the previous transaction completes. Waiting sessions are chosen by the earliest task start deadline,
+	and sessions whose tasks can wait indefinitely (e.g. polls) are served round-robin.
+*/
+class MultidropTaskLock: public opendnp3::ITaskLock, private openpal::Uncopyable
 {
 public:
 
 	MultidropTaskLock();
 
+	virtual bool Acquire(IScheduleCallback&, const openpal::MonotonicTimestamp& deadline, const openpal::MonotonicTimestamp& now) override final;
 
-	virtual bool Acquire(IScheduleCallback&) override final;
+	virtual void Release(IScheduleCallback&, const openpal::MonotonicTimestamp& now) override final;
 
+	virtual void OnLayerUp(IScheduleCallback&, const openpal::MonotonicTimestamp& now) override final;
 
-	virtual void Release(IScheduleCallback&) override final;
+	virtual void OnLayerDown(IScheduleCallback&, const openpal::MonotonicTimestamp& now) override final;
 
+	/// Statistics with the current online and busy periods measured up to now
+	MultidropStatistics GetStatistics(const openpal::MonotonicTimestamp& now) const;
 
-	virtual void OnLayerUp() override final;
+private:
 
+	struct Session
+	{
+		Session(uint32_t order_) : order(order_), isWaiting(false), hasGrant(false)
+		{}
 
-	virtual void OnLayerDown() override final;
+		/// the order in which the session came online, used for round-robin
+		uint32_t order;
 
+		bool isWaiting;
+		openpal::MonotonicTimestamp waitStart;
+		openpal::MonotonicTimestamp deadline;
 
-private:
+		bool hasGrant;
+		openpal::MonotonicTimestamp lastGrant;
+	};
+
+	typedef std::map<IScheduleCallback*, Session> SessionMap;
+
+	IScheduleCallback* ReleaseAndSelect(IScheduleCallback& callback, const openpal::MonotonicTimestamp& now);
 
-	bool AddIfNotContained(IScheduleCallback&);
+	SessionMap::iterator SelectNext();
 
-	std::set<IScheduleCallback*> callbackSet;
-	std::deque<IScheduleCallback*> callbackQueue;
+	bool IsHigherPriority(const Session& lhs, const Session& rhs) const;
 
-	bool isOnline;
+	void Grant(SessionMap::iterator session, const openpal::MonotonicTimestamp& now);
+
+	static uint64_t Elapsed(const openpal::MonotonicTimestamp& start, const openpal::MonotonicTimestamp& end);
+
+	SessionMap sessions;
+
+	uint32_t nextOrder;
+	uint32_t lastOrder;
 
 	IScheduleCallback* pActive;
+	openpal::MonotonicTimestamp activeSince;
+	openpal::MonotonicTimestamp onlineSince;
+
+	MultidropStatistics statistics;
 };
 
 }
@@ -59,6 +59,7 @@ struct Group1Var2
   static bool ReadTarget(openpal::RSlice&, Binary&);
   static bool WriteTarget(const Binary&, openpal::WSlice&);
   static DNP3Serializer<Binary> Inst() { return DNP3Serializer<Binary>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool WriteTargets(const Binary* values, uint32_t count, openpal::WSlice&);
 };
 
 
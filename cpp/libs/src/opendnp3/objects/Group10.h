@@ -59,6 +59,7 @@ struct Group10Var2
   static bool ReadTarget(openpal::RSlice&, BinaryOutputStatus&);
   static bool WriteTarget(const BinaryOutputStatus&, openpal::WSlice&);
   static DNP3Serializer<BinaryOutputStatus> Inst() { return DNP3Serializer<BinaryOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool WriteTargets(const BinaryOutputStatus* values, uint32_t count, openpal::WSlice&);
 };
 
 
@@ -24,6 +24,7 @@
 #include <openpal/serialization/Parse.h>
 #include "opendnp3/app/MeasurementFactory.h"
 #include "opendnp3/app/WriteConversions.h"
+#include <openpal/serialization/Serialization.h>
 
 using namespace openpal;
 
@@ -63,5 +64,26 @@ bool Group121Var1::WriteTarget(const SecurityStat& value, openpal::WSlice& buff)
   return Group121Var1::Write(ConvertGroup121Var1::Apply(value), buff);
 }
 
+bool Group121Var1::WriteTargets(const SecurityStat* values, uint32_t count, openpal::WSlice& buff)
+{
+  if(buff.Size() < (count * Size()))
+  {
+    return false;
+  }
+
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    auto gv = ConvertGroup121Var1::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    UInt16::Write(dest + 1, gv.assocId);
+    UInt32::Write(dest + 3, gv.value);
+    dest += 7;
+  }
+
+  buff.Advance(count * Size());
+  return true;
+}
+
 
 }
@@ -56,6 +56,7 @@ struct Group121Var1
   static bool ReadTarget(openpal::RSlice&, SecurityStat&);
   static bool WriteTarget(const SecurityStat&, openpal::WSlice&);
   static DNP3Serializer<SecurityStat> Inst() { return DNP3Serializer<SecurityStat>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool WriteTargets(const SecurityStat* values, uint32_t count, openpal::WSlice&);
 };
 
 
@@ -24,6 +24,7 @@
 #include <openpal/serialization/Parse.h>
 #include "opendnp3/app/MeasurementFactory.h"
 #include "opendnp3/app/WriteConversions.h"
+#include <openpal/serialization/Serialization.h>
 
 using namespace openpal;
 
@@ -63,6 +64,26 @@ bool Group20Var1::WriteTarget(const Counter& value, openpal::WSlice& buff)
   return Group20Var1::Write(ConvertGroup20Var1::Apply(value), buff);
 }
 
+bool Group20Var1::WriteTargets(const Counter* values, uint32_t count, openpal::WSlice& buff)
+{
+  if(buff.Size() < (count * Size()))
+  {
+    return false;
+  }
+
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    auto gv = ConvertGroup20Var1::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    UInt32::Write(dest + 1, gv.value);
+    dest += 5;
+  }
+
+  buff.Advance(count * Size());
+  return true;
+}
+
 // ------- Group20Var2 -------
 
 Group20Var2::Group20Var2() : flags(0), value(0)
@@ -97,6 +118,26 @@ bool Group20Var2::WriteTarget(const Counter& value, openpal::WSlice& buff)
   return Group20Var2::Write(ConvertGroup20Var2::Apply(value), buff);
 }
 
+bool Group20Var2::WriteTargets(const Counter* values, uint32_t count, openpal::WSlice& buff)
+{
+  if(buff.Size() < (count * Size()))
+  {
+    return false;
+  }
+
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    auto gv = ConvertGroup20Var2::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    UInt16::Write(dest + 1, gv.value);
+    dest += 3;
+  }
+
+  buff.Advance(count * Size());
+  return true;
+}
+
 // ------- Group20Var5 -------
 
 Group20Var5::Group20Var5() : value(0)
@@ -131,6 +172,25 @@ bool Group20Var5::WriteTarget(const Counter& value, openpal::WSlice& buff)
   return Group20Var5::Write(ConvertGroup20Var5::Apply(value), buff);
 }
 
+bool Group20Var5::WriteTargets(const Counter* values, uint32_t count, openpal::WSlice& buff)
+{
+  if(buff.Size() < (count * Size()))
+  {
+    return false;
+  }
+
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    auto gv = ConvertGroup20Var5::Apply(values[i]);
+    UInt32::Write(dest, gv.value);
+    dest += 4;
+  }
+
+  buff.Advance(count * Size());
+  return true;
+}
+
 // ------- Group20Var6 -------
 
 Group20Var6::Group20Var6() : value(0)
@@ -165,5 +225,24 @@ bool Group20Var6::WriteTarget(const Counter& value, openpal::WSlice& buff)
   return Group20Var6::Write(ConvertGroup20Var6::Apply(value), buff);
 }
 
+bool Group20Var6::WriteTargets(const Counter* values, uint32_t count, openpal::WSlice& buff)
+{
+  if(buff.Size() < (count * Size()))
+  {
+    return false;
+  }
+
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    auto gv = ConvertGroup20Var6::Apply(values[i]);
+    UInt16::Write(dest, gv.value);
+    dest += 2;
+  }
+
+  buff.Advance(count * Size());
+  return true;
+}
+
 
 }
@@ -55,6 +55,7 @@ struct Group20Var1
   static bool ReadTarget(openpal::RSlice&, Counter&);
   static bool WriteTarget(const Counter&, openpal::WSlice&);
   static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool WriteTargets(const Counter* values, uint32_t count, openpal::WSlice&);
 };
 
 // Counter - 16-bit With Flag
@@ -76,6 +77,7 @@ struct Group20Var2
   static bool ReadTarget(openpal::RSlice&, Counter&);
   static bool WriteTarget(const Counter&, openpal::WSlice&);
   static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool WriteTargets(const Counter* values, uint32_t count, openpal::WSlice&);
 };
 
 // Counter - 32-bit Without Flag
@@ -96,6 +98,7 @@ struct Group20Var5
   static bool ReadTarget(openpal::RSlice&, Counter&);
   static bool WriteTarget(const Counter&, openpal::WSlice&);
   static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool WriteTargets(const Counter* values, uint32_t count, openpal::WSlice&);
 };
 
 // Counter - 16-bit Without Flag
@@ -116,6 +119,7 @@ struct Group20Var6
   static bool ReadTarget(openpal::RSlice&, Counter&);
   static bool WriteTarget(const Counter&, openpal::WSlice&);
   static DNP3Serializer<Counter> Inst() { return DNP3Serializer<Counter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool WriteTargets(const Counter* values, uint32_t count, openpal::WSlice&);
 };
 
 
@@ -24,6 +24,7 @@
 #include <openpal/serialization/Parse.h>
 #include "opendnp3/app/MeasurementFactory.h"
 #include "opendnp3/app/WriteConversions.h"
+#include <openpal/serialization/Serialization.h>
 
 using namespace openpal;
 
@@ -63,6 +64,26 @@ bool Group21Var1::WriteTarget(const FrozenCounter& value, openpal::WSlice& buff)
   return Group21Var1::Write(ConvertGroup21Var1::Apply(value), buff);
 }
 
+bool Group21Var1::WriteTargets(const FrozenCounter* values, uint32_t count, openpal::WSlice& buff)
+{
+  if(buff.Size() < (count * Size()))
+  {
+    return false;
+  }
+
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    auto gv = ConvertGroup21Var1::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    UInt32::Write(dest + 1, gv.value);
+    dest += 5;
+  }
+
+  buff.Advance(count * Size());
+  return true;
+}
+
 // ------- Group21Var2 -------
 
 Group21Var2::Group21Var2() : flags(0), value(0)
@@ -97,6 +118,26 @@ bool Group21Var2::WriteTarget(const FrozenCounter& value, openpal::WSlice& buff)
   return Group21Var2::Write(ConvertGroup21Var2::Apply(value), buff);
 }
 
+bool Group21Var2::WriteTargets(const FrozenCounter* values, uint32_t count, openpal::WSlice& buff)
+{
+  if(buff.Size() < (count * Size()))
+  {
+    return false;
+  }
+
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    auto gv = ConvertGroup21Var2::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    UInt16::Write(dest + 1, gv.value);
+    dest += 3;
+  }
+
+  buff.Advance(count * Size());
+  return true;
+}
+
 // ------- Group21Var5 -------
 
 Group21Var5::Group21Var5() : flags(0), value(0), time(0)
@@ -131,6 +172,27 @@ bool Group21Var5::WriteTarget(const FrozenCounter& value, openpal::WSlice& buff)
   return Group21Var5::Write(ConvertGroup21Var5::Apply(value), buff);
 }
 
+bool Group21Var5::WriteTargets(const FrozenCounter* values, uint32_t count, openpal::WSlice& buff)
+{
+  if(buff.Size() < (count * Size()))
+  {
+    return false;
+  }
+
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    auto gv = ConvertGroup21Var5::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    UInt32::Write(dest + 1, gv.value);
+    UInt48::Write(dest + 5, gv.time);
+    dest += 11;
+  }
+
+  buff.Advance(count * Size());
+  return true;
+}
+
 // ------- Group21Var6 -------
 
 Group21Var6::Group21Var6() : flags(0), value(0), time(0)
@@ -165,6 +227,27 @@ bool Group21Var6::WriteTarget(const FrozenCounter& value, openpal::WSlice& buff)
   return Group21Var6::Write(ConvertGroup21Var6::Apply(value), buff);
 }
 
+bool Group21Var6::WriteTargets(const FrozenCounter* values, uint32_t count, openpal::WSlice& buff)
+{
+  if(buff.Size() < (count * Size()))
+  {
+    return false;
+  }
+
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    auto gv = ConvertGroup21Var6::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    UInt16::Write(dest + 1, gv.value);
+    UInt48::Write(dest + 3, gv.time);
+    dest += 9;
+  }
+
+  buff.Advance(count * Size());
+  return true;
+}
+
 // ------- Group21Var9 -------
 
 Group21Var9::Group21Var9() : value(0)
@@ -199,6 +282,25 @@ bool Group21Var9::WriteTarget(const FrozenCounter& value, openpal::WSlice& buff)
   return Group21Var9::Write(ConvertGroup21Var9::Apply(value), buff);
 }
 
+bool Group21Var9::WriteTargets(const FrozenCounter* values, uint32_t count, openpal::WSlice& buff)
+{
+  if(buff.Size() < (count * Size()))
+  {
+    return false;
+  }
+
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    auto gv = ConvertGroup21Var9::Apply(values[i]);
+    UInt32::Write(dest, gv.value);
+    dest += 4;
+  }
+
+  buff.Advance(count * Size());
+  return true;
+}
+
 // ------- Group21Var10 -------
 
 Group21Var10::Group21Var10() : value(0)
@@ -233,5 +335,24 @@ bool Group21Var10::WriteTarget(const FrozenCounter& value, openpal::WSlice& buff
   return Group21Var10::Write(ConvertGroup21Var10::Apply(value), buff);
 }
 
+bool Group21Var10::WriteTargets(const FrozenCounter* values, uint32_t count, openpal::WSlice& buff)
+{
+  if(buff.Size() < (count * Size()))
+  {
+    return false;
+  }
+
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    auto gv = ConvertGroup21Var10::Apply(values[i]);
+    UInt16::Write(dest, gv.value);
+    dest += 2;
+  }
+
+  buff.Advance(count * Size());
+  return true;
+}
+
 
 }
@@ -55,6 +55,7 @@ struct Group21Var1
   static bool ReadTarget(openpal::RSlice&, FrozenCounter&);
   static bool WriteTarget(const FrozenCounter&, openpal::WSlice&);
   static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool WriteTargets(const FrozenCounter* values, uint32_t count, openpal::WSlice&);
 };
 
 // Frozen Counter - 16-bit With Flag
@@ -76,6 +77,7 @@ struct Group21Var2
   static bool ReadTarget(openpal::RSlice&, FrozenCounter&);
   static bool WriteTarget(const FrozenCounter&, openpal::WSlice&);
   static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool WriteTargets(const FrozenCounter* values, uint32_t count, openpal::WSlice&);
 };
 
 // Frozen Counter - 32-bit With Flag and Time
@@ -98,6 +100,7 @@ struct Group21Var5
   static bool ReadTarget(openpal::RSlice&, FrozenCounter&);
   static bool WriteTarget(const FrozenCounter&, openpal::WSlice&);
   static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool WriteTargets(const FrozenCounter* values, uint32_t count, openpal::WSlice&);
 };
 
 // Frozen Counter - 16-bit With Flag and Time
@@ -120,6 +123,7 @@ struct Group21Var6
   static bool ReadTarget(openpal::RSlice&, FrozenCounter&);
   static bool WriteTarget(const FrozenCounter&, openpal::WSlice&);
   static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool WriteTargets(const FrozenCounter* values, uint32_t count, openpal::WSlice&);
 };
 
 // Frozen Counter - 32-bit Without Flag
@@ -140,6 +144,7 @@ struct Group21Var9
   static bool ReadTarget(openpal::RSlice&, FrozenCounter&);
   static bool WriteTarget(const FrozenCounter&, openpal::WSlice&);
   static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool WriteTargets(const FrozenCounter* values, uint32_t count, openpal::WSlice&);
 };
 
 // Frozen Counter - 16-bit Without Flag
@@ -160,6 +165,7 @@ struct Group21Var10
   static bool ReadTarget(openpal::RSlice&, FrozenCounter&);
   static bool WriteTarget(const FrozenCounter&, openpal::WSlice&);
   static DNP3Serializer<FrozenCounter> Inst() { return DNP3Serializer<FrozenCounter>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool WriteTargets(const FrozenCounter* values, uint32_t count, openpal::WSlice&);
 };
 
 
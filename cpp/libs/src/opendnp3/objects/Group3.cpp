@@ -24,6 +24,7 @@
 #include <openpal/serialization/Parse.h>
 #include "opendnp3/app/MeasurementFactory.h"
 #include "opendnp3/app/WriteConversions.h"
+#include <openpal/serialization/Serialization.h>
 
 using namespace openpal;
 
@@ -63,5 +64,24 @@ bool Group3Var2::WriteTarget(const DoubleBitBinary& value, openpal::WSlice& buff
   return Group3Var2::Write(ConvertGroup3Var2::Apply(value), buff);
 }
 
+bool Group3Var2::WriteTargets(const DoubleBitBinary* values, uint32_t count, openpal::WSlice& buff)
+{
+  if(buff.Size() < (count * Size()))
+  {
+    return false;
+  }
+
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    auto gv = ConvertGroup3Var2::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    dest += 1;
+  }
+
+  buff.Advance(count * Size());
+  return true;
+}
+
 
 }
@@ -59,6 +59,7 @@ struct Group3Var2
   static bool ReadTarget(openpal::RSlice&, DoubleBitBinary&);
   static bool WriteTarget(const DoubleBitBinary&, openpal::WSlice&);
   static DNP3Serializer<DoubleBitBinary> Inst() { return DNP3Serializer<DoubleBitBinary>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool WriteTargets(const DoubleBitBinary* values, uint32_t count, openpal::WSlice&);
 };
 
 
@@ -24,6 +24,7 @@
 #include <openpal/serialization/Parse.h>
 #include "opendnp3/app/MeasurementFactory.h"
 #include "opendnp3/app/WriteConversions.h"
+#include <openpal/serialization/Serialization.h>
 
 using namespace openpal;
 
@@ -63,6 +64,26 @@ bool Group30Var1::WriteTarget(const Analog& value, openpal::WSlice& buff)
   return Group30Var1::Write(ConvertGroup30Var1::Apply(value), buff);
 }
 
+bool Group30Var1::WriteTargets(const Analog* values, uint32_t count, openpal::WSlice& buff)
+{
+  if(buff.Size() < (count * Size()))
+  {
+    return false;
+  }
+
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    auto gv = ConvertGroup30Var1::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    Int32::Write(dest + 1, gv.value);
+    dest += 5;
+  }
+
+  buff.Advance(count * Size());
+  return true;
+}
+
 // ------- Group30Var2 -------
 
 Group30Var2::Group30Var2() : flags(0), value(0)
@@ -97,6 +118,26 @@ bool Group30Var2::WriteTarget(const Analog& value, openpal::WSlice& buff)
   return Group30Var2::Write(ConvertGroup30Var2::Apply(value), buff);
 }
 
+bool Group30Var2::WriteTargets(const Analog* values, uint32_t count, openpal::WSlice& buff)
+{
+  if(buff.Size() < (count * Size()))
+  {
+    return false;
+  }
+
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    auto gv = ConvertGroup30Var2::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    Int16::Write(dest + 1, gv.value);
+    dest += 3;
+  }
+
+  buff.Advance(count * Size());
+  return true;
+}
+
 // ------- Group30Var3 -------
 
 Group30Var3::Group30Var3() : value(0)
@@ -131,6 +172,25 @@ bool Group30Var3::WriteTarget(const Analog& value, openpal::WSlice& buff)
   return Group30Var3::Write(ConvertGroup30Var3::Apply(value), buff);
 }
 
+bool Group30Var3::WriteTargets(const Analog* values, uint32_t count, openpal::WSlice& buff)
+{
+  if(buff.Size() < (count * Size()))
+  {
+    return false;
+  }
+
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    auto gv = ConvertGroup30Var3::Apply(values[i]);
+    Int32::Write(dest, gv.value);
+    dest += 4;
+  }
+
+  buff.Advance(count * Size());
+  return true;
+}
+
 // ------- Group30Var4 -------
 
 Group30Var4::Group30Var4() : value(0)
@@ -165,6 +225,25 @@ bool Group30Var4::WriteTarget(const Analog& value, openpal::WSlice& buff)
   return Group30Var4::Write(ConvertGroup30Var4::Apply(value), buff);
 }
 
+bool Group30Var4::WriteTargets(const Analog* values, uint32_t count, openpal::WSlice& buff)
+{
+  if(buff.Size() < (count * Size()))
+  {
+    return false;
+  }
+
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    auto gv = ConvertGroup30Var4::Apply(values[i]);
+    Int16::Write(dest, gv.value);
+    dest += 2;
+  }
+
+  buff.Advance(count * Size());
+  return true;
+}
+
 // ------- Group30Var5 -------
 
 Group30Var5::Group30Var5() : flags(0), value(0.0)
@@ -199,6 +278,26 @@ bool Group30Var5::WriteTarget(const Analog& value, openpal::WSlice& buff)
   return Group30Var5::Write(ConvertGroup30Var5::Apply(value), buff);
 }
 
+bool Group30Var5::WriteTargets(const Analog* values, uint32_t count, openpal::WSlice& buff)
+{
+  if(buff.Size() < (count * Size()))
+  {
+    return false;
+  }
+
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    auto gv = ConvertGroup30Var5::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    SingleFloat::Write(dest + 1, gv.value);
+    dest += 5;
+  }
+
+  buff.Advance(count * Size());
+  return true;
+}
+
 // ------- Group30Var6 -------
 
 Group30Var6::Group30Var6() : flags(0), value(0.0)
@@ -233,5 +332,25 @@ bool Group30Var6::WriteTarget(const Analog& value, openpal::WSlice& buff)
   return Group30Var6::Write(ConvertGroup30Var6::Apply(value), buff);
 }
 
+bool Group30Var6::WriteTargets(const Analog* values, uint32_t count, openpal::WSlice& buff)
+{
+  if(buff.Size() < (count * Size()))
+  {
+    return false;
+  }
+
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    auto gv = ConvertGroup30Var6::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    DoubleFloat::Write(dest + 1, gv.value);
+    dest += 9;
+  }
+
+  buff.Advance(count * Size());
+  return true;
+}
+
 
 }
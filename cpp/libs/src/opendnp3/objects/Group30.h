@@ -55,6 +55,7 @@ struct Group30Var1
   static bool ReadTarget(openpal::RSlice&, Analog&);
   static bool WriteTarget(const Analog&, openpal::WSlice&);
   static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool WriteTargets(const Analog* values, uint32_t count, openpal::WSlice&);
 };
 
 // Analog Input - 16-bit With Flag
@@ -76,6 +77,7 @@ struct Group30Var2
   static bool ReadTarget(openpal::RSlice&, Analog&);
   static bool WriteTarget(const Analog&, openpal::WSlice&);
   static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool WriteTargets(const Analog* values, uint32_t count, openpal::WSlice&);
 };
 
 // Analog Input - 32-bit Without Flag
@@ -96,6 +98,7 @@ struct Group30Var3
   static bool ReadTarget(openpal::RSlice&, Analog&);
   static bool WriteTarget(const Analog&, openpal::WSlice&);
   static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool WriteTargets(const Analog* values, uint32_t count, openpal::WSlice&);
 };
 
 // Analog Input - 16-bit Without Flag
@@ -116,6 +119,7 @@ struct Group30Var4
   static bool ReadTarget(openpal::RSlice&, Analog&);
   static bool WriteTarget(const Analog&, openpal::WSlice&);
   static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool WriteTargets(const Analog* values, uint32_t count, openpal::WSlice&);
 };
 
 // Analog Input - Single-precision With Flag
@@ -137,6 +141,7 @@ struct Group30Var5
   static bool ReadTarget(openpal::RSlice&, Analog&);
   static bool WriteTarget(const Analog&, openpal::WSlice&);
   static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool WriteTargets(const Analog* values, uint32_t count, openpal::WSlice&);
 };
 
 // Analog Input - Double-precision With Flag
@@ -158,6 +163,7 @@ struct Group30Var6
   static bool ReadTarget(openpal::RSlice&, Analog&);
   static bool WriteTarget(const Analog&, openpal::WSlice&);
   static DNP3Serializer<Analog> Inst() { return DNP3Serializer<Analog>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool WriteTargets(const Analog* values, uint32_t count, openpal::WSlice&);
 };
 
 
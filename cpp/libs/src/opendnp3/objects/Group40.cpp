@@ -24,6 +24,7 @@
 #include <openpal/serialization/Parse.h>
 #include "opendnp3/app/MeasurementFactory.h"
 #include "opendnp3/app/WriteConversions.h"
+#include <openpal/serialization/Serialization.h>
 
 using namespace openpal;
 
@@ -63,6 +64,26 @@ bool Group40Var1::WriteTarget(const AnalogOutputStatus& value, openpal::WSlice&
   return Group40Var1::Write(ConvertGroup40Var1::Apply(value), buff);
 }
 
+bool Group40Var1::WriteTargets(const AnalogOutputStatus* values, uint32_t count, openpal::WSlice& buff)
+{
+  if(buff.Size() < (count * Size()))
+  {
+    return false;
+  }
+
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    auto gv = ConvertGroup40Var1::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    Int32::Write(dest + 1, gv.value);
+    dest += 5;
+  }
+
+  buff.Advance(count * Size());
+  return true;
+}
+
 // ------- Group40Var2 -------
 
 Group40Var2::Group40Var2() : flags(0), value(0)
@@ -97,6 +118,26 @@ bool Group40Var2::WriteTarget(const AnalogOutputStatus& value, openpal::WSlice&
   return Group40Var2::Write(ConvertGroup40Var2::Apply(value), buff);
 }
 
+bool Group40Var2::WriteTargets(const AnalogOutputStatus* values, uint32_t count, openpal::WSlice& buff)
+{
+  if(buff.Size() < (count * Size()))
+  {
+    return false;
+  }
+
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    auto gv = ConvertGroup40Var2::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    Int16::Write(dest + 1, gv.value);
+    dest += 3;
+  }
+
+  buff.Advance(count * Size());
+  return true;
+}
+
 // ------- Group40Var3 -------
 
 Group40Var3::Group40Var3() : flags(0), value(0.0)
@@ -131,6 +172,26 @@ bool Group40Var3::WriteTarget(const AnalogOutputStatus& value, openpal::WSlice&
   return Group40Var3::Write(ConvertGroup40Var3::Apply(value), buff);
 }
 
+bool Group40Var3::WriteTargets(const AnalogOutputStatus* values, uint32_t count, openpal::WSlice& buff)
+{
+  if(buff.Size() < (count * Size()))
+  {
+    return false;
+  }
+
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    auto gv = ConvertGroup40Var3::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    SingleFloat::Write(dest + 1, gv.value);
+    dest += 5;
+  }
+
+  buff.Advance(count * Size());
+  return true;
+}
+
 // ------- Group40Var4 -------
 
 Group40Var4::Group40Var4() : flags(0), value(0.0)
@@ -165,5 +226,25 @@ bool Group40Var4::WriteTarget(const AnalogOutputStatus& value, openpal::WSlice&
   return Group40Var4::Write(ConvertGroup40Var4::Apply(value), buff);
 }
 
+bool Group40Var4::WriteTargets(const AnalogOutputStatus* values, uint32_t count, openpal::WSlice& buff)
+{
+  if(buff.Size() < (count * Size()))
+  {
+    return false;
+  }
+
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    auto gv = ConvertGroup40Var4::Apply(values[i]);
+    UInt8::Write(dest, gv.flags);
+    DoubleFloat::Write(dest + 1, gv.value);
+    dest += 9;
+  }
+
+  buff.Advance(count * Size());
+  return true;
+}
+
 
 }
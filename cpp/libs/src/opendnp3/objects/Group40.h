@@ -55,6 +55,7 @@ struct Group40Var1
   static bool ReadTarget(openpal::RSlice&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, openpal::WSlice&);
   static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool WriteTargets(const AnalogOutputStatus* values, uint32_t count, openpal::WSlice&);
 };
 
 // Analog Output Status - 16-bit With Flag
@@ -76,6 +77,7 @@ struct Group40Var2
   static bool ReadTarget(openpal::RSlice&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, openpal::WSlice&);
   static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool WriteTargets(const AnalogOutputStatus* values, uint32_t count, openpal::WSlice&);
 };
 
 // Analog Output Status - Single-precision With Flag
@@ -97,6 +99,7 @@ struct Group40Var3
   static bool ReadTarget(openpal::RSlice&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, openpal::WSlice&);
   static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool WriteTargets(const AnalogOutputStatus* values, uint32_t count, openpal::WSlice&);
 };
 
 // Analog Output Status - Double-precision With Flag
@@ -118,6 +121,7 @@ struct Group40Var4
   static bool ReadTarget(openpal::RSlice&, AnalogOutputStatus&);
   static bool WriteTarget(const AnalogOutputStatus&, openpal::WSlice&);
   static DNP3Serializer<AnalogOutputStatus> Inst() { return DNP3Serializer<AnalogOutputStatus>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool WriteTargets(const AnalogOutputStatus* values, uint32_t count, openpal::WSlice&);
 };
 
 
@@ -24,6 +24,7 @@
 #include <openpal/serialization/Parse.h>
 #include "opendnp3/app/MeasurementFactory.h"
 #include "opendnp3/app/WriteConversions.h"
+#include <openpal/serialization/Serialization.h>
 
 using namespace openpal;
 
@@ -78,5 +79,26 @@ bool Group50Var4::WriteTarget(const TimeAndInterval& value, openpal::WSlice& buf
   return Group50Var4::Write(ConvertGroup50Var4::Apply(value), buff);
 }
 
+bool Group50Var4::WriteTargets(const TimeAndInterval* values, uint32_t count, openpal::WSlice& buff)
+{
+  if(buff.Size() < (count * Size()))
+  {
+    return false;
+  }
+
+  uint8_t* dest = buff;
+  for(uint32_t i = 0; i < count; ++i)
+  {
+    auto gv = ConvertGroup50Var4::Apply(values[i]);
+    UInt48::Write(dest, gv.time);
+    UInt32::Write(dest + 6, gv.interval);
+    UInt8::Write(dest + 10, gv.units);
+    dest += 11;
+  }
+
+  buff.Advance(count * Size());
+  return true;
+}
+
 
 }
@@ -63,6 +63,7 @@ struct Group50Var4
   static bool ReadTarget(openpal::RSlice&, TimeAndInterval&);
   static bool WriteTarget(const TimeAndInterval&, openpal::WSlice&);
   static DNP3Serializer<TimeAndInterval> Inst() { return DNP3Serializer<TimeAndInterval>(ID(), Size(), &ReadTarget, &WriteTarget); }
+  static bool WriteTargets(const TimeAndInterval* values, uint32_t count, openpal::WSlice&);
 };
 
 
@@ -81,7 +81,7 @@ bool Database::Update(const TimeAndInterval& value, uint16_t index)
 
 	if (view.Contains(rawIndex))
 	{
-		view[rawIndex].value = value;
+		buffers.GetSelection<TimeAndInterval>().Update(rawIndex, view[rawIndex], value);
 		return true;
 	}
 	else
@@ -138,7 +138,7 @@ bool Database::Modify(const openpal::Function1<const TimeAndInterval&, TimeAndIn
 
 	if (view.Contains(rawIndex))
 	{
-		view[rawIndex].value = modify.Apply(view[rawIndex].value);
+		buffers.GetSelection<TimeAndInterval>().Update(rawIndex, view[rawIndex], modify.Apply(view[rawIndex].value));
 		return true;
 	}
 	else
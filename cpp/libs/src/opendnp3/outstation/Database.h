@@ -100,7 +100,7 @@ private:
 	bool ModifyEvent(const openpal::Function1<const T&, T>& modify, uint16_t index, EventMode mode);
 
 	template <class T>
-	bool UpdateAny(Cell<T>& cell, const T& value, EventMode mode);
+	bool UpdateAny(uint16_t rawIndex, const T& value, EventMode mode);
 };
 
 template <class T>
@@ -112,8 +112,7 @@ uint16_t Database::GetRawIndex(uint16_t index)
 	}
 	else
 	{
-		auto view = buffers.buffers.GetArrayView<T>();
-		auto result = IndexSearch::FindClosestRawIndex(view, index);
+		auto result = IndexSearch::FindClosestRawIndex(buffers.buffers.GetConfigArrayView<T>(), index);
 		return result.match ? result.index : openpal::MaxValue<uint16_t>();
 	}
 }
@@ -126,7 +125,7 @@ bool Database::UpdateEvent(const T& value, uint16_t index, EventMode mode)
 
 	if (view.Contains(rawIndex))
 	{
-		this->UpdateAny(view[rawIndex], value, mode);
+		this->UpdateAny(rawIndex, value, mode);
 		return true;
 	}
 	else
@@ -143,7 +142,7 @@ bool Database::ModifyEvent(const openpal::Function1<const T&, T>& modify, uint16
 
 	if (view.Contains(rawIndex))
 	{
-		this->UpdateAny(view[rawIndex], modify.Apply(view[rawIndex].value), mode);
+		this->UpdateAny(rawIndex, modify.Apply(view[rawIndex].value), mode);
 		return true;
 	}
 	else
@@ -153,8 +152,10 @@ bool Database::ModifyEvent(const openpal::Function1<const T&, T>& modify, uint16
 }
 
 template <class T>
-bool Database::UpdateAny(Cell<T>& cell, const T& value, EventMode mode)
+bool Database::UpdateAny(uint16_t rawIndex, const T& value, EventMode mode)
 {
+	auto& cell = buffers.buffers.GetArrayView<T>()[rawIndex];
+
 	EventClass ec;
 	if (ConvertToEventClass(cell.metadata.clazz, ec))
 	{
@@ -178,12 +179,12 @@ bool Database::UpdateAny(Cell<T>& cell, const T& value, EventMode mode)
 
 			if (pEventReceiver)
 			{
-				pEventReceiver->Update(Event<T>(value, cell.vIndex, ec, cell.metadata.variation));
+				pEventReceiver->Update(Event<T>(value, buffers.buffers.GetConfigArrayView<T>()[rawIndex].vIndex, ec, cell.metadata.variation));
 			}
 		}
 	}
 
-	cell.value = value;
+	buffers.GetSelection<T>().Update(rawIndex, cell, value);
 	return true;
 }
 
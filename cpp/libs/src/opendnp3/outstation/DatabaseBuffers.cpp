@@ -34,22 +34,38 @@ namespace opendnp3
 DatabaseBuffers::DatabaseBuffers(const DatabaseTemplate& dbTemplate, StaticTypeBitField allowedClass0Types, IndexMode indexMode_) :
 	buffers(dbTemplate),
 	class0(allowedClass0Types),
-	indexMode(indexMode_)
+	indexMode(indexMode_),
+	version(1)
 {
 
 }
 
 void DatabaseBuffers::Unselect()
 {
-	this->Deselect<Binary>();
-	this->Deselect<DoubleBitBinary>();
-	this->Deselect<Counter>();
-	this->Deselect<FrozenCounter>();
-	this->Deselect<Analog>();
-	this->Deselect<BinaryOutputStatus>();
-	this->Deselect<AnalogOutputStatus>();
-	this->Deselect<TimeAndInterval>();
-	this->Deselect<SecurityStat>();
+	ranges.Clear<Binary>();
+	ranges.Clear<DoubleBitBinary>();
+	ranges.Clear<Counter>();
+	ranges.Clear<FrozenCounter>();
+	ranges.Clear<Analog>();
+	ranges.Clear<BinaryOutputStatus>();
+	ranges.Clear<AnalogOutputStatus>();
+	ranges.Clear<TimeAndInterval>();
+	ranges.Clear<SecurityStat>();
+
+	// advancing the version deselects every cell without visiting them
+	if (++version == 0)
+	{
+		this->DeselectAll<Binary>();
+		this->DeselectAll<DoubleBitBinary>();
+		this->DeselectAll<Counter>();
+		this->DeselectAll<FrozenCounter>();
+		this->DeselectAll<Analog>();
+		this->DeselectAll<BinaryOutputStatus>();
+		this->DeselectAll<AnalogOutputStatus>();
+		this->DeselectAll<TimeAndInterval>();
+		this->DeselectAll<SecurityStat>();
+		version = 1;
+	}
 }
 
 IINField DatabaseBuffers::SelectAll(GroupVariation gv)
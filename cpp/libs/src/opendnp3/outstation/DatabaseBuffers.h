@@ -70,6 +70,13 @@ public:
 	//used to unselect selected points
 	void Unselect();
 
+	// the selection state of a type, bound to the current selection version
+	template <class T>
+	StaticSelection<T> GetSelection()
+	{
+		return buffers.GetSelection<T>(version);
+	}
+
 	// stores the most revent values and event information
 	StaticBuffers buffers;
 
@@ -80,22 +87,17 @@ private:
 
 	SelectedRanges ranges;
 
+	// never 0, which is reserved for cells that have been deselected individually
+	uint32_t version;
+
 	template <class T>
 	bool LoadType(HeaderWriter& writer);
 
+	// only required when the selection version wraps around
 	template <class T>
-	void Deselect()
+	void DeselectAll()
 	{
-		auto range = ranges.Get<T>();
-		if (range.IsValid())
-		{
-			auto view = buffers.GetArrayView<T>();
-			for (uint16_t i = range.start; i <= range.stop; ++i)
-			{
-				view[i].selection.selected = false;
-			}
-			ranges.Clear<T>();
-		}
+		this->GetSelection<T>().DeselectAll();
 	}
 
 	//specialization for binary in cpp file
@@ -146,8 +148,7 @@ private:
 	{
 		if (indexMode == IndexMode::Discontiguous)
 		{
-			auto view = buffers.GetArrayView<T>();
-			auto mapped = IndexSearch::FindRawRange(view, range);
+			auto mapped = IndexSearch::FindRawRange(buffers.GetConfigArrayView<T>(), range);
 			if (mapped.IsValid())
 			{
 				// detect if any values were requested that aren't actually there
@@ -194,18 +195,20 @@ IINField DatabaseBuffers::GenericSelect(
 			// return code depends on if the range was truncated to match the database
 			IINField ret = allowed.Equals(range) ? IINField() : IINBit::PARAM_ERROR;
 
+			auto selection = this->GetSelection<T>();
+			auto config = buffers.GetConfigArrayView<T>();
+
 			for (uint16_t i = allowed.start; i <= allowed.stop; ++i)
 			{
-				if (view[i].selection.selected)
+				if (selection.IsSelected(i))
 				{
 					ret |= IINBit::PARAM_ERROR;
 				}
 				else
 				{
-					view[i].selection.selected = true;
-					view[i].selection.value = view[i].value;
-					auto var = useDefault ? view[i].variation : variation;
-					view[i].selection.variation = CheckForPromotion<T>(view[i].selection.value, var);
+					// the value is only copied if it changes before it is written
+					auto var = useDefault ? config[i].variation : variation;
+					selection.Select(i, CheckForPromotion<T>(view[i].value, var));
 				}
 			}
 
@@ -231,19 +234,21 @@ bool DatabaseBuffers::LoadType(HeaderWriter& writer)
 	if (range.IsValid())
 	{
 		auto view = buffers.GetArrayView<T>();
+		auto config = buffers.GetConfigArrayView<T>();
+		auto selection = this->GetSelection<T>();
 
 		bool spaceRemaining = true;
 
 		// ... load values, manipulate the range
 		while (spaceRemaining && range.IsValid())
 		{
-			if (view[range.start].selection.selected)
+			if (selection.IsSelected(range.start))
 			{
 				/// lookup the specific write function based on the reporting variation
-				auto writeFun = GetStaticWriter(view[range.start].selection.variation);
+				auto writeFun = GetStaticWriter(selection.GetVariation(range.start));
 
 				// start writing a header, the invoked function will advance the range appropriately
-				spaceRemaining = writeFun(view, writer, range);
+				spaceRemaining = writeFun(view, config, selection, writer, range);
 			}
 			else
 			{
@@ -28,31 +28,30 @@ namespace opendnp3
 EventBuffer::EventBuffer(const EventBufferConfig& config_) :
 	overflow(false),
 	config(config_),
-	events(config_.TotalEvents())
+	events(config_.TotalEvents()),
+	nextSequence(0)
 {
 
 }
 
 void EventBuffer::Unselect()
 {
-	auto unselect = [this](SOERecord & record)
+	auto iter = selection.Iterate();
+	while (iter.HasNext())
 	{
-		if (record.selected)
-		{
-			selectedCounts.Decrement(record.clazz, record.type);
-			record.selected = false;
-		}
+		auto& record = iter.Next()->value;
+
+		selectedCounts.Decrement(record.clazz, record.type);
+		record.selected = false;
 
 		if (record.written)
 		{
 			writtenCounts.Decrement(record.clazz, record.type);
 			record.written = false;
 		}
+	}
 
-		return this->selectedCounts.TotatCount() > 0;
-	};
-
-	events.While(unselect);
+	selection.Clear();
 }
 
 IINField EventBuffer::SelectAll(GroupVariation gv)
@@ -182,7 +181,7 @@ bool EventBuffer::HasAnySelection() const
 
 bool EventBuffer::Load(HeaderWriter& writer)
 {
-	return EventWriter::Write(writer, *this, events.Iterate());
+	return EventWriter::Write(writer, *this, selection.Iterate());
 }
 
 bool EventBuffer::HasMoreUnwrittenEvents() const
@@ -217,20 +216,56 @@ bool EventBuffer::IsOverflown()
 IINField EventBuffer::SelectByClass(const ClassField& field, uint32_t max)
 {
 	uint32_t num = 0;
-	auto iter = events.Iterate();
 	const uint32_t remaining = totalCounts.NumOfClass(field) - selectedCounts.NumOfClass(field);
 
-	while (iter.HasNext() && (num < remaining) && (num < max))
+	// walk the requested class queues together, always taking the oldest head so that a limited count is honored in SOE order
+	const EventClass classes[3] = { EventClass::EC1, EventClass::EC2, EventClass::EC3 };
+	SOEQueue<SOELink::Class>::Iterator iters[3] =
 	{
-		auto pNode = iter.Next();
-		if (field.HasEventType(pNode->value.clazz))
+		SOEQueue<SOELink::Class>::Iterator::Undefined(),
+		SOEQueue<SOELink::Class>::Iterator::Undefined(),
+		SOEQueue<SOELink::Class>::Iterator::Undefined()
+	};
+
+	for (int i = 0; i < 3; ++i)
+	{
+		if (field.HasEventType(classes[i]))
+		{
+			iters[i] = ClassQueue(classes[i]).Iterate();
+		}
+	}
+
+	SOEQueue<SOELink::Selection> selected;
+
+	while ((num < remaining) && (num < max))
+	{
+		SOEQueue<SOELink::Class>::Iterator* pOldest = nullptr;
+
+		for (auto& iter : iters)
+		{
+			if (iter.HasNext() && (!pOldest || SOEQueue<SOELink::Class>::Precedes(iter.Current()->value.sequence, pOldest->Current()->value.sequence)))
+			{
+				pOldest = &iter;
+			}
+		}
+
+		if (!pOldest)
+		{
+			break;
+		}
+
+		auto pNode = pOldest->Next();
+		if (!pNode->value.selected)
 		{
 			pNode->value.SelectDefault();
+			selected.Append(pNode);
 			selectedCounts.Increment(pNode->value.clazz, pNode->value.type);
 			++num;
 		}
 	}
 
+	selection.Merge(selected);
+
 	return IINField();
 }
 
@@ -251,17 +286,12 @@ void EventBuffer::RemoveFromCounts(const SOERecord& record)
 
 bool EventBuffer::RemoveOldestEventOfType(EventType type)
 {
-	// find the first event of this type in the SOE, and discard it
-	auto isMatch = [type](const SOERecord & rec)
-	{
-		return rec.type == type;
-	};
-	auto pNode = events.RemoveFirst(isMatch);
+	// the head of the type queue is the first event of this type in the SOE
+	auto pNode = TypeQueue(type).Head();
 
 	if (pNode)
 	{
-		this->RemoveFromCounts(pNode->value);
-		pNode->value.Reset();
+		this->RemoveNode(pNode);
 		return true;
 	}
 	else
@@ -270,6 +300,23 @@ bool EventBuffer::RemoveOldestEventOfType(EventType type)
 	}
 }
 
+void EventBuffer::RemoveNode(openpal::ListNode<SOERecord>* pNode)
+{
+	auto& record = pNode->value;
+
+	this->RemoveFromCounts(record);
+
+	TypeQueue(record.type).Remove(pNode);
+	ClassQueue(record.clazz).Remove(pNode);
+	if (record.selected)
+	{
+		selection.Remove(pNode);
+	}
+
+	events.Remove(pNode);
+	record.Reset();
+}
+
 void EventBuffer::SelectAllByClass(const ClassField& field)
 {
 	this->SelectByClass(field, openpal::MaxValue<uint32_t>());
@@ -277,20 +324,16 @@ void EventBuffer::SelectAllByClass(const ClassField& field)
 
 void EventBuffer::ClearWritten()
 {
-	auto written = [this](const SOERecord & record)
+	// written records are always a subset of the selection
+	auto iter = selection.Iterate();
+	while (iter.HasNext())
 	{
-		if (record.written)
-		{
-			this->RemoveFromCounts(record);
-			return true;
-		}
-		else
+		auto pNode = iter.Next();
+		if (pNode->value.written)
 		{
-			return false;
+			this->RemoveNode(pNode);
 		}
-	};
-
-	events.RemoveAll(written);
+	}
 }
 
 bool EventBuffer::IsTypeOverflown(EventType type) const
@@ -28,6 +28,7 @@
 #include "opendnp3/outstation/EventCount.h"
 #include "opendnp3/outstation/EventBufferConfig.h"
 #include "opendnp3/outstation/SOERecord.h"
+#include "opendnp3/outstation/SOEQueue.h"
 
 #include <openpal/container/LinkedList.h>
 
@@ -40,9 +41,13 @@ namespace opendnp3
 	arbitrary parts of the list depending on what the user asks for in terms
 	of event type or Class1/2/3.
 
-	At worst, selection is O(n) in the SOE length but it has some type/class
-	tracking to avoid looping over the SOE list when there are no more events matching
-	the selection criteria.
+	Every record is also threaded through an intrusive queue for its type and
+	another for its class. Selection by type or class walks only the matching queue,
+	and overflow eviction takes the head of the type queue in O(1).
+
+	Selected records are kept in a selection queue in SOE order, so loading a response,
+	clearing written events, and unselecting are proportional to the number of selected
+	events rather than the size of the buffer.
 */
 
 class EventBuffer : public IEventReceiver, public IEventSelector, public IResponseLoader, private IEventRecorder
@@ -117,6 +122,11 @@ public:
 
 	bool IsOverflown();
 
+	uint32_t NumEvents() const
+	{
+		return totalCounts.TotatCount();
+	}
+
 private:
 
 	inline bool HasUnwrittenEvents(EventClass ec) const
@@ -149,6 +159,18 @@ private:
 
 	bool RemoveOldestEventOfType(EventType type);
 
+	void RemoveNode(openpal::ListNode<SOERecord>* pNode);
+
+	inline SOEQueue<SOELink::Type>& TypeQueue(EventType type)
+	{
+		return typeQueues[static_cast<uint16_t>(type)];
+	}
+
+	inline SOEQueue<SOELink::Class>& ClassQueue(EventClass clazz)
+	{
+		return classQueues[static_cast<uint8_t>(clazz)];
+	}
+
 	template <class T>
 	void UpdateAny(const Event<T>& evt);
 
@@ -161,6 +183,13 @@ private:
 
 	openpal::LinkedList<SOERecord, uint32_t> events;
 
+	// ---- secondary queues over the SOE list
+
+	uint32_t nextSequence;
+	SOEQueue<SOELink::Type> typeQueues[NUM_OUTSTATION_EVENT_TYPES];
+	SOEQueue<SOELink::Class> classQueues[3];
+	SOEQueue<SOELink::Selection> selection;
+
 	// ---- trakcers
 
 	EventCount totalCounts;
@@ -186,8 +215,15 @@ void EventBuffer::UpdateAny(const Event<T>& evt)
 		}
 
 		// Add the event, the Reset() ensures that selected/written == false
-		events.Add(SOERecord(evt.value, evt.index, evt.clazz, evt.variation))->value.Reset();
-		totalCounts.Increment(evt.clazz, T::EventTypeEnum);
+		auto pNode = events.Add(SOERecord(evt.value, evt.index, evt.clazz, evt.variation));
+		if (pNode)
+		{
+			pNode->value.Reset();
+			pNode->value.sequence = nextSequence++;
+			TypeQueue(T::EventTypeEnum).Append(pNode);
+			ClassQueue(evt.clazz).Append(pNode);
+			totalCounts.Increment(evt.clazz, T::EventTypeEnum);
+		}
 	}
 }
 
@@ -195,14 +231,17 @@ template <class T>
 uint32_t EventBuffer::GenericSelectByType(uint32_t max, bool useDefault, typename T::EventVariation var)
 {
 	uint32_t num = 0;
-	auto iter = events.Iterate();
+	auto iter = TypeQueue(T::EventTypeEnum).Iterate();
 	const uint32_t remaining = totalCounts.NumOfType(T::EventTypeEnum) - selectedCounts.NumOfType(T::EventTypeEnum);
 
+	// newly selected records in SOE order, merged into the selection afterwards
+	SOEQueue<SOELink::Selection> selected;
+
 	while (iter.HasNext() && (num < remaining) && (num < max))
 	{
 		auto pNode = iter.Next();
 
-		if (pNode->value.type == T::EventTypeEnum)
+		if (!pNode->value.selected)
 		{
 			if (useDefault)
 			{
@@ -213,11 +252,14 @@ uint32_t EventBuffer::GenericSelectByType(uint32_t max, bool useDefault, typenam
 				pNode->value.Select(var);
 			}
 
+			selected.Append(pNode);
 			selectedCounts.Increment(pNode->value.clazz, pNode->value.type);
 			++num;
 		}
 	}
 
+	selection.Merge(selected);
+
 	return num;
 }
 
@@ -34,7 +34,7 @@ using namespace openpal;
 
 namespace opendnp3
 {
-bool EventWriter::Write(HeaderWriter& writer, IEventRecorder& recorder, openpal::LinkedListIterator<SOERecord> iterator)
+bool EventWriter::Write(HeaderWriter& writer, IEventRecorder& recorder, SelectionIterator iterator)
 {
 	while (iterator.HasNext() && recorder.HasMoreUnwrittenEvents())
 	{
@@ -76,7 +76,7 @@ EventWriter::Result EventWriter::LoadHeader(HeaderWriter& writer, IEventRecorder
 	case(EventType::SecurityStat) :
 		return LoadHeaderSecurityStat(writer, recorder, pLocation);
 	default:
-		return Result(false, LinkedListIterator<SOERecord>::Undefined());
+		return Result(false, SelectionIterator::Undefined());
 	}
 }
 
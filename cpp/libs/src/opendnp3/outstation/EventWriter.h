@@ -22,10 +22,10 @@
 #define OPENDNP3_EVENTWRITER_H
 
 #include <openpal/util/Uncopyable.h>
-#include <openpal/container/LinkedList.h>
 
 #include "opendnp3/app/HeaderWriter.h"
 #include "opendnp3/outstation/SOERecord.h"
+#include "opendnp3/outstation/SOEQueue.h"
 #include "opendnp3/outstation/IEventRecorder.h"
 
 
@@ -36,7 +36,9 @@ class EventWriter : openpal::StaticOnly
 {
 public:
 
-	static bool Write(HeaderWriter& writer, IEventRecorder& recorder, openpal::LinkedListIterator<SOERecord> iterator);
+	typedef SOEQueueIterator<SOELink::Selection> SelectionIterator;
+
+	static bool Write(HeaderWriter& writer, IEventRecorder& recorder, SelectionIterator iterator);
 
 private:
 
@@ -44,11 +46,11 @@ private:
 	{
 	public:
 
-		Result(bool isFragmentFull_, openpal::LinkedListIterator<SOERecord> location_) : isFragmentFull(isFragmentFull_), location(location_)
+		Result(bool isFragmentFull_, SelectionIterator location_) : isFragmentFull(isFragmentFull_), location(location_)
 		{}
 
 		bool isFragmentFull;
-		openpal::LinkedListIterator<SOERecord> location;
+		SelectionIterator location;
 
 
 	private:
@@ -75,7 +77,7 @@ private:
 	template <class T>
 	static Result WriteTypeWithSerializer(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation, opendnp3::DNP3Serializer<T> serializer, typename T::EventVariation variation)
 	{
-		auto iter = openpal::LinkedListIterator<SOERecord>::From(pLocation);
+		auto iter = SelectionIterator::From(pLocation);
 
 		auto header = writer.IterateOverCountWithPrefix<openpal::UInt16, T>(QualifierCode::UINT16_CNT_UINT16_INDEX, serializer);
 
@@ -97,7 +99,7 @@ private:
 					}
 					else
 					{
-						auto location = openpal::LinkedListIterator<SOERecord>::From(pCurrent);
+						auto location = SelectionIterator::From(pCurrent);
 						return Result(true, location);
 					}
 				}
@@ -110,14 +112,14 @@ private:
 			}
 		}
 
-		auto location = openpal::LinkedListIterator<SOERecord>::From(pCurrent);
+		auto location = SelectionIterator::From(pCurrent);
 		return Result(false, location);
 	}
 
 	template <class T, class CTOType>
 	static Result WriteCTOTypeWithSerializer(HeaderWriter& writer, IEventRecorder& recorder, openpal::ListNode<SOERecord>* pLocation, opendnp3::DNP3Serializer<T> serializer, typename T::EventVariation variation)
 	{
-		auto iter = openpal::LinkedListIterator<SOERecord>::From(pLocation);
+		auto iter = SelectionIterator::From(pLocation);
 
 		CTOType cto;
 		cto.time = pLocation->value.GetTime();
@@ -158,7 +160,7 @@ private:
 							}
 							else
 							{
-								auto location = openpal::LinkedListIterator<SOERecord>::From(pCurrent);
+								auto location = SelectionIterator::From(pCurrent);
 								return Result(true, location);
 							}
 						}
@@ -172,7 +174,7 @@ private:
 			}
 		}
 
-		auto location = openpal::LinkedListIterator<SOERecord>::From(pCurrent);
+		auto location = SelectionIterator::From(pCurrent);
 		return Result(false, location);
 	}
 
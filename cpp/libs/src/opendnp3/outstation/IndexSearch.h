@@ -56,11 +56,12 @@ public:
 		Result() = delete;
 	};
 
-	template <class T>
-	static Range FindRawRange(const openpal::ArrayView<Cell<T>, uint16_t>& view, const Range& range);
+	// works over any array of points that carry a virtual index (cells or their static configuration)
+	template <class Point>
+	static Range FindRawRange(const openpal::ArrayView<Point, uint16_t>& view, const Range& range);
 
-	template <class T>
-	static Result FindClosestRawIndex(const openpal::ArrayView<Cell<T>, uint16_t>& view, uint16_t vIndex);
+	template <class Point>
+	static Result FindClosestRawIndex(const openpal::ArrayView<Point, uint16_t>& view, uint16_t vIndex);
 
 private:
 
@@ -70,8 +71,8 @@ private:
 	}
 };
 
-template <class T>
-Range IndexSearch::FindRawRange(const openpal::ArrayView<Cell<T>, uint16_t>& view, const Range& range)
+template <class Point>
+Range IndexSearch::FindRawRange(const openpal::ArrayView<Point, uint16_t>& view, const Range& range)
 {
 	if (range.IsValid() && view.IsNotEmpty())
 	{
@@ -110,8 +111,8 @@ Range IndexSearch::FindRawRange(const openpal::ArrayView<Cell<T>, uint16_t>& vie
 	}
 }
 
-template <class T>
-IndexSearch::Result IndexSearch::FindClosestRawIndex(const openpal::ArrayView<Cell<T>, uint16_t>& view, uint16_t vIndex)
+template <class Point>
+IndexSearch::Result IndexSearch::FindClosestRawIndex(const openpal::ArrayView<Point, uint16_t>& view, uint16_t vIndex)
 {
 	if (view.IsEmpty())
 	{
@@ -61,6 +61,7 @@ OContext::OContext(
 	pLower(&lower),
 	pCommandHandler(&commandHandler),
 	pApplication(&application),
+	pMetrics(nullptr),
 	eventBuffer(config.eventBufferConfig),
 	database(dbTemplate, eventBuffer, config.params.indexMode, config.params.typesAllowedInClass0),
 	rspContext(database.buffers, eventBuffer),
@@ -380,6 +381,11 @@ OutstationSolicitedStateBase* OContext::RespondToNonReadRequest(const APDUHeader
 
 OutstationSolicitedStateBase* OContext::RespondToReadRequest(const APDUHeader& header, const openpal::RSlice& objects)
 {
+	if (pMetrics)
+	{
+		pMetrics->OnReadBegin();
+	}
+
 	this->history.RecordLastProcessedRequest(header, objects);
 
 	auto response = this->sol.tx.Start();
@@ -390,6 +396,12 @@ OutstationSolicitedStateBase* OContext::RespondToReadRequest(const APDUHeader& h
 	this->sol.seq.confirmNum = header.control.SEQ;
 	response.SetControl(result.second);
 	response.SetIIN(result.first | this->GetResponseIIN());
+
+	if (pMetrics)
+	{
+		pMetrics->OnReadEnd();
+	}
+
 	this->BeginResponseTx(response.ToRSlice());
 
 	if (result.second.CON)
@@ -483,6 +495,12 @@ void OContext::ParseHeader(const openpal::RSlice& apdu)
 
 void OContext::CheckForTaskStart()
 {
+	// updates only add events before this point and confirms only remove them afterwards
+	if (pMetrics)
+	{
+		pMetrics->OnEventCount(this->eventBuffer.NumEvents());
+	}
+
 	// do these checks in order of priority
 	this->CheckForDeferredRequest();
 	this->CheckForUnsolicited();
@@ -503,6 +521,11 @@ DatabaseConfigView OContext::GetConfigView()
 	return this->database.GetConfigView();
 }
 
+void OContext::SetMetricsListener(IStackMetricsListener* pMetrics_)
+{
+	this->pMetrics = pMetrics_;
+}
+
 //// ----------------------------- function handlers -----------------------------
 
 void OContext::ProcessRequestNoAck(const APDUHeader& header, const openpal::RSlice& objects)
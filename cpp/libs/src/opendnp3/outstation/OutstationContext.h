@@ -22,6 +22,7 @@
 #define OPENDNP3_OUTSTATIONCONTEXT_H
 
 #include "opendnp3/LayerInterfaces.h"
+#include "opendnp3/IStackMetricsListener.h"
 
 #include "opendnp3/gen/SecurityStatIndex.h"
 
@@ -100,6 +101,9 @@ public:
 
 	DatabaseConfigView GetConfigView();
 
+	/// optional listener for READ handling times and event buffer occupancy, may be null
+	void SetMetricsListener(IStackMetricsListener* pMetrics);
+
 	/// ---- Processing functions --------
 
 
@@ -168,6 +172,7 @@ public:
 	ILowerLayer* const pLower;
 	ICommandHandler* const pCommandHandler;
 	IOutstationApplication* const pApplication;
+	IStackMetricsListener* pMetrics;
 
 	// ------ Database, event buffer, and response tracking
 	EventBuffer eventBuffer;
@@ -0,0 +1,48 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_POINTCONFIG_H
+#define OPENDNP3_POINTCONFIG_H
+
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/**
+* Static configuration of a point, stored in an array parallel to the cells.
+*
+* Users still configure the virtual index and the default static variation through the
+* cells (see DatabaseConfigView). StaticBuffers copies them here before they are used, so
+* that index searches and static serialization don't stream through the rest of each cell.
+*/
+template <class ValueType>
+struct PointConfig
+{
+	PointConfig() : vIndex(0), variation(ValueType::DefaultStaticVariation)
+	{}
+
+	uint16_t vIndex; // virtual index for discontiguous data, as opposed to the raw array index
+	typename ValueType::StaticVariation variation;
+};
+
+}
+
+#endif
@@ -0,0 +1,211 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_SOEQUEUE_H
+#define OPENDNP3_SOEQUEUE_H
+
+#include "opendnp3/outstation/SOERecord.h"
+
+#include <openpal/container/LinkedList.h>
+#include <openpal/util/Uncopyable.h>
+
+namespace opendnp3
+{
+
+/**
+* Iterates over the nodes of an SOEQueue in the order they were queued
+*/
+template <SOELink LINK>
+class SOEQueueIterator
+{
+public:
+
+	typedef openpal::ListNode<SOERecord> Node;
+
+	static SOEQueueIterator Undefined()
+	{
+		return SOEQueueIterator(nullptr);
+	}
+
+	static SOEQueueIterator From(Node* pStart)
+	{
+		return SOEQueueIterator(pStart);
+	}
+
+	bool HasNext() const
+	{
+		return (pCurrent != nullptr);
+	}
+
+	Node* Current() const
+	{
+		return pCurrent;
+	}
+
+	Node* Next()
+	{
+		auto pRet = pCurrent;
+		if (pCurrent)
+		{
+			pCurrent = pCurrent->value.links[static_cast<uint8_t>(LINK)].next;
+		}
+		return pRet;
+	}
+
+private:
+
+	SOEQueueIterator(Node* pStart) : pCurrent(pStart)
+	{}
+
+	Node* pCurrent;
+};
+
+/**
+* An intrusive doubly-linked queue of nodes that also reside in the global SOE list.
+*
+* Each record carries one pair of links per SOELink, so a record can be a member of a
+* type queue, a class queue, and the selection queue at the same time. Append and
+* Remove are O(1) and never allocate.
+*/
+template <SOELink LINK>
+class SOEQueue : private openpal::Uncopyable
+{
+public:
+
+	typedef openpal::ListNode<SOERecord> Node;
+	typedef SOEQueueIterator<LINK> Iterator;
+
+	SOEQueue() : pHead(nullptr), pTail(nullptr)
+	{}
+
+	Node* Head() const
+	{
+		return pHead;
+	}
+
+	bool IsEmpty() const
+	{
+		return pHead == nullptr;
+	}
+
+	Iterator Iterate() const
+	{
+		return Iterator::From(pHead);
+	}
+
+	void Append(Node* pNode)
+	{
+		Links(pNode).prev = pTail;
+		Links(pNode).next = nullptr;
+
+		if (pTail)
+		{
+			Links(pTail).next = pNode;
+		}
+		else
+		{
+			pHead = pNode;
+		}
+
+		pTail = pNode;
+	}
+
+	void Remove(Node* pNode)
+	{
+		auto& links = Links(pNode);
+
+		if (links.prev)
+		{
+			Links(links.prev).next = links.next;
+		}
+		else
+		{
+			pHead = links.next;
+		}
+
+		if (links.next)
+		{
+			Links(links.next).prev = links.prev;
+		}
+		else
+		{
+			pTail = links.prev;
+		}
+
+		links.prev = links.next = nullptr;
+	}
+
+	// forget all members without touching their links
+	void Clear()
+	{
+		pHead = pTail = nullptr;
+	}
+
+	/**
+	* Merge another queue whose members are in SOE order into this queue, also in SOE order.
+	* The other queue is left empty. O(n + m) in the length of the two queues.
+	*/
+	void Merge(SOEQueue& other)
+	{
+		Node* pLeft = this->pHead;
+		Node* pRight = other.pHead;
+
+		this->Clear();
+		other.Clear();
+
+		while (pLeft || pRight)
+		{
+			Node* pNext = nullptr;
+
+			if (pLeft && (!pRight || Precedes(pLeft->value.sequence, pRight->value.sequence)))
+			{
+				pNext = pLeft;
+				pLeft = Links(pLeft).next;
+			}
+			else
+			{
+				pNext = pRight;
+				pRight = Links(pRight).next;
+			}
+
+			this->Append(pNext);
+		}
+	}
+
+	// true if sequence number 'a' was assigned before 'b', tolerant of wrap-around
+	inline static bool Precedes(uint32_t a, uint32_t b)
+	{
+		return static_cast<int32_t>(a - b) < 0;
+	}
+
+private:
+
+	inline static SOELinks& Links(Node* pNode)
+	{
+		return pNode->value.links[static_cast<uint8_t>(LINK)];
+	}
+
+	Node* pHead;
+	Node* pTail;
+};
+
+}
+
+#endif
@@ -31,6 +31,8 @@ SOERecord::SOERecord(EventType type_, EventClass clazz_, uint16_t index_, uint64
 	clazz(clazz_),
 	selected(false),
 	written(false),
+	sequence(0),
+	links(),
 	index(index_),
 	time(time_),
 	flags(flags_)
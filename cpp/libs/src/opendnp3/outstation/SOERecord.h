@@ -27,10 +27,35 @@
 
 #include <openpal/serialization/UInt48Type.h>
 
+namespace openpal
+{
+template <class ValueType>
+class ListNode;
+}
 
 namespace opendnp3
 {
 
+class SOERecord;
+
+/**
+* Identifies one of the secondary queues that an SOERecord can be threaded through
+*/
+enum class SOELink : uint8_t
+{
+    Type = 0,
+    Class = 1,
+    Selection = 2
+};
+
+static const uint8_t NUM_SOE_LINKS = 3;
+
+struct SOELinks
+{
+	openpal::ListNode<SOERecord>* prev;
+	openpal::ListNode<SOERecord>* next;
+};
+
 template <class T>
 struct ValueAndVariation
 {
@@ -104,6 +129,12 @@ public:
 	bool written;
 	void Reset();
 
+	// position in the global SOE, used to keep the selection queue in SOE order
+	uint32_t sequence;
+
+	// intrusive links for the secondary queues, indexed by SOELink
+	SOELinks links[NUM_SOE_LINKS];
+
 	DNPTime GetTime() const
 	{
 		return time;
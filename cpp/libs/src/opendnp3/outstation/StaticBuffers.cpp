@@ -32,7 +32,26 @@ StaticBuffers::StaticBuffers(const DatabaseTemplate& dbTemplate) :
 	binaryOutputStatii(dbTemplate.numBinaryOutputStatus),
 	analogOutputStatii(dbTemplate.numAnalogOutputStatus),
 	timeAndIntervals(dbTemplate.numTimeAndInterval),
-	securityStats(dbTemplate.numSecurityStats)
+	securityStats(dbTemplate.numSecurityStats),
+	binaryConfig(binaries.Size()),
+	doubleBinaryConfig(doubleBinaries.Size()),
+	analogConfig(analogs.Size()),
+	counterConfig(counters.Size()),
+	frozenCounterConfig(frozenCounters.Size()),
+	binaryOutputStatusConfig(binaryOutputStatii.Size()),
+	analogOutputStatusConfig(analogOutputStatii.Size()),
+	timeAndIntervalConfig(timeAndIntervals.Size()),
+	securityStatConfig(securityStats.Size()),
+	binarySelection(dbTemplate.numBinary),
+	doubleBinarySelection(dbTemplate.numDoubleBinary),
+	analogSelection(dbTemplate.numAnalog),
+	counterSelection(dbTemplate.numCounter),
+	frozenCounterSelection(dbTemplate.numFrozenCounter),
+	binaryOutputStatusSelection(dbTemplate.numBinaryOutputStatus),
+	analogOutputStatusSelection(dbTemplate.numAnalogOutputStatus),
+	timeAndIntervalSelection(dbTemplate.numTimeAndInterval),
+	securityStatSelection(dbTemplate.numSecurityStats),
+	configPending(true)
 {
 	this->SetDefaultIndices<Binary>();
 	this->SetDefaultIndices<DoubleBitBinary>();
@@ -47,6 +66,8 @@ StaticBuffers::StaticBuffers(const DatabaseTemplate& dbTemplate) :
 
 DatabaseConfigView StaticBuffers::GetView() const
 {
+	configPending = true;
+
 	return DatabaseConfigView(
 	           binaries.ToView(),
 	           doubleBinaries.ToView(),
@@ -113,6 +134,128 @@ openpal::ArrayView<Cell<SecurityStat>, uint16_t> StaticBuffers::GetArrayView()
 	return securityStats.ToView();
 }
 
+template <>
+openpal::ArrayView<PointConfig<Binary>, uint16_t> StaticBuffers::GetConfigStorage()
+{
+	return binaryConfig.ToView();
+}
+
+template <>
+openpal::ArrayView<PointConfig<DoubleBitBinary>, uint16_t> StaticBuffers::GetConfigStorage()
+{
+	return doubleBinaryConfig.ToView();
+}
+
+template <>
+openpal::ArrayView<PointConfig<Analog>, uint16_t> StaticBuffers::GetConfigStorage()
+{
+	return analogConfig.ToView();
+}
+
+template <>
+openpal::ArrayView<PointConfig<Counter>, uint16_t> StaticBuffers::GetConfigStorage()
+{
+	return counterConfig.ToView();
+}
+
+template <>
+openpal::ArrayView<PointConfig<FrozenCounter>, uint16_t> StaticBuffers::GetConfigStorage()
+{
+	return frozenCounterConfig.ToView();
+}
+
+template <>
+openpal::ArrayView<PointConfig<BinaryOutputStatus>, uint16_t> StaticBuffers::GetConfigStorage()
+{
+	return binaryOutputStatusConfig.ToView();
+}
+
+template <>
+openpal::ArrayView<PointConfig<AnalogOutputStatus>, uint16_t> StaticBuffers::GetConfigStorage()
+{
+	return analogOutputStatusConfig.ToView();
+}
+
+template <>
+openpal::ArrayView<PointConfig<TimeAndInterval>, uint16_t> StaticBuffers::GetConfigStorage()
+{
+	return timeAndIntervalConfig.ToView();
+}
+
+template <>
+openpal::ArrayView<PointConfig<SecurityStat>, uint16_t> StaticBuffers::GetConfigStorage()
+{
+	return securityStatConfig.ToView();
+}
+
+void StaticBuffers::ApplyConfig()
+{
+	this->CopyConfig<Binary>();
+	this->CopyConfig<DoubleBitBinary>();
+	this->CopyConfig<Analog>();
+	this->CopyConfig<Counter>();
+	this->CopyConfig<FrozenCounter>();
+	this->CopyConfig<BinaryOutputStatus>();
+	this->CopyConfig<AnalogOutputStatus>();
+	this->CopyConfig<TimeAndInterval>();
+	this->CopyConfig<SecurityStat>();
+	configPending = false;
+}
+
+template <>
+StaticSelection<Binary> StaticBuffers::GetSelection(uint32_t version)
+{
+	return binarySelection.GetSelection(version);
+}
+
+template <>
+StaticSelection<DoubleBitBinary> StaticBuffers::GetSelection(uint32_t version)
+{
+	return doubleBinarySelection.GetSelection(version);
+}
+
+template <>
+StaticSelection<Counter> StaticBuffers::GetSelection(uint32_t version)
+{
+	return counterSelection.GetSelection(version);
+}
+
+template <>
+StaticSelection<FrozenCounter> StaticBuffers::GetSelection(uint32_t version)
+{
+	return frozenCounterSelection.GetSelection(version);
+}
+
+template <>
+StaticSelection<Analog> StaticBuffers::GetSelection(uint32_t version)
+{
+	return analogSelection.GetSelection(version);
+}
+
+template <>
+StaticSelection<BinaryOutputStatus> StaticBuffers::GetSelection(uint32_t version)
+{
+	return binaryOutputStatusSelection.GetSelection(version);
+}
+
+template <>
+StaticSelection<AnalogOutputStatus> StaticBuffers::GetSelection(uint32_t version)
+{
+	return analogOutputStatusSelection.GetSelection(version);
+}
+
+template <>
+StaticSelection<TimeAndInterval> StaticBuffers::GetSelection(uint32_t version)
+{
+	return timeAndIntervalSelection.GetSelection(version);
+}
+
+template <>
+StaticSelection<SecurityStat> StaticBuffers::GetSelection(uint32_t version)
+{
+	return securityStatSelection.GetSelection(version);
+}
+
 }
 
 
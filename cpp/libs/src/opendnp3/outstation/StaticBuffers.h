@@ -24,6 +24,8 @@
 #include "opendnp3/outstation/DatabaseConfigView.h"
 
 #include "opendnp3/outstation/Cell.h"
+#include "opendnp3/outstation/PointConfig.h"
+#include "opendnp3/outstation/StaticSelection.h"
 #include "opendnp3/outstation/DatabaseTemplate.h"
 #include "opendnp3/app/SecurityStat.h"
 
@@ -44,14 +46,37 @@ public:
 
 	explicit StaticBuffers(const DatabaseTemplate& dbTemplate);
 
+	// the view exposes the configuration held in the cells, so it is copied again before its next use
 	DatabaseConfigView GetView() const;
 
 	// specializations in cpp file
 	template <class T>
 	openpal::ArrayView<Cell<T>, uint16_t> GetArrayView();
 
+	template <class T>
+	openpal::ArrayView<PointConfig<T>, uint16_t> GetConfigArrayView()
+	{
+		if (configPending)
+		{
+			this->ApplyConfig();
+		}
+
+		return this->GetConfigStorage<T>();
+	}
+
+	// specializations in cpp file
+	template <class T>
+	StaticSelection<T> GetSelection(uint32_t version);
+
 private:
 
+	// copies the virtual indices and default static variations from the cells into the config arrays
+	void ApplyConfig();
+
+	// specializations in cpp file
+	template <class T>
+	openpal::ArrayView<PointConfig<T>, uint16_t> GetConfigStorage();
+
 	template <class T>
 	void SetDefaultIndices()
 	{
@@ -62,6 +87,18 @@ private:
 		}
 	}
 
+	template <class T>
+	void CopyConfig()
+	{
+		auto cells = GetArrayView<T>();
+		auto config = GetConfigStorage<T>();
+		for (uint16_t i = 0; i < cells.Size(); ++i)
+		{
+			config[i].vIndex = cells[i].vIndex;
+			config[i].variation = cells[i].variation;
+		}
+	}
+
 	openpal::Array<Cell<Binary>, uint16_t> binaries;
 	openpal::Array<Cell<DoubleBitBinary>, uint16_t> doubleBinaries;
 	openpal::Array<Cell<Analog>, uint16_t> analogs;
@@ -71,6 +108,31 @@ private:
 	openpal::Array<Cell<AnalogOutputStatus>, uint16_t> analogOutputStatii;
 	openpal::Array<Cell<TimeAndInterval>, uint16_t> timeAndIntervals;
 	openpal::Array<Cell<SecurityStat>, uint16_t> securityStats;
+
+	// compact copies of the static configuration in the cells, read by index searches and serialization
+	openpal::Array<PointConfig<Binary>, uint16_t> binaryConfig;
+	openpal::Array<PointConfig<DoubleBitBinary>, uint16_t> doubleBinaryConfig;
+	openpal::Array<PointConfig<Analog>, uint16_t> analogConfig;
+	openpal::Array<PointConfig<Counter>, uint16_t> counterConfig;
+	openpal::Array<PointConfig<FrozenCounter>, uint16_t> frozenCounterConfig;
+	openpal::Array<PointConfig<BinaryOutputStatus>, uint16_t> binaryOutputStatusConfig;
+	openpal::Array<PointConfig<AnalogOutputStatus>, uint16_t> analogOutputStatusConfig;
+	openpal::Array<PointConfig<TimeAndInterval>, uint16_t> timeAndIntervalConfig;
+	openpal::Array<PointConfig<SecurityStat>, uint16_t> securityStatConfig;
+
+	// selection state is kept apart from the cells, see StaticSelection
+	SelectionBuffer<Binary> binarySelection;
+	SelectionBuffer<DoubleBitBinary> doubleBinarySelection;
+	SelectionBuffer<Analog> analogSelection;
+	SelectionBuffer<Counter> counterSelection;
+	SelectionBuffer<FrozenCounter> frozenCounterSelection;
+	SelectionBuffer<BinaryOutputStatus> binaryOutputStatusSelection;
+	SelectionBuffer<AnalogOutputStatus> analogOutputStatusSelection;
+	SelectionBuffer<TimeAndInterval> timeAndIntervalSelection;
+	SelectionBuffer<SecurityStat> securityStatSelection;
+
+	// set whenever a config view is handed out, cleared when the cells are copied into the config arrays
+	mutable bool configPending;
 };
 
 }
@@ -27,6 +27,8 @@
 #include "opendnp3/app/MeasurementTypes.h"
 #include "opendnp3/app/SecurityStat.h"
 #include "opendnp3/outstation/Cell.h"
+#include "opendnp3/outstation/PointConfig.h"
+#include "opendnp3/outstation/StaticSelection.h"
 
 #include <openpal/container/ArrayView.h>
 
@@ -36,7 +38,7 @@ namespace opendnp3
 template <class T>
 struct StaticWriter
 {
-	typedef bool (*Function)(openpal::ArrayView<Cell<T>, uint16_t>& view, HeaderWriter& writer, Range& range);
+	typedef bool (*Function)(openpal::ArrayView<Cell<T>, uint16_t>& view, const openpal::ArrayView<PointConfig<T>, uint16_t>& config, StaticSelection<T>& selection, HeaderWriter& writer, Range& range);
 };
 
 StaticWriter<Binary>::Function GetStaticWriter(StaticBinaryVariation variation);
@@ -57,29 +59,66 @@ StaticWriter<TimeAndInterval>::Function GetStaticWriter(StaticTimeAndIntervalVar
 
 StaticWriter<SecurityStat>::Function GetStaticWriter(StaticSecurityStatVariation variation);
 
-template <class Target, class IndexType>
-bool LoadWithRangeIterator(openpal::ArrayView<Cell<Target>, uint16_t>& view, RangeWriteIterator<IndexType, Target>& iterator, Range& range)
+/**
+* Loads contiguous runs of selected values that use the same variation. Each run is gathered
+* and handed to the bulk serializer of the object type, so the space is checked once per run
+* instead of once per value.
+*/
+template <class Serializer, class IndexType>
+bool LoadWithRangeIterator(openpal::ArrayView<Cell<typename Serializer::Target>, uint16_t>& view, const openpal::ArrayView<PointConfig<typename Serializer::Target>, uint16_t>& config, StaticSelection<typename Serializer::Target>& selection, RangeWriteIterator<IndexType, typename Serializer::Target>& iterator, Range& range)
 {
-	const Cell<Target>& start = view[range.start];
-	uint16_t nextIndex = start.vIndex;
+	const uint32_t MAX_RUN = 32;
+	typename Serializer::Target values[MAX_RUN];
 
-	while (
-	    range.IsValid() &&
-	    view[range.start].selection.selected &&
-	    (view[range.start].selection.variation == start.selection.variation) &&
-	    (view[range.start].vIndex == nextIndex)
-	)
+	const auto variation = selection.GetVariation(range.start);
+	uint16_t nextIndex = config[range.start].vIndex;
+
+	auto isNext = [&](uint32_t i, uint32_t vIndex) -> bool
 	{
-		if (iterator.Write(view[range.start].selection.value))
+		return (i <= range.stop) && selection.IsSelected(static_cast<uint16_t>(i)) && (selection.GetVariation(static_cast<uint16_t>(i)) == variation) && (config[static_cast<uint16_t>(i)].vIndex == vIndex);
+	};
+
+	while (range.IsValid())
+	{
+		const uint32_t remaining = iterator.Remaining();
+		const uint32_t capacity = (remaining < MAX_RUN) ? remaining : MAX_RUN;
+
+		// measure and gather the run
+		uint32_t num = 0;
+		while (num < capacity && isNext(range.start + num, nextIndex + num))
 		{
-			// deselect the value and advance the range
-			view[range.start].selection.selected = false;
-			range.Advance();
-			++nextIndex;
+			const uint16_t i = static_cast<uint16_t>(range.start + num);
+			values[num] = selection.GetSelectedValue(i, view[i]);
+			++num;
 		}
-		else
+
+		if (num > 0)
 		{
-			return false;
+			if (!iterator.template WriteMany<Serializer>(values, num))
+			{
+				return false;
+			}
+
+			// deselect the values and advance the range
+			for (uint32_t j = 0; j < num; ++j)
+			{
+				selection.Deselect(range.start);
+				range.Advance();
+			}
+
+			nextIndex += static_cast<uint16_t>(num);
+		}
+
+		if (num < capacity)
+		{
+			// the run ended before the buffer did
+			return true;
+		}
+
+		if (capacity < MAX_RUN)
+		{
+			// out of space, which only matters if the run continues
+			return !(range.IsValid() && isNext(range.start, nextIndex));
 		}
 	}
 
@@ -87,23 +126,22 @@ bool LoadWithRangeIterator(openpal::ArrayView<Cell<Target>, uint16_t>& view, Ran
 }
 
 template <class Target, class IndexType>
-bool LoadWithBitfieldIterator(openpal::ArrayView<Cell<Target>, uint16_t>& view, BitfieldRangeWriteIterator<IndexType>& iterator, Range& range)
+bool LoadWithBitfieldIterator(openpal::ArrayView<Cell<Target>, uint16_t>& view, const openpal::ArrayView<PointConfig<Target>, uint16_t>& config, StaticSelection<Target>& selection, BitfieldRangeWriteIterator<IndexType>& iterator, Range& range)
 {
-	const Cell<Target>& start = view[range.start];
-
-	uint16_t nextIndex = start.vIndex;
+	const auto variation = selection.GetVariation(range.start);
+	uint16_t nextIndex = config[range.start].vIndex;
 
 	while (
 	    range.IsValid() &&
-	    view[range.start].selection.selected &&
-	    (view[range.start].selection.variation == start.selection.variation) &&
-	    (view[range.start].vIndex == nextIndex)
+	    selection.IsSelected(range.start) &&
+	    (selection.GetVariation(range.start) == variation) &&
+	    (config[range.start].vIndex == nextIndex)
 	)
 	{
-		if (iterator.Write(view[range.start].selection.value.value))
+		if (iterator.Write(selection.GetSelectedValue(range.start, view[range.start]).value))
 		{
 			// deselect the value and advance the range
-			view[range.start].selection.selected = false;
+			selection.Deselect(range.start);
 			range.Advance();
 			++nextIndex;
 		}
@@ -117,40 +155,40 @@ bool LoadWithBitfieldIterator(openpal::ArrayView<Cell<Target>, uint16_t>& view,
 }
 
 template <class T, class GV>
-bool WriteSingleBitfield(openpal::ArrayView<Cell<T>, uint16_t>& view, HeaderWriter& writer, Range& range)
+bool WriteSingleBitfield(openpal::ArrayView<Cell<T>, uint16_t>& view, const openpal::ArrayView<PointConfig<T>, uint16_t>& config, StaticSelection<T>& selection, HeaderWriter& writer, Range& range)
 {
-	auto start = view[range.start].vIndex;
-	auto stop = view[range.stop].vIndex;
+	auto start = config[range.start].vIndex;
+	auto stop = config[range.stop].vIndex;
 	auto mapped = Range::From(start, stop);
 
 	if (mapped.IsOneByte())
 	{
 		auto iter = writer.IterateOverSingleBitfield<openpal::UInt8>(GV::ID(), QualifierCode::UINT8_START_STOP, static_cast<uint8_t>(mapped.start));
-		return LoadWithBitfieldIterator<T, openpal::UInt8>(view, iter, range);
+		return LoadWithBitfieldIterator<T, openpal::UInt8>(view, config, selection, iter, range);
 	}
 	else
 	{
 		auto iter = writer.IterateOverSingleBitfield<openpal::UInt16>(GV::ID(), QualifierCode::UINT16_START_STOP, mapped.start);
-		return LoadWithBitfieldIterator<T, openpal::UInt16>(view, iter, range);
+		return LoadWithBitfieldIterator<T, openpal::UInt16>(view, config, selection, iter, range);
 	}
 }
 
 template <class Serializer>
-bool WriteWithSerializer(openpal::ArrayView<Cell<typename Serializer::Target>, uint16_t>& view, HeaderWriter& writer, Range& range)
+bool WriteWithSerializer(openpal::ArrayView<Cell<typename Serializer::Target>, uint16_t>& view, const openpal::ArrayView<PointConfig<typename Serializer::Target>, uint16_t>& config, StaticSelection<typename Serializer::Target>& selection, HeaderWriter& writer, Range& range)
 {
-	auto start = view[range.start].vIndex;
-	auto stop = view[range.stop].vIndex;
+	auto start = config[range.start].vIndex;
+	auto stop = config[range.stop].vIndex;
 	auto mapped = Range::From(start, stop);
 
 	if (mapped.IsOneByte())
 	{
 		auto iter = writer.IterateOverRange<openpal::UInt8, typename Serializer::Target>(QualifierCode::UINT8_START_STOP, Serializer::Inst(), static_cast<uint8_t>(mapped.start));
-		return LoadWithRangeIterator<typename Serializer::Target, openpal::UInt8>(view, iter, range);
+		return LoadWithRangeIterator<Serializer, openpal::UInt8>(view, config, selection, iter, range);
 	}
 	else
 	{
 		auto iter = writer.IterateOverRange<openpal::UInt16, typename Serializer::Target>(QualifierCode::UINT16_START_STOP, Serializer::Inst(), mapped.start);
-		return LoadWithRangeIterator<typename Serializer::Target, openpal::UInt16>(view, iter, range);
+		return LoadWithRangeIterator<Serializer, openpal::UInt16>(view, config, selection, iter, range);
 	}
 }
 
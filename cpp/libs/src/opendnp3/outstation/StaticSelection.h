@@ -0,0 +1,150 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_STATICSELECTION_H
+#define OPENDNP3_STATICSELECTION_H
+
+#include "opendnp3/outstation/Cell.h"
+
+#include <openpal/container/Array.h>
+#include <openpal/util/Uncopyable.h>
+
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/**
+* Records whether a static value is requested in a response.
+*
+* A value is selected when its version matches the current selection version of the database,
+* so clearing a selection never has to visit the values.
+*/
+template <class T>
+struct SelectionState
+{
+	SelectionState() : version(0), copied(false), variation(T::DefaultStaticVariation)
+	{}
+
+	uint32_t version;
+	bool copied; // the live value changed after selection, use the snapshot
+	typename T::StaticVariation variation;
+};
+
+/**
+* View of the selection state for one measurement type, bound to the current selection version.
+*
+* The selected value is only copied into the snapshot array if the live value is updated while
+* it is selected but not yet written, so a response is always a consistent snapshot.
+*/
+template <class T>
+class StaticSelection
+{
+public:
+
+	StaticSelection(openpal::ArrayView<SelectionState<T>, uint16_t> states_, openpal::ArrayView<T, uint16_t> snapshots_, uint32_t version_) :
+		states(states_),
+		snapshots(snapshots_),
+		version(version_)
+	{}
+
+	bool IsSelected(uint16_t i) const
+	{
+		return states[i].version == version;
+	}
+
+	void Select(uint16_t i, typename T::StaticVariation variation)
+	{
+		auto& state = states[i];
+		state.version = version;
+		state.copied = false;
+		state.variation = variation;
+	}
+
+	// version 0 is never used for a selection
+	void Deselect(uint16_t i)
+	{
+		states[i].version = 0;
+	}
+
+	void DeselectAll()
+	{
+		for (uint16_t i = 0; i < states.Size(); ++i)
+		{
+			states[i].version = 0;
+		}
+	}
+
+	typename T::StaticVariation GetVariation(uint16_t i) const
+	{
+		return states[i].variation;
+	}
+
+	// the value as it was when it was selected
+	const T& GetSelectedValue(uint16_t i, const Cell<T>& cell) const
+	{
+		return states[i].copied ? snapshots[i] : cell.value;
+	}
+
+	// change the live value, preserving the selected value if it hasn't been written yet
+	void Update(uint16_t i, Cell<T>& cell, const T& value)
+	{
+		auto& state = states[i];
+		if ((state.version == version) && !state.copied)
+		{
+			snapshots[i] = cell.value;
+			state.copied = true;
+		}
+
+		cell.value = value;
+	}
+
+private:
+
+	openpal::ArrayView<SelectionState<T>, uint16_t> states;
+	openpal::ArrayView<T, uint16_t> snapshots;
+	uint32_t version;
+};
+
+/**
+* Storage for the selection state and snapshots of one measurement type
+*/
+template <class T>
+class SelectionBuffer : private openpal::Uncopyable
+{
+public:
+
+	explicit SelectionBuffer(uint16_t size) : states(size), snapshots(size)
+	{}
+
+	StaticSelection<T> GetSelection(uint32_t version) const
+	{
+		return StaticSelection<T>(states.ToView(), snapshots.ToView(), version);
+	}
+
+private:
+
+	openpal::Array<SelectionState<T>, uint16_t> states;
+	openpal::Array<T, uint16_t> snapshots;
+};
+
+}
+
+#endif
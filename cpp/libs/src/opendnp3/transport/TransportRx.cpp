@@ -96,7 +96,12 @@ RSlice TransportRx::ProcessReceive(const RSlice& input)
 		{
 			if (pStatistics) ++pStatistics->numTransportRx;
 
-			auto payload = input.Skip(1);
+			if (first && last)
+			{
+				// the whole fragment is in this segment, so pass it up in place instead of reassembling it
+				this->sequence.Increment();
+				return payload;
+			}
 
 			payload.CopyTo(available);
 
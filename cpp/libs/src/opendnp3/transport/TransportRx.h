@@ -43,6 +43,14 @@ class TransportRx
 public:
 	TransportRx(const openpal::Logger&, uint32_t maxRxFragSize, StackStatistics* pStatistics);
 
+	/**
+	* Process a received segment, returning a complete fragment or an empty slice
+	*
+	* A fragment that arrives in a single FIR/FIN segment is returned as a view into the input, without a copy.
+	* Fragments of several segments are reassembled into the receive buffer. Either way, the returned slice is
+	* only valid until the next segment is received, because the link layer reuses its frame buffer for the next
+	* frame. Upper layers have to finish with it, or copy it, before returning from IUpperLayer::OnReceive.
+	*/
 	openpal::RSlice ProcessReceive(const openpal::RSlice& input);
 
 	void Reset();
@@ -52,7 +52,7 @@ bool TransportTx::HasValue() const
 	return apdu.Size() > 0;
 }
 
-openpal::RSlice TransportTx::GetSegment()
+TransportSegment TransportTx::GetSegment()
 {
 	if (txSegment.IsSet())
 	{
@@ -62,12 +62,8 @@ openpal::RSlice TransportTx::GetSegment()
 	{
 		uint32_t numToSend = (apdu.Size() < MAX_TPDU_PAYLOAD) ? apdu.Size() : MAX_TPDU_PAYLOAD;
 
-		auto dest = tpduBuffer.GetWSlice().Skip(1);
-		apdu.Take(numToSend).CopyTo(dest);
-
 		bool fir = (tpduCount == 0);
 		bool fin = (numToSend == apdu.Size());
-		tpduBuffer()[0] = GetHeader(fir, fin, sequence);
 
 		FORMAT_LOG_BLOCK(logger, flags::TRANSPORT_TX, "FIR: %d FIN: %d SEQ: %u LEN: %u", fir, fin, sequence.Get(), numToSend);
 
@@ -76,7 +72,7 @@ openpal::RSlice TransportTx::GetSegment()
 			++pStatistics->numTransportTx;
 		}
 
-		auto segment = tpduBuffer.ToRSlice(numToSend + 1);
+		TransportSegment segment(GetHeader(fir, fin, sequence), apdu.Take(numToSend));
 		txSegment.Set(segment);
 		return segment;
 	}
@@ -23,7 +23,6 @@
 
 #include <openpal/logging/Logger.h>
 #include <openpal/container/Settable.h>
-#include <openpal/container/StaticBuffer.h>
 
 #include "opendnp3/StackStatistics.h"
 #include "opendnp3/link/ITransportSegment.h"
@@ -53,7 +52,7 @@ public:
 
 	virtual bool HasValue() const override final;
 
-	virtual openpal::RSlice GetSegment() override final;
+	virtual TransportSegment GetSegment() override final;
 
 	virtual bool Advance() override final;
 
@@ -62,10 +61,8 @@ private:
 	// A wrapper to the APDU buffer that we're segmenting
 	openpal::RSlice apdu;
 
-	openpal::Settable<openpal::RSlice> txSegment;
-
-	// Static buffer where we store tpdus that are being transmitted
-	openpal::StaticBuffer<MAX_TPDU_LENGTH> tpduBuffer;
+	// The current segment is a view into the APDU, so it is computed once and never copied
+	openpal::Settable<TransportSegment> txSegment;
 
 	openpal::Logger logger;
 	StackStatistics* pStatistics;
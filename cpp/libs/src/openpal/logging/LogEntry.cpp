@@ -27,17 +27,19 @@ LogEntry::LogEntry() :
 	alias(""),
 	location(""),
 	message(""),
-	errorCode(-1)
+	errorCode(-1),
+	timestamp(0)
 {}
 
 
-LogEntry::LogEntry(char const* alias_, const LogFilters& filters_, char const* location_, char const* message_, int errorCode_)
+LogEntry::LogEntry(char const* alias_, const LogFilters& filters_, char const* location_, char const* message_, int errorCode_, uint64_t timestamp_)
 	:
 	alias(alias_),
 	filters(filters_),
 	location(location_),
 	message(message_),
-	errorCode(errorCode_)
+	errorCode(errorCode_),
+	timestamp(timestamp_)
 {
 
 }
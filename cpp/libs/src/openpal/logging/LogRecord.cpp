@@ -0,0 +1,128 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "openpal/logging/LogRecord.h"
+
+#include "openpal/container/RSlice.h"
+#include "openpal/util/ToHex.h"
+
+namespace openpal
+{
+namespace logargs
+{
+
+void Codec<char const*>::Write(uint8_t*& pos, uint32_t& budget, char const* value)
+{
+	if (!value)
+	{
+		value = "(null)";
+	}
+
+	auto length = static_cast<uint32_t>(strlen(value));
+	if (length > budget)
+	{
+		length = budget;
+	}
+	memcpy(pos, value, length);
+	pos[length] = '\0';
+	pos += (length + 1);
+	budget -= length;
+}
+
+char const* Codec<char const*>::Read(const uint8_t*& pos)
+{
+	auto value = reinterpret_cast<char const*>(pos);
+	pos += (strlen(value) + 1);
+	return value;
+}
+
+void Formatter<>::Run(char* dest, uint32_t size, char const* format, const uint8_t* pos)
+{
+	// an unused argument keeps the format string from being flagged as unchecked, it's ignored by snprintf
+	Run(dest, size, format, pos, 0);
+}
+
+}
+
+LogRecord::LogRecord() :
+	location(""),
+	errorCode(-1),
+	format(""),
+	pFormat(&logargs::Formatter<>::Run),
+	argsSize(0)
+{}
+
+LogRecord::LogRecord(const LogFilters& filters_, char const* location_, int errorCode_) :
+	filters(filters_),
+	location(location_),
+	errorCode(errorCode_),
+	format(""),
+	pFormat(&logargs::Formatter<>::Run),
+	argsSize(0)
+{}
+
+void LogRecord::CaptureHex(const RSlice& bytes)
+{
+	uint32_t count = (bytes.Size() < MAX_HEX_PER_LINE) ? bytes.Size() : MAX_HEX_PER_LINE;
+	args[0] = static_cast<uint8_t>(count);
+	memcpy(args + 1, bytes, count);
+	argsSize = static_cast<uint16_t>(count + 1);
+	format = "";
+	pFormat = &LogRecord::FormatHex;
+}
+
+void LogRecord::Format(char* dest, uint32_t size) const
+{
+	if (size > 0)
+	{
+		pFormat(dest, size, format, args);
+	}
+}
+
+void LogRecord::CopyTo(LogRecord& dest) const
+{
+	dest.filters = filters;
+	dest.location = location;
+	dest.errorCode = errorCode;
+	dest.format = format;
+	dest.pFormat = pFormat;
+	dest.argsSize = argsSize;
+	memcpy(dest.args, args, argsSize);
+}
+
+void LogRecord::FormatHex(char* dest, uint32_t size, char const*, const uint8_t* args)
+{
+	uint32_t count = args[0];
+	if ((3 * count) >= size)
+	{
+		count = (size - 1) / 3;
+	}
+	auto pLocation = dest;
+	for (uint32_t pos = 0; pos < count; ++pos)
+	{
+		pLocation[0] = ToHexChar((args[pos + 1] & 0xf0) >> 4);
+		pLocation[1] = ToHexChar(args[pos + 1] & 0xf);
+		pLocation[2] = ' ';
+		pLocation += 3;
+	}
+	*pLocation = '\0';
+}
+
+}
@@ -60,6 +60,14 @@ void LogRoot::Log(const LogFilters& filters, char const* location, char const* m
 	}
 }
 
+void LogRoot::Log(const LogRecord& record)
+{
+	if (pHandler)
+	{
+		pHandler->LogDeferred(alias, record);
+	}
+}
+
 Logger LogRoot::GetLogger()
 {
 	return Logger(this);
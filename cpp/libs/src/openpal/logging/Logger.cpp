@@ -46,5 +46,13 @@ void Logger::Log(const LogFilters& filters, char const* location, char const* me
 	}
 }
 
+void Logger::Log(const LogRecord& record)
+{
+	if (pRoot->IsEnabled(record.GetFilters()))
+	{
+		pRoot->Log(record);
+	}
+}
+
 }
 
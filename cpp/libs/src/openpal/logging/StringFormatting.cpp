@@ -20,6 +20,8 @@
  */
 #include "openpal/logging/StringFormatting.h"
 
+#include "openpal/logging/LogRecord.h"
+
 #include "openpal/util/ToHex.h"
 #include "openpal/container/RSlice.h"
 #include "openpal/Configure.h"
@@ -44,7 +46,6 @@ char* AllocateCopy(char const* src)
 
 void LogHex(Logger& logger, const openpal::LogFilters& filters, const openpal::RSlice& source, uint32_t firstRowSize, uint32_t otherRowSize)
 {
-	char buffer[MAX_LOG_ENTRY_SIZE];
 	RSlice copy(source);
 	uint32_t rowCount = 0;
 	while (copy.IsNotEmpty())
@@ -64,18 +65,10 @@ void LogHex(Logger& logger, const openpal::LogFilters& filters, const openpal::R
 				rowSize = otherRowSize;
 			}
 		}
-		auto region = copy.Take(rowSize);
-		auto pLocation = buffer;
-		for (uint32_t pos = 0; pos < rowSize; ++pos)
-		{
-			pLocation[0] = ToHexChar((region[pos] & 0xf0) >> 4);
-			pLocation[1] = ToHexChar(region[pos] & 0xf);
-			pLocation[2] = ' ';
-			pLocation += 3;
-		}
-		buffer[3 * rowSize] = '\0';
+		LogRecord record(filters, "", -1);
+		record.CaptureHex(copy.Take(rowSize));
 		copy.Advance(rowSize);
-		logger.Log(filters, "", buffer, -1);
+		logger.Log(record);
 		++rowCount;
 	}
 }
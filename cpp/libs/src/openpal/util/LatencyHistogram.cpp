@@ -0,0 +1,111 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include "openpal/util/LatencyHistogram.h"
+
+namespace openpal
+{
+
+LatencyHistogram::LatencyHistogram() : count(0), totalMicroseconds(0), maxMicroseconds(0)
+{
+	for (uint32_t i = 0; i < NUM_BUCKETS; ++i)
+	{
+		counts[i] = 0;
+	}
+}
+
+uint32_t LatencyHistogram::GetBucket(uint64_t microseconds)
+{
+	if (microseconds < NUM_SUB_BUCKETS)
+	{
+		return static_cast<uint32_t>(microseconds);
+	}
+
+	if (microseconds >> 32)
+	{
+		return NUM_BUCKETS - 1;
+	}
+
+	// position of the most significant bit by binary search
+	auto value = static_cast<uint32_t>(microseconds);
+	uint32_t msb = 0;
+	for (uint32_t shift = 16; shift > 0; shift >>= 1)
+	{
+		if (value >> (msb + shift))
+		{
+			msb += shift;
+		}
+	}
+
+	const uint32_t exponent = msb - SUB_BUCKET_BITS;
+	const uint32_t sub = (value >> exponent) & (NUM_SUB_BUCKETS - 1);
+	return NUM_SUB_BUCKETS + exponent * NUM_SUB_BUCKETS + sub;
+}
+
+uint64_t LatencyHistogram::GetBucketLowerBound(uint32_t bucket)
+{
+	if (bucket < NUM_SUB_BUCKETS)
+	{
+		return bucket;
+	}
+
+	const uint32_t exponent = (bucket - NUM_SUB_BUCKETS) / NUM_SUB_BUCKETS;
+	const uint32_t sub = (bucket - NUM_SUB_BUCKETS) % NUM_SUB_BUCKETS;
+	return static_cast<uint64_t>(NUM_SUB_BUCKETS + sub) << exponent;
+}
+
+uint64_t LatencyHistogram::GetBucketUpperBound(uint32_t bucket)
+{
+	return (bucket + 1 < NUM_BUCKETS) ? GetBucketLowerBound(bucket + 1) - 1 : ~static_cast<uint64_t>(0);
+}
+
+double LatencyHistogram::MeanMicroseconds() const
+{
+	return (count == 0) ? 0.0 : static_cast<double>(totalMicroseconds) / static_cast<double>(count);
+}
+
+uint64_t LatencyHistogram::PercentileMicroseconds(double percentile) const
+{
+	if (count == 0)
+	{
+		return 0;
+	}
+
+	auto rank = static_cast<uint64_t>((percentile / 100.0) * static_cast<double>(count) + 0.5);
+	if (rank < 1)
+	{
+		rank = 1;
+	}
+
+	uint64_t seen = 0;
+	for (uint32_t i = 0; i < NUM_BUCKETS; ++i)
+	{
+		seen += counts[i];
+		if (seen >= rank)
+		{
+			const auto upper = GetBucketUpperBound(i);
+			return (upper < maxMicroseconds) ? upper : maxMicroseconds;
+		}
+	}
+
+	return maxMicroseconds;
+}
+
+}
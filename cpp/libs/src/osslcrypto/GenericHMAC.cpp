@@ -75,5 +75,76 @@ RSlice CalculateHMAC(
 
 	return output.ToRSlice().Take(outputSize);
 }
+
+KeyedHMAC::KeyedHMAC(const EVP_MD* md_, uint16_t outputSize) :
+	md(md_),
+	OUTPUT_SIZE(outputSize),
+	keyed(false)
+{
+	HMAC_CTX_init(&ctx);
+}
+
+KeyedHMAC::~KeyedHMAC()
+{
+	HMAC_CTX_cleanup(&ctx);
+}
+
+bool KeyedHMAC::SetKey(const openpal::RSlice& key, std::error_code& ec)
+{
+	keyed = (HMAC_Init_ex(&ctx, key, key.Size(), md, nullptr) != 0);
+	if (!keyed)
+	{
+		ec = make_error_code(errors::OPENSSL_HMAC_INIT_EX_ERROR);
+	}
+	return keyed;
+}
+
+RSlice KeyedHMAC::Calculate(std::initializer_list<openpal::RSlice> data, openpal::WSlice& output, std::error_code& ec)
+{
+	if (output.Size() < OUTPUT_SIZE)
+	{
+		ec = make_error_code(errors::HMAC_INSUFFICIENT_OUTPUT_BUFFER_SIZE);
+		return RSlice();
+	}
+
+	// a null key and digest resets the context to the keyed inner state
+	if (!keyed || HMAC_Init_ex(&ctx, nullptr, 0, nullptr, nullptr) == 0)
+	{
+		ec = make_error_code(errors::OPENSSL_HMAC_INIT_EX_ERROR);
+		return RSlice();
+	}
+
+	for (auto & bytes : data)
+	{
+		if (HMAC_Update(&ctx, bytes, bytes.Size()) == 0)
+		{
+			ec = make_error_code(errors::OPENSSL_HMAC_UPDATE_ERROR);
+			return RSlice();
+		}
+	}
+
+	unsigned int length = 0;
+	if (HMAC_Final(&ctx, output, &length) == 0)
+	{
+		ec = make_error_code(errors::OPENSSL_HMAC_FINAL_ERROR);
+		return RSlice();
+	}
+
+	return output.ToRSlice().Take(OUTPUT_SIZE);
 }
 
+std::unique_ptr<openpal::IKeyedHMAC> CreateKeyedHMAC(
+    const EVP_MD* md,
+    uint16_t outputSize,
+    const openpal::RSlice& key,
+    std::error_code& ec
+)
+{
+	std::unique_ptr<KeyedHMAC> keyed(new KeyedHMAC(md, outputSize));
+	if (!keyed->SetKey(key, ec))
+	{
+		return nullptr;
+	}
+	return std::move(keyed);
+}
+}
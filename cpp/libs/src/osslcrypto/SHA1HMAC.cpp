@@ -32,5 +32,10 @@ openpal::RSlice SHA1HMAC::Calculate(const RSlice& key, std::initializer_list<RSl
 	return CalculateHMAC(EVP_sha1(), OUTPUT_SIZE, key, data, output, ec);
 }
 
+std::unique_ptr<openpal::IKeyedHMAC> SHA1HMAC::CreateKeyed(const RSlice& key, std::error_code& ec)
+{
+	return CreateKeyedHMAC(EVP_sha1(), OUTPUT_SIZE, key, ec);
+}
+
 }
 
@@ -32,5 +32,10 @@ RSlice SHA256HMAC::Calculate(const RSlice& key, std::initializer_list<RSlice> da
 	return CalculateHMAC(EVP_sha256(), OUTPUT_SIZE, key, data, output, ec);
 }
 
+std::unique_ptr<openpal::IKeyedHMAC> SHA256HMAC::CreateKeyed(const RSlice& key, std::error_code& ec)
+{
+	return CreateKeyedHMAC(EVP_sha256(), OUTPUT_SIZE, key, ec);
+}
+
 }
 
@@ -59,7 +59,27 @@ openpal::RSlice HMACProvider::Compute(const openpal::RSlice& key, std::initializ
 
 	return result.Take(TRUNC_SIZE);
 }
-}
 
+openpal::RSlice HMACProvider::Compute(openpal::IKeyedHMAC* pKeyed, const openpal::RSlice& key, std::initializer_list<openpal::RSlice> buffers, std::error_code& ec)
+{
+	if (!pKeyed)
+	{
+		return this->Compute(key, buffers, ec);
+	}
+
+	auto dest = buffer.GetWSlice();
+	auto result = pKeyed->Calculate(buffers, dest, ec);
+
+	if (ec)
+	{
+		return openpal::RSlice();
+	}
 
+	return result.Take(TRUNC_SIZE);
+}
 
+std::unique_ptr<openpal::IKeyedHMAC> HMACProvider::CreateKeyed(const openpal::RSlice& key, std::error_code& ec)
+{
+	return pHMAC->CreateKeyed(key, ec);
+}
+}
@@ -40,6 +40,12 @@ public:
 
 	openpal::RSlice Compute(const openpal::RSlice& key, std::initializer_list<openpal::RSlice> buffers, std::error_code& ec);
 
+	// Calculate with a keyed context from CreateKeyed(), or with the raw key if pKeyed is null
+	openpal::RSlice Compute(openpal::IKeyedHMAC* pKeyed, const openpal::RSlice& key, std::initializer_list<openpal::RSlice> buffers, std::error_code& ec);
+
+	// Bind a key so that repeated calculations with it skip the key setup
+	std::unique_ptr<openpal::IKeyedHMAC> CreateKeyed(const openpal::RSlice& key, std::error_code& ec);
+
 	uint32_t OutputSize() const
 	{
 		return TRUNC_SIZE;
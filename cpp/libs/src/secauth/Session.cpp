@@ -20,6 +20,8 @@
  */
 #include "Session.h"
 
+#include "secauth/HMACProvider.h"
+
 #include <openpal/executor/TimeDuration.h>
 
 using namespace openpal;
@@ -27,8 +29,9 @@ using namespace opendnp3;
 
 namespace secauth
 {
-Session::Session(openpal::IMonotonicTimeSource& timeSource, const openpal::TimeDuration& duration, uint32_t maxAuthCount) :
+Session::Session(openpal::IMonotonicTimeSource& timeSource, const openpal::TimeDuration& duration, uint32_t maxAuthCount, HMACProvider* pHMAC_) :
 	pTimeSource(&timeSource),
+	pHMAC(pHMAC_),
 	DURATION(duration),
 	MAX_AUTH_COUNT(maxAuthCount),
 	status(KeyStatus::NOT_INIT),
@@ -67,6 +70,14 @@ void Session::SetKeys(const SessionKeysView& view)
 	this->expirationTime = pTimeSource->GetTime().Add(this->DURATION);
 	this->keys.SetKeys(view);
 	this->status = KeyStatus::OK;
+
+	if (pHMAC)
+	{
+		// key the control context once per session key change instead of once per challenge reply.
+		// on failure the context stays null and calculations fall back to the raw key
+		std::error_code ec;
+		this->controlHMAC = pHMAC->CreateKeyed(this->keys.GetView().controlKey, ec);
+	}
 }
 
 opendnp3::KeyStatus Session::GetKeyStatus()
@@ -84,6 +95,16 @@ opendnp3::KeyStatus Session::TryGetKeyView(SessionKeysView& view)
 	return result;
 }
 
+opendnp3::KeyStatus Session::TryGetKeyView(SessionKeysView& view, SessionHMACs& hmacs)
+{
+	auto result = this->TryGetKeyView(view);
+	if (result == KeyStatus::OK)
+	{
+		hmacs.pControl = controlHMAC.get();
+	}
+	return result;
+}
+
 
 }
 
@@ -26,17 +26,33 @@
 #include <opendnp3/gen/KeyStatus.h>
 
 #include <openpal/executor/IMonotonicTimeSource.h>
+#include <openpal/crypto/IKeyedHMAC.h>
 #include <openpal/util/Uncopyable.h>
 
+#include <memory>
+
 namespace secauth
 {
+
+class HMACProvider;
+
+// Keyed HMAC context for a session's control key. May be null, in which case the raw key is used.
+// The monitor key is only HMAC'd once per key change, so it is never cached.
+struct SessionHMACs
+{
+	SessionHMACs() : pControl(nullptr)
+	{}
+
+	openpal::IKeyedHMAC* pControl;
+};
+
 // All the info for a session
 class Session : private openpal::Uncopyable
 {
 public:
 
-	// construct an uninitialized session
-	Session(openpal::IMonotonicTimeSource& timeSource, const openpal::TimeDuration& duration, uint32_t maxAuthCount);
+	// construct an uninitialized session. If pHMAC is set, SetKeys also keys an HMAC context for the control key.
+	Session(openpal::IMonotonicTimeSource& timeSource, const openpal::TimeDuration& duration, uint32_t maxAuthCount, HMACProvider* pHMAC = nullptr);
 
 	void SetKeys(const SessionKeysView& view);
 
@@ -44,6 +60,8 @@ public:
 
 	opendnp3::KeyStatus TryGetKeyView(SessionKeysView& view);
 
+	opendnp3::KeyStatus TryGetKeyView(SessionKeysView& view, SessionHMACs& hmacs);
+
 	opendnp3::KeyStatus IncrementAuthCount();
 
 private:
@@ -52,6 +70,7 @@ private:
 
 
 	openpal::IMonotonicTimeSource* pTimeSource;
+	HMACProvider* pHMAC;
 
 	const openpal::TimeDuration DURATION;
 	const uint32_t MAX_AUTH_COUNT;
@@ -60,6 +79,8 @@ private:
 	SessionKeys keys;
 	openpal::MonotonicTimestamp expirationTime;
 	uint32_t authCount;
+
+	std::unique_ptr<openpal::IKeyedHMAC> controlHMAC;
 };
 
 }
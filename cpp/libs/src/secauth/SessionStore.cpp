@@ -28,11 +28,13 @@ namespace secauth
 SessionStore::SessionStore(
     IMonotonicTimeSource& timeSource,
     openpal::TimeDuration sessionKeyValidity_,
-    uint32_t maxAuthMessageCount_
+    uint32_t maxAuthMessageCount_,
+    HMACProvider* pHMAC_
 ) :
 	pTimeSource(&timeSource),
 	sessionKeyValidity(sessionKeyValidity_),
-	maxAuthMessageCount(maxAuthMessageCount_)
+	maxAuthMessageCount(maxAuthMessageCount_),
+	pHMAC(pHMAC_)
 {
 
 
@@ -76,7 +78,7 @@ void SessionStore::SetSessionKeys(const User& user, const SessionKeysView& view)
 	if (iter == sessionMap.end())
 	{
 		auto session = std::unique_ptr<Session>(
-		                   new Session(*pTimeSource, sessionKeyValidity, maxAuthMessageCount)
+		                   new Session(*pTimeSource, sessionKeyValidity, maxAuthMessageCount, pHMAC)
 		               );
 		session->SetKeys(view);
 		sessionMap[user.GetId()] = std::move(session);
@@ -93,13 +95,19 @@ opendnp3::KeyStatus SessionStore::TryGetSessionKeys(const User& user, SessionKey
 	return (iter == sessionMap.end()) ? KeyStatus::UNDEFINED : iter->second->TryGetKeyView(view);
 }
 
+opendnp3::KeyStatus SessionStore::TryGetSessionKeys(const User& user, SessionKeysView& view, SessionHMACs& hmacs)
+{
+	auto iter = sessionMap.find(user.GetId());
+	return (iter == sessionMap.end()) ? KeyStatus::UNDEFINED : iter->second->TryGetKeyView(view, hmacs);
+}
+
 opendnp3::KeyStatus SessionStore::GetSessionKeyStatus(const User& user)
 {
 	auto iter = sessionMap.find(user.GetId());
 	if (iter == sessionMap.end())
 	{
 		// initialize new session info
-		sessionMap[user.GetId()] = std::unique_ptr<Session>(new Session(*pTimeSource, sessionKeyValidity, maxAuthMessageCount));
+		sessionMap[user.GetId()] = std::unique_ptr<Session>(new Session(*pTimeSource, sessionKeyValidity, maxAuthMessageCount, pHMAC));
 		return KeyStatus::NOT_INIT;
 	}
 	else
@@ -42,7 +42,8 @@ public:
 	SessionStore(
 	    openpal::IMonotonicTimeSource& timeSource,
 	    openpal::TimeDuration sessionKeyValidity,
-	    uint32_t maxAuthMessageCount
+	    uint32_t maxAuthMessageCount,
+	    HMACProvider* pHMAC = nullptr
 	);
 
 	void SetSessionKeys(const opendnp3::User& user, const SessionKeysView& view);
@@ -50,6 +51,9 @@ public:
 	// Session keys are only set if KeyStatus == OK
 	opendnp3::KeyStatus TryGetSessionKeys(const opendnp3::User& user, SessionKeysView& view);
 
+	// Also retrieves the keyed control HMAC context if the store was given an HMACProvider
+	opendnp3::KeyStatus TryGetSessionKeys(const opendnp3::User& user, SessionKeysView& view, SessionHMACs& hmacs);
+
 	// Retrieves the session key status for a user. Creates a new session if no info exists.
 	opendnp3::KeyStatus GetSessionKeyStatus(const opendnp3::User& user);
 
@@ -68,6 +72,7 @@ private:
 	openpal::IMonotonicTimeSource* pTimeSource;
 	openpal::TimeDuration sessionKeyValidity;
 	uint32_t maxAuthMessageCount;
+	HMACProvider* pHMAC;
 
 	std::map<uint16_t, std::unique_ptr<Session>> sessionMap;
 };
@@ -77,7 +77,7 @@ void MAuthContext::InitSessionKeyTaskForUser(const User& user)
 	}
 	else
 	{
-		iter->second->Demand();
+		this->scheduler.Demand(*iter->second);
 	}
 }
 
@@ -95,7 +95,7 @@ bool ChallengeState::WriteChallenge(
 	return true;
 }
 
-bool ChallengeState::VerifyAuthenticity(const openpal::RSlice& key, HMACProvider& provider, const openpal::RSlice& hmac, openpal::Logger logger)
+bool ChallengeState::VerifyAuthenticity(const openpal::RSlice& key, openpal::IKeyedHMAC* pKeyed, HMACProvider& provider, const openpal::RSlice& hmac, openpal::Logger logger)
 {
 	if (provider.OutputSize() != hmac.Size())
 	{
@@ -105,7 +105,7 @@ bool ChallengeState::VerifyAuthenticity(const openpal::RSlice& key, HMACProvider
 
 	// calculate the hmac we expect
 	std::error_code ec;
-	auto hmacCalc = provider.Compute(key, { challengeFragment, criticalASDU.GetFragment() }, ec);
+	auto hmacCalc = provider.Compute(pKeyed, key, { challengeFragment, criticalASDU.GetFragment() }, ec);
 
 	if (ec)
 	{
@@ -51,8 +51,10 @@ public:
 	    openpal::Logger* pLogger
 	);
 
+	// pKeyed is an optional keyed HMAC context for 'key'
 	bool VerifyAuthenticity(
 	    const openpal::RSlice& key,
+	    openpal::IKeyedHMAC* pKeyed,
 	    HMACProvider& provider,
 	    const openpal::RSlice& hmac,
 	    openpal::Logger logger
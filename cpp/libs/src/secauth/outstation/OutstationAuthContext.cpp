@@ -239,8 +239,9 @@ OAuthContext::APDUResult OAuthContext::ProcessChallengeReply(const openpal::RSli
 	// first look-up the session for the specified user
 	User user(reply.userNum);
 	SessionKeysView keys;
+	SessionHMACs hmacs;
 
-	if (security.sessions.TryGetSessionKeys(user, keys) != KeyStatus::OK)
+	if (security.sessions.TryGetSessionKeys(user, keys, hmacs) != KeyStatus::OK)
 	{
 		++(this->security.otherStats.authFailuresDueToExpiredKeys);
 		this->Increment(SecurityStatIndex::AUTHENTICATION_FAILURES);
@@ -248,7 +249,7 @@ OAuthContext::APDUResult OAuthContext::ProcessChallengeReply(const openpal::RSli
 		return this->TryRespondWithAuthError(header.control.SEQ, reply.challengeSeqNum, user, AuthErrorCode::AUTHENTICATION_FAILED);
 	}
 
-	if (!security.challenge.VerifyAuthenticity(keys.controlKey, security.hmac, reply.hmacValue, this->logger))
+	if (!security.challenge.VerifyAuthenticity(keys.controlKey, hmacs.pControl, security.hmac, reply.hmacValue, this->logger))
 	{
 		this->Increment(SecurityStatIndex::AUTHENTICATION_FAILURES);
 		FORMAT_LOG_BLOCK(this->logger, flags::WARN, "Authentication failure for user %u", user.GetId());
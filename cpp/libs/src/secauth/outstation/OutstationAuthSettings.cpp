@@ -37,7 +37,8 @@ OutstationAuthSettings::OutstationAuthSettings() :
 	hmacMode(HMACMode::SHA256_TRUNC_16), // strongest by default
 	functions(CriticalFunctions::AuthEverything()),
 	maxAuthMsgCount(AuthConstants::DEFAULT_SESSION_KEY_MAX_AUTH_COUNT),
-	sessionKeyTimeout(openpal::TimeDuration::Minutes(AuthConstants::DEFAULT_SESSION_KEY_CHANGE_MINUTES))
+	sessionKeyTimeout(openpal::TimeDuration::Minutes(AuthConstants::DEFAULT_SESSION_KEY_CHANGE_MINUTES)),
+	cacheKeyedHMACs(false)
 {}
 
 }
@@ -42,7 +42,7 @@ OutstationSecurity::OutstationSecurity(
 	pCrypto(&crypto),
 	sessionKeyChangeState(settings.sessionKeyChangeChallengeSize, logger, crypto),
 	updateKeyChangeState(settings.updateKeyChangeChallengeSize, logger, crypto),
-	sessions(executor, settings.sessionKeyTimeout, settings.maxAuthMsgCount),
+	sessions(executor, settings.sessionKeyTimeout, settings.maxAuthMsgCount, settings.cacheKeyedHMACs ? &hmac : nullptr),
 	txBuffer(params.maxTxFragSize)
 {
 
@@ -29,7 +29,13 @@
 
 #include <opendnp3/LogLevels.h>
 
+#include <testlib/StopWatch.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
 #include <thread>
+#include <vector>
 
 using namespace std;
 using namespace boost;
@@ -96,3 +102,148 @@ TEST_CASE(SUITE("StrandsSequenceCallbacksViaStrandWrap"))
 
 
 
+
+TEST_CASE(SUITE("ShardedPoolAssignsShardsRoundRobin"))
+{
+	IOServiceThreadPool pool(&ConsoleLogger::Instance(), levels::NORMAL, 4, []() {}, []() {}, ThreadPoolMode::SHARDED);
+	REQUIRE(pool.NumShards() == 4);
+
+	std::vector<io_service*> services;
+	for (int i = 0; i < 8; ++i) services.push_back(&pool.Acquire());
+
+	for (uint32_t i = 0; i < 4; ++i)
+	{
+		REQUIRE(pool.GetLoad(i) == 2);
+		REQUIRE(services[i] == services[i + 4]);
+		REQUIRE(services[i] != services[(i + 1) % 4]);
+	}
+
+	for (auto pService : services) pool.Release(*pService);
+	for (uint32_t i = 0; i < 4; ++i) REQUIRE(pool.GetLoad(i) == 0);
+}
+
+TEST_CASE(SUITE("ShardedPoolAssignsLeastLoadedShard"))
+{
+	IOServiceThreadPool pool(&ConsoleLogger::Instance(), levels::NORMAL, 3, []() {}, []() {}, ThreadPoolMode::SHARDED, ShardSelection::LEAST_LOADED);
+
+	auto& s1 = pool.Acquire();
+	auto& s2 = pool.Acquire();
+	auto& s3 = pool.Acquire();
+	REQUIRE(&s1 != &s2);
+	REQUIRE(&s2 != &s3);
+
+	pool.Release(s2);
+	REQUIRE(&pool.Acquire() == &s2);
+}
+
+TEST_CASE(SUITE("SharedPoolHasOneShard"))
+{
+	IOServiceThreadPool pool(&ConsoleLogger::Instance(), levels::NORMAL, 4);
+	REQUIRE(pool.NumShards() == 1);
+	REQUIRE(&pool.Acquire() == &pool.GetIOService());
+	REQUIRE(&pool.Acquire() == &pool.GetIOService());
+}
+
+TEST_CASE(SUITE("ExecutorOnShardRunsOnOneThreadWithoutStrand"))
+{
+	IOServiceThreadPool pool(&ConsoleLogger::Instance(), levels::NORMAL, 4, []() {}, []() {}, ThreadPoolMode::SHARDED);
+	ASIOExecutor executor(pool.Acquire());
+
+	REQUIRE_FALSE(executor.RunningInThisThread());
+
+	const int NUM_POSTERS = 4;
+	const int NUM_POSTS = 10000;
+
+	int count = 0;
+	bool inThread = true;
+	std::thread::id runner;
+	bool sameThread = true;
+
+	auto post = [&]()
+	{
+		for (int i = 0; i < NUM_POSTS; ++i)
+		{
+			executor.Enqueue([&]()
+			{
+				++count;
+				inThread = inThread && executor.RunningInThisThread();
+				if (runner == std::thread::id()) runner = std::this_thread::get_id();
+				sameThread = sameThread && (runner == std::this_thread::get_id());
+			});
+		}
+	};
+
+	std::vector<std::thread*> posters;
+	for (int i = 0; i < NUM_POSTERS; ++i) posters.push_back(new std::thread(post));
+	for (auto pThread : posters)
+	{
+		pThread->join();
+		delete pThread;
+	}
+
+	auto result = executor.ReturnBlockFor<int>([&]()
+	{
+		return count;
+	});
+
+	REQUIRE(result == NUM_POSTERS * NUM_POSTS);
+	REQUIRE(inThread);
+	REQUIRE(sameThread);
+
+	// timers complete through the executor as well
+	std::atomic<bool> expired(false);
+	auto onExpiration = [&]()
+	{
+		expired = executor.RunningInThisThread();
+	};
+	executor.BlockFor([&]()
+	{
+		executor.Start(TimeDuration::Milliseconds(1), Action0::Bind(onExpiration));
+	});
+	executor.WaitForShutdown();
+	REQUIRE(expired);
+}
+
+TEST_CASE(SUITE("Posts per second to many executors in shared and sharded mode"), "[.][benchmark]")
+{
+	const uint32_t NUM_THREADS = 4;
+	const uint32_t NUM_EXECUTORS = 1000;
+	const uint32_t NUM_POSTS = 1000;
+
+	auto run = [&](ThreadPoolMode mode, const char* name)
+	{
+		IOServiceThreadPool pool(&ConsoleLogger::Instance(), levels::NORMAL, NUM_THREADS, []() {}, []() {}, mode);
+
+		std::vector<ASIOExecutor*> executors;
+		std::vector<uint32_t> counts(NUM_EXECUTORS, 0);
+		for (uint32_t i = 0; i < NUM_EXECUTORS; ++i) executors.push_back(new ASIOExecutor(pool.Acquire()));
+
+		testlib::StopWatch sw;
+
+		for (uint32_t i = 0; i < NUM_POSTS; ++i)
+		{
+			for (uint32_t j = 0; j < NUM_EXECUTORS; ++j)
+			{
+				auto pCount = &counts[j];
+				executors[j]->Enqueue([pCount]()
+				{
+					++(*pCount);
+				});
+			}
+		}
+
+		for (auto pExecutor : executors) pExecutor->BlockFor([]() {});
+
+		auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(sw.Elapsed()).count();
+
+		for (uint32_t j = 0; j < NUM_EXECUTORS; ++j) REQUIRE(counts[j] == NUM_POSTS);
+
+		std::cout << name << ": " << (NUM_EXECUTORS * NUM_POSTS * 1000000ull / (elapsed ? elapsed : 1)) << " posts/sec" << std::endl;
+
+		pool.Shutdown();
+		for (auto pExecutor : executors) delete pExecutor;
+	};
+
+	run(ThreadPoolMode::SHARED, "shared");
+	run(ThreadPoolMode::SHARDED, "sharded");
+}
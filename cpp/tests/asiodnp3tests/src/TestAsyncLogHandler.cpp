@@ -0,0 +1,335 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include <asiopal/AsyncLogHandler.h>
+#include <asiopal/LogFanoutHandler.h>
+
+#include <openpal/logging/LogRoot.h>
+#include <openpal/logging/LogMacros.h>
+#include <openpal/container/RSlice.h>
+
+#include <testlib/StopWatch.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace openpal;
+using namespace asiopal;
+
+#define SUITE(name) "AsyncLogHandlerTestSuite - " name
+
+namespace
+{
+
+class RecordingHandler : public ILogHandler
+{
+public:
+
+	virtual void Log(const LogEntry& entry) override
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		aliases.push_back(entry.GetAlias());
+		messages.push_back(entry.GetMessage());
+		timestamps.push_back(entry.GetTimestamp());
+	}
+
+	std::mutex mutex;
+	std::vector<std::string> aliases;
+	std::vector<std::string> messages;
+	std::vector<uint64_t> timestamps;
+};
+
+class BlockingHandler : public ILogHandler
+{
+public:
+
+	BlockingHandler() : entered(false), released(false)
+	{}
+
+	virtual void Log(const LogEntry& entry) override
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		entered = true;
+		condition.notify_all();
+		condition.wait(lock, [this]()
+		{
+			return released;
+		});
+	}
+
+	void WaitForEntry()
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		condition.wait(lock, [this]()
+		{
+			return entered;
+		});
+	}
+
+	void Release()
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		released = true;
+		condition.notify_all();
+	}
+
+private:
+
+	std::mutex mutex;
+	std::condition_variable condition;
+	bool entered;
+	bool released;
+};
+
+class CountingHandler : public ILogHandler
+{
+public:
+
+	CountingHandler() : count(0)
+	{}
+
+	virtual void Log(const LogEntry& entry) override
+	{
+		count += entry.GetMessage()[0] ? 1 : 0;
+	}
+
+	std::atomic<uint64_t> count;
+};
+
+}
+
+TEST_CASE(SUITE("Formats and delivers messages on the background thread"))
+{
+	RecordingHandler recorder;
+	AsyncLogHandler handler;
+	handler.Subscribe(&recorder);
+
+	{
+		// the root and its alias are destroyed before the messages are delivered
+		LogRoot root(&handler, "outstation", ~0);
+		auto logger = root.GetLogger();
+
+		char name[16] = "group30";
+		FORMAT_LOG_BLOCK(logger, 1, "%s var %u", name, 5u);
+		name[0] = 'X';
+		SIMPLE_LOG_BLOCK(logger, 1, "plain");
+		uint8_t bytes[] = { 0xC0, 0x01 };
+		FORMAT_HEX_BLOCK(logger, 1, RSlice(bytes, 2), 10, 10);
+	}
+
+	handler.Flush();
+
+	REQUIRE(recorder.messages.size() == 3);
+	REQUIRE(recorder.messages[0] == "group30 var 5");
+	REQUIRE(recorder.messages[1] == "plain");
+	REQUIRE(recorder.messages[2] == "C0 01 ");
+	for (auto& alias : recorder.aliases) REQUIRE(alias == "outstation");
+	for (auto timestamp : recorder.timestamps) REQUIRE(timestamp > 0);
+	REQUIRE(handler.GetNumDelivered() == 3);
+	REQUIRE(handler.GetNumDropped() == 0);
+}
+
+TEST_CASE(SUITE("Counts records that don't fit in the ring instead of blocking"))
+{
+	const uint32_t RING_SIZE = 4;
+
+	BlockingHandler blocker;
+	AsyncLogHandler handler(RING_SIZE);
+	handler.Subscribe(&blocker);
+
+	LogRoot root(&handler, "root", ~0);
+	auto logger = root.GetLogger();
+
+	SIMPLE_LOG_BLOCK(logger, 1, "first");
+	blocker.WaitForEntry();
+
+	// the record being delivered still occupies its slot
+	for (int i = 0; i < 13; ++i)
+	{
+		FORMAT_LOG_BLOCK(logger, 1, "message %i", i);
+	}
+
+	REQUIRE(handler.GetNumDropped() == 10);
+
+	blocker.Release();
+	handler.Flush();
+	REQUIRE(handler.GetNumDelivered() == 4);
+}
+
+TEST_CASE(SUITE("Preserves the order of each producing thread"))
+{
+	const int NUM_THREADS = 4;
+	const int NUM_MESSAGES = 1000;
+
+	RecordingHandler recorder;
+	AsyncLogHandler handler(NUM_MESSAGES);
+	handler.Subscribe(&recorder);
+
+	LogRoot root(&handler, "root", ~0);
+
+	std::vector<std::thread*> threads;
+	for (int t = 0; t < NUM_THREADS; ++t)
+	{
+		threads.push_back(new std::thread([&root, t]()
+		{
+			auto logger = root.GetLogger();
+			for (int i = 0; i < NUM_MESSAGES; ++i)
+			{
+				FORMAT_LOG_BLOCK(logger, 1, "%i %i", t, i);
+			}
+		}));
+	}
+
+	for (auto pThread : threads)
+	{
+		pThread->join();
+		delete pThread;
+	}
+
+	handler.Flush();
+
+	REQUIRE(handler.GetNumDropped() == 0);
+	REQUIRE(recorder.messages.size() == NUM_THREADS * NUM_MESSAGES);
+
+	std::vector<int> next(NUM_THREADS, 0);
+	for (auto& message : recorder.messages)
+	{
+		int t = 0;
+		int i = 0;
+		REQUIRE(sscanf(message.c_str(), "%i %i", &t, &i) == 2);
+		REQUIRE(i == next[t]);
+		++next[t];
+	}
+}
+
+TEST_CASE(SUITE("Reuses the ring of a thread that exited"))
+{
+	const uint32_t NUM_THREADS = 3 * AsyncLogHandler::MAX_PRODUCERS;
+
+	CountingHandler counter;
+	AsyncLogHandler handler;
+	handler.Subscribe(&counter);
+
+	LogRoot root(&handler, "root", ~0);
+
+	for (uint32_t i = 0; i < NUM_THREADS; ++i)
+	{
+		std::thread thread([&root, i]()
+		{
+			FORMAT_LOG_BLOCK(root.GetLogger(), 1, "thread %u", i);
+		});
+		thread.join();
+
+		// a released ring is only reused once its records are delivered
+		handler.Flush();
+	}
+
+	REQUIRE(handler.GetNumRings() == 1);
+	REQUIRE(counter.count == NUM_THREADS);
+	REQUIRE(handler.GetNumDropped() == 0);
+}
+
+TEST_CASE(SUITE("Long aliases are delivered in full"))
+{
+	RecordingHandler recorder;
+	AsyncLogHandler handler;
+	handler.Subscribe(&recorder);
+
+	const std::string longAlias(200, 'a');
+	const std::string shortAlias(3, 'b');
+
+	{
+		LogRoot longRoot(&handler, longAlias.c_str(), ~0);
+		LogRoot shortRoot(&handler, shortAlias.c_str(), ~0);
+		SIMPLE_LOG_BLOCK(longRoot.GetLogger(), 1, "long");
+		SIMPLE_LOG_BLOCK(shortRoot.GetLogger(), 1, "short");
+	}
+
+	// the roots and their aliases are gone before the records are delivered
+	handler.Flush();
+
+	REQUIRE(recorder.aliases.size() == 2);
+	REQUIRE(recorder.aliases[0] == longAlias);
+	REQUIRE(recorder.aliases[1] == shortAlias);
+}
+
+TEST_CASE(SUITE("Log calls per second on the protocol thread, synchronous vs asynchronous"), "[.][benchmark]")
+{
+	const uint32_t NUM_MESSAGES = 200000;
+	uint8_t frame[] = { 0x05, 0x64, 0x12, 0xC4, 0x01, 0x00, 0x0A, 0x00, 0xDE, 0xAD, 0xC0, 0xC1, 0x01, 0x3C, 0x02, 0x06, 0x3C, 0x03, 0x06, 0x3C };
+
+	auto run = [&](ILogHandler & target, const char* name, const std::function<void()>& release)
+	{
+		LogRoot root(&target, "channel", ~0);
+		auto logger = root.GetLogger();
+
+		testlib::StopWatch sw;
+		for (uint32_t i = 0; i < NUM_MESSAGES; ++i)
+		{
+			FORMAT_LOG_BLOCK(logger, 1, "FIR: %u FIN: %u SEQ: %u LEN: %u", 1u, 1u, i % 64, 20u);
+			FORMAT_HEX_BLOCK(logger, 1, RSlice(frame, sizeof(frame)), 10, 18);
+		}
+		auto caller = std::chrono::duration_cast<std::chrono::microseconds>(sw.Elapsed()).count();
+		release();
+		auto total = std::chrono::duration_cast<std::chrono::microseconds>(sw.Elapsed()).count();
+
+		std::cout << name << ": " << (NUM_MESSAGES * 1000000ull / (caller ? caller : 1)) << " calls/sec on the caller, "
+		          << (NUM_MESSAGES * 1000000ull / (total ? total : 1)) << " calls/sec delivered" << std::endl;
+	};
+
+	{
+		CountingHandler counter;
+		LogFanoutHandler fanout;
+		fanout.Subscribe(&counter);
+		run(fanout, "synchronous fanout", []() {});
+		REQUIRE(counter.count == 3 * NUM_MESSAGES);
+	}
+
+	{
+		// the consumer is stalled while the caller is timed, so the first number is the cost of the call alone
+		BlockingHandler blocker;
+		CountingHandler counter;
+		AsyncLogHandler async(4 * NUM_MESSAGES);
+		async.Subscribe(&blocker);
+		async.Subscribe(&counter);
+
+		LogRoot root(&async, "stall", ~0);
+		SIMPLE_LOG_BLOCK(root.GetLogger(), 1, "stall");
+		blocker.WaitForEntry();
+
+		run(async, "asynchronous", [&]()
+		{
+			blocker.Release();
+			async.Flush();
+		});
+		REQUIRE(async.GetNumDropped() == 0);
+		REQUIRE(counter.count == (3 * NUM_MESSAGES + 1));
+	}
+}
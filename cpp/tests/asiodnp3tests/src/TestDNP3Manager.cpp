@@ -29,15 +29,22 @@
 #include <opendnp3/master/ISOEHandler.h>
 
 #include <asiopal/UTCTimeSource.h>
+#include <asiopal/Synchronized.h>
 
 #include <dnp3mocks/NullSOEHandler.h>
 
+#include <testlib/StopWatch.h>
+
 #include <thread>
+#include <mutex>
+#include <set>
+#include <iostream>
 
 using namespace opendnp3;
 using namespace asiodnp3;
 using namespace asiopal;
 using namespace openpal;
+using namespace testlib;
 
 #define SUITE(name) "DNP3ManagerTestSuite - " name
 
@@ -115,7 +122,204 @@ TEST_CASE(SUITE("ManualChannelShutdown"))
 	}
 }
 
+TEST_CASE(SUITE("AsyncMethodsCallBackOnTheExecutor"))
+{
+	std::mutex mutex;
+	std::set<std::thread::id> poolThreads;
+
+	auto onThreadStart = [&]()
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		poolThreads.insert(std::this_thread::get_id());
+	};
+
+	auto onExecutor = [&]() -> bool
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		return poolThreads.count(std::this_thread::get_id()) > 0;
+	};
+
+	DNP3Manager manager(std::thread::hardware_concurrency(), nullptr, onThreadStart);
+
+	auto pClient = manager.AddTCPClient("client", levels::NORMAL, ChannelRetry::Default(), "127.0.0.1", "", 20000);
+
+	IMaster* pMaster = nullptr;
+	Synchronized<bool> added;
+	pClient->AddMasterAsync("master", NullSOEHandler::Instance(), asiodnp3::DefaultMasterApplication::Instance(), MasterStackConfig(), [&](IMaster * master)
+	{
+		pMaster = master;
+		added.SetValue(onExecutor());
+	});
+	REQUIRE(added.WaitForValue());
+	REQUIRE(pMaster != nullptr);
+
+	Synchronized<bool> enabled;
+	pMaster->EnableAsync([&](bool result)
+	{
+		enabled.SetValue(result && onExecutor());
+	});
+	REQUIRE(enabled.WaitForValue());
+
+	Synchronized<bool> scanned;
+	pMaster->AddClassScanAsync(ClassField::AllClasses(), TimeDuration::Minutes(1), [&](const MasterScan&)
+	{
+		scanned.SetValue(onExecutor());
+	});
+	REQUIRE(scanned.WaitForValue());
+
+	Synchronized<bool> read;
+	pClient->GetChannelStatisticsAsync([&](const LinkChannelStatistics&)
+	{
+		read.SetValue(onExecutor());
+	});
+	REQUIRE(read.WaitForValue());
+
+	Synchronized<bool> readMultidrop;
+	pClient->GetMultidropStatisticsAsync([&](const MultidropStatistics&)
+	{
+		readMultidrop.SetValue(onExecutor());
+	});
+	REQUIRE(readMultidrop.WaitForValue());
+
+	pClient->Shutdown();
+}
+
+TEST_CASE(SUITE("AddMastersReturnsNullForRoutesInUse"))
+{
+	DNP3Manager manager(std::thread::hardware_concurrency());
+
+	auto pClient = manager.AddTCPClient("client", levels::NORMAL, ChannelRetry::Default(), "127.0.0.1", "", 20000);
+
+	MasterStackConfig config;
+	std::vector<MasterSpec> specs;
+	specs.push_back(MasterSpec("master1", NullSOEHandler::Instance(), asiodnp3::DefaultMasterApplication::Instance(), config));
+	config.link.RemoteAddr = 2;
+	specs.push_back(MasterSpec("master2", NullSOEHandler::Instance(), asiodnp3::DefaultMasterApplication::Instance(), config));
+	specs.push_back(MasterSpec("master3", NullSOEHandler::Instance(), asiodnp3::DefaultMasterApplication::Instance(), config));
+
+	auto masters = pClient->AddMasters(specs);
+	REQUIRE(masters.size() == 3);
+	REQUIRE(masters[0] != nullptr);
+	REQUIRE(masters[1] != nullptr);
+	REQUIRE(masters[2] == nullptr);
+}
+
+TEST_CASE(SUITE("Master startup time"), "[.][benchmark]")
+{
+	const uint16_t NUM_MASTERS = 3000;
+
+	auto run = [](bool bulk)
+	{
+		DNP3Manager manager(std::thread::hardware_concurrency());
+		auto pClient = manager.AddTCPClient("client", levels::NOTHING, ChannelRetry::Default(), "127.0.0.1", "", 20000);
+
+		std::vector<MasterSpec> specs;
+		for (uint16_t i = 0; i < NUM_MASTERS; ++i)
+		{
+			MasterStackConfig config;
+			config.link.RemoteAddr = i;
+			specs.push_back(MasterSpec("master", NullSOEHandler::Instance(), asiodnp3::DefaultMasterApplication::Instance(), config));
+		}
+
+		StopWatch sw;
+		if (bulk)
+		{
+			pClient->AddMasters(specs);
+		}
+		else
+		{
+			for (auto& spec : specs)
+			{
+				pClient->AddMaster(spec.id.c_str(), *spec.pSOEHandler, *spec.pApplication, spec.config);
+			}
+		}
+		auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(sw.Elapsed()).count();
+
+		std::cout << NUM_MASTERS << " masters via " << (bulk ? "AddMasters" : "AddMaster") << ": " << ms << " ms" << std::endl;
+	};
+
+	run(false);
+	run(true);
+}
+
+TEST_CASE(SUITE("LogMessagesAreOnlyDeliveredFromABackgroundThreadWhenAsyncLoggingIsEnabled"))
+{
+	class ThreadRecorder : public ILogHandler
+	{
+	public:
+
+		virtual void Log(const LogEntry& entry) override final
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			threads.insert(std::this_thread::get_id());
+		}
+
+		std::mutex mutex;
+		std::set<std::thread::id> threads;
+	};
+
+	auto run = [](bool asyncLogging)
+	{
+		std::mutex mutex;
+		std::set<std::thread::id> callers = { std::this_thread::get_id() };
+		auto onThreadStart = [&]()
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			callers.insert(std::this_thread::get_id());
+		};
+
+		ThreadRecorder recorder;
+
+		{
+			DNP3Manager manager(std::thread::hardware_concurrency(), nullptr, onThreadStart, []() {}, ThreadPoolMode::SHARED, ShardSelection::ROUND_ROBIN, asyncLogging);
+			manager.AddLogSubscriber(&recorder);
+			manager.AddTCPServer("server", levels::ALL, ChannelRetry::Default(), "127.0.0.1", 20000);
+			manager.Shutdown();
+		}
+
+		REQUIRE_FALSE(recorder.threads.empty());
+		for (auto& id : recorder.threads)
+		{
+			REQUIRE((callers.count(id) == 0) == asyncLogging);
+		}
+	};
+
+	run(false);
+	run(true);
+}
+
+TEST_CASE(SUITE("StackMetricsAreReadableWithoutTheExecutor"))
+{
+	DNP3Manager manager(std::thread::hardware_concurrency());
+
+	auto pClient = manager.AddTCPClient("client", levels::NORMAL, ChannelRetry::Default(), "127.0.0.1", "127.0.0.1", 20000);
+	auto pServer = manager.AddTCPServer("server", levels::NORMAL, ChannelRetry::Default(), "0.0.0.0", 20000);
 
+	auto pOutstation = pServer->AddOutstation("outstation", SuccessCommandHandler::Instance(), DefaultOutstationApplication::Instance(), OutstationStackConfig(DatabaseTemplate::AllTypes(5)));
+	MasterStackConfig config;
+	config.metrics.recordStrandQueueDelay = true;
+	auto pMaster = pClient->AddMaster("master", NullSOEHandler::Instance(), asiodnp3::DefaultMasterApplication::Instance(), config);
 
+	pOutstation->Enable();
+	pMaster->Enable();
 
+	// the startup integrity poll completes a round trip
+	StopWatch sw;
+	while (pMaster->GetStackMetrics().GetTaskRoundTrip(MasterTaskType::STARTUP_INTEGRITY_POLL).count == 0)
+	{
+		REQUIRE(sw.Elapsed(false) < std::chrono::seconds(10));
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
 
+	auto master = pMaster->GetStackMetrics();
+	REQUIRE(master.strandQueueDelay.count > 0);
+	REQUIRE(master.readHandling.count == 0);
+
+	// the outstation's channel doesn't record the strand queue delay unless asked to
+	auto outstation = pOutstation->GetStackMetrics();
+	REQUIRE(outstation.readHandling.count > 0);
+	REQUIRE(outstation.strandQueueDelay.count == 0);
+
+	pClient->Shutdown();
+	pServer->Shutdown();
+}
@@ -21,6 +21,10 @@
 #include <catch.hpp>
 
 #include <functional>
+#include <vector>
+#include <memory>
+#include <chrono>
+#include <iostream>
 
 #include <openpal/util/ToHex.h>
 #include <openpal/container/Buffer.h>
@@ -33,6 +37,7 @@
 
 #include <testlib/BufferHelpers.h>
 #include <testlib/HexConversions.h>
+#include <testlib/StopWatch.h>
 
 using namespace opendnp3;
 using namespace openpal;
@@ -219,3 +224,74 @@ TEST_CASE(SUITE("LinkLayerRouterClearsBufferOnLowerLayerDown"))
 	REQUIRE(1 ==  mfs.m_num_frames);
 }
 
+/// Test that frames are delivered to the correct session and routes can be reused after removal
+TEST_CASE(SUITE("RoutesFramesToManySessions"))
+{
+	LinkLayerRouterTest t;
+	MockFrameSink mfs1;
+	MockFrameSink mfs2;
+
+	REQUIRE(t.router.AddContext(&mfs1, Route(1, 1024)));
+	REQUIRE(t.router.AddContext(&mfs2, Route(1, 2048)));
+	REQUIRE(t.router.Enable(&mfs1));
+	REQUIRE(t.router.Enable(&mfs2));
+	t.phys.SignalOpenSuccess();
+
+	Buffer buffer(292);
+	auto writeTo = buffer.GetWSlice();
+	t.phys.TriggerRead(ToHex(LinkFrame::FormatAck(writeTo, true, false, 2048, 1, nullptr)));
+	REQUIRE(mfs1.m_num_frames == 0);
+	REQUIRE(mfs2.m_num_frames == 1);
+
+	REQUIRE(t.router.Disable(&mfs2));
+	writeTo = buffer.GetWSlice();
+	t.phys.TriggerRead(ToHex(LinkFrame::FormatAck(writeTo, true, false, 2048, 1, nullptr)));
+	REQUIRE(mfs2.m_num_frames == 1);
+	REQUIRE(t.log.NextErrorCode() == DLERR_UNKNOWN_ROUTE);
+
+	REQUIRE(t.router.Remove(&mfs2));
+	REQUIRE_FALSE(t.router.IsRouteInUse(Route(1, 2048)));
+	REQUIRE(t.router.AddContext(&mfs2, Route(1, 2048)));
+	REQUIRE(t.router.IsRouteInUse(Route(1, 2048)));
+}
+
+TEST_CASE(SUITE("Frames per second routed to many sessions"), "[.][benchmark]")
+{
+	const uint32_t NUM_FRAMES = 1000000;
+
+	for (uint16_t numSessions : { 1, 16, 256 })
+	{
+		LinkLayerRouterTest t;
+		std::vector<std::unique_ptr<MockFrameSink>> sessions;
+
+		for (uint16_t i = 0; i < numSessions; ++i)
+		{
+			sessions.push_back(std::unique_ptr<MockFrameSink>(new MockFrameSink()));
+			REQUIRE(t.router.AddContext(sessions.back().get(), Route(1, 1024 + i)));
+			REQUIRE(t.router.Enable(sessions.back().get()));
+		}
+
+		t.phys.SignalOpenSuccess();
+
+		RSlice empty;
+		testlib::StopWatch sw;
+
+		for (uint32_t i = 0; i < NUM_FRAMES; ++i)
+		{
+			uint16_t dest = 1024 + (i % numSessions);
+			LinkHeaderFields header(LinkFunction::SEC_ACK, false, false, false, dest, 1);
+			t.router.OnFrame(header, empty);
+		}
+
+		auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(sw.Elapsed()).count();
+
+		size_t total = 0;
+		for (auto& session : sessions)
+		{
+			total += session->m_num_frames;
+		}
+		REQUIRE(total == NUM_FRAMES);
+
+		std::cout << numSessions << " sessions: " << (NUM_FRAMES * 1000000ull / (elapsed ? elapsed : 1)) << " frames/sec" << std::endl;
+	}
+}
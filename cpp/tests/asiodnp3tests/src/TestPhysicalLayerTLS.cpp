@@ -0,0 +1,141 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifdef OPENDNP3_USE_TLS
+
+#include <catch.hpp>
+#include <asio.hpp>
+
+#include <asiopal/tls/PhysicalLayerTLSClient.h>
+#include <asiopal/tls/PhysicalLayerTLSServer.h>
+#include <asiopal/tls/TLSContextCache.h>
+
+#include <opendnp3/LogLevels.h>
+
+#include <dnp3mocks/MockUpperLayer.h>
+#include <dnp3mocks/LowerLayerToPhysAdapter.h>
+
+#include <testlib/MockLogHandler.h>
+#include <testlib/BufferHelpers.h>
+
+#include "mocks/TestObjectASIO.h"
+#include "mocks/TLSTestConfig.h"
+
+using namespace opendnp3;
+using namespace openpal;
+using namespace asiopal;
+using namespace testlib;
+
+#define SUITE(name) "PhysicalLayerTLSSuite - " name
+
+namespace
+{
+	class TLSTestObject : public TestObjectASIO
+	{
+	public:
+
+		TLSTestObject(TLSContextCache& cache, const TLSConfig& config) :
+			client(log.root, GetService(), "127.0.0.1", "127.0.0.1", 50001, cache.Get(config, TLSRole::CLIENT)),
+			server(log.root, GetService(), "127.0.0.1", 50001, cache.Get(config, TLSRole::SERVER)),
+			clientAdapter(log.GetLogger(), &client, true),
+			serverAdapter(log.GetLogger(), &server, true)
+		{
+			client.SetChannelStatistics(&clientStats);
+			server.SetChannelStatistics(&serverStats);
+
+			clientAdapter.SetUpperLayer(clientUpper);
+			serverAdapter.SetUpperLayer(serverUpper);
+
+			clientUpper.SetLowerLayer(clientAdapter);
+			serverUpper.SetLowerLayer(serverAdapter);
+		}
+
+		MockLogHandler log;
+
+		ChannelStatistics clientStats;
+		ChannelStatistics serverStats;
+
+		PhysicalLayerTLSClient client;
+		PhysicalLayerTLSServer server;
+
+		LowerLayerToPhysAdapter clientAdapter;
+		LowerLayerToPhysAdapter serverAdapter;
+
+		MockUpperLayer clientUpper;
+		MockUpperLayer serverUpper;
+	};
+}
+
+TEST_CASE(SUITE("CacheSharesContextsByConfigAndRole"))
+{
+	TLSContextCache cache;
+	auto config = GetTestTLSConfig();
+
+	auto client1 = cache.Get(config, TLSRole::CLIENT);
+	auto client2 = cache.Get(config, TLSRole::CLIENT);
+	auto server = cache.Get(config, TLSRole::SERVER);
+
+	REQUIRE(client1 == client2);
+	REQUIRE(client1 != server);
+	REQUIRE(cache.NumContexts() == 2);
+
+	config.allowTLSv10 = false;
+	auto client3 = cache.Get(config, TLSRole::CLIENT);
+	REQUIRE(client3 != client1);
+	REQUIRE(cache.NumContexts() == 3);
+
+	client1.reset();
+	client2.reset();
+	REQUIRE(cache.NumContexts() == 2);
+}
+
+TEST_CASE(SUITE("ReconnectResumesSession"))
+{
+	TLSContextCache cache;
+	TLSTestObject t(cache, GetTestTLSConfig());
+
+	const uint32_t NUM_CONNECTIONS = 3;
+	ByteStr bs(64, 77);
+
+	for (uint32_t i = 0; i < NUM_CONNECTIONS; ++i)
+	{
+		t.server.BeginOpen();
+		t.client.BeginOpen();
+		REQUIRE(t.ProceedUntil(std::bind(&MockUpperLayer::IsOnline, &t.serverUpper)));
+		REQUIRE(t.ProceedUntil(std::bind(&MockUpperLayer::IsOnline, &t.clientUpper)));
+
+		// exchange data so that sessions issued after the handshake reach the client
+		t.clientUpper.SendDown(bs.ToRSlice());
+		t.serverUpper.SendDown(bs.ToRSlice());
+		REQUIRE(t.ProceedUntil(std::bind(&MockUpperLayer::SizeEquals, &t.serverUpper, bs.Size() * (i + 1))));
+		REQUIRE(t.ProceedUntil(std::bind(&MockUpperLayer::SizeEquals, &t.clientUpper, bs.Size() * (i + 1))));
+
+		t.client.BeginClose();
+		REQUIRE(t.ProceedUntilFalse(std::bind(&MockUpperLayer::IsOnline, &t.serverUpper)));
+		REQUIRE(t.ProceedUntilFalse(std::bind(&MockUpperLayer::IsOnline, &t.clientUpper)));
+	}
+
+	REQUIRE(t.clientStats.numFullHandshake == 1);
+	REQUIRE(t.clientStats.numResumedHandshake == (NUM_CONNECTIONS - 1));
+	REQUIRE(t.serverStats.numFullHandshake == 1);
+	REQUIRE(t.serverStats.numResumedHandshake == (NUM_CONNECTIONS - 1));
+}
+
+#endif
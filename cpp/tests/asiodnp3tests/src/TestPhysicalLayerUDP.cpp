@@ -0,0 +1,169 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+#include <asio.hpp>
+
+#include <asiopal/PhysicalLayerUDPClient.h>
+#include <asiopal/PhysicalLayerUDPServer.h>
+
+#include <opendnp3/LogLevels.h>
+
+#include <dnp3mocks/MockUpperLayer.h>
+#include <dnp3mocks/LowerLayerToPhysAdapter.h>
+
+#include <testlib/MockLogHandler.h>
+#include <testlib/BufferHelpers.h>
+
+#include "mocks/TestObjectASIO.h"
+
+#include <functional>
+
+using namespace opendnp3;
+using namespace openpal;
+using namespace asiopal;
+using namespace testlib;
+
+#define SUITE(name) "PhysicalLayerUDPSuite - " name
+
+namespace
+{
+	class UDPTestObject : public TestObjectASIO
+	{
+	public:
+
+		UDPTestObject() :
+			client(log.root, GetService(), "127.0.0.1", "127.0.0.1", 50002),
+			server(log.root, GetService(), "127.0.0.1", 50002),
+			clientAdapter(log.GetLogger(), &client, true),
+			serverAdapter(log.GetLogger(), &server, true),
+			numServerReceive(0)
+		{
+			clientAdapter.SetUpperLayer(clientUpper);
+			serverAdapter.SetUpperLayer(serverUpper);
+
+			clientUpper.SetLowerLayer(clientAdapter);
+			serverUpper.SetLowerLayer(serverAdapter);
+
+			serverUpper.SetReceiveHandler([this](const RSlice&)
+			{
+				++numServerReceive;
+			});
+		}
+
+		void OpenBoth()
+		{
+			server.BeginOpen();
+			client.BeginOpen();
+			REQUIRE(ProceedUntil(std::bind(&MockUpperLayer::IsOnline, &serverUpper)));
+			REQUIRE(ProceedUntil(std::bind(&MockUpperLayer::IsOnline, &clientUpper)));
+		}
+
+		MockLogHandler log;
+
+		PhysicalLayerUDPClient client;
+		PhysicalLayerUDPServer server;
+
+		LowerLayerToPhysAdapter clientAdapter;
+		LowerLayerToPhysAdapter serverAdapter;
+
+		MockUpperLayer clientUpper;
+		MockUpperLayer serverUpper;
+
+		uint32_t numServerReceive;
+	};
+}
+
+TEST_CASE(SUITE("ClientAndServerOpenWithoutAPeer"))
+{
+	UDPTestObject t;
+
+	for (int i = 0; i < 3; ++i)
+	{
+		t.OpenBoth();
+
+		t.client.BeginClose();
+		t.server.BeginClose();
+		REQUIRE(t.ProceedUntilFalse(std::bind(&MockUpperLayer::IsOnline, &t.clientUpper)));
+		REQUIRE(t.ProceedUntilFalse(std::bind(&MockUpperLayer::IsOnline, &t.serverUpper)));
+	}
+}
+
+TEST_CASE(SUITE("ServerDropsWritesUntilItHearsFromAPeer"))
+{
+	UDPTestObject t;
+	t.OpenBoth();
+
+	ByteStr bs(10, 0);
+	t.serverUpper.SendDown(bs.ToRSlice());
+	REQUIRE(t.ProceedUntil(std::bind(&MockUpperLayer::CountersEqual, &t.serverUpper, 1, 0)));
+	REQUIRE(t.log.PopUntil(flags::WARN));
+}
+
+TEST_CASE(SUITE("ServerAnswersTheLastSender"))
+{
+	const uint32_t SEND_SIZE = 100;
+
+	UDPTestObject t;
+	t.OpenBoth();
+
+	ByteStr request(SEND_SIZE, 13);
+	t.clientUpper.SendDown(request.ToRSlice());
+	REQUIRE(t.ProceedUntil(std::bind(&MockUpperLayer::SizeEquals, &t.serverUpper, SEND_SIZE)));
+	REQUIRE(t.serverUpper.BufferEquals(request.ToRSlice()));
+
+	ByteStr response(SEND_SIZE, 77);
+	t.serverUpper.SendDown(response.ToRSlice());
+	REQUIRE(t.ProceedUntil(std::bind(&MockUpperLayer::SizeEquals, &t.clientUpper, SEND_SIZE)));
+	REQUIRE(t.clientUpper.BufferEquals(response.ToRSlice()));
+}
+
+TEST_CASE(SUITE("EachWriteArrivesAsOneDatagram"))
+{
+	// the size of a full fragment of 2048 bytes split into link frames
+	const uint32_t SEND_SIZE = 2358;
+	const uint32_t NUM_WRITES = 10;
+
+	UDPTestObject t;
+	t.OpenBoth();
+
+	ByteStr bs(SEND_SIZE, 42);
+	for (uint32_t i = 0; i < NUM_WRITES; ++i)
+	{
+		t.clientUpper.SendDown(bs.ToRSlice());
+		REQUIRE(t.ProceedUntil(std::bind(&MockUpperLayer::SizeEquals, &t.serverUpper, SEND_SIZE * (i + 1))));
+	}
+
+	REQUIRE(t.numServerReceive == NUM_WRITES);
+}
+
+TEST_CASE(SUITE("CloseWhileReading"))
+{
+	UDPTestObject t;
+	t.OpenBoth();
+
+	// both sides have a read outstanding that is cancelled by the close
+	t.server.BeginClose();
+	REQUIRE(t.ProceedUntilFalse(std::bind(&MockUpperLayer::IsOnline, &t.serverUpper)));
+	REQUIRE(t.clientUpper.IsOnline());
+
+	t.client.BeginClose();
+	REQUIRE(t.ProceedUntilFalse(std::bind(&MockUpperLayer::IsOnline, &t.clientUpper)));
+}
@@ -0,0 +1,369 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+#include <asio.hpp>
+
+#include <asiopal/PhysicalLayerTCPClient.h>
+#include <asiopal/PhysicalLayerTCPServer.h>
+#include <asiopal/TCPListener.h>
+#include <asiopal/SocketOptions.h>
+
+#ifdef OPENDNP3_USE_TLS
+#include <asiopal/tls/PhysicalLayerTLSClient.h>
+#include <asiopal/tls/PhysicalLayerTLSServer.h>
+#endif
+
+#include <opendnp3/LogLevels.h>
+
+#include <dnp3mocks/MockUpperLayer.h>
+#include <dnp3mocks/LowerLayerToPhysAdapter.h>
+
+#include <testlib/MockLogHandler.h>
+
+#include "mocks/TestObjectASIO.h"
+#include "mocks/TLSTestConfig.h"
+
+#include <functional>
+#include <memory>
+#include <stdexcept>
+
+using namespace opendnp3;
+using namespace openpal;
+using namespace asiopal;
+using namespace testlib;
+
+#define SUITE(name) "SocketOptionsTestSuite - " name
+
+namespace
+{
+	// an integer option at any level, read back from the socket with getsockopt
+	class GettableSocketOption
+	{
+	public:
+
+		GettableSocketOption(int level_, int name_) : optionLevel(level_), optionName(name_), value(0)
+		{}
+
+		template <class Protocol>
+		int level(const Protocol&) const
+		{
+			return optionLevel;
+		}
+
+		template <class Protocol>
+		int name(const Protocol&) const
+		{
+			return optionName;
+		}
+
+		template <class Protocol>
+		int* data(const Protocol&)
+		{
+			return &value;
+		}
+
+		template <class Protocol>
+		std::size_t size(const Protocol&) const
+		{
+			return sizeof(value);
+		}
+
+		template <class Protocol>
+		void resize(const Protocol&, std::size_t size)
+		{
+			if (size != sizeof(value))
+			{
+				throw std::length_error("integer socket option resize");
+			}
+		}
+
+		int Value() const
+		{
+			return value;
+		}
+
+	private:
+
+		int optionLevel;
+		int optionName;
+		int value;
+	};
+
+	int GetOption(asio::ip::tcp::socket::lowest_layer_type& socket, int level, int name)
+	{
+		GettableSocketOption option(level, name);
+		socket.get_option(option);
+		return option.Value();
+	}
+
+	struct ObservedOptions
+	{
+		ObservedOptions() : isSet(false), noDelay(0), sendBufferSize(0), receiveBufferSize(0), keepAlive(0), keepAliveIdle(0), keepAliveInterval(0), keepAliveCount(0), userTimeout(0), busyPoll(0)
+		{}
+
+		void Read(asio::ip::tcp::socket::lowest_layer_type& socket)
+		{
+			isSet = true;
+			noDelay = GetOption(socket, IPPROTO_TCP, TCP_NODELAY);
+			sendBufferSize = GetOption(socket, SOL_SOCKET, SO_SNDBUF);
+			receiveBufferSize = GetOption(socket, SOL_SOCKET, SO_RCVBUF);
+			keepAlive = GetOption(socket, SOL_SOCKET, SO_KEEPALIVE);
+#ifdef TCP_KEEPIDLE
+			keepAliveIdle = GetOption(socket, IPPROTO_TCP, TCP_KEEPIDLE);
+#endif
+#ifdef TCP_KEEPINTVL
+			keepAliveInterval = GetOption(socket, IPPROTO_TCP, TCP_KEEPINTVL);
+#endif
+#ifdef TCP_KEEPCNT
+			keepAliveCount = GetOption(socket, IPPROTO_TCP, TCP_KEEPCNT);
+#endif
+#ifdef TCP_USER_TIMEOUT
+			userTimeout = GetOption(socket, IPPROTO_TCP, TCP_USER_TIMEOUT);
+#endif
+#ifdef SO_BUSY_POLL
+			busyPoll = GetOption(socket, SOL_SOCKET, SO_BUSY_POLL);
+#endif
+		}
+
+		bool isSet;
+		int noDelay;
+		int sendBufferSize;
+		int receiveBufferSize;
+		int keepAlive;
+		int keepAliveIdle;
+		int keepAliveInterval;
+		int keepAliveCount;
+		int userTimeout;
+		int busyPoll;
+	};
+
+	SocketOptions GetTestOptions()
+	{
+		SocketOptions options;
+		options.noDelay = true;
+		options.sendBufferSize = 1 << 18;
+		options.receiveBufferSize = 1 << 18;
+		options.keepAlive = true;
+		options.keepAliveIdle = TimeDuration::Seconds(30);
+		options.keepAliveInterval = TimeDuration::Milliseconds(4500);
+		options.keepAliveCount = 4;
+		options.userTimeout = TimeDuration::Seconds(20);
+		options.busyPollMicroseconds = 50;
+		return options;
+	}
+
+	class SocketOptionsTestObject : public TestObjectASIO
+	{
+	public:
+
+		SocketOptionsTestObject(const SocketOptions& options) :
+			client(log.root, GetService(), "127.0.0.1", "127.0.0.1", 50003, options, std::bind(&ObservedOptions::Read, &clientOptions, std::placeholders::_1)),
+			server(log.root, GetService(), "127.0.0.1", 50003, options, std::bind(&ObservedOptions::Read, &serverOptions, std::placeholders::_1)),
+			clientAdapter(log.GetLogger(), &client, true),
+			serverAdapter(log.GetLogger(), &server, true)
+		{
+			clientAdapter.SetUpperLayer(clientUpper);
+			serverAdapter.SetUpperLayer(serverUpper);
+
+			clientUpper.SetLowerLayer(clientAdapter);
+			serverUpper.SetLowerLayer(serverAdapter);
+		}
+
+		void Connect()
+		{
+			server.BeginOpen();
+			client.BeginOpen();
+			REQUIRE(ProceedUntil(std::bind(&MockUpperLayer::IsOnline, &serverUpper)));
+			REQUIRE(ProceedUntil(std::bind(&MockUpperLayer::IsOnline, &clientUpper)));
+			REQUIRE(clientOptions.isSet);
+			REQUIRE(serverOptions.isSet);
+		}
+
+		MockLogHandler log;
+
+		ObservedOptions clientOptions;
+		ObservedOptions serverOptions;
+
+		PhysicalLayerTCPClient client;
+		PhysicalLayerTCPServer server;
+
+		LowerLayerToPhysAdapter clientAdapter;
+		LowerLayerToPhysAdapter serverAdapter;
+
+		MockUpperLayer clientUpper;
+		MockUpperLayer serverUpper;
+	};
+
+#ifdef OPENDNP3_USE_TLS
+
+	class TLSSocketOptionsTestObject : public TestObjectASIO
+	{
+	public:
+
+		TLSSocketOptionsTestObject(const SocketOptions& options) :
+			client(log.root, GetService(), "127.0.0.1", "127.0.0.1", 50004, GetTestTLSConfig(), options, std::bind(&ObservedOptions::Read, &clientOptions, std::placeholders::_1)),
+			server(log.root, GetService(), "127.0.0.1", 50004, GetTestTLSConfig(), options, std::bind(&ObservedOptions::Read, &serverOptions, std::placeholders::_1)),
+			clientAdapter(log.GetLogger(), &client, true),
+			serverAdapter(log.GetLogger(), &server, true)
+		{
+			clientAdapter.SetUpperLayer(clientUpper);
+			serverAdapter.SetUpperLayer(serverUpper);
+
+			clientUpper.SetLowerLayer(clientAdapter);
+			serverUpper.SetLowerLayer(serverAdapter);
+		}
+
+		MockLogHandler log;
+
+		ObservedOptions clientOptions;
+		ObservedOptions serverOptions;
+
+		PhysicalLayerTLSClient client;
+		PhysicalLayerTLSServer server;
+
+		LowerLayerToPhysAdapter clientAdapter;
+		LowerLayerToPhysAdapter serverAdapter;
+
+		MockUpperLayer clientUpper;
+		MockUpperLayer serverUpper;
+	};
+
+#endif
+
+	void RequireTestOptions(const ObservedOptions& observed)
+	{
+		REQUIRE(observed.noDelay != 0);
+		// linux reports double the requested size to account for bookkeeping overhead
+		REQUIRE(observed.sendBufferSize >= (1 << 18));
+		REQUIRE(observed.receiveBufferSize >= (1 << 18));
+		REQUIRE(observed.keepAlive != 0);
+#ifdef TCP_KEEPIDLE
+		REQUIRE(observed.keepAliveIdle == 30);
+#endif
+#ifdef TCP_KEEPINTVL
+		REQUIRE(observed.keepAliveInterval == 5); // rounded up to whole seconds
+#endif
+#ifdef TCP_KEEPCNT
+		REQUIRE(observed.keepAliveCount == 4);
+#endif
+#ifdef TCP_USER_TIMEOUT
+		REQUIRE(observed.userTimeout == 20000);
+#endif
+	}
+}
+
+TEST_CASE(SUITE("ClientAndServerApplyOptionsOnConnectAndAccept"))
+{
+	SocketOptionsTestObject t(GetTestOptions());
+	t.Connect();
+
+	RequireTestOptions(t.clientOptions);
+	RequireTestOptions(t.serverOptions);
+
+#ifdef SO_BUSY_POLL
+	// raising the busy poll time above the system default needs CAP_NET_ADMIN, otherwise it's logged and skipped
+	if (t.clientOptions.busyPoll != 50)
+	{
+		REQUIRE(t.log.PopUntil(flags::WARN));
+	}
+#endif
+}
+
+TEST_CASE(SUITE("OptionsAreReappliedOnEachConnection"))
+{
+	SocketOptionsTestObject t(GetTestOptions());
+
+	for (int i = 0; i < 3; ++i)
+	{
+		t.clientOptions = ObservedOptions();
+		t.serverOptions = ObservedOptions();
+
+		t.Connect();
+
+		RequireTestOptions(t.clientOptions);
+		RequireTestOptions(t.serverOptions);
+
+		t.client.BeginClose();
+		REQUIRE(t.ProceedUntilFalse(std::bind(&MockUpperLayer::IsOnline, &t.clientUpper)));
+		REQUIRE(t.ProceedUntilFalse(std::bind(&MockUpperLayer::IsOnline, &t.serverUpper)));
+	}
+}
+
+TEST_CASE(SUITE("DefaultOptionsLeaveTheOperatingSystemSettings"))
+{
+	SocketOptionsTestObject t((SocketOptions()));
+	t.Connect();
+
+	REQUIRE(t.clientOptions.noDelay == 0);
+	REQUIRE(t.clientOptions.keepAlive == 0);
+	REQUIRE(t.serverOptions.noDelay == 0);
+	REQUIRE(t.serverOptions.keepAlive == 0);
+	REQUIRE(t.log.IsLogErrorFree());
+}
+
+#ifdef OPENDNP3_USE_TLS
+
+TEST_CASE(SUITE("TLSClientAndServerApplyOptionsOnConnectAndAccept"))
+{
+	TLSSocketOptionsTestObject t(GetTestOptions());
+
+	t.server.BeginOpen();
+	t.client.BeginOpen();
+	REQUIRE(t.ProceedUntil(std::bind(&MockUpperLayer::IsOnline, &t.serverUpper)));
+	REQUIRE(t.ProceedUntil(std::bind(&MockUpperLayer::IsOnline, &t.clientUpper)));
+	REQUIRE(t.clientOptions.isSet);
+	REQUIRE(t.serverOptions.isSet);
+
+	RequireTestOptions(t.clientOptions);
+	RequireTestOptions(t.serverOptions);
+}
+
+#endif
+
+TEST_CASE(SUITE("ListenerAppliesOptionsToAcceptedSockets"))
+{
+	TestObjectASIO t;
+	MockLogHandler log;
+	ObservedOptions observed;
+
+	TCPListener listener(log.root, t.GetService(), "127.0.0.1", 50005, GetTestOptions(), std::bind(&ObservedOptions::Read, &observed, std::placeholders::_1));
+	REQUIRE_FALSE(listener.Listen());
+
+	std::unique_ptr<PhysicalLayerPeer> accepted;
+	listener.BeginAccept([&](const std::error_code & ec, PhysicalLayerPeer * pPeer)
+	{
+		REQUIRE_FALSE(ec);
+		accepted.reset(pPeer);
+	});
+
+	asio::ip::tcp::socket client(t.GetService());
+	client.connect(asio::ip::tcp::endpoint(asio::ip::address::from_string("127.0.0.1"), 50005));
+
+	REQUIRE(t.ProceedUntil([&]()
+	{
+		return accepted != nullptr;
+	}));
+
+	REQUIRE(observed.isSet);
+	RequireTestOptions(observed);
+
+	listener.Close();
+}
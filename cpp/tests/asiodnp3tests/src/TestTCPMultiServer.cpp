@@ -0,0 +1,361 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+#include <asio.hpp>
+
+#include <asiodnp3/DNP3Manager.h>
+#include <asiodnp3/DefaultMasterApplication.h>
+
+#include <opendnp3/LogLevels.h>
+#include <opendnp3/outstation/SimpleCommandHandler.h>
+#include <opendnp3/outstation/IOutstationApplication.h>
+
+#include <dnp3mocks/NullSOEHandler.h>
+
+#include <testlib/StopWatch.h>
+
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace opendnp3;
+using namespace asiodnp3;
+using namespace openpal;
+using namespace testlib;
+
+#define SUITE(name) "TCPMultiServerTestSuite - " name
+
+const uint16_t MASTER_ADDRESS = 1;
+const uint16_t FIRST_OUTSTATION_ADDRESS = 10;
+
+// the field devices dial in, and speak first with a null unsolicited response
+IChannel* AddDialInOutstation(DNP3Manager& manager, uint16_t address)
+{
+	auto pChannel = manager.AddTCPClient("client", levels::NORMAL, ChannelRetry::Default(), "127.0.0.1", "127.0.0.1", 20000);
+
+	OutstationStackConfig config(DatabaseTemplate::AllTypes(1));
+	config.outstation.params.allowUnsolicited = true;
+	config.link.LocalAddr = address;
+	config.link.RemoteAddr = MASTER_ADDRESS;
+
+	auto pOutstation = pChannel->AddOutstation("outstation", SuccessCommandHandler::Instance(), DefaultOutstationApplication::Instance(), config);
+	pOutstation->Enable();
+	return pChannel;
+}
+
+IMaster* AddMaster(IChannel& server, uint16_t outstationAddress)
+{
+	MasterStackConfig config;
+	config.link.LocalAddr = MASTER_ADDRESS;
+	config.link.RemoteAddr = outstationAddress;
+
+	auto pMaster = server.AddMaster("master", NullSOEHandler::Instance(), asiodnp3::DefaultMasterApplication::Instance(), config);
+	pMaster->Enable();
+	return pMaster;
+}
+
+void WaitFor(const std::function<bool ()>& condition)
+{
+	StopWatch sw;
+	while (!condition())
+	{
+		REQUIRE(sw.Elapsed(false) < std::chrono::seconds(30));
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+}
+
+// a peer that connects and never sends anything. Retries until the server is listening
+std::unique_ptr<asio::ip::tcp::socket> ConnectSilently(asio::io_service& service)
+{
+	std::unique_ptr<asio::ip::tcp::socket> socket(new asio::ip::tcp::socket(service));
+	auto connected = [&]()
+	{
+		std::error_code ec;
+		socket->close(ec);
+		socket->connect(asio::ip::tcp::endpoint(asio::ip::address::from_string("127.0.0.1"), 20000), ec);
+		return !ec;
+	};
+	WaitFor(connected);
+	return socket;
+}
+
+TEST_CASE(SUITE("HundredsOfClientsAreBoundToTheirSessionsOnOnePort"))
+{
+	const uint16_t NUM_CLIENTS = 300;
+
+	DNP3Manager manager(std::thread::hardware_concurrency());
+
+	auto pServer = manager.AddTCPMultiServer("server", levels::NORMAL, ChannelRetry::Default(), "127.0.0.1", 20000);
+
+	std::vector<IMaster*> masters;
+	for (uint16_t i = 0; i < NUM_CLIENTS; ++i)
+	{
+		masters.push_back(AddMaster(*pServer, FIRST_OUTSTATION_ADDRESS + i));
+	}
+
+	std::vector<IChannel*> clients;
+	for (uint16_t i = 0; i < NUM_CLIENTS; ++i)
+	{
+		clients.push_back(AddDialInOutstation(manager, FIRST_OUTSTATION_ADDRESS + i));
+	}
+
+	// every master completes its startup integrity poll over its own connection
+	auto polled = [&]()
+	{
+		for (auto pMaster : masters)
+		{
+			if (pMaster->GetStackMetrics().GetTaskRoundTrip(MasterTaskType::STARTUP_INTEGRITY_POLL).count == 0)
+			{
+				return false;
+			}
+		}
+		return true;
+	};
+	WaitFor(polled);
+
+	auto stats = pServer->GetServerStatistics();
+	REQUIRE(stats.numAccept == NUM_CLIENTS);
+	REQUIRE(stats.NumActive() == NUM_CLIENTS);
+	REQUIRE(stats.numRejected == 0);
+	REQUIRE(stats.numRebind == 0);
+
+	for (auto& connection : stats.connections)
+	{
+		REQUIRE(connection.numSessions == 1);
+		REQUIRE(connection.numLinkFrameRx > 0);
+		REQUIRE(connection.numLinkFrameTx > 0);
+		REQUIRE(connection.numBytesRx > 0);
+		REQUIRE(connection.numBytesTx > 0);
+		REQUIRE(!connection.remoteAddress.empty());
+	}
+
+	auto channel = pServer->GetChannelStatistics();
+	REQUIRE(channel.numOpen == NUM_CLIENTS);
+
+	for (auto pClient : clients)
+	{
+		pClient->Shutdown();
+	}
+
+	auto closed = [&]()
+	{
+		auto stats = pServer->GetServerStatistics();
+		return stats.NumActive() == 0 && stats.numClose == NUM_CLIENTS;
+	};
+	WaitFor(closed);
+
+	pServer->Shutdown();
+}
+
+TEST_CASE(SUITE("ConnectionIsClosedIfItsFirstFrameMatchesNoSession"))
+{
+	DNP3Manager manager(std::thread::hardware_concurrency());
+
+	auto pServer = manager.AddTCPMultiServer("server", levels::NORMAL, ChannelRetry::Default(), "127.0.0.1", 20000);
+	AddMaster(*pServer, FIRST_OUTSTATION_ADDRESS);
+
+	AddDialInOutstation(manager, FIRST_OUTSTATION_ADDRESS + 1);
+
+	auto rejected = [&]()
+	{
+		return pServer->GetServerStatistics().numRejected > 0;
+	};
+	WaitFor(rejected);
+
+	auto stats = pServer->GetServerStatistics();
+	REQUIRE(stats.numAccept >= 1);
+	REQUIRE(stats.numClose == stats.numRejected);
+}
+
+TEST_CASE(SUITE("ShutdownClosesOpenConnections"))
+{
+	DNP3Manager manager(std::thread::hardware_concurrency());
+
+	auto pServer = manager.AddTCPMultiServer("server", levels::NORMAL, ChannelRetry::Default(), "127.0.0.1", 20000);
+	AddMaster(*pServer, FIRST_OUTSTATION_ADDRESS);
+
+	AddDialInOutstation(manager, FIRST_OUTSTATION_ADDRESS);
+
+	auto bound = [&]()
+	{
+		auto stats = pServer->GetServerStatistics();
+		return stats.NumActive() == 1 && stats.connections[0].numSessions == 1;
+	};
+	WaitFor(bound);
+
+	// the manager shuts down the server with the client still connected
+}
+
+TEST_CASE(SUITE("ConnectionIsClosedIfItIsNotBoundWithinTheBindTimeout"))
+{
+	DNP3Manager manager(std::thread::hardware_concurrency());
+
+	MultiServerSettings settings;
+	settings.bindTimeout = TimeDuration::Milliseconds(100);
+
+	auto pServer = manager.AddTCPMultiServer("server", levels::NORMAL, ChannelRetry::Default(), "127.0.0.1", 20000, DNP3Manager::DEFAULT_RX_BUFFER_SIZE, asiopal::SocketOptions(), settings);
+	AddMaster(*pServer, FIRST_OUTSTATION_ADDRESS);
+
+	asio::io_service service;
+	auto socket = ConnectSilently(service);
+
+	auto timedOut = [&]()
+	{
+		auto stats = pServer->GetServerStatistics();
+		return stats.numBindTimeout == 1 && stats.NumActive() == 0;
+	};
+	WaitFor(timedOut);
+
+	// the server closed its end
+	uint8_t byte;
+	std::error_code ec;
+	socket->read_some(asio::buffer(&byte, 1), ec);
+	REQUIRE(ec == asio::error::eof);
+
+	// a peer that speaks is still bound
+	AddDialInOutstation(manager, FIRST_OUTSTATION_ADDRESS);
+
+	auto bound = [&]()
+	{
+		auto stats = pServer->GetServerStatistics();
+		return stats.NumActive() == 1 && stats.connections[0].numSessions == 1;
+	};
+	WaitFor(bound);
+
+	REQUIRE(pServer->GetServerStatistics().numBindTimeout == 1);
+}
+
+TEST_CASE(SUITE("ConnectionsBeyondTheUnboundLimitAreClosed"))
+{
+	const uint32_t MAX_UNBOUND = 3;
+	const uint32_t NUM_SILENT = 5;
+
+	DNP3Manager manager(std::thread::hardware_concurrency());
+
+	MultiServerSettings settings;
+	settings.maxUnbound = MAX_UNBOUND;
+
+	auto pServer = manager.AddTCPMultiServer("server", levels::NORMAL, ChannelRetry::Default(), "127.0.0.1", 20000, DNP3Manager::DEFAULT_RX_BUFFER_SIZE, asiopal::SocketOptions(), settings);
+	AddMaster(*pServer, FIRST_OUTSTATION_ADDRESS);
+
+	asio::io_service service;
+	std::vector<std::unique_ptr<asio::ip::tcp::socket>> sockets;
+	for (uint32_t i = 0; i < NUM_SILENT; ++i)
+	{
+		sockets.push_back(ConnectSilently(service));
+	}
+
+	auto accepted = [&]()
+	{
+		return pServer->GetServerStatistics().numAccept == NUM_SILENT;
+	};
+	WaitFor(accepted);
+
+	auto stats = pServer->GetServerStatistics();
+	REQUIRE(stats.NumActive() == MAX_UNBOUND);
+	REQUIRE(stats.numUnboundLimit == (NUM_SILENT - MAX_UNBOUND));
+	REQUIRE(stats.numClose == (NUM_SILENT - MAX_UNBOUND));
+	REQUIRE(stats.numBindTimeout == 0);
+
+	// freeing a slot lets a peer that speaks connect and bind
+	sockets.clear();
+
+	auto closed = [&]()
+	{
+		return pServer->GetServerStatistics().NumActive() == 0;
+	};
+	WaitFor(closed);
+
+	AddDialInOutstation(manager, FIRST_OUTSTATION_ADDRESS);
+
+	auto bound = [&]()
+	{
+		auto stats = pServer->GetServerStatistics();
+		return stats.NumActive() == 1 && stats.connections[0].numSessions == 1;
+	};
+	WaitFor(bound);
+}
+
+TEST_CASE(SUITE("PeerCannotTakeOverASessionBoundToAnActiveConnection"))
+{
+	DNP3Manager manager(std::thread::hardware_concurrency());
+
+	MultiServerSettings settings;
+	settings.rebindIdleTimeout = TimeDuration::Max();
+
+	auto pServer = manager.AddTCPMultiServer("server", levels::NORMAL, ChannelRetry::Default(), "127.0.0.1", 20000, DNP3Manager::DEFAULT_RX_BUFFER_SIZE, asiopal::SocketOptions(), settings);
+	auto pMaster = AddMaster(*pServer, FIRST_OUTSTATION_ADDRESS);
+
+	AddDialInOutstation(manager, FIRST_OUTSTATION_ADDRESS);
+
+	auto polled = [&]()
+	{
+		return pMaster->GetStackMetrics().GetTaskRoundTrip(MasterTaskType::STARTUP_INTEGRITY_POLL).count > 0;
+	};
+	WaitFor(polled);
+
+	// a second peer that claims the same addresses
+	AddDialInOutstation(manager, FIRST_OUTSTATION_ADDRESS);
+
+	auto refused = [&]()
+	{
+		return pServer->GetServerStatistics().numRebindRefused > 0;
+	};
+	WaitFor(refused);
+
+	auto stats = pServer->GetServerStatistics();
+	REQUIRE(stats.numRebind == 0);
+	REQUIRE(stats.NumActive() == 2);
+	REQUIRE(stats.connections[0].numSessions == 1);
+	REQUIRE(stats.connections[1].numSessions == 0);
+}
+
+TEST_CASE(SUITE("SessionMovesToANewConnectionOnceTheOldOneIsIdle"))
+{
+	DNP3Manager manager(std::thread::hardware_concurrency());
+
+	MultiServerSettings settings;
+	settings.rebindIdleTimeout = TimeDuration::Milliseconds(100);
+
+	auto pServer = manager.AddTCPMultiServer("server", levels::NORMAL, ChannelRetry::Default(), "127.0.0.1", 20000, DNP3Manager::DEFAULT_RX_BUFFER_SIZE, asiopal::SocketOptions(), settings);
+	auto pMaster = AddMaster(*pServer, FIRST_OUTSTATION_ADDRESS);
+
+	AddDialInOutstation(manager, FIRST_OUTSTATION_ADDRESS);
+
+	auto polled = [&]()
+	{
+		return pMaster->GetStackMetrics().GetTaskRoundTrip(MasterTaskType::STARTUP_INTEGRITY_POLL).count > 0;
+	};
+	WaitFor(polled);
+
+	// nothing is polled after the startup integrity poll, so the first connection goes quiet
+	std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+	AddDialInOutstation(manager, FIRST_OUTSTATION_ADDRESS);
+
+	auto moved = [&]()
+	{
+		auto stats = pServer->GetServerStatistics();
+		return stats.numRebind == 1 && stats.NumActive() == 1 && stats.connections[0].numSessions == 1;
+	};
+	WaitFor(moved);
+}
@@ -0,0 +1,138 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include <asiopal/TimerWheel.h>
+
+#include <vector>
+
+using namespace asiopal;
+
+#define SUITE(name) "TimerWheelTestSuite - " name
+
+TEST_CASE(SUITE("ExpiresInOrderOfExpiration"))
+{
+	TimerWheel wheel(1000);
+	TimerWheelNode a, b, c;
+
+	REQUIRE(wheel.Schedule(a, 1300, 1000) == 1280); // visited when the second level cascades
+	REQUIRE(wheel.Schedule(b, 1005, 1000) == 1005);
+	REQUIRE(wheel.Schedule(c, 1003, 1000) == 1003);
+
+	TimerWheel::Tick next = 0;
+	REQUIRE(wheel.NextWake(next));
+	REQUIRE(next == 1003);
+
+	wheel.Advance(1002);
+	REQUIRE(wheel.PopExpired() == nullptr);
+
+	wheel.Advance(1010);
+	REQUIRE(wheel.PopExpired() == &c);
+	REQUIRE(wheel.PopExpired() == &b);
+	REQUIRE(wheel.PopExpired() == nullptr);
+
+	REQUIRE(wheel.NextWake(next));
+	REQUIRE(next == 1280);
+	wheel.Advance(1299);
+	REQUIRE(wheel.PopExpired() == nullptr);
+	wheel.Advance(1300);
+	REQUIRE(wheel.PopExpired() == &a);
+	REQUIRE(wheel.IsEmpty());
+	REQUIRE_FALSE(wheel.NextWake(next));
+}
+
+TEST_CASE(SUITE("OverdueTimersExpireOnNextAdvance"))
+{
+	TimerWheel wheel(1000);
+	TimerWheelNode a;
+
+	REQUIRE(wheel.Schedule(a, 10, 1000) == 1000);
+	wheel.Advance(1000);
+	REQUIRE(wheel.PopExpired() == &a);
+}
+
+TEST_CASE(SUITE("CancelUnlinksScheduledAndExpiredNodes"))
+{
+	TimerWheel wheel(0);
+	TimerWheelNode a, b, c;
+
+	wheel.Schedule(a, 10, 0);
+	wheel.Schedule(b, 10, 0);
+	wheel.Schedule(c, 100000, 0);
+
+	wheel.Cancel(c);
+	REQUIRE_FALSE(c.IsLinked());
+
+	wheel.Advance(10);
+	wheel.Cancel(a);
+	REQUIRE(wheel.PopExpired() == &b);
+	REQUIRE(wheel.PopExpired() == nullptr);
+	REQUIRE(wheel.IsEmpty());
+}
+
+TEST_CASE(SUITE("EmptyWheelFastForwards"))
+{
+	TimerWheel wheel(0);
+	TimerWheelNode a;
+
+	// an idle wheel doesn't treat the elapsed time as a delay
+	REQUIRE(wheel.Schedule(a, 5000000010, 5000000000) == 5000000010);
+	wheel.Advance(5000000010);
+	REQUIRE(wheel.PopExpired() == &a);
+}
+
+TEST_CASE(SUITE("EveryNodeExpiresExactlyOnTimeWhenDrivenByNextWake"))
+{
+	const uint32_t NUM = 2000;
+	const TimerWheel::Tick START = 123456789;
+
+	TimerWheel wheel(START);
+	std::vector<TimerWheelNode> nodes(NUM);
+
+	// spread timers over every level, including some beyond the range of the wheel
+	uint64_t seed = 1;
+	for (auto& node : nodes)
+	{
+		seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+		const uint32_t bits = 1 + static_cast<uint32_t>((seed >> 33) % 34);
+		const TimerWheel::Tick delay = (seed >> 20) & ((TimerWheel::Tick(1) << bits) - 1);
+		wheel.Schedule(node, START + delay, START);
+	}
+
+	uint32_t count = 0;
+	bool onTime = true;
+	TimerWheel::Tick now = 0;
+	while (wheel.NextWake(now))
+	{
+		wheel.Advance(now);
+		while (auto pNode = wheel.PopExpired())
+		{
+			++count;
+			if (pNode->GetExpiration() != now)
+			{
+				onTime = false;
+			}
+		}
+	}
+
+	REQUIRE(count == NUM);
+	REQUIRE(onTime);
+}
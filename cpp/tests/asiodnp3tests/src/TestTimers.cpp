@@ -28,7 +28,10 @@
 
 #include <opendnp3/LogLevels.h>
 
+#include <testlib/StopWatch.h>
+
 #include <map>
+#include <vector>
 #include <functional>
 #include <chrono>
 #include <iostream>
@@ -38,6 +41,7 @@ using namespace std::chrono;
 using namespace openpal;
 using namespace opendnp3;
 using namespace asiopal;
+using namespace testlib;
 
 class MockTimerHandler
 {
@@ -173,4 +177,43 @@ TEST_CASE(SUITE("MultipleOutstanding"))
 	REQUIRE(1 ==  mth2.GetCount());
 }
 
+TEST_CASE(SUITE("Timer churn"), "[.][benchmark]")
+{
+	// mimics many channels restarting response and keep-alive timers
+	const uint32_t OUTSTANDING = 1000;
+	const uint32_t ROUNDS = 500;
+
+	asio::io_service service;
+	ASIOExecutor exe(service);
+
+	auto nothing = []() {};
+	auto action = Action0::Bind(nothing);
+
+	std::vector<ITimer*> timers(OUTSTANDING);
+	for (uint32_t i = 0; i < OUTSTANDING; ++i)
+	{
+		timers[i] = exe.Start(TimeDuration::Seconds(5 + (i % 60)), action);
+	}
 
+	StopWatch sw;
+	for (uint32_t round = 0; round < ROUNDS; ++round)
+	{
+		for (uint32_t i = 0; i < OUTSTANDING; ++i)
+		{
+			timers[i]->Cancel();
+			timers[i] = exe.Start(TimeDuration::Seconds(5 + ((i + round) % 60)), action);
+		}
+		service.poll();
+		service.reset();
+	}
+	auto us = std::chrono::duration_cast<std::chrono::microseconds>(sw.Elapsed()).count();
+
+	std::cout << "cancel + restart with " << OUTSTANDING << " outstanding timers: "
+	          << (1000.0 * OUTSTANDING * ROUNDS) / us << " kops/s" << std::endl;
+
+	for (auto pTimer : timers)
+	{
+		pTimer->Cancel();
+	}
+	service.poll();
+}
@@ -0,0 +1,278 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+#include <asio.hpp>
+
+#include <asiodnp3/DNP3Manager.h>
+#include <asiodnp3/DefaultMasterApplication.h>
+
+#include <opendnp3/LogLevels.h>
+#include <opendnp3/outstation/SimpleCommandHandler.h>
+#include <opendnp3/outstation/IOutstationApplication.h>
+
+#include <dnp3mocks/NullSOEHandler.h>
+
+#include <testlib/StopWatch.h>
+
+#include <functional>
+#include <thread>
+#include <vector>
+#include <iostream>
+
+using namespace opendnp3;
+using namespace asiodnp3;
+using namespace openpal;
+using namespace testlib;
+
+#define SUITE(name) "UDPChannelsTestSuite - " name
+
+namespace
+{
+	const uint16_t MASTER_ADDRESS = 1;
+	const uint16_t FIRST_OUTSTATION_ADDRESS = 10;
+
+	// enough for all the frames of a 2048 byte fragment, so that each fragment goes out in one datagram
+	const uint32_t FRAMES_PER_WRITE = 10;
+
+	IOutstation* AddOutstation(IChannel& channel, uint16_t address, uint16_t numPoints, bool allowUnsolicited)
+	{
+		OutstationStackConfig config(DatabaseTemplate::AllTypes(numPoints));
+		config.outstation.params.allowUnsolicited = allowUnsolicited;
+		config.link.LocalAddr = address;
+		config.link.RemoteAddr = MASTER_ADDRESS;
+		config.link.MaxUnconfirmedFramesPerWrite = FRAMES_PER_WRITE;
+
+		auto pOutstation = channel.AddOutstation("outstation", SuccessCommandHandler::Instance(), DefaultOutstationApplication::Instance(), config);
+		pOutstation->Enable();
+		return pOutstation;
+	}
+
+	IMaster* AddMaster(IChannel& channel, uint16_t outstationAddress)
+	{
+		MasterStackConfig config;
+		config.link.LocalAddr = MASTER_ADDRESS;
+		config.link.RemoteAddr = outstationAddress;
+		config.link.MaxUnconfirmedFramesPerWrite = FRAMES_PER_WRITE;
+
+		auto pMaster = channel.AddMaster("master", NullSOEHandler::Instance(), asiodnp3::DefaultMasterApplication::Instance(), config);
+		pMaster->Enable();
+		return pMaster;
+	}
+
+	uint64_t NumPolls(IMaster& master, MasterTaskType type)
+	{
+		return master.GetStackMetrics().GetTaskRoundTrip(type).count;
+	}
+
+	void WaitFor(const std::function<bool ()>& condition)
+	{
+		StopWatch sw;
+		while (!condition())
+		{
+			REQUIRE(sw.Elapsed(false) < std::chrono::seconds(30));
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		}
+	}
+}
+
+TEST_CASE(SUITE("MasterOnUDPClientPollsOutstationOnUDPServer"))
+{
+	DNP3Manager manager(std::thread::hardware_concurrency());
+
+	auto pServer = manager.AddUDPServer("server", levels::NORMAL, ChannelRetry::Default(), "127.0.0.1", 20000);
+	auto pClient = manager.AddUDPClient("client", levels::NORMAL, ChannelRetry::Default(), "127.0.0.1", "127.0.0.1", 20000);
+
+	// the response to the integrity poll is several fragments, each of several frames
+	AddOutstation(*pServer, FIRST_OUTSTATION_ADDRESS, 200, false);
+	auto pMaster = AddMaster(*pClient, FIRST_OUTSTATION_ADDRESS);
+
+	WaitFor([&]() { return NumPolls(*pMaster, MasterTaskType::STARTUP_INTEGRITY_POLL) > 0; });
+
+	auto stats = pClient->GetChannelStatistics();
+	REQUIRE(stats.numLinkFrameRx > 0);
+	REQUIRE(stats.numCrcError == 0);
+
+	pClient->Shutdown();
+	pServer->Shutdown();
+}
+
+TEST_CASE(SUITE("MultiServerBindsEachPeerToItsSession"))
+{
+	const uint16_t NUM_PEERS = 50;
+
+	DNP3Manager manager(std::thread::hardware_concurrency());
+
+	auto pServer = manager.AddUDPMultiServer("server", levels::NORMAL, ChannelRetry::Default(), "127.0.0.1", 20000);
+
+	std::vector<IMaster*> masters;
+	for (uint16_t i = 0; i < NUM_PEERS; ++i)
+	{
+		masters.push_back(AddMaster(*pServer, FIRST_OUTSTATION_ADDRESS + i));
+	}
+
+	// the field devices speak first with a null unsolicited response, which is how the server learns their endpoints
+	for (uint16_t i = 0; i < NUM_PEERS; ++i)
+	{
+		auto pClient = manager.AddUDPClient("client", levels::NORMAL, ChannelRetry::Default(), "127.0.0.1", "127.0.0.1", 20000);
+		AddOutstation(*pClient, FIRST_OUTSTATION_ADDRESS + i, 1, true);
+	}
+
+	auto polled = [&]()
+	{
+		for (auto pMaster : masters)
+		{
+			if (NumPolls(*pMaster, MasterTaskType::STARTUP_INTEGRITY_POLL) == 0)
+			{
+				return false;
+			}
+		}
+		return true;
+	};
+	WaitFor(polled);
+
+	auto stats = pServer->GetServerStatistics();
+	REQUIRE(stats.numAccept == NUM_PEERS);
+	REQUIRE(stats.NumActive() == NUM_PEERS);
+	REQUIRE(stats.numRejected == 0);
+
+	for (auto& peer : stats.connections)
+	{
+		REQUIRE(peer.numSessions == 1);
+		REQUIRE(peer.numLinkFrameRx > 0);
+		REQUIRE(peer.numLinkFrameTx > 0);
+	}
+}
+
+TEST_CASE(SUITE("MultiServerDropsPeersThatMatchNoSession"))
+{
+	DNP3Manager manager(std::thread::hardware_concurrency());
+
+	auto pServer = manager.AddUDPMultiServer("server", levels::NORMAL, ChannelRetry::Default(), "127.0.0.1", 20000);
+	AddMaster(*pServer, FIRST_OUTSTATION_ADDRESS);
+
+	auto pClient = manager.AddUDPClient("client", levels::NORMAL, ChannelRetry::Default(), "127.0.0.1", "127.0.0.1", 20000);
+	AddOutstation(*pClient, FIRST_OUTSTATION_ADDRESS + 1, 1, true);
+
+	WaitFor([&]() { return pServer->GetServerStatistics().numRejected > 0; });
+
+	auto stats = pServer->GetServerStatistics();
+	REQUIRE(stats.numClose == stats.numRejected);
+}
+
+TEST_CASE(SUITE("MultiServerClosesPeersThatAreNotBoundInTime"))
+{
+	DNP3Manager manager(std::thread::hardware_concurrency());
+
+	MultiServerSettings settings;
+	settings.bindTimeout = TimeDuration::Milliseconds(100);
+
+	auto pServer = manager.AddUDPMultiServer("server", levels::NORMAL, ChannelRetry::Default(), "127.0.0.1", 20000, DNP3Manager::DEFAULT_RX_BUFFER_SIZE, settings);
+	AddMaster(*pServer, FIRST_OUTSTATION_ADDRESS);
+
+	// a datagram that contains no frame creates a peer that is never bound
+	asio::io_service service;
+	asio::ip::udp::socket socket(service, asio::ip::udp::endpoint(asio::ip::udp::v4(), 0));
+	const uint8_t garbage[] = { 0xAB, 0xCD };
+	auto remote = asio::ip::udp::endpoint(asio::ip::address::from_string("127.0.0.1"), 20000);
+
+	auto timedOut = [&]()
+	{
+		if (pServer->GetServerStatistics().numAccept == 0)
+		{
+			// the server may not be listening yet
+			socket.send_to(asio::buffer(garbage, sizeof(garbage)), remote);
+			return false;
+		}
+		auto stats = pServer->GetServerStatistics();
+		return stats.numBindTimeout == 1 && stats.NumActive() == 0;
+	};
+	WaitFor(timedOut);
+}
+
+TEST_CASE(SUITE("MultiServerClosesIdlePeers"))
+{
+	DNP3Manager manager(std::thread::hardware_concurrency());
+
+	MultiServerSettings settings;
+	settings.peerIdleTimeout = TimeDuration::Milliseconds(500);
+
+	auto pServer = manager.AddUDPMultiServer("server", levels::NORMAL, ChannelRetry::Default(), "127.0.0.1", 20000, DNP3Manager::DEFAULT_RX_BUFFER_SIZE, settings);
+	auto pMaster = AddMaster(*pServer, FIRST_OUTSTATION_ADDRESS);
+
+	// the integrity poll response arrives in datagrams larger than the receive buffer, so the peer delivers them in several reads
+	auto pClient = manager.AddUDPClient("client", levels::NORMAL, ChannelRetry::Default(), "127.0.0.1", "127.0.0.1", 20000);
+	AddOutstation(*pClient, FIRST_OUTSTATION_ADDRESS, 200, true);
+
+	WaitFor([&]() { return NumPolls(*pMaster, MasterTaskType::STARTUP_INTEGRITY_POLL) > 0; });
+	REQUIRE(pServer->GetChannelStatistics().numCrcError == 0);
+
+	// the master has nothing more to poll, so the outstation goes quiet and its peer is closed
+	auto closed = [&]()
+	{
+		auto stats = pServer->GetServerStatistics();
+		return stats.NumActive() == 0 && stats.numClose == 1;
+	};
+	WaitFor(closed);
+
+	auto stats = pServer->GetServerStatistics();
+	REQUIRE(stats.numAccept == 1);
+	REQUIRE(stats.numBindTimeout == 0);
+	REQUIRE(stats.numRejected == 0);
+}
+
+TEST_CASE(SUITE("Integrity polls per second over TCP and UDP"), "[.][benchmark]")
+{
+	const auto DURATION = std::chrono::seconds(5);
+
+	auto run = [&](bool udp)
+	{
+		DNP3Manager manager(2);
+
+		auto pServer = udp ?
+			manager.AddUDPServer("server", levels::NOTHING, ChannelRetry::Default(), "127.0.0.1", 20000) :
+			manager.AddTCPServer("server", levels::NOTHING, ChannelRetry::Default(), "127.0.0.1", 20000);
+
+		auto pClient = udp ?
+			manager.AddUDPClient("client", levels::NOTHING, ChannelRetry::Default(), "127.0.0.1", "127.0.0.1", 20000) :
+			manager.AddTCPClient("client", levels::NOTHING, ChannelRetry::Default(), "127.0.0.1", "127.0.0.1", 20000);
+
+		AddOutstation(*pServer, FIRST_OUTSTATION_ADDRESS, 50, false);
+		auto pMaster = AddMaster(*pClient, FIRST_OUTSTATION_ADDRESS);
+
+		WaitFor([&]() { return NumPolls(*pMaster, MasterTaskType::STARTUP_INTEGRITY_POLL) > 0; });
+
+		pMaster->AddClassScan(ClassField::AllClasses(), TimeDuration::Milliseconds(0));
+
+		const auto start = NumPolls(*pMaster, MasterTaskType::USER_TASK);
+		StopWatch sw;
+		std::this_thread::sleep_for(DURATION);
+		const auto num = NumPolls(*pMaster, MasterTaskType::USER_TASK) - start;
+		const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(sw.Elapsed()).count();
+
+		auto stats = pClient->GetChannelStatistics();
+
+		std::cout << (udp ? "UDP" : "TCP") << ": " << (num * 1000) / ms << " polls/s, "
+		          << (static_cast<uint64_t>(stats.numBytesRx) * 1000) / ms << " bytes/s received" << std::endl;
+	};
+
+	run(false);
+	run(true);
+}
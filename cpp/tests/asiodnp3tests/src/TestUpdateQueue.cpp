@@ -0,0 +1,326 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include <asiodnp3/UpdateQueue.h>
+#include <asiodnp3/ChangeSet.h>
+
+#include <opendnp3/app/Indexed.h>
+
+#include <testlib/StopWatch.h>
+
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <iostream>
+
+using namespace opendnp3;
+using namespace asiodnp3;
+
+#define SUITE(name) "UpdateQueueTestSuite - " name
+
+// remembers the analog, binary and time-and-interval updates it receives
+class RecordingDatabase : public IDatabase
+{
+public:
+
+	struct AnalogUpdate
+	{
+		Analog meas;
+		uint16_t index;
+		EventMode mode;
+	};
+
+	std::vector<AnalogUpdate> analogs;
+	std::vector<Indexed<Binary>> binaries;
+	std::vector<Indexed<TimeAndInterval>> timeAndIntervals;
+
+	virtual bool Update(const Binary& meas, uint16_t index, EventMode mode) override final
+	{
+		binaries.push_back(WithIndex(meas, index));
+		return true;
+	}
+
+	virtual bool Update(const Analog& meas, uint16_t index, EventMode mode) override final
+	{
+		AnalogUpdate update = { meas, index, mode };
+		analogs.push_back(update);
+		return true;
+	}
+
+	virtual bool Update(const TimeAndInterval& meas, uint16_t index) override final
+	{
+		timeAndIntervals.push_back(WithIndex(meas, index));
+		return true;
+	}
+
+	virtual bool Update(const DoubleBitBinary& meas, uint16_t index, EventMode mode) override final { return true; }
+	virtual bool Update(const Counter& meas, uint16_t index, EventMode mode) override final { return true; }
+	virtual bool Update(const FrozenCounter& meas, uint16_t index, EventMode mode) override final { return true; }
+	virtual bool Update(const BinaryOutputStatus& meas, uint16_t index, EventMode mode) override final { return true; }
+	virtual bool Update(const AnalogOutputStatus& meas, uint16_t index, EventMode mode) override final { return true; }
+
+	virtual bool Modify(const openpal::Function1<const Binary&, Binary>& modify, uint16_t index, EventMode mode) override final { return true; }
+	virtual bool Modify(const openpal::Function1<const DoubleBitBinary&, DoubleBitBinary>& modify, uint16_t index, EventMode mode) override final { return true; }
+	virtual bool Modify(const openpal::Function1<const Analog&, Analog>& modify, uint16_t index, EventMode mode) override final { return true; }
+	virtual bool Modify(const openpal::Function1<const Counter&, Counter>& modify, uint16_t index, EventMode mode) override final { return true; }
+	virtual bool Modify(const openpal::Function1<const FrozenCounter&, FrozenCounter>& modify, uint16_t index, EventMode mode) override final { return true; }
+	virtual bool Modify(const openpal::Function1<const BinaryOutputStatus&, BinaryOutputStatus>& modify, uint16_t index, EventMode mode) override final { return true; }
+	virtual bool Modify(const openpal::Function1<const AnalogOutputStatus&, AnalogOutputStatus>& modify, uint16_t index, EventMode mode) override final { return true; }
+	virtual bool Modify(const openpal::Function1<const TimeAndInterval&, TimeAndInterval>& modify, uint16_t index) override final { return true; }
+};
+
+TEST_CASE(SUITE("Updates are applied in order with all of their fields"))
+{
+	UpdateQueue queue(UpdateQueueConfig(8));
+	RecordingDatabase db;
+
+	REQUIRE(queue.IsAvailable());
+	REQUIRE(queue.TryPush(Analog(3.5, 0x01, DNPTime(42)), 7, EventMode::Force));
+	REQUIRE(queue.TryPush(Binary(true, 0x81, DNPTime(43)), 2, EventMode::Detect));
+	REQUIRE(queue.TryPush(TimeAndInterval(DNPTime(44), 5, 3), 1, EventMode::Detect));
+
+	REQUIRE(queue.Apply(db, queue.Capacity()) == 3);
+
+	REQUIRE(db.analogs.size() == 1);
+	REQUIRE(db.analogs[0].meas.value == 3.5);
+	REQUIRE(db.analogs[0].meas.quality == 0x01);
+	REQUIRE(db.analogs[0].meas.time == 42);
+	REQUIRE(db.analogs[0].index == 7);
+	REQUIRE(db.analogs[0].mode == EventMode::Force);
+
+	REQUIRE(db.binaries.size() == 1);
+	REQUIRE(db.binaries[0].value.value);
+	REQUIRE(db.binaries[0].value.quality == 0x81);
+	REQUIRE(db.binaries[0].index == 2);
+
+	REQUIRE(db.timeAndIntervals.size() == 1);
+	REQUIRE(db.timeAndIntervals[0].value.time == 44);
+	REQUIRE(db.timeAndIntervals[0].value.interval == 5);
+	REQUIRE(db.timeAndIntervals[0].value.units == 3);
+
+	auto stats = queue.GetStatistics();
+	REQUIRE(stats.numQueued == 3);
+	REQUIRE(stats.numApplied == 3);
+	REQUIRE(stats.numDrains == 1);
+}
+
+TEST_CASE(SUITE("Capacity is rounded up and overflows are counted"))
+{
+	UpdateQueue queue(UpdateQueueConfig(5));
+	RecordingDatabase db;
+
+	REQUIRE(queue.Capacity() == 8);
+
+	for (uint16_t i = 0; i < 8; ++i)
+	{
+		REQUIRE(queue.TryPush(Analog(i), i, EventMode::Detect));
+	}
+
+	REQUIRE_FALSE(queue.TryPush(Analog(8), 8, EventMode::Detect));
+	REQUIRE(queue.GetStatistics().numOverflows == 1);
+
+	// applying frees slots for the next lap around the ring
+	REQUIRE(queue.Apply(db, 2) == 2);
+	REQUIRE(queue.TryPush(Analog(8), 8, EventMode::Detect));
+	REQUIRE(queue.TryPush(Analog(9), 9, EventMode::Detect));
+	REQUIRE_FALSE(queue.TryPush(Analog(10), 10, EventMode::Detect));
+
+	REQUIRE(queue.Apply(db, queue.Capacity()) == 8);
+	REQUIRE(db.analogs.size() == 10);
+	for (uint16_t i = 0; i < 10; ++i)
+	{
+		REQUIRE(db.analogs[i].index == i);
+	}
+}
+
+TEST_CASE(SUITE("Zero capacity disables the queue"))
+{
+	UpdateQueue queue(UpdateQueueConfig(0));
+	REQUIRE(queue.Capacity() == 0);
+	REQUIRE_FALSE(queue.IsAvailable());
+}
+
+TEST_CASE(SUITE("Queue is unavailable while fallback updates are outstanding"))
+{
+	UpdateQueue queue(UpdateQueueConfig(8));
+	queue.BeginFallback();
+	REQUIRE_FALSE(queue.IsAvailable());
+	queue.EndFallback();
+	REQUIRE(queue.IsAvailable());
+}
+
+TEST_CASE(SUITE("Drain pending flag is only handed out once"))
+{
+	UpdateQueue queue(UpdateQueueConfig(8));
+	RecordingDatabase db;
+
+	REQUIRE(queue.TryPush(Analog(1), 1, EventMode::Detect));
+	REQUIRE(queue.MarkDrainPending());
+	REQUIRE_FALSE(queue.MarkDrainPending());
+
+	REQUIRE(queue.Apply(db, queue.Capacity()) == 1);
+
+	// an update that arrives before the consumer clears the flag is picked up by the same drain
+	REQUIRE(queue.TryPush(Analog(2), 2, EventMode::Detect));
+	REQUIRE_FALSE(queue.MarkDrainPending());
+	REQUIRE(queue.ClearDrainPending());
+	REQUIRE(queue.Apply(db, queue.Capacity()) == 1);
+	REQUIRE_FALSE(queue.ClearDrainPending());
+
+	REQUIRE(queue.MarkDrainPending());
+}
+
+TEST_CASE(SUITE("Change sets apply updates and functions in order and can be reused"))
+{
+	ChangeSet changes;
+	RecordingDatabase db;
+
+	changes.Update(UpdateRecord(Analog(1), 1, EventMode::Detect));
+	changes.Add([](IDatabase & db)
+	{
+		db.Update(Analog(2), 2, EventMode::Force);
+	});
+	changes.Update(UpdateRecord(Analog(3), 3, EventMode::Detect));
+
+	REQUIRE(changes.Size() == 3);
+	REQUIRE(changes.GetUpdate(0) != nullptr);
+	REQUIRE(changes.GetUpdate(1) == nullptr);
+
+	changes.ApplyFrom(1, db);
+	REQUIRE(db.analogs.size() == 2);
+	REQUIRE(db.analogs[0].index == 2);
+	REQUIRE(db.analogs[0].mode == EventMode::Force);
+	REQUIRE(db.analogs[1].index == 3);
+
+	changes.Clear();
+	REQUIRE(changes.IsEmpty());
+
+	changes.Update(UpdateRecord(Analog(4), 4, EventMode::Detect));
+	changes.ApplyAll(db);
+	REQUIRE(db.analogs.size() == 3);
+	REQUIRE(db.analogs[2].index == 4);
+}
+
+TEST_CASE(SUITE("Concurrent producers keep their own ordering"))
+{
+	const uint16_t NUM_PRODUCERS = 4;
+	const uint16_t NUM_UPDATES = 10000;
+
+	UpdateQueue queue(UpdateQueueConfig(64));
+	RecordingDatabase db;
+
+	std::vector<std::thread> producers;
+	for (uint16_t p = 0; p < NUM_PRODUCERS; ++p)
+	{
+		producers.push_back(std::thread([&queue, p]()
+		{
+			for (uint16_t i = 0; i < NUM_UPDATES;)
+			{
+				// the producer id is the index, the sequence is the value
+				if (queue.TryPush(Analog(i), p, EventMode::Detect))
+				{
+					++i;
+				}
+				else
+				{
+					std::this_thread::yield();
+				}
+			}
+		}));
+	}
+
+	while (db.analogs.size() < (NUM_PRODUCERS * NUM_UPDATES))
+	{
+		if (queue.Apply(db, queue.Capacity()) == 0)
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	for (auto& producer : producers)
+	{
+		producer.join();
+	}
+
+	std::vector<double> next(NUM_PRODUCERS, 0);
+	for (auto& update : db.analogs)
+	{
+		REQUIRE(update.meas.value == next[update.index]);
+		next[update.index] += 1;
+	}
+
+	REQUIRE(queue.GetStatistics().numApplied == (NUM_PRODUCERS * NUM_UPDATES));
+}
+
+TEST_CASE(SUITE("Analog updates per second through the queue and a change set"), "[.][benchmark]")
+{
+	const uint32_t NUM_UPDATES = 1000000;
+	const uint32_t BATCH = 1000;
+
+	RecordingDatabase db;
+	db.analogs.reserve(NUM_UPDATES);
+
+	{
+		UpdateQueueConfig config(BATCH);
+		UpdateQueue queue(config);
+		testlib::StopWatch sw;
+
+		for (uint32_t i = 0; i < NUM_UPDATES; i += BATCH)
+		{
+			for (uint32_t j = 0; j < BATCH; ++j)
+			{
+				queue.TryPush(Analog(j), static_cast<uint16_t>(j), EventMode::Detect);
+			}
+			queue.Apply(db, queue.Capacity());
+		}
+
+		auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(sw.Elapsed()).count();
+		REQUIRE(db.analogs.size() == NUM_UPDATES);
+		std::cout << "update queue: " << (NUM_UPDATES * 1000000ull / (elapsed ? elapsed : 1)) << " updates/sec" << std::endl;
+	}
+
+	db.analogs.clear();
+
+	{
+		testlib::StopWatch sw;
+
+		for (uint32_t i = 0; i < NUM_UPDATES; i += BATCH)
+		{
+			auto pChanges = new ChangeSet();
+			for (uint32_t j = 0; j < BATCH; ++j)
+			{
+				Analog meas(j);
+				uint16_t index = static_cast<uint16_t>(j);
+				pChanges->Add([ = ](IDatabase & db)
+				{
+					db.Update(meas, index, EventMode::Detect);
+				});
+			}
+			pChanges->ApplyAll(db);
+			delete pChanges;
+		}
+
+		auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(sw.Elapsed()).count();
+		REQUIRE(db.analogs.size() == NUM_UPDATES);
+		std::cout << "change set: " << (NUM_UPDATES * 1000000ull / (elapsed ? elapsed : 1)) << " updates/sec" << std::endl;
+	}
+}
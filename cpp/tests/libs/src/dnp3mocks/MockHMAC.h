@@ -22,14 +22,17 @@
 #define __MOCK_HMAC_H_
 
 #include <openpal/crypto/IHMACAlgo.h>
+#include <openpal/container/Buffer.h>
 
 namespace opendnp3
 {
+class MockKeyedHMAC;
+
 class MockHMAC : public openpal::IHMACAlgo
 {
 public:
 
-	MockHMAC(uint16_t size) : fillByte(0xFF), SIZE(size) {}
+	MockHMAC(uint16_t size) : fillByte(0xFF), numKeyedCalculations(0), SIZE(size) {}
 
 	virtual uint16_t OutputSize() const
 	{
@@ -60,14 +63,51 @@ public:
 		}
 	}
 
+	virtual std::unique_ptr<openpal::IKeyedHMAC> CreateKeyed(const openpal::RSlice& key, std::error_code& ec);
+
 	uint8_t fillByte;
 
+	/// --- number of calculations performed through a keyed context ---
+	uint32_t numKeyedCalculations;
+
 private:
 
 	const uint16_t SIZE;
 
 
 };
+
+class MockKeyedHMAC : public openpal::IKeyedHMAC
+{
+public:
+
+	MockKeyedHMAC(MockHMAC& hmac, const openpal::RSlice& key_) : pHMAC(&hmac), key(key_) {}
+
+	virtual uint16_t OutputSize() const
+	{
+		return pHMAC->OutputSize();
+	}
+
+	virtual openpal::RSlice Calculate(
+	    std::initializer_list<openpal::RSlice> data,
+	    openpal::WSlice& output,
+	    std::error_code& ec
+	)
+	{
+		++pHMAC->numKeyedCalculations;
+		return pHMAC->Calculate(key.ToRSlice(), data, output, ec);
+	}
+
+private:
+
+	MockHMAC* pHMAC;
+	openpal::Buffer key;
+};
+
+inline std::unique_ptr<openpal::IKeyedHMAC> MockHMAC::CreateKeyed(const openpal::RSlice& key, std::error_code& ec)
+{
+	return std::unique_ptr<openpal::IKeyedHMAC>(new MockKeyedHMAC(*this, key));
+}
 }
 
 #endif
@@ -0,0 +1,84 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#ifndef OPENDNP3_MOCK_STACK_METRICS_LISTENER_H_
+#define OPENDNP3_MOCK_STACK_METRICS_LISTENER_H_
+
+#include <opendnp3/IStackMetricsListener.h>
+
+#include <vector>
+
+namespace opendnp3
+{
+
+class MockStackMetricsListener final : public IStackMetricsListener
+{
+public:
+
+	MockStackMetricsListener() : numReadBegin(0), numReadEnd(0), lastEventCount(0), maxEventCount(0), numLinkRetransmit(0)
+	{}
+
+	virtual void OnTaskRequest(MasterTaskType type) override
+	{
+		requests.push_back(type);
+	}
+
+	virtual void OnTaskResponse(MasterTaskType type) override
+	{
+		responses.push_back(type);
+	}
+
+	virtual void OnReadBegin() override
+	{
+		++numReadBegin;
+	}
+
+	virtual void OnReadEnd() override
+	{
+		++numReadEnd;
+	}
+
+	virtual void OnEventCount(uint32_t numEvents) override
+	{
+		lastEventCount = numEvents;
+		if (numEvents > maxEventCount)
+		{
+			maxEventCount = numEvents;
+		}
+	}
+
+	virtual void OnLinkRetransmit() override
+	{
+		++numLinkRetransmit;
+	}
+
+	std::vector<MasterTaskType> requests;
+	std::vector<MasterTaskType> responses;
+
+	uint32_t numReadBegin;
+	uint32_t numReadEnd;
+	uint32_t lastEventCount;
+	uint32_t maxEventCount;
+	uint32_t numLinkRetransmit;
+};
+
+}
+
+#endif
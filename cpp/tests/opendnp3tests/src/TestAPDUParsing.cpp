@@ -26,6 +26,7 @@
 #include <testlib/BufferHelpers.h>
 #include <testlib/HexConversions.h>
 #include <testlib/MockLogHandler.h>
+#include <testlib/StopWatch.h>
 
 #include <openpal/util/ToHex.h>
 
@@ -36,6 +37,9 @@
 #include <opendnp3/app/Indexed.h>
 
 #include <functional>
+#include <sstream>
+#include <iostream>
+#include <chrono>
 
 using namespace std;
 using namespace openpal;
@@ -467,4 +471,110 @@ TEST_CASE(SUITE("Group43Var3CountWithAllIndexSizes"))
 	TestComplex("2B 03 28 01 00 09 00 01 32 00 00 00 88 6E D0 92 4A 01", ParseResult::OK, 1, validator);
 }
 
+TEST_CASE(SUITE("DefaultParsingHandlesNothingIfAnyHeaderIsMalformed"))
+{
+	// a valid g1v2 header followed by a header w/ an unknown qualifier
+	HexSequence buffer("01 02 00 01 01 81 01 02 09 02 00");
+	MockApduHeaderHandler mock;
+	auto result = APDUParser::Parse(buffer.ToRSlice(), mock, nullptr);
+	REQUIRE((result == ParseResult::UNKNOWN_QUALIFIER));
+	REQUIRE(mock.records.empty());
+}
+
+// visits every value like a master measurement handler, but retains nothing
+class CountingStaticHandler : public IAPDUHandler
+{
+public:
+
+	uint64_t numValues = 0;
+
+	virtual bool IsAllowed(uint32_t headerCount, GroupVariation gv, QualifierCode qc) override final
+	{
+		return true;
+	}
+
+protected:
+
+	virtual IINField ProcessHeader(const RangeHeader& header, const ICollection<Indexed<Binary>>& values) override final
+	{
+		return Count(values);
+	}
+
+	virtual IINField ProcessHeader(const RangeHeader& header, const ICollection<Indexed<BinaryOutputStatus>>& values) override final
+	{
+		return Count(values);
+	}
+
+	virtual IINField ProcessHeader(const RangeHeader& header, const ICollection<Indexed<Counter>>& values) override final
+	{
+		return Count(values);
+	}
+
+	virtual IINField ProcessHeader(const RangeHeader& header, const ICollection<Indexed<Analog>>& values) override final
+	{
+		return Count(values);
+	}
+
+	virtual IINField ProcessHeader(const RangeHeader& header, const ICollection<Indexed<AnalogOutputStatus>>& values) override final
+	{
+		return Count(values);
+	}
+
+private:
+
+	template <class T>
+	IINField Count(const ICollection<T>& values)
+	{
+		values.ForeachItem([this](const T&)
+		{
+			++numValues;
+		});
+		return IINField::Empty();
+	}
+};
+
+// appends a 1 byte start/stop header and 'size' bytes of zeroed object data per point
+void AppendRangeHeader(std::ostringstream& oss, uint8_t group, uint8_t variation, uint8_t stop, uint32_t size)
+{
+	oss << ToHex(&group, 1) << " " << ToHex(&variation, 1) << " 00 00 " << ToHex(&stop, 1);
+	for (uint32_t i = 0; i < (stop + 1u) * size; ++i)
+	{
+		oss << " 01";
+	}
+	oss << " ";
+}
+
+TEST_CASE(SUITE("Integrity poll responses parsed per second"), "[.][benchmark]")
+{
+	const uint32_t ITERATIONS = 20000;
 
+	// a typical class 0 response fragment: flags w/ binaries, output status, counters, analogs
+	std::ostringstream oss;
+	AppendRangeHeader(oss, 1, 2, 99, 1);
+	AppendRangeHeader(oss, 10, 2, 31, 1);
+	AppendRangeHeader(oss, 20, 1, 49, 5);
+	AppendRangeHeader(oss, 30, 1, 99, 5);
+	AppendRangeHeader(oss, 40, 1, 9, 5);
+
+	HexSequence buffer(oss.str());
+
+	CountingStaticHandler handler;
+	testlib::MockLogHandler log;
+	auto logger = log.GetLogger();
+
+	uint32_t numFailures = 0;
+	StopWatch sw;
+	for (uint32_t i = 0; i < ITERATIONS; ++i)
+	{
+		if (APDUParser::Parse(buffer.ToRSlice(), handler, &logger) != ParseResult::OK)
+		{
+			++numFailures;
+		}
+	}
+	auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(sw.Elapsed()).count();
+
+	REQUIRE(numFailures == 0);
+	REQUIRE(handler.numValues == 292ull * ITERATIONS);
+
+	std::cout << buffer.Size() << " byte responses: " << (ITERATIONS * 1000000ull / (elapsed ? elapsed : 1)) << " responses/sec" << std::endl;
+}
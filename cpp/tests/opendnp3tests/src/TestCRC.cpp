@@ -22,6 +22,7 @@
 
 
 #include <testlib/BufferHelpers.h>
+#include <testlib/StopWatch.h>
 
 #include <opendnp3/link/CRC.h>
 
@@ -29,6 +30,7 @@
 #include <vector>
 #include <string>
 #include <sstream>
+#include <chrono>
 
 using namespace std;
 using namespace opendnp3;
@@ -43,4 +45,64 @@ TEST_CASE(SUITE("CrcTest"))
 	REQUIRE(CRC::CalcCrc(hs, 8) == 0x21E9);
 }
 
+TEST_CASE(SUITE("SlicedMatchesBytewiseForAllFrameLengths"))
+{
+	std::vector<uint8_t> data;
+	uint32_t seed = 0x1234;
+	for (int i = 0; i < 300; ++i)
+	{
+		seed = seed * 1103515245 + 12345;
+		data.push_back(static_cast<uint8_t>(seed >> 16));
+	}
+
+	for (uint32_t length = 0; length <= data.size(); ++length)
+	{
+		REQUIRE(CRC::CalcCrc(data.data(), length) == CRC::CalcCrcBytewise(data.data(), length));
+	}
+}
 
+TEST_CASE(SUITE("AddCrcProducesCorrectCrc"))
+{
+	HexSequence hs("05 64 05 C0 01 00 00 04 00 00");
+	CRC::AddCrc(hs, 8);
+	REQUIRE(CRC::IsCorrectCRC(hs, 8));
+	REQUIRE(hs[8] == 0xE9);
+	REQUIRE(hs[9] == 0x21);
+}
+
+TEST_CASE(SUITE("Link frame blocks per second"), "[.][benchmark]")
+{
+	// full 16 byte data blocks and 8 byte headers are what the link layer checks
+	const uint32_t ITERATIONS = 2000000;
+
+	std::vector<uint8_t> block;
+	for (uint8_t i = 0; i < 16; ++i)
+	{
+		block.push_back(i);
+	}
+
+	for (uint32_t size : { 8u, 16u })
+	{
+		uint16_t sum = 0;
+		StopWatch bytewise;
+		for (uint32_t i = 0; i < ITERATIONS; ++i)
+		{
+			block[0] = static_cast<uint8_t>(i);
+			sum ^= CRC::CalcCrcBytewise(block.data(), size);
+		}
+		auto bytewiseUs = std::chrono::duration_cast<std::chrono::microseconds>(bytewise.Elapsed()).count();
+
+		StopWatch sliced;
+		for (uint32_t i = 0; i < ITERATIONS; ++i)
+		{
+			block[0] = static_cast<uint8_t>(i);
+			sum ^= CRC::CalcCrc(block.data(), size);
+		}
+		auto slicedUs = std::chrono::duration_cast<std::chrono::microseconds>(sliced.Elapsed()).count();
+
+		// both loops see the same inputs so the checksums cancel
+		REQUIRE(sum == 0);
+
+		std::cout << size << " byte blocks: bytewise " << bytewiseUs << " us, slice-by-8 " << slicedUs << " us" << std::endl;
+	}
+}
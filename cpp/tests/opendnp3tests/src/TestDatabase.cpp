@@ -22,12 +22,19 @@
 
 #include "mocks/MeasurementComparisons.h"
 #include "mocks/DatabaseTestObject.h"
+#include "mocks/APDUHelpers.h"
+
+#include <testlib/StopWatch.h>
+#include <testlib/HexConversions.h>
 
 #include <limits>
+#include <iostream>
+#include <chrono>
 
 using namespace std;
 using namespace openpal;
 using namespace opendnp3;
+using namespace testlib;
 
 template <class T>
 void TestBufferForEvent(bool aIsEvent, const T& arNewVal, DatabaseTestObject& test, std::deque< Event <T> >& arQueue)
@@ -61,6 +68,20 @@ bool IsCounterEvent(uint32_t val1, uint32_t val2, uint32_t deadband)
 	return c1.IsEvent(c2, deadband);
 }
 
+std::string LoadStatic(DatabaseTestObject& t, uint32_t size)
+{
+	auto response = APDUHelpers::Response(size);
+	auto writer = response.GetWriter();
+	t.db.buffers.Load(writer);
+	return ToHex(response.ToRSlice());
+}
+
+// the object header that starts at a particular byte offset of the hex
+std::string HeaderAt(const std::string& hex, uint32_t offset)
+{
+	return hex.substr(3 * offset, 14);
+}
+
 #define SUITE(name) "DatabaseTestSuite - " name
 
 // tests for the various analog event conditions
@@ -178,3 +199,218 @@ TEST_CASE(SUITE("CounterLastReportedChange"))
 }
 
 
+
+TEST_CASE(SUITE("SelectedValueIsPreservedWhenUpdatedBeforeWrite"))
+{
+	DatabaseTestObject t(DatabaseTemplate::AnalogOnly(2));
+	t.db.Update(Analog(1), 0);
+	t.db.Update(Analog(1), 1);
+
+	REQUIRE_FALSE(t.db.buffers.SelectAll(GroupVariation::Group30Var0).Any());
+
+	t.db.Update(Analog(2), 0);
+	t.db.Update(Analog(3), 0);
+
+	auto selection = t.db.buffers.GetSelection<Analog>();
+	auto view = t.db.buffers.buffers.GetArrayView<Analog>();
+
+	REQUIRE(selection.IsSelected(0));
+	REQUIRE(selection.GetSelectedValue(0, view[0]).value == 1);
+	REQUIRE(view[0].value.value == 3);
+
+	// untouched cells report the live value
+	REQUIRE(selection.IsSelected(1));
+	REQUIRE(selection.GetSelectedValue(1, view[1]).value == 1);
+}
+
+TEST_CASE(SUITE("UnselectDeselectsAllCells"))
+{
+	DatabaseTestObject t(DatabaseTemplate::AnalogOnly(2));
+
+	REQUIRE_FALSE(t.db.buffers.SelectAll(GroupVariation::Group30Var0).Any());
+	t.db.Unselect();
+
+	auto selection = t.db.buffers.GetSelection<Analog>();
+
+	REQUIRE_FALSE(selection.IsSelected(0));
+	REQUIRE_FALSE(selection.IsSelected(1));
+	REQUIRE_FALSE(t.db.buffers.HasAnySelection());
+
+	// a new selection reports values updated after the previous one was cleared
+	t.db.Update(Analog(4), 0);
+	REQUIRE_FALSE(t.db.buffers.SelectAll(GroupVariation::Group30Var0).Any());
+
+	selection = t.db.buffers.GetSelection<Analog>();
+	REQUIRE(selection.GetSelectedValue(0, t.db.buffers.buffers.GetArrayView<Analog>()[0]).value == 4);
+}
+
+TEST_CASE(SUITE("ContiguousRunsAreSplitByVariation"))
+{
+	DatabaseTestObject t(DatabaseTemplate::AnalogOnly(100));
+	t.db.GetConfigView().analogs[50].variation = StaticAnalogVariation::Group30Var2;
+
+	t.db.buffers.SelectAll(GroupVariation::Group60Var1);
+	auto hex = LoadStatic(t, 2048);
+
+	REQUIRE(hex.size() == (3 * 517 - 1));
+	REQUIRE(HeaderAt(hex, 4) == "1E 01 00 00 31");
+	REQUIRE(HeaderAt(hex, 259) == "1E 02 00 32 32");
+	REQUIRE(HeaderAt(hex, 267) == "1E 01 00 33 63");
+	REQUIRE_FALSE(t.db.buffers.HasAnySelection());
+}
+
+TEST_CASE(SUITE("ContiguousRunsAreSplitAcrossFragments"))
+{
+	DatabaseTestObject t(DatabaseTemplate::AnalogOnly(100));
+	t.db.GetConfigView().analogs[50].variation = StaticAnalogVariation::Group30Var2;
+
+	t.db.buffers.SelectAll(GroupVariation::Group60Var1);
+
+	// 18 g30v1 values fit in 100 bytes
+	auto first = LoadStatic(t, 100);
+	REQUIRE(first.size() == (3 * 99 - 1));
+	REQUIRE(HeaderAt(first, 4) == "1E 01 00 00 11");
+
+	auto second = LoadStatic(t, 100);
+	REQUIRE(second.size() == (3 * 99 - 1));
+	REQUIRE(HeaderAt(second, 4) == "1E 01 00 12 23");
+
+	// the end of the first run, the g30v2 value, and a single value of the last run
+	auto third = LoadStatic(t, 100);
+	REQUIRE(third.size() == (3 * 97 - 1));
+	REQUIRE(HeaderAt(third, 4) == "1E 01 00 24 31");
+	REQUIRE(HeaderAt(third, 79) == "1E 02 00 32 32");
+	REQUIRE(HeaderAt(third, 87) == "1E 01 00 33 33");
+
+	REQUIRE(t.db.buffers.HasAnySelection());
+}
+
+TEST_CASE(SUITE("Class 0 latency versus database size"), "[.][benchmark]")
+{
+	const uint16_t SIZES[] = { 1000, 10000, 65535 };
+	const int ITERATIONS = 100;
+
+	for (auto size : SIZES)
+	{
+		DatabaseTestObject t(DatabaseTemplate::AnalogOnly(size));
+
+		std::chrono::microseconds first(0);
+		std::chrono::microseconds total(0);
+
+		for (int i = 0; i < ITERATIONS; ++i)
+		{
+			StopWatch sw;
+
+			t.db.buffers.SelectAll(GroupVariation::Group60Var1);
+
+			bool complete = false;
+			bool isFirst = true;
+
+			while (!complete)
+			{
+				auto response = APDUHelpers::Response();
+				auto writer = response.GetWriter();
+				complete = t.db.buffers.Load(writer);
+
+				if (isFirst)
+				{
+					first += std::chrono::duration_cast<std::chrono::microseconds>(sw.Elapsed());
+					isFirst = false;
+				}
+
+				// values keep changing while the response is being sent
+				t.db.Update(Analog(i), 0);
+			}
+
+			t.db.Unselect();
+
+			total += std::chrono::duration_cast<std::chrono::microseconds>(sw.Elapsed());
+		}
+
+		std::cout << "Class 0 of " << size << " analogs: first fragment " << (first.count() / ITERATIONS)
+		          << " us, complete response " << (total.count() / ITERATIONS) << " us" << std::endl;
+	}
+}
+
+TEST_CASE(SUITE("Analog update throughput"), "[.][benchmark]")
+{
+	const uint16_t SIZE = 65535;
+	const int PASSES = 20;
+
+	DatabaseTestObject t(DatabaseTemplate::AnalogOnly(SIZE));
+
+	{
+		// detection runs on every update, but nothing exceeds the deadband
+		auto view = t.db.GetConfigView();
+		view.analogs.foreach([](Cell<Analog>& cell)
+		{
+			cell.metadata.clazz = PointClass::Class1;
+			cell.metadata.deadband = 1000000;
+		});
+	}
+
+	for (auto selected : { false, true })
+	{
+		if (selected)
+		{
+			// every update lands on a selected cell that hasn't been written yet
+			t.db.buffers.SelectAll(GroupVariation::Group60Var1);
+		}
+
+		StopWatch sw;
+
+		for (int pass = 0; pass < PASSES; ++pass)
+		{
+			for (uint16_t i = 0; i < SIZE; ++i)
+			{
+				t.db.Update(Analog(pass, 0x01), i);
+			}
+		}
+
+		auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(sw.Elapsed());
+		auto rate = (static_cast<double>(SIZE) * PASSES * 1000000.0) / elapsed.count();
+
+		std::cout << "Updates to " << SIZE << " analogs" << (selected ? " during a class 0 read: " : ": ")
+		          << static_cast<uint64_t>(rate) << " per second" << std::endl;
+
+		t.db.Unselect();
+	}
+}
+
+TEST_CASE(SUITE("Class 0 serialization bytes per second"), "[.][benchmark]")
+{
+	const uint16_t SIZE = 65535;
+	const int ITERATIONS = 50;
+
+	auto measure = [](const char* name, const DatabaseTemplate& dbTemplate)
+	{
+		DatabaseTestObject t(dbTemplate);
+
+		uint64_t bytes = 0;
+		StopWatch sw;
+
+		for (int i = 0; i < ITERATIONS; ++i)
+		{
+			t.db.buffers.SelectAll(GroupVariation::Group60Var1);
+
+			bool complete = false;
+			while (!complete)
+			{
+				auto response = APDUHelpers::Response();
+				auto writer = response.GetWriter();
+				complete = t.db.buffers.Load(writer);
+				bytes += response.ToRSlice().Size();
+			}
+		}
+
+		auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(sw.Elapsed());
+		auto rate = static_cast<double>(bytes) / elapsed.count();
+
+		std::cout << "Class 0 of " << SIZE << " " << name << ": " << rate << " MB/s" << std::endl;
+	};
+
+	measure("g1v2 binaries", DatabaseTemplate::BinaryOnly(SIZE));
+	measure("g30v1 analogs", DatabaseTemplate::AnalogOnly(SIZE));
+	measure("g20v1 counters", DatabaseTemplate::CounterOnly(SIZE));
+	measure("g40v1 analog output statii", DatabaseTemplate::AnalogOutputStatusOnly(SIZE));
+}
@@ -0,0 +1,186 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include <opendnp3/outstation/EventBuffer.h>
+#include <opendnp3/app/APDUResponse.h>
+
+#include <testlib/HexConversions.h>
+#include <testlib/StopWatch.h>
+
+#include "mocks/APDUHelpers.h"
+
+#include <iostream>
+#include <chrono>
+
+using namespace std;
+using namespace openpal;
+using namespace opendnp3;
+using namespace testlib;
+
+#define SUITE(name) "EventBufferTestSuite - " name
+
+namespace
+{
+void AddBinary(EventBuffer& buffer, bool value, uint16_t index, EventClass clazz = EventClass::EC1)
+{
+	buffer.Update(Event<Binary>(Binary(value), index, clazz, EventBinaryVariation::Group2Var1));
+}
+
+void AddAnalog(EventBuffer& buffer, int32_t value, uint16_t index, EventClass clazz = EventClass::EC1)
+{
+	buffer.Update(Event<Analog>(Analog(value), index, clazz, EventAnalogVariation::Group32Var1));
+}
+
+std::string Load(EventBuffer& buffer)
+{
+	APDUResponse response(APDUHelpers::Response());
+	auto writer = response.GetWriter();
+	buffer.Load(writer);
+	return ToHex(response.ToRSlice());
+}
+}
+
+TEST_CASE(SUITE("Selections by type are written in SOE order"))
+{
+	EventBuffer buffer(EventBufferConfig::AllTypes(10));
+
+	AddBinary(buffer, true, 0);
+	AddAnalog(buffer, 5, 1);
+	AddBinary(buffer, true, 2);
+
+	buffer.SelectAll(GroupVariation::Group32Var0);
+	buffer.SelectAll(GroupVariation::Group2Var0);
+
+	REQUIRE(Load(buffer) == "C0 81 00 00 02 01 28 01 00 00 00 81 20 01 28 01 00 01 00 01 05 00 00 00 02 01 28 01 00 02 00 81");
+}
+
+TEST_CASE(SUITE("Selection by type only selects that type"))
+{
+	EventBuffer buffer(EventBufferConfig::AllTypes(10));
+
+	AddBinary(buffer, true, 0);
+	AddAnalog(buffer, 5, 1);
+	AddBinary(buffer, true, 2);
+
+	buffer.SelectCount(GroupVariation::Group2Var0, 1);
+	REQUIRE(Load(buffer) == "C0 81 00 00 02 01 28 01 00 00 00 81");
+	buffer.ClearWritten();
+
+	buffer.SelectAll(GroupVariation::Group2Var0);
+	REQUIRE(Load(buffer) == "C0 81 00 00 02 01 28 01 00 02 00 81");
+	buffer.ClearWritten();
+
+	REQUIRE(buffer.UnwrittenClassField().HasClass1());
+	buffer.SelectAll(GroupVariation::Group32Var0);
+	REQUIRE(Load(buffer) == "C0 81 00 00 20 01 28 01 00 01 00 01 05 00 00 00");
+	buffer.ClearWritten();
+
+	REQUIRE_FALSE(buffer.UnwrittenClassField().HasEventClass());
+}
+
+TEST_CASE(SUITE("Class selection only selects the requested classes in SOE order"))
+{
+	EventBuffer buffer(EventBufferConfig::AllTypes(10));
+
+	AddBinary(buffer, true, 0, EventClass::EC2);
+	AddBinary(buffer, true, 1, EventClass::EC1);
+	AddBinary(buffer, true, 2, EventClass::EC3);
+	AddBinary(buffer, true, 3, EventClass::EC1);
+
+	buffer.SelectAllByClass(ClassField(false, true, true, false));
+	REQUIRE(Load(buffer) == "C0 81 00 00 02 01 28 03 00 00 00 81 01 00 81 03 00 81");
+	buffer.ClearWritten();
+
+	auto unwritten = buffer.UnwrittenClassField();
+	REQUIRE_FALSE(unwritten.HasClass1());
+	REQUIRE_FALSE(unwritten.HasClass2());
+	REQUIRE(unwritten.HasClass3());
+}
+
+TEST_CASE(SUITE("Overflow discards the oldest event of the same type"))
+{
+	EventBuffer buffer(EventBufferConfig::AllTypes(2));
+
+	AddBinary(buffer, true, 0);
+	AddAnalog(buffer, 5, 1);
+	AddBinary(buffer, true, 2);
+	AddBinary(buffer, true, 3);
+
+	REQUIRE(buffer.IsOverflown());
+
+	buffer.SelectAllByClass(ClassField::AllEventClasses());
+	REQUIRE(Load(buffer) == "C0 81 00 00 20 01 28 01 00 01 00 01 05 00 00 00 02 01 28 02 00 02 00 81 03 00 81");
+}
+
+TEST_CASE(SUITE("Unselect restores events that were written but not confirmed"))
+{
+	EventBuffer buffer(EventBufferConfig::AllTypes(10));
+
+	AddBinary(buffer, true, 0);
+	AddBinary(buffer, true, 1);
+
+	buffer.SelectAll(GroupVariation::Group2Var0);
+	REQUIRE(Load(buffer) == "C0 81 00 00 02 01 28 02 00 00 00 81 01 00 81");
+	REQUIRE_FALSE(buffer.HasAnySelection());
+
+	buffer.Unselect();
+
+	buffer.SelectAll(GroupVariation::Group2Var0);
+	REQUIRE(buffer.HasAnySelection());
+	REQUIRE(Load(buffer) == "C0 81 00 00 02 01 28 02 00 00 00 81 01 00 81");
+}
+
+TEST_CASE(SUITE("Select latency versus buffer fill"), "[.][benchmark]")
+{
+	const uint16_t ANALOGS = 100;
+	const uint16_t FILLS[] = { 1000, 10000, 60000 };
+	const int ITERATIONS = 100;
+
+	for (auto binaries : FILLS)
+	{
+		EventBuffer buffer(EventBufferConfig(binaries, 0, ANALOGS));
+
+		for (uint16_t i = 0; i < binaries; ++i)
+		{
+			AddBinary(buffer, (i % 2) == 0, i);
+		}
+
+		for (uint16_t i = 0; i < ANALOGS; ++i)
+		{
+			AddAnalog(buffer, i, i);
+		}
+
+		StopWatch sw;
+
+		for (int i = 0; i < ITERATIONS; ++i)
+		{
+			buffer.SelectAll(GroupVariation::Group32Var0);
+			Load(buffer);
+			buffer.Unselect();
+		}
+
+		auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(sw.Elapsed());
+
+		std::cout << "Group32Var0 select + load of " << ANALOGS << " analogs behind " << binaries << " binaries: "
+		          << (elapsed.count() / ITERATIONS) << " us" << std::endl;
+	}
+}
@@ -0,0 +1,98 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include <openpal/util/LatencyHistogram.h>
+
+using namespace openpal;
+
+#define SUITE(name) "LatencyHistogramTestSuite - " name
+
+namespace
+{
+void Record(LatencyHistogram& histogram, uint64_t microseconds)
+{
+	++histogram.counts[LatencyHistogram::GetBucket(microseconds)];
+	++histogram.count;
+	histogram.totalMicroseconds += microseconds;
+	if (microseconds > histogram.maxMicroseconds)
+	{
+		histogram.maxMicroseconds = microseconds;
+	}
+}
+}
+
+TEST_CASE(SUITE("SmallValuesHaveTheirOwnBuckets"))
+{
+	for (uint32_t i = 0; i < LatencyHistogram::NUM_SUB_BUCKETS; ++i)
+	{
+		REQUIRE(LatencyHistogram::GetBucket(i) == i);
+		REQUIRE(LatencyHistogram::GetBucketLowerBound(i) == i);
+		REQUIRE(LatencyHistogram::GetBucketUpperBound(i) == i);
+	}
+}
+
+TEST_CASE(SUITE("BucketsCoverValuesWithoutGaps"))
+{
+	for (uint32_t i = 0; i < LatencyHistogram::NUM_BUCKETS - 1; ++i)
+	{
+		const auto lower = LatencyHistogram::GetBucketLowerBound(i);
+		const auto upper = LatencyHistogram::GetBucketUpperBound(i);
+
+		REQUIRE(LatencyHistogram::GetBucket(lower) == i);
+		REQUIRE(LatencyHistogram::GetBucket(upper) == i);
+		REQUIRE(LatencyHistogram::GetBucketLowerBound(i + 1) == upper + 1);
+
+		// above the first buckets, widths stay within 25% of the values they hold
+		if (i >= LatencyHistogram::NUM_SUB_BUCKETS)
+		{
+			REQUIRE((upper - lower + 1) * 4 <= lower);
+		}
+	}
+}
+
+TEST_CASE(SUITE("LargeValuesGoInTheLastBucket"))
+{
+	const uint64_t big = static_cast<uint64_t>(1) << 40;
+	REQUIRE(LatencyHistogram::GetBucket(0xFFFFFFFF) == LatencyHistogram::NUM_BUCKETS - 1);
+	REQUIRE(LatencyHistogram::GetBucket(big) == LatencyHistogram::NUM_BUCKETS - 1);
+}
+
+TEST_CASE(SUITE("PercentilesAndMean"))
+{
+	LatencyHistogram histogram;
+	REQUIRE(histogram.PercentileMicroseconds(50) == 0);
+	REQUIRE(histogram.MeanMicroseconds() == 0.0);
+
+	for (uint64_t i = 1; i <= 99; ++i)
+	{
+		Record(histogram, 100);
+	}
+	Record(histogram, 10000);
+
+	REQUIRE(histogram.count == 100);
+	REQUIRE(histogram.MeanMicroseconds() == Approx(199.0));
+
+	// 100 is in the bucket [96, 111]
+	REQUIRE(histogram.PercentileMicroseconds(50) == 111);
+	REQUIRE(histogram.PercentileMicroseconds(99) == 111);
+	REQUIRE(histogram.PercentileMicroseconds(100) == 10000);
+}
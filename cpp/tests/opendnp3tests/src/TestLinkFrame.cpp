@@ -177,3 +177,57 @@ TEST_CASE(SUITE("NotSupported"))
 
 
 
+
+TEST_CASE(SUITE("CountFrames"))
+{
+	Buffer buffer(3 * 292);
+	auto write = buffer.GetWSlice();
+
+	HexSequence hs("01 02 03 04 05 06 07 08 09 0A 0B 0C 0D 0E 0F 10 11");
+	LinkFrame::FormatResetLinkStates(write, true, 1, 1024, nullptr);
+	LinkFrame::FormatUnconfirmedUserData(write, true, 1, 1024, hs, hs.Size(), nullptr);
+	LinkFrame::FormatAck(write, true, false, 1, 1024, nullptr);
+
+	auto frames = buffer.ToRSlice().Take(buffer.Size() - write.Size());
+
+	REQUIRE(LinkFrame::CountFrames(frames) == 3);
+	REQUIRE(LinkFrame::CountFrames(frames.Take(frames.Size() - 1)) == 2);
+	REQUIRE(LinkFrame::CountFrames(RSlice::Empty()) == 0);
+}
+
+TEST_CASE(SUITE("SegmentUserDataMatchesContiguousUserData"))
+{
+	// every payload size so that the header byte lands in partial and complete first blocks
+	for (uint32_t size = 0; size < 250; ++size)
+	{
+		Buffer apdu(250);
+		for (uint32_t i = 0; i < apdu.Size(); ++i)
+		{
+			apdu()[i] = static_cast<uint8_t>(i);
+		}
+
+		// the contiguous tpdu is the header byte followed by the payload
+		apdu()[0] = 0xC0;
+		auto tpdu = apdu.ToRSlice().Take(size + 1);
+		TransportSegment segment(0xC0, tpdu.Skip(1));
+
+		for (bool confirmed : { true, false })
+		{
+			uint8_t expected[292];
+			uint8_t actual[292];
+			WSlice expectedWrapper(expected, 292);
+			WSlice actualWrapper(actual, 292);
+
+			auto expectedFrame = confirmed ?
+			                     LinkFrame::FormatConfirmedUserData(expectedWrapper, true, true, 1, 1024, tpdu, tpdu.Size(), nullptr) :
+			                     LinkFrame::FormatUnconfirmedUserData(expectedWrapper, true, 1, 1024, tpdu, tpdu.Size(), nullptr);
+
+			auto actualFrame = confirmed ?
+			                   LinkFrame::FormatConfirmedUserData(actualWrapper, true, true, 1, 1024, segment, nullptr) :
+			                   LinkFrame::FormatUnconfirmedUserData(actualWrapper, true, 1, 1024, segment, nullptr);
+
+			REQUIRE(actualWrapper.Size() == expectedWrapper.Size());
+			REQUIRE(ToHex(actualFrame) == ToHex(expectedFrame));
+		}
+	}
+}
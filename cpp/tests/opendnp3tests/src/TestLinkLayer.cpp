@@ -21,6 +21,7 @@
 #include <catch.hpp>
 
 #include <opendnp3/ErrorCodes.h>
+#include <opendnp3/transport/TransportTx.h>
 
 #include <openpal/util/ToHex.h>
 
@@ -28,6 +29,9 @@
 #include "mocks/LinkLayerTest.h"
 #include "mocks/LinkHex.h"
 
+#include <dnp3mocks/MockStackMetricsListener.h>
+
+#include <testlib/BufferHelpers.h>
 #include <testlib/HexConversions.h>
 
 
@@ -248,6 +252,58 @@ TEST_CASE(SUITE("SendUnconfirmed"))
 }
 
 
+TEST_CASE(SUITE("SendUnconfirmedMultipleFramesPerWrite"))
+{
+	LinkConfig config = LinkLayerTest::DefaultConfig();
+	config.MaxUnconfirmedFramesPerWrite = 2;
+
+	LinkLayerTest t(config);
+	t.link.OnLowerLayerUp();
+
+	BufferSegment segments(250, IncrementHex(0, 250) + IncrementHex(0, 250) + IncrementHex(0, 10));
+	t.link.Send(segments);
+	REQUIRE(t.NumTotalWrites() == 1);
+	REQUIRE(t.PopLastWriteAsHex() == LinkHex::UnconfirmedUserData(true, 1024, 1, IncrementHex(0, 250)) + " " + LinkHex::UnconfirmedUserData(true, 1024, 1, IncrementHex(0, 250)));
+
+	t.link.OnTransmitResult(true);
+	REQUIRE(t.NumTotalWrites() == 2);
+	REQUIRE(t.PopLastWriteAsHex() == LinkHex::UnconfirmedUserData(true, 1024, 1, IncrementHex(0, 10)));
+
+	t.link.OnTransmitResult(true);
+	REQUIRE(t.exe.RunMany() > 0);
+
+	REQUIRE(t.upper.GetState().successCnt == 1);
+	REQUIRE(t.NumTotalWrites() == 2);
+}
+
+TEST_CASE(SUITE("SendUnconfirmedMultipleFramesPerWriteDoesNotSkipTransportSequence"))
+{
+	LinkConfig config = LinkLayerTest::DefaultConfig();
+	config.MaxUnconfirmedFramesPerWrite = 2;
+
+	LinkLayerTest t(config);
+	t.link.OnLowerLayerUp();
+
+	TransportTx tx(t.log.GetLogger(), nullptr);
+	HexSequence apdu("12 34 56");
+
+	tx.Configure(apdu.ToRSlice());
+	t.link.Send(tx);
+	REQUIRE(t.PopLastWriteAsHex() == LinkHex::UnconfirmedUserData(true, 1024, 1, "C0 12 34 56"));
+	t.link.OnTransmitResult(true);
+	REQUIRE(t.exe.RunMany() > 0);
+	REQUIRE(t.upper.GetState().successCnt == 1);
+
+	// the single segment was consumed by the batch, so the next fragment uses the very next sequence number
+	tx.Configure(apdu.ToRSlice());
+	t.link.Send(tx);
+	REQUIRE(t.PopLastWriteAsHex() == LinkHex::UnconfirmedUserData(true, 1024, 1, "C1 12 34 56"));
+	t.link.OnTransmitResult(true);
+	REQUIRE(t.exe.RunMany() > 0);
+	REQUIRE(t.upper.GetState().successCnt == 2);
+	REQUIRE(t.NumTotalWrites() == 2);
+}
+
 TEST_CASE(SUITE("CloseBehavior"))
 {
 	LinkLayerTest t;
@@ -421,6 +477,31 @@ TEST_CASE(SUITE("ConfirmedDataRetry"))
 	REQUIRE(t.upper.CountersEqual(1, 0));
 }
 
+TEST_CASE(SUITE("ConfirmedDataRetryIsCountedAsRetransmit"))
+{
+	LinkConfig cfg = LinkLayerTest::DefaultConfig();
+	cfg.NumRetry = 1;
+	cfg.UseConfirms = true;
+
+	LinkLayerTest t(cfg);
+	MockStackMetricsListener metrics;
+	t.link.SetMetricsListener(&metrics);
+	t.link.OnLowerLayerUp();
+
+	BufferSegment segments(250, IncrementHex(0, 250));
+	t.link.Send(segments);
+	t.link.OnTransmitResult(true);
+
+	t.OnFrame(LinkFunction::SEC_ACK, false, false, false, 1, 1024);
+	t.link.OnTransmitResult(true);
+	REQUIRE(metrics.numLinkRetransmit == 0);
+
+	t.exe.AdvanceTime(cfg.Timeout);
+	REQUIRE(t.exe.RunMany() > 0);
+	REQUIRE(t.NumTotalWrites() == 3);
+	REQUIRE(metrics.numLinkRetransmit == 1);
+}
+
 TEST_CASE(SUITE("ResetLinkRetries"))
 {
 	LinkConfig cfg = LinkLayerTest::DefaultConfig();
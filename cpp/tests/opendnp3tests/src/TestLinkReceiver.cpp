@@ -27,10 +27,39 @@
 
 #include <openpal/container/Buffer.h>
 
+#include <opendnp3/link/IFrameSink.h>
+
+#include <testlib/HexConversions.h>
+#include <testlib/StopWatch.h>
+
+#include <iostream>
+#include <chrono>
+
 using namespace openpal;
 using namespace opendnp3;
 using namespace testlib;
 
+namespace
+{
+class CountingFrameSink : public IFrameSink
+{
+public:
+
+	CountingFrameSink() : numFrames(0), numBytes(0)
+	{}
+
+	virtual bool OnFrame(const LinkHeaderFields& header, const openpal::RSlice& userdata) override final
+	{
+		++numFrames;
+		numBytes += userdata.Size();
+		return true;
+	}
+
+	uint64_t numFrames;
+	uint64_t numBytes;
+};
+}
+
 
 #define SUITE(name) "LinkParserTestSuite - " name
 
@@ -319,3 +348,93 @@ TEST_CASE(SUITE("ManyReceives"))
 	}
 }
 
+
+TEST_CASE(SUITE("LargeBufferParsesEveryFrameInOneRead"))
+{
+	const uint32_t NUM_FRAMES = 10;
+
+	Buffer buffer(NUM_FRAMES * LPDU_MAX_FRAME_SIZE);
+	auto writeTo = buffer.GetWSlice();
+	HexSequence data(IncrementHex(0, 250));
+
+	for (uint32_t i = 0; i < NUM_FRAMES; ++i)
+	{
+		LinkFrame::FormatUnconfirmedUserData(writeTo, true, 1, 1024, data, data.Size(), nullptr);
+	}
+
+	LinkParserTest t(4096);
+	REQUIRE(t.parser.WriteBuff().Size() == 4096);
+
+	t.WriteData(buffer.ToRSlice().Take(buffer.Size() - writeTo.Size()));
+	REQUIRE(t.log.IsLogErrorFree());
+	REQUIRE(t.sink.m_num_frames == NUM_FRAMES);
+	REQUIRE(t.sink.CheckLast(LinkFunction::PRI_UNCONFIRMED_USER_DATA, true, 1, 1024));
+
+	std::string expected;
+	for (uint32_t i = 0; i < NUM_FRAMES; ++i)
+	{
+		expected += (i == 0) ? IncrementHex(0, 250) : (" " + IncrementHex(0, 250));
+	}
+	REQUIRE(t.sink.BufferEqualsHex(expected));
+}
+
+TEST_CASE(SUITE("BufferSizeIsNeverLessThanOneFrame"))
+{
+	LinkParserTest t(10);
+	REQUIRE(t.parser.WriteBuff().Size() == LPDU_MAX_FRAME_SIZE);
+}
+
+TEST_CASE(SUITE("ResyncSkipsLongRunsOfNoise"))
+{
+	LinkParserTest t;
+	t.WriteData("01 02 03 05 05 04 FF 64 05 64 05 C0 01 00 00 04 E9 21");
+	REQUIRE(t.sink.m_num_frames == 1);
+	REQUIRE(t.sink.CheckLast(LinkFunction::PRI_RESET_LINK_STATES, true, 1, 1024));
+}
+
+TEST_CASE(SUITE("Frames per second parsed from a captured stream"), "[.][benchmark]")
+{
+	// a stream of full user data frames interleaved with acks, as seen on a busy channel
+	const uint32_t NUM_PAIRS = 1000;
+	const uint32_t ITERATIONS = 20;
+
+	Buffer capture(NUM_PAIRS * (LPDU_MAX_FRAME_SIZE + LPDU_HEADER_SIZE));
+	auto writeTo = capture.GetWSlice();
+	HexSequence data(IncrementHex(0, 250));
+
+	for (uint32_t i = 0; i < NUM_PAIRS; ++i)
+	{
+		LinkFrame::FormatUnconfirmedUserData(writeTo, true, 1, 1024, data, data.Size(), nullptr);
+		LinkFrame::FormatAck(writeTo, false, false, 1024, 1, nullptr);
+	}
+
+	const auto stream = capture.ToRSlice().Take(capture.Size() - writeTo.Size());
+
+	for (auto rxBufferSize : { 292u, 4096u, 65536u })
+	{
+		testlib::MockLogHandler log;
+		LinkLayerParser parser(log.GetLogger(), nullptr, rxBufferSize);
+		CountingFrameSink sink;
+
+		StopWatch sw;
+
+		for (uint32_t i = 0; i < ITERATIONS; ++i)
+		{
+			auto input = stream;
+			while (input.IsNotEmpty())
+			{
+				auto dest = parser.WriteBuff();
+				auto num = (input.Size() < dest.Size()) ? input.Size() : dest.Size();
+				input.Take(num).CopyTo(dest);
+				input.Advance(num);
+				parser.OnRead(num, &sink);
+			}
+		}
+
+		auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(sw.Elapsed()).count();
+		REQUIRE(sink.numFrames == (2 * NUM_PAIRS * ITERATIONS));
+
+		std::cout << "rx buffer " << rxBufferSize << " bytes: "
+		          << (sink.numFrames * 1000000 / (elapsed ? elapsed : 1)) << " frames/sec" << std::endl;
+	}
+}
@@ -27,6 +27,7 @@
 #include <dnp3mocks/MockTaskCallback.h>
 #include <dnp3mocks/APDUHexBuilders.h>
 #include <dnp3mocks/CallbackQueue.h>
+#include <dnp3mocks/MockStackMetricsListener.h>
 
 #include <opendnp3/app/APDUResponse.h>
 #include <opendnp3/app/APDUBuilders.h>
@@ -77,6 +78,30 @@ TEST_CASE(SUITE("SolicitedResponseWithData"))
 	REQUIRE((Binary(true, 0x01) == t.meas.binarySOE[2].meas));
 }
 
+TEST_CASE(SUITE("RoundTripIsReportedByTaskType"))
+{
+	MasterParams params;
+	params.disableUnsolOnStartup = false;
+	params.unsolClassMask = 0;
+	MasterTestObject t(params);
+	MockStackMetricsListener metrics;
+	t.context.SetMetricsListener(&metrics);
+	t.context.OnLowerLayerUp();
+
+	t.exe.RunMany();
+
+	REQUIRE(t.lower.PopWriteAsHex() == hex::IntegrityPoll(0));
+	REQUIRE(metrics.requests.size() == 1);
+	REQUIRE(metrics.requests[0] == MasterTaskType::STARTUP_INTEGRITY_POLL);
+	REQUIRE(metrics.responses.empty());
+
+	t.context.OnSendResult(true);
+	t.SendToMaster(hex::EmptyResponse(0));
+
+	REQUIRE(metrics.responses.size() == 1);
+	REQUIRE(metrics.responses[0] == MasterTaskType::STARTUP_INTEGRITY_POLL);
+}
+
 TEST_CASE(SUITE("UnsolDisableEnableOnStartup"))
 {
 	MasterParams params;
@@ -71,3 +71,165 @@ TEST_CASE(SUITE("MultidropRoundRobinStartupSequence"))
 
 }
 
+TEST_CASE(SUITE("NextSessionStartsInTheSameCallAsTheFinalResponse"))
+{
+	MultidropTaskLock taskLock;
+
+	MasterParams params;
+	params.disableUnsolOnStartup = false;
+
+	MasterTestObject t1(params, taskLock);
+	MasterTestObject t2(params, taskLock);
+
+	t1.context.OnLowerLayerUp();
+	t2.context.OnLowerLayerUp();
+
+	t1.exe.RunMany();
+	t2.exe.RunMany();
+
+	REQUIRE(t1.lower.PopWriteAsHex() == hex::IntegrityPoll(0));
+	REQUIRE(t2.lower.PopWriteAsHex() == "");
+
+	t1.context.OnSendResult(true);
+	t1.SendToMaster(hex::EmptyResponse(0));
+
+	// no executor has run, the request was sent while processing t1's response
+	REQUIRE(t2.lower.PopWriteAsHex() == hex::IntegrityPoll(0));
+}
+
+TEST_CASE(SUITE("DisabledSessionHandsTheLockToWaitingSessions"))
+{
+	MultidropTaskLock taskLock;
+
+	MasterParams params;
+	params.disableUnsolOnStartup = false;
+
+	MasterTestObject t1(params, taskLock);
+	MasterTestObject t2(params, taskLock);
+
+	t1.context.OnLowerLayerUp();
+	t2.context.OnLowerLayerUp();
+
+	t1.exe.RunMany();
+	t2.exe.RunMany();
+
+	REQUIRE(t1.lower.PopWriteAsHex() == hex::IntegrityPoll(0));
+	REQUIRE(t2.lower.PopWriteAsHex() == "");
+
+	t1.context.OnLowerLayerDown();
+	t2.exe.RunMany();
+
+	REQUIRE(t2.lower.PopWriteAsHex() == hex::IntegrityPoll(0));
+}
+
+namespace
+{
+class MockScheduleCallback : public IScheduleCallback
+{
+public:
+
+	MockScheduleCallback() : numPending(0), numGranted(0)
+	{}
+
+	virtual void OnPendingTask() override
+	{
+		++numPending;
+	}
+
+	virtual void OnLockGranted() override
+	{
+		++numGranted;
+	}
+
+	uint32_t numPending;
+	uint32_t numGranted;
+};
+}
+
+TEST_CASE(SUITE("WaitingSessionsAreServedRoundRobin"))
+{
+	MultidropTaskLock lock;
+	MockScheduleCallback a, b, c;
+	const auto max = MonotonicTimestamp::Max();
+	const MonotonicTimestamp now(0);
+
+	lock.OnLayerUp(a, now);
+	lock.OnLayerUp(b, now);
+	lock.OnLayerUp(c, now);
+
+	REQUIRE(lock.Acquire(a, max, now));
+	REQUIRE_FALSE(lock.Acquire(c, max, now));
+	REQUIRE_FALSE(lock.Acquire(b, max, now));
+
+	lock.Release(a, now);
+	REQUIRE(b.numGranted == 1);
+	REQUIRE(lock.Acquire(b, max, now));
+
+	// a asks again before c has run, but c is next in the rotation
+	REQUIRE_FALSE(lock.Acquire(a, max, now));
+	lock.Release(b, now);
+	REQUIRE(c.numGranted == 1);
+	REQUIRE(a.numGranted == 0);
+
+	lock.Release(c, now);
+	REQUIRE(a.numGranted == 1);
+	REQUIRE(lock.Acquire(a, max, now));
+}
+
+TEST_CASE(SUITE("TasksWithStartDeadlinesAreServedFirst"))
+{
+	MultidropTaskLock lock;
+	MockScheduleCallback a, b, c;
+	const auto max = MonotonicTimestamp::Max();
+	const MonotonicTimestamp now(0);
+
+	lock.OnLayerUp(a, now);
+	lock.OnLayerUp(b, now);
+	lock.OnLayerUp(c, now);
+
+	REQUIRE(lock.Acquire(a, max, now));
+	REQUIRE_FALSE(lock.Acquire(b, max, now));
+	REQUIRE_FALSE(lock.Acquire(c, MonotonicTimestamp(5000), now));
+
+	lock.Release(a, now);
+	REQUIRE(c.numGranted == 1);
+	REQUIRE(b.numGranted == 0);
+
+	lock.Release(c, now);
+	REQUIRE(b.numGranted == 1);
+}
+
+TEST_CASE(SUITE("StatisticsMeasureUtilizationAndPollCycles"))
+{
+	MultidropTaskLock lock;
+	MockScheduleCallback a, b;
+	const auto max = MonotonicTimestamp::Max();
+
+	lock.OnLayerUp(a, MonotonicTimestamp(0));
+	lock.OnLayerUp(b, MonotonicTimestamp(0));
+
+	REQUIRE(lock.Acquire(a, max, MonotonicTimestamp(0)));
+	REQUIRE_FALSE(lock.Acquire(b, max, MonotonicTimestamp(100)));
+	lock.Release(a, MonotonicTimestamp(300));	// b waited 200 ms
+	lock.Release(b, MonotonicTimestamp(500));
+
+	// channel idle from 500 to 1000
+	REQUIRE(lock.Acquire(a, max, MonotonicTimestamp(1000)));
+	lock.Release(a, MonotonicTimestamp(1200));
+
+	auto stats = lock.GetStatistics(MonotonicTimestamp(2000));
+
+	REQUIRE(stats.numGrants == 3);
+	REQUIRE(stats.numContendedGrants == 1);
+	REQUIRE(stats.waitTimeMs == 200);
+	REQUIRE(stats.busyTimeMs == 700);
+	REQUIRE(stats.onlineTimeMs == 2000);
+	REQUIRE(stats.Utilization() == Approx(0.35));
+	REQUIRE(stats.numPollCycles == 1);
+	REQUIRE(stats.lastPollCycleMs == 1000);
+	REQUIRE(stats.maxPollCycleMs == 1000);
+
+	lock.OnLayerDown(a, MonotonicTimestamp(2500));
+	lock.OnLayerDown(b, MonotonicTimestamp(3000));
+	REQUIRE(lock.GetStatistics(MonotonicTimestamp(9000)).onlineTimeMs == 3000);
+}
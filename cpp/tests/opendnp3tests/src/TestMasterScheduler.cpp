@@ -0,0 +1,329 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include <opendnp3/master/MasterScheduler.h>
+#include <opendnp3/master/TaskComparison.h>
+#include <opendnp3/master/TaskPriority.h>
+
+#include <dnp3mocks/MockMasterApplication.h>
+
+#include <testlib/MockLogHandler.h>
+#include <testlib/StopWatch.h>
+
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace openpal;
+using namespace opendnp3;
+using namespace testlib;
+
+#define SUITE(name) "MasterSchedulerTestSuite - " name
+
+namespace
+{
+class TestTask final : public IMasterTask
+{
+public:
+
+	TestTask(IMasterApplication& app, Logger logger, int priority_, bool blocks_, MonotonicTimestamp expiration, bool recurring_ = true) :
+		IMasterTask(app, expiration, logger, TaskConfig::Default()),
+		priority(priority_),
+		blocks(blocks_),
+		recurring(recurring_)
+	{}
+
+	virtual char const* Name() const override
+	{
+		return "test task";
+	}
+
+	virtual int Priority() const override
+	{
+		return priority;
+	}
+
+	virtual bool BlocksLowerPriority() const override
+	{
+		return blocks;
+	}
+
+	virtual bool IsRecurring() const override
+	{
+		return recurring;
+	}
+
+	virtual bool BuildRequest(APDURequest& request, uint8_t seq) override
+	{
+		return true;
+	}
+
+private:
+
+	virtual ResponseResult ProcessResponse(const APDUResponseHeader& response, const openpal::RSlice& objects) override
+	{
+		return ResponseResult::OK_FINAL;
+	}
+
+	virtual TaskState OnTaskComplete(TaskCompletion completion, openpal::MonotonicTimestamp now) override
+	{
+		return TaskState::Disabled();
+	}
+
+	virtual bool IsEnabled() const override
+	{
+		return true;
+	}
+
+	virtual MasterTaskType GetTaskType() const override
+	{
+		return MasterTaskType::USER_TASK;
+	}
+
+	const int priority;
+	const bool blocks;
+	const bool recurring;
+};
+
+class MockTaskFilter final : public ITaskFilter
+{
+public:
+
+	MockTaskFilter() : timeout(MonotonicTimestamp::Max())
+	{}
+
+	virtual bool CanRun(const IMasterTask& task) override
+	{
+		return true;
+	}
+
+	virtual void SetTaskStartTimeout(const openpal::MonotonicTimestamp& time) override
+	{
+		timeout = time;
+	}
+
+	MonotonicTimestamp timeout;
+};
+
+class SchedulerTest
+{
+public:
+
+	SchedulerTest() : scheduler(filter)
+	{}
+
+	TestTask* Add(int priority, bool blocks, int64_t expiration)
+	{
+		tasks.push_back(std::unique_ptr<TestTask>(new TestTask(app, log.GetLogger(), priority, blocks, expiration)));
+		scheduler.Schedule(ManagedPtr<IMasterTask>::WrapperOnly(tasks.back().get()));
+		return tasks.back().get();
+	}
+
+	IMasterTask* GetNext(int64_t now, MonotonicTimestamp& next)
+	{
+		auto task = scheduler.GetNext(now, next);
+		return task.IsDefined() ? &*task : nullptr;
+	}
+
+	MockMasterApplication app;
+	MockLogHandler log;
+	MockTaskFilter filter;
+	MasterScheduler scheduler;
+	std::vector<std::unique_ptr<TestTask>> tasks;
+};
+
+// the linear scan the scheduler replaced
+IMasterTask* SelectByScan(std::vector<IMasterTask*>& tasks, const MonotonicTimestamp& now, ITaskFilter& filter, MonotonicTimestamp& next)
+{
+	if (tasks.empty())
+	{
+		next = MonotonicTimestamp::Max();
+		return nullptr;
+	}
+
+	auto best = tasks.begin();
+	for (auto current = best + 1; current != tasks.end(); ++current)
+	{
+		if (TaskComparison::SelectHigherPriority(now, **best, **current, filter) == TaskComparison::Result::Right)
+		{
+			best = current;
+		}
+	}
+
+	if ((*best)->ExpirationTime().milliseconds <= now.milliseconds)
+	{
+		auto task = *best;
+		tasks.erase(best);
+		return task;
+	}
+
+	next = (*best)->ExpirationTime();
+	return nullptr;
+}
+}
+
+TEST_CASE(SUITE("Expired tasks are selected by priority"))
+{
+	SchedulerTest t;
+	t.Add(priority::USER_POLL, false, 0);
+	auto command = t.Add(priority::COMMAND, false, 5);
+
+	MonotonicTimestamp next;
+	REQUIRE(t.GetNext(10, next) == command);
+}
+
+TEST_CASE(SUITE("Pending tasks are selected by expiration"))
+{
+	SchedulerTest t;
+	t.Add(priority::COMMAND, false, 50);
+	t.Add(priority::USER_POLL, false, 30);
+
+	MonotonicTimestamp next;
+	REQUIRE(t.GetNext(10, next) == nullptr);
+	REQUIRE(next.milliseconds == 30);
+}
+
+TEST_CASE(SUITE("Blocking task holds back lower priority tasks"))
+{
+	SchedulerTest t;
+	auto poll = t.Add(priority::USER_POLL, false, 0);
+	auto integrity = t.Add(priority::INTEGRITY_POLL, true, 20);
+
+	MonotonicTimestamp next;
+	REQUIRE(t.GetNext(0, next) == nullptr);
+	REQUIRE(next.milliseconds == 20);
+
+	REQUIRE(t.GetNext(20, next) == integrity);
+	REQUIRE(t.GetNext(20, next) == poll);
+	REQUIRE(t.scheduler.Size() == 0);
+}
+
+TEST_CASE(SUITE("Demand re-indexes a scheduled task"))
+{
+	SchedulerTest t;
+	auto later = t.Add(priority::USER_POLL, false, 100);
+	t.Add(priority::USER_POLL, false, 50);
+
+	MonotonicTimestamp next;
+	REQUIRE(t.GetNext(0, next) == nullptr);
+	REQUIRE(next.milliseconds == 50);
+
+	t.scheduler.Demand(*later);
+	REQUIRE(t.GetNext(0, next) == later);
+}
+
+TEST_CASE(SUITE("Start timeouts fail tasks that never started"))
+{
+	SchedulerTest t;
+	auto task = new TestTask(t.app, t.log.GetLogger(), priority::COMMAND, false, 1000, false);
+	task->ConfigureStartExpiration(100);
+	t.scheduler.Schedule(ManagedPtr<IMasterTask>::Deleted(task));
+
+	REQUIRE(t.filter.timeout.milliseconds == 100);
+
+	t.scheduler.CheckTaskStartTimeout(99);
+	REQUIRE(t.scheduler.Size() == 1);
+
+	t.scheduler.CheckTaskStartTimeout(100);
+	REQUIRE(t.scheduler.Size() == 0);
+	REQUIRE(t.app.taskCompletionEvents.size() == 1);
+	REQUIRE(t.app.taskCompletionEvents.front().result == TaskCompletion::FAILURE_START_TIMEOUT);
+}
+
+TEST_CASE(SUITE("Selection matches the pairwise comparison"))
+{
+	const int PRIORITIES[] = { priority::SESSION_KEY, priority::COMMAND, priority::USER_REQUEST, priority::USER_POLL };
+
+	SchedulerTest t;
+	std::vector<IMasterTask*> reference;
+	std::mt19937 gen(42);
+
+	for (int i = 0; i < 500; ++i)
+	{
+		auto task = t.Add(PRIORITIES[gen() % 4], false, gen() % 1000);
+		reference.push_back(task);
+	}
+
+	int64_t now = 0;
+	while (!reference.empty())
+	{
+		MonotonicTimestamp next;
+		MonotonicTimestamp expectedNext;
+		auto task = t.GetNext(now, next);
+		auto expected = SelectByScan(reference, now, t.filter, expectedNext);
+
+		REQUIRE(task == expected);
+
+		if (!task)
+		{
+			REQUIRE(next == expectedNext);
+			now = next.milliseconds;
+		}
+		else if (gen() % 4 == 0)
+		{
+			// occasionally let time pass so that several tasks expire together
+			now += 7;
+		}
+	}
+}
+
+TEST_CASE(SUITE("Drain rate versus queued tasks"), "[.][benchmark]")
+{
+	const int PRIORITIES[] = { priority::COMMAND, priority::USER_REQUEST, priority::USER_POLL };
+
+	for (int count : { 100, 1000, 5000 })
+	{
+		SchedulerTest t;
+		std::mt19937 gen(42);
+		for (int i = 0; i < count; ++i)
+		{
+			t.tasks.push_back(std::unique_ptr<TestTask>(new TestTask(t.app, t.log.GetLogger(), PRIORITIES[gen() % 3], false, gen() % 10000)));
+		}
+
+		const int ROUNDS = 10;
+		uint32_t decisions = 0;
+		StopWatch stopwatch;
+
+		for (int round = 0; round < ROUNDS; ++round)
+		{
+			for (auto& task : t.tasks)
+			{
+				t.scheduler.Schedule(ManagedPtr<IMasterTask>::WrapperOnly(task.get()));
+			}
+
+			int64_t now = 0;
+			while (t.scheduler.Size() > 0)
+			{
+				MonotonicTimestamp next;
+				if (!t.GetNext(now, next))
+				{
+					now = next.milliseconds;
+				}
+				++decisions;
+			}
+		}
+
+		auto us = std::chrono::duration_cast<std::chrono::microseconds>(stopwatch.Elapsed()).count();
+		std::cout << count << " queued tasks: " << (1000.0 * us / decisions) << " ns per scheduling decision" << std::endl;
+	}
+}
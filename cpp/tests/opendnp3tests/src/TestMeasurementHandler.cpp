@@ -21,13 +21,22 @@
 #include <catch.hpp>
 
 #include <opendnp3/master/MeasurementHandler.h>
+#include <opendnp3/master/MeasurementColumns.h>
+#include <opendnp3/app/parsing/Collections.h>
 
 #include <testlib/BufferHelpers.h>
 
 #include <testlib/MockLogHandler.h>
+#include <testlib/StopWatch.h>
 #include <dnp3mocks/MockSOEHandler.h>
 
 #include <functional>
+#include <vector>
+#include <algorithm>
+#include <sstream>
+#include <iomanip>
+#include <iostream>
+#include <chrono>
 
 using namespace openpal;
 using namespace opendnp3;
@@ -124,4 +133,189 @@ ParseResult TestObjectHeaders(const std::string& objects, ParseResult expectedRe
 	REQUIRE(result == expectedResult);
 	verify(soe);
 	return result;
-}
\ No newline at end of file
+}
+
+// loads analog and binary headers into columns, ignores everything else
+class ColumnarSOEHandler : public ISOEHandler
+{
+public:
+
+	ColumnarSOEHandler(uint32_t capacity, bool useColumns_ = true) :
+		useColumns(useColumns_),
+		indices(capacity),
+		analogs(capacity),
+		binaries(capacity),
+		flags(capacity),
+		times(capacity),
+		numLoaded(0)
+	{}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<Binary>>& values) override final
+	{
+		MeasurementColumns<Binary> columns(indices.data(), bools, flags.data(), times.data(), std::min<uint32_t>(static_cast<uint32_t>(indices.size()), 64));
+		numLoaded = columns.Load(values);
+		for (uint32_t i = 0; i < numLoaded; ++i)
+		{
+			binaries[i] = bools[i];
+		}
+	}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<Analog>>& values) override final
+	{
+		if (useColumns)
+		{
+			MeasurementColumns<Analog> columns(indices.data(), analogs.data(), flags.data(), times.data(), static_cast<uint32_t>(indices.size()));
+			numLoaded = columns.Load(values);
+		}
+		else
+		{
+			// the per value alternative
+			numLoaded = 0;
+			values.ForeachItem([this](const Indexed<Analog>& item)
+			{
+				if (numLoaded < indices.size())
+				{
+					indices[numLoaded] = item.index;
+					analogs[numLoaded] = item.value.value;
+					flags[numLoaded] = item.value.quality;
+					times[numLoaded] = item.value.time;
+					++numLoaded;
+				}
+			});
+		}
+	}
+
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<DoubleBitBinary>>& values) override final {}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<Counter>>& values) override final {}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<FrozenCounter>>& values) override final {}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<BinaryOutputStatus>>& values) override final {}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<AnalogOutputStatus>>& values) override final {}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<OctetString>>& values) override final {}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<TimeAndInterval>>& values) override final {}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<BinaryCommandEvent>>& values) override final {}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<AnalogCommandEvent>>& values) override final {}
+	virtual void Process(const HeaderInfo& info, const ICollection<Indexed<SecurityStat>>& values) override final {}
+
+	const bool useColumns;
+	std::vector<uint16_t> indices;
+	std::vector<double> analogs;
+	std::vector<bool> binaries;
+	std::vector<uint8_t> flags;
+	std::vector<uint64_t> times;
+	uint32_t numLoaded;
+
+protected:
+
+	void Start() override final {}
+	void End() override final {}
+
+private:
+
+	// std::vector<bool> isn't contiguous
+	bool bools[64];
+};
+
+// g30v1 with a 2 byte start/stop over [start, stop], value == index, flags == 0x01
+std::string AnalogRangeHeader(uint16_t start, uint16_t stop)
+{
+	std::ostringstream oss;
+	oss << std::hex << std::uppercase << std::setfill('0');
+	oss << "1E 01 01 " << std::setw(2) << (start & 0xFF) << " " << std::setw(2) << (start >> 8) << " "
+	    << std::setw(2) << (stop & 0xFF) << " " << std::setw(2) << (stop >> 8);
+
+	for (uint32_t i = start; i <= stop; ++i)
+	{
+		oss << " 01 " << std::setw(2) << (i & 0xFF) << " " << std::setw(2) << ((i >> 8) & 0xFF) << " 00 00";
+	}
+
+	return oss.str();
+}
+
+TEST_CASE(SUITE("loads a range of analogs into columns"))
+{
+	// spans several decode blocks
+	ColumnarSOEHandler soe(200);
+	testlib::MockLogHandler log;
+	auto logger = log.GetLogger();
+	HexSequence hex(AnalogRangeHeader(3, 102));
+
+	REQUIRE(MeasurementHandler::ProcessMeasurements(hex.ToRSlice(), logger, &soe) == ParseResult::OK);
+	REQUIRE(soe.numLoaded == 100);
+
+	for (uint32_t i = 0; i < 100; ++i)
+	{
+		REQUIRE(soe.indices[i] == (i + 3));
+		REQUIRE(soe.analogs[i] == (i + 3));
+		REQUIRE(soe.flags[i] == 0x01);
+	}
+}
+
+TEST_CASE(SUITE("columns are never loaded beyond their capacity"))
+{
+	ColumnarSOEHandler soe(40);
+	testlib::MockLogHandler log;
+	auto logger = log.GetLogger();
+	HexSequence hex(AnalogRangeHeader(0, 99));
+
+	REQUIRE(MeasurementHandler::ProcessMeasurements(hex.ToRSlice(), logger, &soe) == ParseResult::OK);
+	REQUIRE(soe.numLoaded == 40);
+	REQUIRE(soe.indices[39] == 39);
+}
+
+TEST_CASE(SUITE("columns include the CTO adjustment"))
+{
+	ColumnarSOEHandler soe(10);
+	testlib::MockLogHandler log;
+	auto logger = log.GetLogger();
+
+	// g51v1 - CTO == 3, g2v3 - index 7, t = 2, true/online - g2v3 - index 8, t = 5, false/online
+	HexSequence hex("33 01 07 01 03 00 00 00 00 00 02 03 17 02 07 81 02 00 08 01 05 00");
+
+	REQUIRE(MeasurementHandler::ProcessMeasurements(hex.ToRSlice(), logger, &soe) == ParseResult::OK);
+	REQUIRE(soe.numLoaded == 2);
+	REQUIRE(soe.indices[0] == 7);
+	REQUIRE(soe.binaries[0]);
+	REQUIRE(soe.times[0] == 5);
+	REQUIRE(soe.indices[1] == 8);
+	REQUIRE_FALSE(soe.binaries[1]);
+	REQUIRE(soe.times[1] == 8);
+}
+
+TEST_CASE(SUITE("columns load collections that are not decoded from a buffer"))
+{
+	const Indexed<Analog> items[3] = { WithIndex(Analog(4.0, 0x01), 2), WithIndex(Analog(5.0, 0x01), 4), WithIndex(Analog(6.0, 0x01), 6) };
+	ArrayCollection<Indexed<Analog>> collection(items, 3);
+
+	uint16_t indices[2];
+	double values[2];
+
+	MeasurementColumns<Analog> columns(indices, values, nullptr, nullptr, 2);
+	REQUIRE(columns.Load(collection) == 2);
+	REQUIRE(indices[0] == 2);
+	REQUIRE(values[0] == 4.0);
+	REQUIRE(indices[1] == 4);
+	REQUIRE(values[1] == 5.0);
+}
+
+TEST_CASE(SUITE("Analog integrity poll ingestion"), "[.][benchmark]")
+{
+	const uint32_t ITERATIONS = 2000;
+	const uint16_t NUM_POINTS = 2000;
+
+	HexSequence hex(AnalogRangeHeader(0, NUM_POINTS - 1));
+	testlib::MockLogHandler log;
+	auto logger = log.GetLogger();
+
+	for (bool useColumns : { false, true })
+	{
+		ColumnarSOEHandler soe(NUM_POINTS, useColumns);
+		StopWatch sw;
+		for (uint32_t i = 0; i < ITERATIONS; ++i)
+		{
+			MeasurementHandler::ProcessMeasurements(hex.ToRSlice(), logger, &soe);
+		}
+		auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(sw.Elapsed()).count();
+		REQUIRE(soe.numLoaded == NUM_POINTS);
+		std::cout << (useColumns ? "columns: " : "per value visitor: ") << (elapsed / ITERATIONS) << " us per response" << std::endl;
+	}
+}
@@ -315,6 +315,37 @@ TEST_CASE(SUITE("ReadClass0MultiFragAnalog"))
 	REQUIRE(t.lower.PopWriteAsHex() == "");
 }
 
+TEST_CASE(SUITE("ReadClass0MultiFragIsConsistentSnapshot"))
+{
+	OutstationConfig config;
+	config.params.maxTxFragSize = 20; // override to use a fragment length of 20
+	OutstationTestObject t(config, DatabaseTemplate::AnalogOnly(4));
+	t.LowerLayerUp();
+
+	t.SendToOutstation("C0 01 3C 01 06"); // Read class 0
+	REQUIRE(t.lower.PopWriteAsHex() == "A0 81 80 00 1E 01 00 00 01 02 00 00 00 00 02 00 00 00 00");
+
+	// values that change mid-response are reported as they were when the read was received
+	t.Transaction([](IDatabase & db)
+	{
+		for (uint16_t i = 0; i < 4; i++)
+		{
+			db.Update(Analog(9, 0x01), i);
+		}
+	});
+
+	t.OnSendResult(true);
+	t.SendToOutstation("C0 00");
+	REQUIRE(t.lower.PopWriteAsHex() == "41 81 80 00 1E 01 00 02 03 02 00 00 00 00 02 00 00 00 00");
+	t.OnSendResult(true);
+	t.SendToOutstation("C1 00");
+	REQUIRE(t.lower.PopWriteAsHex() == "");
+
+	// the next read reports the new values
+	t.SendToOutstation("C2 01 3C 01 06");
+	REQUIRE(t.lower.PopWriteAsHex() == "A2 81 80 00 1E 01 00 00 01 01 09 00 00 00 01 09 00 00 00");
+}
+
 TEST_CASE(SUITE("ReadFuncNotSupported"))
 {
 	OutstationConfig config;
@@ -23,6 +23,7 @@
 #include "mocks/OutstationTestObject.h"
 
 #include <dnp3mocks/APDUHexBuilders.h>
+#include <dnp3mocks/MockStackMetricsListener.h>
 
 #include <opendnp3/ErrorCodes.h>
 
@@ -62,6 +63,41 @@ TEST_CASE(SUITE("ReadDiscontiguousEvent"))
 	REQUIRE(t.lower.PopWriteAsHex() == "E0 81 80 00 02 01 28 01 00 00 00 81");
 }
 
+TEST_CASE(SUITE("MetricsTrackReadsAndEventBufferHighWater"))
+{
+	OutstationConfig config;
+	config.eventBufferConfig = EventBufferConfig::AllTypes(10);
+	OutstationTestObject t(config, DatabaseTemplate::BinaryOnly(2));
+	MockStackMetricsListener metrics;
+	t.context.SetMetricsListener(&metrics);
+	t.LowerLayerUp();
+
+	t.Transaction([](IDatabase & db)
+	{
+		db.Update(Binary(true, 0x01), 0);
+		db.Update(Binary(true, 0x01), 1);
+	});
+
+	REQUIRE(metrics.maxEventCount == 2);
+
+	t.SendToOutstation(hex::ClassPoll(0, PointClass::Class1));
+	REQUIRE(t.lower.PopWriteAsHex() == "E0 81 80 00 02 01 28 02 00 00 00 81 01 00 81");
+	REQUIRE(metrics.numReadBegin == 1);
+	REQUIRE(metrics.numReadEnd == 1);
+
+	t.OnSendResult(true);
+	t.SendToOutstation(hex::SolicitedConfirm(0));
+
+	t.Transaction([](IDatabase & db)
+	{
+		db.Update(Binary(false, 0x01), 0);
+	});
+
+	// the confirm cleared the buffer
+	REQUIRE(metrics.lastEventCount == 1);
+	REQUIRE(metrics.maxEventCount == 2);
+}
+
 TEST_CASE(SUITE("ReceiveNewRequestSolConfirmWait"))
 {
 	OutstationConfig config;
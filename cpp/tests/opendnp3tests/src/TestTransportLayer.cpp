@@ -27,6 +27,21 @@
 
 #include <opendnp3/app/AppConstants.h>
 #include <opendnp3/transport/TransportConstants.h>
+#include <opendnp3/transport/TransportRx.h>
+#include <opendnp3/transport/TransportTx.h>
+#include <opendnp3/link/LinkFrame.h>
+#include <opendnp3/link/LinkLayerConstants.h>
+
+#include <openpal/container/Buffer.h>
+
+#include <testlib/BufferHelpers.h>
+#include <testlib/StopWatch.h>
+
+#include <iostream>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <vector>
 
 using namespace std;
 using namespace openpal;
@@ -44,14 +59,41 @@ TEST_CASE(SUITE("RepeatSendsDoNotLogOrChangeStatistics"))
 	transmitter.Configure(hs.ToRSlice());
 
 	auto segment1 = transmitter.GetSegment();
-	REQUIRE("C0 12 34 56" == ToHex(segment1));
+	REQUIRE("C0 12 34 56" == SegmentToHex(segment1));
 	REQUIRE(1 == stats.numTransportTx);
 
 	auto segment2 = transmitter.GetSegment();
-	REQUIRE("C0 12 34 56" == ToHex(segment2));
+	REQUIRE("C0 12 34 56" == SegmentToHex(segment2));
 	REQUIRE(1 == stats.numTransportTx);
 }
 
+TEST_CASE(SUITE("SegmentsAreViewsIntoTheApdu"))
+{
+	MockLogHandler log;
+	TransportTx transmitter(log.GetLogger(), nullptr);
+	Buffer apdu(2 * MAX_TPDU_PAYLOAD + 10);
+	transmitter.Configure(apdu.ToRSlice());
+
+	auto first = transmitter.GetSegment();
+	REQUIRE(first.header == TL_HDR_FIR);
+	REQUIRE(first.payload.Size() == MAX_TPDU_PAYLOAD);
+	REQUIRE(static_cast<const uint8_t*>(first.payload) == apdu());
+
+	REQUIRE(transmitter.Advance());
+	auto second = transmitter.GetSegment();
+	REQUIRE(second.header == 1);
+	REQUIRE(second.payload.Size() == MAX_TPDU_PAYLOAD);
+	REQUIRE(static_cast<const uint8_t*>(second.payload) == apdu() + MAX_TPDU_PAYLOAD);
+
+	REQUIRE(transmitter.Advance());
+	auto last = transmitter.GetSegment();
+	REQUIRE(last.header == (TL_HDR_FIN | 2));
+	REQUIRE(last.payload.Size() == 10);
+	REQUIRE(static_cast<const uint8_t*>(last.payload) == apdu() + 2 * MAX_TPDU_PAYLOAD);
+
+	REQUIRE_FALSE(transmitter.Advance());
+}
+
 // make sure an invalid state exception gets thrown
 // for every event other than LowerLayerUp() since
 // the layer starts in the online state
@@ -197,6 +239,40 @@ TEST_CASE(SUITE("ReceiveNewFir"))
 	REQUIRE(test.log.NextErrorCode() == TLERR_NEW_FIR_MID_SEQUENCE); //make sure it logs the dropped frames
 }
 
+TEST_CASE(SUITE("SingleSegmentFragmentIsPassedUpWithoutACopy"))
+{
+	MockLogHandler log;
+	StackStatistics stats;
+	TransportRx receiver(log.GetLogger(), DEFAULT_MAX_APDU_SIZE, &stats);
+
+	HexSequence tpdu("C0 AB CD EF");
+	auto apdu = receiver.ProcessReceive(tpdu.ToRSlice());
+
+	REQUIRE(ToHex(apdu) == "AB CD EF");
+	REQUIRE(static_cast<const uint8_t*>(apdu) == static_cast<const uint8_t*>(tpdu.ToRSlice()) + 1);
+	REQUIRE(stats.numTransportRx == 1);
+
+	// the sequence still advances, so a following multi-segment fragment is accepted
+	REQUIRE(receiver.ProcessReceive(HexSequence("41 01 02").ToRSlice()).IsEmpty());
+	REQUIRE(ToHex(receiver.ProcessReceive(HexSequence("82 03").ToRSlice())) == "01 02 03");
+	REQUIRE(log.IsLogErrorFree());
+}
+
+TEST_CASE(SUITE("MultiSegmentFragmentIsReassembledIntoTheReceiveBuffer"))
+{
+	MockLogHandler log;
+	TransportRx receiver(log.GetLogger(), DEFAULT_MAX_APDU_SIZE, nullptr);
+
+	HexSequence first("40 01 02");
+	HexSequence last("81 03 04");
+
+	REQUIRE(receiver.ProcessReceive(first.ToRSlice()).IsEmpty());
+	auto apdu = receiver.ProcessReceive(last.ToRSlice());
+
+	REQUIRE(ToHex(apdu) == "01 02 03 04");
+	REQUIRE(static_cast<const uint8_t*>(apdu) != static_cast<const uint8_t*>(last.ToRSlice()) + 1);
+}
+
 TEST_CASE(SUITE("SendArguments"))
 {
 	TransportTestObject test(true);
@@ -300,7 +376,131 @@ TEST_CASE(SUITE("SendFullAPDU"))
 	test.transport.OnSendResult(true);
 }
 
+TEST_CASE(SUITE("Copies per received fragment"), "[.][benchmark]")
+{
+	const uint32_t ITERATIONS = 200000;
 
+	// a confirm, a small event response, a full single segment, and a fragment of every size that needs reassembly
+	for (uint32_t size : { 2u, 40u, static_cast<uint32_t>(MAX_TPDU_PAYLOAD), 2048u, 4096u })
+	{
+		const uint32_t numSegments = CalcMaxPackets(size, MAX_TPDU_PAYLOAD);
+		const uint32_t lastSize = CalcLastPacketSize(size, MAX_TPDU_PAYLOAD);
+
+		// each segment is a separate buffer, like consecutive frames from the link layer
+		std::vector<std::unique_ptr<Buffer>> segments;
+		for (uint32_t i = 0; i < numSegments; ++i)
+		{
+			const bool fir = (i == 0);
+			const bool fin = (i == numSegments - 1);
+			const uint32_t payloadSize = fin ? lastSize : MAX_TPDU_PAYLOAD;
+
+			std::unique_ptr<Buffer> segment(new Buffer(payloadSize + 1));
+			(*segment)()[0] = (fir ? TL_HDR_FIR : 0) | (fin ? TL_HDR_FIN : 0) | (i % 64);
+			segments.push_back(std::move(segment));
+		}
+
+		MockLogHandler log(levels::NOTHING);
+		TransportRx receiver(log.GetLogger(), 4096, nullptr);
+
+		uint32_t numFragments = 0;
+		uint64_t numCopies = 0;
+		uint64_t numBytesCopied = 0;
+
+		StopWatch sw;
+
+		for (uint32_t i = 0; i < ITERATIONS; ++i)
+		{
+			for (auto& segment : segments)
+			{
+				auto apdu = receiver.ProcessReceive(segment->ToRSlice());
+				if (apdu.Size() == size)
+				{
+					++numFragments;
+					if (static_cast<const uint8_t*>(apdu) != (*segment)() + 1)
+					{
+						// reassembled, so every segment was copied into the receive buffer
+						numCopies += numSegments;
+						numBytesCopied += size;
+					}
+				}
+			}
+		}
+
+		auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(sw.Elapsed()).count();
+		REQUIRE(numFragments == ITERATIONS);
+
+		std::cout << size << " byte fragments: "
+		          << (static_cast<uint64_t>(ITERATIONS) * 1000000 / (elapsed ? elapsed : 1)) << " fragments/sec, "
+		          << (static_cast<double>(numCopies) / ITERATIONS) << " copies and "
+		          << (numBytesCopied / ITERATIONS) << " bytes copied per fragment" << std::endl;
+	}
+}
 
+TEST_CASE(SUITE("Framing throughput for large fragments"), "[.][benchmark]")
+{
+	const uint32_t ITERATIONS = 100000;
 
-
+	for (uint32_t size : { 2048u, 4096u })
+	{
+		Buffer apdu(size);
+		for (uint32_t i = 0; i < size; ++i)
+		{
+			apdu()[i] = static_cast<uint8_t>(i);
+		}
+
+		MockLogHandler log(levels::NOTHING);
+		TransportTx transmitter(log.GetLogger(), nullptr);
+
+		// room for every frame of the fragment back-to-back
+		Buffer frames(CalcMaxPackets(size, MAX_TPDU_PAYLOAD) * LPDU_MAX_FRAME_SIZE);
+		uint8_t tpdu[MAX_TPDU_LENGTH];
+
+		// the previous approach stages each segment in a tpdu buffer and copies it again into the frame
+		auto staged = [&]()
+		{
+			auto dest = frames.GetWSlice();
+			transmitter.Configure(apdu.ToRSlice());
+			do
+			{
+				auto segment = transmitter.GetSegment();
+				tpdu[0] = segment.header;
+				auto payload = WSlice(tpdu + 1, MAX_TPDU_PAYLOAD);
+				segment.payload.CopyTo(payload);
+				LinkFrame::FormatUnconfirmedUserData(dest, true, 1, 1024, tpdu, static_cast<uint8_t>(segment.Size()), nullptr);
+			}
+			while (transmitter.Advance());
+			return frames.Size() - dest.Size();
+		};
+
+		// frames are written directly from the APDU
+		auto direct = [&]()
+		{
+			auto dest = frames.GetWSlice();
+			transmitter.Configure(apdu.ToRSlice());
+			do
+			{
+				LinkFrame::FormatUnconfirmedUserData(dest, true, 1, 1024, transmitter.GetSegment(), nullptr);
+			}
+			while (transmitter.Advance());
+			return frames.Size() - dest.Size();
+		};
+
+		for (auto& test : { std::make_pair("staged", std::function<uint32_t ()>(staged)), std::make_pair("direct", std::function<uint32_t ()>(direct)) })
+		{
+			uint64_t numFrameBytes = 0;
+
+			StopWatch sw;
+
+			for (uint32_t i = 0; i < ITERATIONS; ++i)
+			{
+				numFrameBytes += test.second();
+			}
+
+			auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(sw.Elapsed()).count();
+			REQUIRE(numFrameBytes > static_cast<uint64_t>(size) * ITERATIONS);
+
+			std::cout << size << " byte fragments (" << test.first << "): "
+			          << (static_cast<uint64_t>(size) * ITERATIONS * 1000000 / (elapsed ? elapsed : 1)) << " APDU bytes/sec" << std::endl;
+		}
+	}
+}
@@ -55,11 +55,11 @@ bool BufferSegment::HasValue() const
 	return remainder.Size() > 0;
 }
 
-openpal::RSlice BufferSegment::GetSegment()
+TransportSegment BufferSegment::GetSegment()
 {
 	auto size = std::min(segmentSize, remainder.Size());
 	auto chunk = remainder.Take(size);
-	return chunk;
+	return TransportSegment(chunk[0], chunk.Skip(1));
 }
 
 bool BufferSegment::Advance()
@@ -69,6 +69,12 @@ bool BufferSegment::Advance()
 	return remainder.IsNotEmpty();
 }
 
+std::string SegmentToHex(const TransportSegment& segment)
+{
+	auto hex = ByteToHex(segment.header);
+	return segment.payload.IsEmpty() ? hex : (hex + " " + ToHex(segment.payload));
+}
+
 }
 
 
@@ -37,7 +37,7 @@ public:
 
 	virtual bool HasValue() const override final;
 
-	virtual openpal::RSlice GetSegment() override final;
+	virtual TransportSegment GetSegment() override final;
 
 	virtual bool Advance() override final;
 
@@ -49,6 +49,9 @@ private:
 	openpal::RSlice remainder;
 };
 
+// Formats the header byte and payload of a segment as contiguous hex
+std::string SegmentToHex(const TransportSegment& segment);
+
 
 }
 
@@ -38,10 +38,10 @@ namespace opendnp3
 class LinkParserTest
 {
 public:
-	LinkParserTest(bool aImmediate = false) :
+	LinkParserTest(uint32_t rxBufferSize = LPDU_MAX_FRAME_SIZE) :
 		log(),
 		sink(),
-		parser(log.GetLogger())
+		parser(log.GetLogger(), nullptr, rxBufferSize)
 	{}
 
 	void WriteData(const openpal::RSlice& input)
@@ -29,6 +29,8 @@
 #include <testlib/BufferHelpers.h>
 #include <testlib/HexConversions.h>
 
+#include "BufferSegment.h"
+
 namespace opendnp3
 {
 
@@ -41,7 +43,7 @@ public:
 	{
 		while (segments.HasValue())
 		{
-			sends.push_back(testlib::ToHex(segments.GetSegment()));
+			sends.push_back(SegmentToHex(segments.GetSegment()));
 			segments.Advance();
 		}
 	}
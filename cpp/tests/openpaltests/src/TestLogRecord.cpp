@@ -0,0 +1,109 @@
+/*
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) under one or
+ * more contributor license agreements. See the NOTICE file distributed
+ * with this work for additional information regarding copyright ownership.
+ * Green Energy Corp licenses this file to you under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except in
+ * compliance with the License.  You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This project was forked on 01/01/2013 by Automatak, LLC and modifications
+ * may have been made to this file. Automatak, LLC licenses these modifications
+ * to you under the terms of the License.
+ */
+#include <catch.hpp>
+
+#include <openpal/logging/LogRecord.h>
+#include <openpal/container/RSlice.h>
+
+#include <cstring>
+#include <string>
+
+using namespace openpal;
+
+using namespace std;
+
+#define SUITE(name) "LogRecord - " name
+
+namespace
+{
+std::string Format(const LogRecord& record)
+{
+	char buffer[MAX_LOG_ENTRY_SIZE];
+	record.Format(buffer, MAX_LOG_ENTRY_SIZE);
+	return std::string(buffer);
+}
+}
+
+TEST_CASE(SUITE("Records format the same as snprintf"))
+{
+	LogRecord record(LogFilters(1), "here", 7);
+	int32_t value = -3;
+	uint16_t port = 20000;
+	record.Capture("%s %i %u 0x%02x %c %.2f", "channel", value, port, 0xab, 'x', 1.5);
+
+	REQUIRE(Format(record) == "channel -3 20000 0xab x 1.50");
+	REQUIRE(record.GetFilters().GetBitfield() == 1);
+	REQUIRE(std::string(record.GetLocation()) == "here");
+	REQUIRE(record.GetErrorCode() == 7);
+}
+
+TEST_CASE(SUITE("Strings are copied when captured"))
+{
+	char buffer[16];
+	strcpy(buffer, "before");
+
+	LogRecord record;
+	record.Capture("value: %s", buffer);
+	strcpy(buffer, "after");
+
+	REQUIRE(Format(record) == "value: before");
+}
+
+TEST_CASE(SUITE("Long strings are truncated to the size of an entry"))
+{
+	std::string first(200, 'a');
+	std::string second(200, 'b');
+
+	LogRecord record;
+	record.Capture("%s%s%u", first.c_str(), second.c_str(), 42u);
+
+	auto text = Format(record);
+	REQUIRE(text.size() == (MAX_LOG_ENTRY_SIZE - 1));
+	REQUIRE(text == first.substr(0, MAX_LOG_ENTRY_SIZE - 1));
+}
+
+TEST_CASE(SUITE("Format strings without arguments are still formatted"))
+{
+	LogRecord record;
+	record.Capture("100%% done");
+	REQUIRE(Format(record) == "100% done");
+}
+
+TEST_CASE(SUITE("Hex rows are formatted when the record is formatted"))
+{
+	uint8_t bytes[] = { 0x05, 0x64, 0xFF };
+
+	LogRecord record;
+	record.CaptureHex(RSlice(bytes, 3));
+	bytes[0] = 0x00;
+
+	REQUIRE(Format(record) == "05 64 FF ");
+}
+
+TEST_CASE(SUITE("Formatting truncates to the destination size"))
+{
+	LogRecord record;
+	record.Capture("%s", "abcdef");
+
+	char small[4];
+	record.Format(small, 4);
+	REQUIRE(std::string(small) == "abc");
+}
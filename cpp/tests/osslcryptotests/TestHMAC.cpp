@@ -47,9 +47,11 @@
 
 #include <testlib/HexConversions.h>
 #include <testlib/BufferHelpers.h>
+#include <testlib/StopWatch.h>
 
 #include <thread>
 #include <atomic>
+#include <iostream>
 
 #define SUITE(name) "HMACTestSuite - " name
 
@@ -69,6 +71,30 @@ void TestHMACSuccess(IHMACAlgo& algo, const openpal::RSlice& key, const openpal:
 	REQUIRE(resultStr == expected);
 }
 
+void TestKeyedMatchesUnkeyed(IHMACAlgo& algo, const openpal::RSlice& key, const openpal::RSlice& data1, const openpal::RSlice& data2)
+{
+	error_code ec;
+	auto keyed = algo.CreateKeyed(key, ec);
+	REQUIRE_FALSE(ec);
+	REQUIRE(keyed);
+	REQUIRE(keyed->OutputSize() == algo.OutputSize());
+
+	Buffer expected(algo.OutputSize());
+	Buffer actual(algo.OutputSize());
+
+	// the keyed context must be reset between calculations
+	for (auto& data : { data1, data2, data1 })
+	{
+		auto expectedDest = expected.GetWSlice();
+		auto actualDest = actual.GetWSlice();
+		auto expectedResult = algo.Calculate(key, { data }, expectedDest, ec);
+		REQUIRE_FALSE(ec);
+		auto actualResult = keyed->Calculate({ data }, actualDest, ec);
+		REQUIRE_FALSE(ec);
+		REQUIRE(ToHex(actualResult) == ToHex(expectedResult));
+	}
+}
+
 void TestInsufficientOutputSizeFails(IHMACAlgo& algo)
 {
 	Buffer buffer(algo.OutputSize() - 1);
@@ -125,3 +151,72 @@ TEST_CASE(SUITE("InsufficientWriteBuffer"))
 	TestInsufficientOutputSizeFails(crypto.GetSHA1HMAC());
 	TestInsufficientOutputSizeFails(crypto.GetSHA256HMAC());
 }
+
+TEST_CASE(SUITE("KeyedHMACMatchesUnkeyed"))
+{
+	std::string key = "keykeykeykeykeykeykeykeykeykey";
+	std::string data1 = "The quick brown fox jumps over the lazy dog";
+	std::string data2 = "The lazy dog";
+
+	auto keyView = RSlice(reinterpret_cast<const uint8_t*>(key.c_str()), key.size());
+	auto dataView1 = RSlice(reinterpret_cast<const uint8_t*>(data1.c_str()), data1.size());
+	auto dataView2 = RSlice(reinterpret_cast<const uint8_t*>(data2.c_str()), data2.size());
+
+	CryptoProvider crypto;
+
+	TestKeyedMatchesUnkeyed(crypto.GetSHA1HMAC(), keyView, dataView1, dataView2);
+	TestKeyedMatchesUnkeyed(crypto.GetSHA256HMAC(), keyView, dataView1, dataView2);
+}
+
+TEST_CASE(SUITE("KeyedInsufficientWriteBuffer"))
+{
+	CryptoProvider crypto;
+	Buffer key(16);
+	error_code ec;
+	auto keyed = crypto.GetSHA256HMAC().CreateKeyed(key.ToRSlice(), ec);
+	REQUIRE(keyed);
+
+	Buffer buffer(keyed->OutputSize() - 1);
+	auto dest = buffer.GetWSlice();
+	auto output = keyed->Calculate({ RSlice() }, dest, ec);
+	REQUIRE(ec == make_error_code(errors::HMAC_INSUFFICIENT_OUTPUT_BUFFER_SIZE));
+	REQUIRE(output.IsEmpty());
+}
+
+TEST_CASE(SUITE("HMAC throughput"), "[.][benchmark]")
+{
+	// a 16 byte session key and a challenge + critical ASDU sized message
+	const uint32_t ITERATIONS = 200000;
+	Buffer key(16);
+	Buffer challenge(30);
+	Buffer asdu(60);
+	key.GetWSlice().SetAllTo(0xAB);
+	challenge.GetWSlice().SetAllTo(0x01);
+	asdu.GetWSlice().SetAllTo(0x02);
+
+	CryptoProvider crypto;
+	auto& algo = crypto.GetSHA256HMAC();
+	Buffer output(algo.OutputSize());
+	error_code ec;
+
+	StopWatch sw;
+	for (uint32_t i = 0; i < ITERATIONS; ++i)
+	{
+		auto dest = output.GetWSlice();
+		algo.Calculate(key.ToRSlice(), { challenge.ToRSlice(), asdu.ToRSlice() }, dest, ec);
+	}
+	auto unkeyedUs = std::chrono::duration_cast<std::chrono::microseconds>(sw.Elapsed()).count();
+
+	auto keyed = algo.CreateKeyed(key.ToRSlice(), ec);
+	for (uint32_t i = 0; i < ITERATIONS; ++i)
+	{
+		auto dest = output.GetWSlice();
+		keyed->Calculate({ challenge.ToRSlice(), asdu.ToRSlice() }, dest, ec);
+	}
+	auto keyedUs = std::chrono::duration_cast<std::chrono::microseconds>(sw.Elapsed()).count();
+
+	REQUIRE_FALSE(ec);
+
+	std::cout << "SHA256 HMAC per message key setup: " << (1000.0 * ITERATIONS) / unkeyedUs << " k/s" << std::endl;
+	std::cout << "SHA256 HMAC with a keyed context: " << (1000.0 * ITERATIONS) / keyedUs << " k/s" << std::endl;
+}
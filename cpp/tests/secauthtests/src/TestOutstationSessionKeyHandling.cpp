@@ -227,6 +227,49 @@ TEST_CASE(SUITE("Critical requests can be challenged and processed"))
 	REQUIRE(fixture.lower.HasNoData());
 }
 
+TEST_CASE(SUITE("Challenge replies are verified with the cached control key context if enabled"))
+{
+	OutstationAuthSettings settings;
+	settings.cacheKeyedHMACs = true;
+	OutstationSecAuthFixture fixture(settings);
+	fixture.AddUser(User::Default(), "bob", 0xFF, KeyWrapAlgorithm::AES_256);
+	fixture.LowerLayerUp();
+
+	AppSeqNum seq;
+
+	fixture.TestSessionKeyChange(seq, User::Default(), KeyWrapAlgorithm::AES_256, HMACMode::SHA256_TRUNC_16);
+
+	// the session key change response is HMAC'd with the raw monitor key
+	REQUIRE(fixture.crypto.sha256.numKeyedCalculations == 0);
+
+	auto poll = hex::ClassTask(FunctionCode::READ, seq, ClassField::AllEventClasses());
+	fixture.SendAndReceive(poll);
+
+	auto challengeReply = hex::ChallengeReply(seq, 1, User::DEFAULT_ID, hex::repeat(0xFF, 16));
+	auto response = hex::EmptyResponse(seq, IINBit::DEVICE_RESTART);
+	REQUIRE(fixture.SendAndReceive(challengeReply) == response);
+	REQUIRE(fixture.crypto.sha256.numKeyedCalculations == 1);
+}
+
+TEST_CASE(SUITE("Challenge replies are verified with the raw control key by default"))
+{
+	OutstationSecAuthFixture fixture;
+	fixture.AddUser(User::Default(), "bob", 0xFF, KeyWrapAlgorithm::AES_256);
+	fixture.LowerLayerUp();
+
+	AppSeqNum seq;
+
+	fixture.TestSessionKeyChange(seq, User::Default(), KeyWrapAlgorithm::AES_256, HMACMode::SHA256_TRUNC_16);
+
+	auto poll = hex::ClassTask(FunctionCode::READ, seq, ClassField::AllEventClasses());
+	fixture.SendAndReceive(poll);
+
+	auto challengeReply = hex::ChallengeReply(seq, 1, User::DEFAULT_ID, hex::repeat(0xFF, 16));
+	auto response = hex::EmptyResponse(seq, IINBit::DEVICE_RESTART);
+	REQUIRE(fixture.SendAndReceive(challengeReply) == response);
+	REQUIRE(fixture.crypto.sha256.numKeyedCalculations == 0);
+}
+
 TEST_CASE(SUITE("Outstation enforces permissions for critical functions"))
 {
 	OutstationSecAuthFixture fixture;
@@ -2,7 +2,7 @@ package com.automatak.render.dnp3.objects.generators
 
 import com.automatak.render._
 import com.automatak.render.cpp._
-import com.automatak.render.dnp3.objects.FixedSize
+import com.automatak.render.dnp3.objects._
 
 object ConversionHeaders {
 
@@ -16,6 +16,7 @@ object ConversionHeaders {
   val factory = quoted("opendnp3/app/MeasurementFactory.h")
   val serializer = quoted("opendnp3/app/DNP3Serializer.h")
   val conversions = quoted("opendnp3/app/WriteConversions.h")
+  val serialization = bracketed("openpal/serialization/Serialization.h")
 
   val cppIncludes = List(factory, conversions)
 }
@@ -81,6 +82,58 @@ trait Conversion extends FixedSize {
 }
 
 
+/**
+ * Conversions used to write static data also get a bulk writer for contiguous runs of values.
+ * The space is checked once per run and each field is written at a fixed offset.
+ */
+trait BulkConversion extends Conversion {
+
+  override def headerLines(implicit i : Indentation) : Iterator[String] = super.headerLines ++ Iterator(bulkSignature)
+  override def implLines(implicit i : Indentation): Iterator[String] = super.implLines ++ space ++ bulkImplLines
+  override def implIncludes : List[String] = super.implIncludes ++ List(serialization)
+
+  private def bulkSignature : String = {
+    "static bool WriteTargets(const %s* values, uint32_t count, openpal::WSlice&);".format(target)
+  }
+
+  private def fieldSerializer(f: FixedSizeField) : String = f.typ match {
+    case UInt8Field => "UInt8"
+    case UInt16Field => "UInt16"
+    case UInt32Field => "UInt32"
+    case UInt48Field => "UInt48"
+    case SInt16Field => "Int16"
+    case SInt32Field => "Int32"
+    case Float32Field => "SingleFloat"
+    case Float64Field => "DoubleFloat"
+    case _ => throw new Exception("No bulk serializer for field: " + f.name)
+  }
+
+  private def bulkImplLines(implicit indent: Indentation): Iterator[String] = {
+
+    val offsets = fields.scanLeft(0)((sum, f) => sum + f.typ.numBytes)
+
+    def writes : Iterator[String] = fields.zip(offsets).iterator.map { case (f, offset) =>
+      if(offset == 0) "%s::Write(dest, gv.%s);".format(fieldSerializer(f), f.name)
+      else "%s::Write(dest + %d, gv.%s);".format(fieldSerializer(f), offset, f.name)
+    }
+
+    Iterator("bool %s::WriteTargets(const %s* values, uint32_t count, openpal::WSlice& buff)".format(name, target)) ++ bracket {
+      Iterator("if(buff.Size() < (count * Size()))") ++ bracket {
+        Iterator("return false;")
+      } ++ space ++
+      Iterator("uint8_t* dest = buff;") ++
+      Iterator("for(uint32_t i = 0; i < count; ++i)") ++ bracket {
+        Iterator("auto gv = Convert%s::Apply(values[i]);".format(name)) ++
+        writes ++
+        Iterator("dest += %d;".format(size))
+      } ++ space ++
+      Iterator("buff.Advance(count * Size());") ++
+      Iterator("return true;")
+    }
+  }
+
+}
+
 
 trait ConversionToBinary extends Conversion {
   def target = "Binary"
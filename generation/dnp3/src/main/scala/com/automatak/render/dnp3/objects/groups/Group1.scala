@@ -2,7 +2,7 @@ package com.automatak.render.dnp3.objects.groups
 
 import com.automatak.render.dnp3.objects._
 import com.automatak.render.dnp3.objects.VariationNames._
-import com.automatak.render.dnp3.objects.generators.ConversionToBinary
+import com.automatak.render.dnp3.objects.generators.{ConversionToBinary, BulkConversion}
 
 object Group1 extends ObjectGroup {
   def objects = List(Group1Var0, Group1Var1, Group1Var2)
@@ -14,5 +14,5 @@ object Group1Var0 extends AnyVariation(Group1, 0)
 
 object Group1Var1 extends SingleBitfield(Group1, 1, packedFormat)
 
-object Group1Var2 extends FixedSize(Group1, 2, withFlags)(FixedSizeField.flags) with ConversionToBinary
+object Group1Var2 extends FixedSize(Group1, 2, withFlags)(FixedSizeField.flags) with ConversionToBinary with BulkConversion
 
@@ -4,7 +4,7 @@ import com.automatak.render.dnp3.objects._
 
 import FixedSizeField._
 import com.automatak.render.dnp3.objects.VariationNames._
-import com.automatak.render.dnp3.objects.generators.ConversionToDoubleBitBinary
+import com.automatak.render.dnp3.objects.generators.{ConversionToDoubleBitBinary, BulkConversion}
 
 object Group3 extends ObjectGroup {
   def objects = List(Group3Var0, Group3Var1, Group3Var2)
@@ -14,4 +14,4 @@ object Group3 extends ObjectGroup {
 
 object Group3Var0 extends AnyVariation(Group3, 0)
 object Group3Var1 extends DoubleBitfield(Group3, 1, packedFormat)
-object Group3Var2 extends FixedSize(Group3, 2, withFlags)(flags) with ConversionToDoubleBitBinary
+object Group3Var2 extends FixedSize(Group3, 2, withFlags)(flags) with ConversionToDoubleBitBinary with BulkConversion
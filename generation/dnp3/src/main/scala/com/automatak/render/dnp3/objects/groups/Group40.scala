@@ -4,7 +4,7 @@ import com.automatak.render.dnp3.objects._
 
 import FixedSizeField._
 import com.automatak.render.dnp3.objects.VariationNames._
-import com.automatak.render.dnp3.objects.generators.ConversionToAnalogOutputStatus
+import com.automatak.render.dnp3.objects.generators.{ConversionToAnalogOutputStatus, BulkConversion}
 
 // Analog output status
 object Group40 extends ObjectGroup {
@@ -14,7 +14,7 @@ object Group40 extends ObjectGroup {
 }
 
 object Group40Var0 extends AnyVariation(Group40, 0)
-object Group40Var1 extends FixedSize(Group40, 1, bit32WithFlag)(flags, value32) with ConversionToAnalogOutputStatus
-object Group40Var2 extends FixedSize(Group40, 2, bit16WithFlag)(flags, value16) with ConversionToAnalogOutputStatus
-object Group40Var3 extends FixedSize(Group40, 3, singlePrecisionWithFlag)(flags, float32) with ConversionToAnalogOutputStatus
-object Group40Var4 extends FixedSize(Group40, 4, doublePrecisionWithFlag)(flags, float64) with ConversionToAnalogOutputStatus
+object Group40Var1 extends FixedSize(Group40, 1, bit32WithFlag)(flags, value32) with ConversionToAnalogOutputStatus with BulkConversion
+object Group40Var2 extends FixedSize(Group40, 2, bit16WithFlag)(flags, value16) with ConversionToAnalogOutputStatus with BulkConversion
+object Group40Var3 extends FixedSize(Group40, 3, singlePrecisionWithFlag)(flags, float32) with ConversionToAnalogOutputStatus with BulkConversion
+object Group40Var4 extends FixedSize(Group40, 4, doublePrecisionWithFlag)(flags, float64) with ConversionToAnalogOutputStatus with BulkConversion
@@ -3,7 +3,7 @@ package com.automatak.render.dnp3.objects.groups
 import com.automatak.render.dnp3.objects._
 
 import FixedSizeField._
-import com.automatak.render.dnp3.objects.generators.ConversionToTimeAndInterval
+import com.automatak.render.dnp3.objects.generators.{ConversionToTimeAndInterval, BulkConversion}
 
 // absolute time
 object Group50 extends ObjectGroup {
@@ -18,5 +18,5 @@ object Group50Var4 extends FixedSize(Group50, 4, "Indexed absolute time and long
   time48,
   FixedSizeField("interval", UInt32Field),
   FixedSizeField("units", UInt8Field)
-) with ConversionToTimeAndInterval
+) with ConversionToTimeAndInterval with BulkConversion
 